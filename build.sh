@@ -40,7 +40,6 @@ fi
 current_work_dir=$PWD
 
 export LD_LIBRARY_PATH=$LD_LIBRARY_PATH:$current_work_dir/build/lib/src
-export PROFILER_PATH=/opt/rocm/profiler/bin
 
 red=`tput setaf 1`
 green=`tput setaf 2`
@@ -48,6 +47,7 @@ reset=`tput sgr0`
 copt="-O3"
 verbose=""
 install=0
+target_opts=""
 
 # Help menu
 print_help() {
@@ -56,14 +56,16 @@ cat <<-HELP
 This script is invoked to build hcBLAS library and test sources. Please provide the following arguments:
 
   ${green}--test${reset}     Test to enable the library testing (on/basic/off). Upon basic option minimal tests get evaluated
-  ${green}--profile${reset}  Profile to enable profiling of five blas kernels namely SGEMM, CGEMM, SGEMV, SGER and SAXPY (CodeXL)
-  ${green}--bench${reset}    Profile benchmark using chrono timer
+  ${green}--profile${reset}  Run the benchmark suite over every routine, precision and layout (on/off); results in build/test/hcblas-benchmark.json
+  ${green}--bench${reset}    Replay the convolution network SGEMM shapes with hcblas-bench (on/off)
   ${green}--debug${reset}    Compile with debug info (-g)
   ${green}--verbose${reset}  Run make with VERBOSE=1
   ${green}--install${reset}  Install the shared library and include the header files under /opt/rocm/hcblas  Requires sudo perms.
   ${green}--examples${reset} To build and run the example files in examples folder (on/off) (ONLY SUPPORTED ON AMD PLATFORM)
-
-NOTE: export PROFILER_PATH=/path/to/profiler before enabling profile variable.
+  ${green}--targets${reset}  GPU targets to build the kernels for, e.g. --targets="gfx803;gfx900;gfx906" (ONLY SUPPORTED ON AMD PLATFORM)
+  ${green}--modules${reset}  Build one kernel module per GPU target, loaded only for the devices present (on/off)
+  ${green}--lazy${reset}     Build each GEMM routine as a module loaded on its first call (on/off)
+  ${green}--kernels${reset}  Build only the kernels named in a selection table file, one name per line as the HCBLAS_LAYER trace prints them
 =============================================================================================================================
 HELP
 exit 0
@@ -92,6 +94,22 @@ while [ $# -gt 0 ]; do
     --examples=*)
       examples="${1#*=}"
       ;;
+    --targets=*)
+      target_opts="$target_opts -DHCBLAS_AMDGPU_TARGETS=${1#*=}"
+      ;;
+    --modules=*)
+      if [ "${1#*=}" = "on" ]; then
+        target_opts="$target_opts -DHCBLAS_TARGET_MODULES=ON"
+      fi
+      ;;
+    --lazy=*)
+      if [ "${1#*=}" = "on" ]; then
+        target_opts="$target_opts -DHCBLAS_ROUTINE_MODULES=ON"
+      fi
+      ;;
+    --kernels=*)
+      target_opts="$target_opts -DHCBLAS_LEAN_KERNELS=ON -DHCBLAS_KERNELS=${1#*=}"
+      ;;
     --help) print_help;;
     *)
       printf "************************************************************\n"
@@ -118,7 +136,7 @@ build_dir=$current_work_dir/build
 cd $build_dir
 
 if [ "$platform" = "hcc" ]; then
-  cmake -DCMAKE_C_COMPILER=$cmake_c_compiler   -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS="$copt -fPIC" -DCMAKE_INSTALL_PREFIX=/opt/rocm/hcblas $current_work_dir
+  cmake -DCMAKE_C_COMPILER=$cmake_c_compiler   -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS="$copt -fPIC" -DCMAKE_INSTALL_PREFIX=/opt/rocm/hcblas $target_opts $current_work_dir
 
   make -j$working_threads package $verbose
   make -j$working_threads $verbose
@@ -134,7 +152,7 @@ if [ "$platform" = "hcc" ]; then
   if ( [ "$testing" = "on" ] ); then
 # Build Tests
     mkdir -p $current_work_dir/build/test
-    cd $build_dir/test/ && cmake -DCMAKE_C_COMPILER=$cmake_c_compiler -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS=-fPIC $current_work_dir/test/
+    cd $build_dir/test/ && cmake -DCMAKE_C_COMPILER=$cmake_c_compiler -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS=-fPIC $target_opts $current_work_dir/test/
     set +e
     make -j$working_threads
 # Invoke test script 
@@ -155,7 +173,7 @@ if [ "$platform" = "hcc" ]; then
   if ( [ "$testing" = "basic" ] ); then
 # Build Tests
     mkdir -p $current_work_dir/build/test
-    cd $build_dir/test/ && cmake -DCMAKE_C_COMPILER=$cmake_c_compiler -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS=-fPIC -DTEST_BASIC=ON $current_work_dir/test/
+    cd $build_dir/test/ && cmake -DCMAKE_C_COMPILER=$cmake_c_compiler -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS=-fPIC -DTEST_BASIC=ON $target_opts $current_work_dir/test/
     set +e
     make -j$working_threads
 # Invoke test script 
@@ -178,17 +196,24 @@ if [ "$platform" = "hcc" ]; then
   if ( [ "$profiling" = "on" ] ); then 
     printf "* PROFILING *\n"
     printf "*************\n"
-    cd $current_work_dir/profile/
-# Invoke profiling script
-    ./runme.sh
+    mkdir -p $build_dir/test
+    cd $build_dir/test/ && cmake -DCMAKE_C_COMPILER=$cmake_c_compiler -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS=-fPIC $target_opts $current_work_dir/test/
+    make -j$working_threads benchmark
   fi
 
 # bench=on
   if [ "$benchmark" = "on" ]; then
     printf "* BENCHMARKING *\n"
     printf "****************\n"
+    mkdir -p $build_dir/test
+    cd $build_dir/test/ && cmake -DCMAKE_C_COMPILER=$cmake_c_compiler -DCMAKE_CXX_COMPILER=$cmake_cxx_compiler -DCMAKE_CXX_FLAGS=-fPIC $target_opts $current_work_dir/test/
+    make -j$working_threads hcblas-bench
     cd $current_work_dir/benchmark/BLAS_benchmark_Convolution_Networks/
-    ./runme.sh
+    while read dimensions; do
+      if [ -f $dimensions ]; then
+        $build_dir/test/src/bin/hcblas-bench $dimensions
+      fi
+    done < Input.txt
   fi
 
 #EXAMPLES
@@ -48,9 +48,6 @@ if [ "$deepclean" = "1" ]; then
   sudo rm -f /opt/rocm/lib/libhcblas*
   sudo rm -f /opt/rocm/lib/libhipblas*
  
-  rm -rf ./profile/*Data
-  rm -f ./profile/*.csv
-
   rm -rf ./benchmark/BLAS_benchmark_Convolution_Networks/*Data
   rm -f ./benchmark/BLAS_benchmark_Convolution_Networks/*.csv
 fi
@@ -0,0 +1,46 @@
+# Kernel variants compiled into the library
+#
+#  HCBLAS_LEAN_KERNELS  - ON compiles only the kernel variants named in
+#                         HCBLAS_KERNELS (and the fallback each selector
+#                         needs); variants left out resolve to the fallback
+#  HCBLAS_KERNELS       - the selection table: kernel names as the
+#                         HCBLAS_LAYER trace prints them, either as a list or
+#                         as a file with one name per line; a name keeps
+#                         the variant for every precision that has it
+#
+# HCBLAS_KERNEL_FLAGS holds the compiler flags telling the kernel tables
+# which variants are built; HCBLAS_KERNEL_LIST the names.
+
+OPTION(HCBLAS_LEAN_KERNELS "Build only the kernel variants named in HCBLAS_KERNELS" OFF)
+SET(HCBLAS_KERNELS "" CACHE STRING "Kernel names, or a file of them, a lean build keeps")
+
+SET(HCBLAS_KERNEL_LIST "")
+SET(HCBLAS_KERNEL_FLAGS "")
+IF (HCBLAS_LEAN_KERNELS)
+  IF (EXISTS "${HCBLAS_KERNELS}" AND NOT IS_DIRECTORY "${HCBLAS_KERNELS}")
+    FILE(STRINGS "${HCBLAS_KERNELS}" HCBLAS_KERNEL_LIST REGEX "^[A-Za-z0-9_]+$")
+  ELSE()
+    SET(HCBLAS_KERNEL_LIST ${HCBLAS_KERNELS})
+  ENDIF()
+  SET(HCBLAS_KERNEL_FLAGS "-DHCBLAS_LEAN_KERNELS")
+  FOREACH(kernel ${HCBLAS_KERNEL_LIST})
+    SET(HCBLAS_KERNEL_FLAGS "${HCBLAS_KERNEL_FLAGS} -DHCBLAS_KERNEL_${kernel}")
+  ENDFOREACH()
+ENDIF()
+
+# HCBLAS_VARIANT_SOURCES(VAR) sets VAR to the translation units under the
+# current directory's variants/, one per kernel variant and named after the
+# kernel. A lean build keeps the TS16XMTS2 fallbacks and the variants
+# HCBLAS_KERNELS names.
+MACRO(HCBLAS_VARIANT_SOURCES VAR)
+  FILE(GLOB ${VAR} ${CMAKE_CURRENT_SOURCE_DIR}/variants/*.cpp)
+  IF (HCBLAS_LEAN_KERNELS)
+    FOREACH(variant ${${VAR}})
+      GET_FILENAME_COMPONENT(kernel ${variant} NAME_WE)
+      LIST(FIND HCBLAS_KERNEL_LIST ${kernel} index)
+      IF (index EQUAL -1 AND NOT kernel MATCHES "TS16XMTS2$")
+        LIST(REMOVE_ITEM ${VAR} ${variant})
+      ENDIF()
+    ENDFOREACH()
+  ENDIF()
+ENDMACRO()
@@ -0,0 +1,22 @@
+# GEMM routines loaded on first use
+#
+#  HCBLAS_ROUTINE_MODULES  - ON leaves the GEMM routines out of libhcblas and
+#                            builds each routine in each precision as a module
+#                            libhcblas-<routine>.so of its own, which the
+#                            library loads the first time the routine is
+#                            called or when hcblasWarmup() asks for it
+#
+# HCBLAS_MODULE_ROUTINES lists the routines built as modules, named as the
+# HCBLAS_ROUTINE_SRC_<routine> source lists lib/src/blas exports.
+
+OPTION(HCBLAS_ROUTINE_MODULES "Build the GEMM routines as modules loaded on first use" OFF)
+
+SET(HCBLAS_MODULE_ROUTINES "")
+SET(HCBLAS_MODULE_FLAGS "")
+IF (HCBLAS_ROUTINE_MODULES)
+  IF (HCBLAS_TARGET_MODULES)
+    MESSAGE(FATAL_ERROR "HCBLAS_ROUTINE_MODULES cannot be combined with HCBLAS_TARGET_MODULES")
+  ENDIF()
+  SET(HCBLAS_MODULE_ROUTINES sgemm dgemm hgemm cgemm zgemm)
+  SET(HCBLAS_MODULE_FLAGS "-DHCBLAS_ROUTINE_MODULES")
+ENDIF()
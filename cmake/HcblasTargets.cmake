@@ -0,0 +1,21 @@
+# GPU targets the HCC kernels are built for
+#
+#  HCBLAS_AMDGPU_TARGETS  - list of targets, e.g. -DHCBLAS_AMDGPU_TARGETS="gfx803;gfx900;gfx906"
+#  HCBLAS_TARGET_MODULES  - ON links the kernels for the first target into
+#                           libhcblas and those of every other target into a
+#                           module libhcblas-<target>.so of its own, which the
+#                           library loads only on a device of that target
+#
+# HCBLAS_TARGET_FLAGS(<var> <target>...) sets <var> to the -amdgpu-target
+# linker flags for the targets given.
+
+SET(HCBLAS_AMDGPU_TARGETS "gfx803;gfx900" CACHE STRING "GPU targets to build the kernels for")
+OPTION(HCBLAS_TARGET_MODULES "Build one kernel module per GPU target, loaded for the device found at run time" OFF)
+
+MACRO(HCBLAS_TARGET_FLAGS VAR)
+  SET(${VAR} "")
+  FOREACH(target ${ARGN})
+    SET(${VAR} "${${VAR}} -amdgpu-target=${target}")
+  ENDFOREACH()
+  STRING(STRIP "${${VAR}}" ${VAR})
+ENDMACRO()
@@ -32,6 +32,7 @@ THE SOFTWARE.
 // 2.2.1. hcblasHandle_t
 
 #include <hc_defines.h>
+#include <cstddef>
 
 // The hcblasHandle_t type is a pointer to an opaque structure holding the
 // hcBLAS library context. The hcBLAS library context must be initialized
@@ -39,6 +40,13 @@ THE SOFTWARE.
 // library function calls. The context should be destroyed at the end using
 // hcblasDestroy().
 
+// Thread safety: a handle may be shared by several threads. Functions taking
+// a handle only read its state, and the stream each call executes on is
+// resolved per call, from the calling thread's binding
+// (hcblasSetThreadAcclView()) when there is one and from the handle default
+// (hcblasSetAcclView()) otherwise. hcblasDestroy() must not race with other
+// calls on the same handle.
+
 namespace hc {
 class accelerator;
 class accelerator_view;
@@ -96,13 +104,162 @@ typedef hcFloatComplex hcComplex;
 typedef double_2_ hcDoubleComplex;
 typedef hcDoubleComplex hcDoubleComplex;
 
+// 2.2.5. hcblasFillMode_t
+
+// The type indicates which part (lower or upper) of the dense matrix was
+// filled and consequently should be used by the function. Its values
+// correspond to Fortran characters ‘L’ or ‘l’ (lower) and ‘U’ or ‘u’ (upper)
+// that are often used as parameters to legacy BLAS implementations.
+
+enum hcblasFillMode_t : unsigned short {
+  HCBLAS_FILL_MODE_LOWER,  // the lower part of the matrix is filled
+  HCBLAS_FILL_MODE_UPPER   // the upper part of the matrix is filled
+};
+
+// 2.2.6. hcblasDiagType_t
+
+// The type indicates whether the main diagonal of the dense matrix is unity
+// and consequently should not be touched or modified by the function. Its
+// values correspond to Fortran characters ‘N’ or ‘n’ (non-unit) and ‘U’ or
+// ‘u’ (unit) that are often used as parameters to legacy BLAS
+// implementations.
+
+enum hcblasDiagType_t : unsigned short {
+  HCBLAS_DIAG_NON_UNIT,  // the matrix diagonal has non-unit elements
+  HCBLAS_DIAG_UNIT       // the matrix diagonal has unit elements
+};
+
+// 2.2.7. hcblasDataType_t
+
+// The hcblasDataType_t type describes the storage type of a matrix operand
+// and the type used for accumulation in the Ex family of functions.
+
+enum hcblasDataType_t : unsigned short {
+  HCBLAS_R_16F,  // real 16 bit floating point
+  HCBLAS_R_32F,  // real 32 bit floating point
+  HCBLAS_R_64F,  // real 64 bit floating point
+  HCBLAS_C_32F,  // complex pair of 32 bit floating point
+  HCBLAS_C_64F,  // complex pair of 64 bit floating point
+  HCBLAS_R_8I,   // real 8 bit signed integer
+  HCBLAS_R_32I,  // real 32 bit signed integer
+  HCBLAS_R_16BF  // real 16 bit bfloat16 (8 bit exponent, 7 bit mantissa)
+};
+
+// 2.2.8. hcblasGemmAlgo_t
+
+// The hcblasGemmAlgo_t type selects the GEMM algorithm used by
+// hcblasGemmEx(). HCBLAS_GEMM_DEFAULT lets the library pick the kernel.
+
+enum hcblasGemmAlgo_t : unsigned short {
+  HCBLAS_GEMM_DEFAULT  // heuristic kernel selection
+};
+
+// 2.2.9. hcblasQuantAxis_t
+
+// The hcblasQuantAxis_t type indicates whether the requantisation scale and
+// zero point of hcblasIgemmRequant() are given per row or per column of C.
+
+enum hcblasQuantAxis_t : unsigned short {
+  HCBLAS_QUANT_PER_ROW,    // one scale and zero point per row of C
+  HCBLAS_QUANT_PER_COLUMN  // one scale and zero point per column of C
+};
+
+// 2.2.10. hcBfloat16
+
+// hcBfloat16 holds the upper 16 bits of an IEEE-754 single precision value.
+// hcblasBfloat16ToFloat() widens it exactly and hcblasFloatToBfloat16()
+// narrows a float with round to nearest even; both are usable on the host
+// and in kernels.
+
+#include "hcblas_bfloat16.h"
+
+// 2.2.11. hcblasEpilogue_t
+
+// hcblasEpilogue_t describes work fused into the store phase of a GEMM so
+// that C is written once. For each element of C
+// v = α scale[q] op ( A ) op ( B ) + β C + bias[p]
+// aux = v (if aux is not NULL), C = activation ( v )
+// where p and q are the row or column of C selected by biasAxis and
+// scaleAxis. bias and scale are device arrays of m (per row) or n (per
+// column) elements and may be NULL. aux is a device matrix with the same
+// shape and element type as C and leading dimension ldaux.
+
+enum hcblasActivation_t : unsigned short {
+  HCBLAS_ACTIVATION_NONE,     // identity
+  HCBLAS_ACTIVATION_RELU,     // max(v, 0)
+  HCBLAS_ACTIVATION_GELU,     // v * Phi(v), tanh approximation
+  HCBLAS_ACTIVATION_SIGMOID,  // 1 / (1 + exp(-v))
+  HCBLAS_ACTIVATION_CLAMP     // min(max(v, clampMin), clampMax)
+};
+
+struct hcblasEpilogue_t {
+  const float *bias;
+  hcblasQuantAxis_t biasAxis;
+  const float *scale;
+  hcblasQuantAxis_t scaleAxis;
+  hcblasActivation_t activation;
+  float clampMin;
+  float clampMax;
+  void *aux;
+  int ldaux;
+};
+
+// 2.2.12. hcblasPlan_t
+
+// The hcblasPlan_t type is a pointer to an opaque structure holding a
+// sequence of hcBLAS calls recorded with hcblasBeginCapture() and
+// hcblasEndCapture(). The plan can be launched any number of times with
+// hcblasLaunchPlan() and must be released with hcblasDestroyPlan().
+
+typedef struct hcblasPlan *hcblasPlan_t;
+
+// 2.2.13. hcblasBackend_t
+
+// The hcblasBackend_t type selects where the routines of a handle run.
+// HCBLAS_BACKEND_CPU runs them on a pool of host threads, so every pointer
+// passed to the handle must be host accessible; it is mainly meant for
+// hosts without a supported GPU and as a reference to check results
+// against. HCBLAS_BACKEND_DEFAULT picks the backend as hcblasCreate() does.
+
+enum hcblasBackend_t : unsigned short {
+  HCBLAS_BACKEND_DEFAULT,  // HCBLAS_BACKEND environment variable or device
+  HCBLAS_BACKEND_HCC,      // HCC kernels on the accelerator
+  HCBLAS_BACKEND_CPU       // host threads
+};
+
+// 2.2.14. hcblasXtHandle_t
+
+// The hcblasXtHandle_t type is a pointer to an opaque structure holding the
+// devices the hcblasXt routines share their work out to. It is created with
+// hcblasXtCreate() and released with hcblasXtDestroy().
+
+typedef struct hcblasXtContext *hcblasXtHandle_t;
+
+// 2.2.15. hcblasRoutine_t
+
+// The hcblasRoutine_t type names the routines that a library built with
+// HCBLAS_ROUTINE_MODULES loads on their first call, one module per routine
+// and precision; routines built on them, such as hcblasGemmEx(), load the
+// module they use too. Values can be combined with | for hcblasWarmup().
+
+enum hcblasRoutine_t : unsigned int {
+  HCBLAS_ROUTINE_SGEMM = 1u << 0,  // hcblasSgemm() and hcblasSgemmBatched()
+  HCBLAS_ROUTINE_DGEMM = 1u << 1,  // hcblasDgemm() and hcblasDgemmBatched()
+  HCBLAS_ROUTINE_HGEMM = 1u << 2,  // hcblasHgemm()
+  HCBLAS_ROUTINE_CGEMM = 1u << 3,  // hcblasCgemm() and hcblasCgemmBatched()
+  HCBLAS_ROUTINE_ZGEMM = 1u << 4,  // hcblasZgemm() and hcblasZgemmBatched()
+  HCBLAS_ROUTINE_ALL = (1u << 5) - 1
+};
+
 // hcblas Helper functions
 
 // 1. hcblasCreate()
 
 // This function initializes the HCBLAS library and creates a handle to an
 // opaque structure holding the HCBLAS library context. Create the handle
-// for use on the specified GPU.
+// for use on the specified GPU. The handle runs on the CPU backend when the
+// HCBLAS_BACKEND environment variable is "cpu" or the device path of av is
+// "cpu", and on HCC kernels otherwise (see hcblasCreateWithBackend()).
 
 // Return Values
 // --------------------------------------------------------------------
@@ -116,6 +273,8 @@ hcblasStatus_t hcblasCreate(hcblasHandle_t *handle, hc::accelerator_view *av);
 // This function releases hardware resources used by the HCBLAS library.
 // This function is usually the last call with a particular handle to the HCBLAS
 // library.
+// Captures still open with the handle, on any thread, are dropped and their
+// plans released.
 
 // Return Values
 // ---------------------------------------------------------------------
@@ -131,6 +290,10 @@ hcblasStatus_t hcblasDestroy(hcblasHandle_t *handle);
 // stream is not set, all kernels use the defaultNULL stream. In particular,
 // this routine can be used to change the stream between kernel launches and
 // then to reset the hcBLAS library stream back to NULL.
+// The stream set here is the handle default; threads that bound their own
+// stream with hcblasSetThreadAcclView() keep using it. The call may race with
+// hcBLAS calls on other threads: each call launches on the stream it
+// resolved when it started.
 
 // Return Values
 // ---------------------------------------------------------------------
@@ -146,6 +309,10 @@ hcblasStatus_t hcblasSetAcclView(hcblasHandle_t handle,
 // This function gets the hcBLAS library stream, which is being used to execute
 // all calls to the hcBLAS library functions. If the hcBLAS library stream is
 // not set, all kernels use the defaultNULL stream.
+// The stream returned is the one the calling thread launches on, its own
+// binding if it has one. The returned view is owned by the handle and stays
+// valid until the handle is destroyed, whatever the calling thread binds or
+// clears in the meantime on this or other handles.
 
 // Return Values
 // ---------------------------------------------------------------------
@@ -232,6 +399,266 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
                                int elemSize, const void *A, int lda, void *B,
                                int ldb);
 
+// 7. hcblasSetThreadAcclView()
+
+// This function binds a stream to the handle for the calling thread only.
+// Subsequent hcBLAS calls made by this thread with this handle execute on
+// accl_view, whatever the handle default set by hcblasSetAcclView() is, and
+// calls made by other threads are unaffected. This lets many threads share a
+// single handle while each keeps its own stream. Binding again replaces the
+// previous binding of the thread.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the stream was bound successfully
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasSetThreadAcclView(hcblasHandle_t handle,
+                                       hc::accelerator_view &accl_view,
+                                       void *streamId = nullptr);
+
+// 8. hcblasClearThreadAcclView()
+
+// This function removes the stream bound by hcblasSetThreadAcclView() for the
+// calling thread, which goes back to the handle default stream.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the binding was removed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasClearThreadAcclView(hcblasHandle_t handle);
+
+// 9. hcblasBeginCapture()
+
+// This function starts recording the hcBLAS calls the calling thread makes
+// with handle. While capturing, hcblas<t>gemm(), hcblas<t>gemv() and
+// hcblas<t>axpy() for <t> = S validate their arguments, pick their kernel
+// and append the launch to the plan instead of executing it. The other
+// routines that take handle and access device memory (including the
+// hcblasSet/Get<Vector|Matrix>() copies) cannot be recorded: they return
+// HCBLAS_STATUS_INVALID_VALUE without running, so nothing executes out of
+// order with the recorded calls. Other threads using the same handle are
+// not affected. Handles on the CPU backend run every call immediately and
+// cannot capture.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            capture started
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      the thread is already capturing on handle,
+//                                  or handle runs on the CPU backend
+// HCBLAS_STATUS_ALLOC_FAILED       the plan could not be allocated
+
+hcblasStatus_t hcblasBeginCapture(hcblasHandle_t handle);
+
+// 10. hcblasEndCapture()
+
+// This function stops the capture started by hcblasBeginCapture() on the
+// calling thread and returns the recorded calls in *plan.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the plan was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      plan is NULL or the thread is not
+//                                  capturing on handle
+
+hcblasStatus_t hcblasEndCapture(hcblasHandle_t handle, hcblasPlan_t *plan);
+
+// 11. hcblasLaunchPlan()
+
+// This function launches the calls recorded in plan, in capture order, on the
+// stream the calling thread uses with handle. Arguments were checked and
+// kernels chosen at capture time, so a launch only enqueues the kernels.
+// Scalars are the values passed at capture time; device pointers are those
+// of the capture unless changed with hcblasPlanRebind().
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the plan was launched
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      plan is NULL
+// HCBLAS_STATUS_EXECUTION_FAILED   a recorded call failed to launch
+
+hcblasStatus_t hcblasLaunchPlan(hcblasHandle_t handle, hcblasPlan_t plan);
+
+// 12. hcblasPlanRebind()
+
+// This function replaces the device pointer from with to in every call
+// recorded in plan, so the same plan can run on other buffers. The new
+// buffers must be large enough for the recorded shapes and offsets.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the pointer was replaced
+// HCBLAS_STATUS_INVALID_VALUE      plan or to is NULL, or from is not used
+//                                  by plan
+
+hcblasStatus_t hcblasPlanRebind(hcblasPlan_t plan, const void *from,
+                                void *to);
+
+// 13. hcblasDestroyPlan()
+
+// This function releases a plan returned by hcblasEndCapture().
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the plan was released
+// HCBLAS_STATUS_INVALID_VALUE      plan is NULL
+
+hcblasStatus_t hcblasDestroyPlan(hcblasPlan_t plan);
+
+// 14. hcblasCreateWithBackend()
+
+// This function creates a handle like hcblasCreate() whose routines run on
+// backend. CPU handles do not support hcblasBeginCapture().
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            initialization succeeded
+// HCBLAS_STATUS_INVALID_VALUE      backend is not a hcblasBackend_t value
+// HCBLAS_STATUS_ALLOC_FAILED       the resources could not be allocated
+
+hcblasStatus_t hcblasCreateWithBackend(hcblasHandle_t *handle,
+                                       hc::accelerator_view *av,
+                                       hcblasBackend_t backend);
+
+// 15. hcblasGetBackend()
+
+// This function returns in *backend where the routines of handle run,
+// HCBLAS_BACKEND_HCC or HCBLAS_BACKEND_CPU.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the backend was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      backend is NULL
+
+hcblasStatus_t hcblasGetBackend(hcblasHandle_t handle,
+                                hcblasBackend_t *backend);
+
+// 16. hcblasXtCreate()
+
+// This function creates a handle for the multi-device hcblasXt routines on
+// every accelerator returned by hc::accelerator::get_all() that is neither
+// the CPU nor emulated, or on the CPU if there is no other.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            initialization succeeded
+// HCBLAS_STATUS_INVALID_VALUE      handle is NULL
+// HCBLAS_STATUS_ALLOC_FAILED       the resources could not be allocated
+
+hcblasStatus_t hcblasXtCreate(hcblasXtHandle_t *handle);
+
+// 17. hcblasXtDestroy()
+
+// This function releases the devices of an hcblasXt handle.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the shut down succeeded
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+
+hcblasStatus_t hcblasXtDestroy(hcblasXtHandle_t *handle);
+
+// 18. hcblasXtDeviceSelect()
+
+// This function makes the hcblasXt routines of handle run on the nbDevices
+// accelerators whose indices in hc::accelerator::get_all() are listed in
+// deviceId.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the devices were selected
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      nbDevices<1, deviceId is NULL or an index
+//                                  is out of range or repeated
+// HCBLAS_STATUS_ALLOC_FAILED       the resources could not be allocated
+
+hcblasStatus_t hcblasXtDeviceSelect(hcblasXtHandle_t handle, int nbDevices,
+                                    const int deviceId[]);
+
+// 19. hcblasXtSetBlockDim()
+
+// This function sets the side of the square blocks of C that the hcblasXt
+// routines share out among the devices; the default is 2048.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the block size was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      blockDim<1
+
+hcblasStatus_t hcblasXtSetBlockDim(hcblasXtHandle_t handle, int blockDim);
+
+// 20. hcblasXtGetBlockDim()
+
+// This function returns in *blockDim the side of the blocks of C that the
+// hcblasXt routines share out among the devices.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the block size was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      blockDim is NULL
+
+hcblasStatus_t hcblasXtGetBlockDim(hcblasXtHandle_t handle, int *blockDim);
+
+// 21. hcblasWarmup()
+
+// This function loads the modules of the routines in routines, a
+// combination of hcblasRoutine_t values, so that their first call does not
+// pay for it. Call it off the critical path, e.g. right after
+// hcblasCreate(). Routines built into the library, and handles on the CPU
+// backend, need no loading and the call then does nothing.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the modules are loaded
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      routines is not a combination of
+//                                  hcblasRoutine_t values
+// HCBLAS_STATUS_INTERNAL_ERROR     a module could not be loaded
+
+hcblasStatus_t hcblasWarmup(hcblasHandle_t handle, unsigned int routines);
+
+// 22. hcblasGetModuleLoadTime()
+
+// This function returns in *milliseconds how long loading the module of
+// routine took: 0 if the routine is built into the library and a negative
+// value if its module has not been loaded (yet, or it failed to load).
+// Loads also appear in the HCBLAS_LAYER trace as load_<routine>(<time>ms)
+// in the kernel column of the call that caused them.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the time was returned
+// HCBLAS_STATUS_INVALID_VALUE      routine is not a single hcblasRoutine_t
+//                                  value, or milliseconds is NULL
+
+hcblasStatus_t hcblasGetModuleLoadTime(hcblasRoutine_t routine,
+                                       double *milliseconds);
+
+// 23. hcblasGetGemmCacheStats()
+
+// This function returns how many GEMM calls on handle found their kernel in
+// the handle's decision cache (*hits) and how many had to select it
+// (*misses). A call hits when an earlier one had the same precision, order,
+// transposes, sizes, leading dimensions and operand alignment. Only SGEMM
+// consults the cache so far.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the counts were returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      hits or misses is NULL
+
+hcblasStatus_t hcblasGetGemmCacheStats(hcblasHandle_t handle,
+                                       unsigned long long *hits,
+                                       unsigned long long *misses);
+
 // HCBLAS Level-1 function reference
 
 // Level-1 Basic Linear Algebra Subprograms (BLAS1) functions perform scalar and
@@ -585,6 +1012,337 @@ hcblasStatus_t hcblasDgerBatched(hcblasHandle_t handle, int m, int n,
                                  const double *y, int incy, double *A, int lda,
                                  int batchCount);
 
+// 3. hcblas<t>symv() and hcblasChemv()
+
+// This function performs the symmetric (Hermitian for hcblasChemv)
+// matrix-vector multiplication
+// y = α A x + β y
+// where A is a n × n symmetric (Hermitian) matrix stored in lower or upper
+// mode, x and y are vectors, and α and β are scalars. Only the triangle
+// selected by uplo is read; the imaginary part of the diagonal of a Hermitian
+// matrix is assumed to be zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           input          <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication, if beta==0
+//                                              then y does not have to be a
+//                                              valid input.
+// y            device           in/out         <type> vector with n elements.
+// incy         host             input          stride between consecutive
+//                                              elements of y.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsymv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const float *alpha, const float *A, int lda,
+                           const float *x, int incx, const float *beta,
+                           float *y, int incy);
+hcblasStatus_t hcblasDsymv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const double *alpha, const double *A, int lda,
+                           const double *x, int incx, const double *beta,
+                           double *y, int incy);
+hcblasStatus_t hcblasChemv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const hcComplex *alpha, const hcComplex *A, int lda,
+                           const hcComplex *x, int incx, const hcComplex *beta,
+                           hcComplex *y, int incy);
+
+// 4. hcblas<t>trmv()
+
+// This function performs the triangular matrix-vector multiplication
+// x = op ( A ) x
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, and x is a vector. Also, for matrix A
+// op ( A ) = A             if trans == HCBLAS_OP_N
+//            A^T           if trans == HCBLAS_OP_T
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose.
+// diag         host             input          indicates if the elements on
+//                                              the main diagonal of matrix A
+//                                              are unity and should not be
+//                                              accessed.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           in/out         <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrmv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const float *A, int lda, float *x, int incx);
+hcblasStatus_t hcblasDtrmv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const double *A, int lda, double *x,
+                           int incx);
+
+// 5. hcblas<t>trsv()
+
+// This function solves the triangular linear system with a single
+// right-hand-side
+// op ( A ) x = b
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, and x and b are vectors. The solution x
+// overwrites the right-hand-sides b on exit. No test for singularity or
+// near-singularity is included in this function. Also, for matrix A
+// op ( A ) = A             if trans == HCBLAS_OP_N
+//            A^T           if trans == HCBLAS_OP_T
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose.
+// diag         host             input          indicates if the elements on
+//                                              the main diagonal of matrix A
+//                                              are unity and should not be
+//                                              accessed.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           in/out         <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrsv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const float *A, int lda, float *x, int incx);
+hcblasStatus_t hcblasDtrsv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const double *A, int lda, double *x,
+                           int incx);
+
+// 6. hcblas<t>syr() and hcblas<t>syr2()
+
+// This function performs the symmetric rank-1 and rank-2 updates
+// A = α x x T + A          if syr() is called
+//     α ( x y T + y x T ) + A   if syr2() is called
+// where A is a n × n symmetric matrix stored in column-major format, x and y
+// are vectors, and α is a scalar. Only the triangle selected by uplo is
+// updated.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// x            device           input          <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// y            device           input          <type> vector with n elements
+//                                              (syr2 only).
+// incy         host             input          stride between consecutive
+//                                              elements of y (syr2 only).
+// A            device           in/out         <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyr(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                          const float *alpha, const float *x, int incx,
+                          float *A, int lda);
+hcblasStatus_t hcblasDsyr(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                          const double *alpha, const double *x, int incx,
+                          double *A, int lda);
+hcblasStatus_t hcblasSsyr2(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const float *alpha, const float *x, int incx,
+                           const float *y, int incy, float *A, int lda);
+hcblasStatus_t hcblasDsyr2(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const double *alpha, const double *x, int incx,
+                           const double *y, int incy, double *A, int lda);
+
+// 7. hcblas<t>gbmv()
+
+// This function performs the banded matrix-vector multiplication
+// y = α op ( A ) x + β y
+// where A is a m × n banded matrix with kl subdiagonals and ku
+// superdiagonals, x and y are vectors, and α and β are scalars. Also, for
+// matrix A
+// op ( A ) = A             if trans == HCBLAS_OP_N
+//            A^T           if trans == HCBLAS_OP_T
+// The banded matrix A is stored column by column, with the main diagonal
+// stored in row ku+1 (starting in first position), the first superdiagonal
+// stored in row ku (starting in second position), the first subdiagonal
+// stored in row ku+2 (starting in first position), etc. So that in general,
+// the element A(i,j) is stored in the memory location A(ku+1+i-j,j) for
+// j = 1 , … , n and i ∈ [ max ( 1 , j − ku ) , min ( m , j + kl ) ].
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix A.
+// n            host             input          number of columns of matrix A.
+// kl           host             input          number of subdiagonals of
+//                                              matrix A.
+// ku           host             input          number of superdiagonals of
+//                                              matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= kl+ku+1.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           input          <type> vector with n elements if
+//                                              trans==HCBLAS_OP_N and m
+//                                              elements otherwise.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication, if beta==0
+//                                              then y does not have to be a
+//                                              valid input.
+// y            device           in/out         <type> vector with m elements if
+//                                              trans==HCBLAS_OP_N and n
+//                                              elements otherwise.
+// incy         host             input          stride between consecutive
+//                                              elements of y.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,kl,ku<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgbmv(hcblasHandle_t handle, hcblasOperation_t trans,
+                           int m, int n, int kl, int ku, const float *alpha,
+                           const float *A, int lda, const float *x, int incx,
+                           const float *beta, float *y, int incy);
+hcblasStatus_t hcblasDgbmv(hcblasHandle_t handle, hcblasOperation_t trans,
+                           int m, int n, int kl, int ku, const double *alpha,
+                           const double *A, int lda, const double *x, int incx,
+                           const double *beta, double *y, int incy);
+
+// 8. hcblas<t>sbmv()
+
+// This function performs the symmetric banded matrix-vector multiplication
+// y = α A x + β y
+// where A is a n × n symmetric banded matrix with k subdiagonals and
+// superdiagonals, x and y are vectors, and α and β are scalars.
+// If uplo == HCBLAS_FILL_MODE_LOWER then the symmetric banded matrix A is
+// stored column by column, with the main diagonal of the matrix stored in
+// row 1, the first subdiagonal in row 2 (starting at first position), etc.
+// So that in general, the element A(i,j) is stored in the memory location
+// A(1+i-j,j) for j = 1 , … , n and i ∈ [ j , min ( m , j + k ) ].
+// If uplo == HCBLAS_FILL_MODE_UPPER then the main diagonal is stored in row
+// k+1, the first superdiagonal in row k (starting at second position), etc.
+// So that in general, the element A(i,j) is stored in the memory location
+// A(1+k+i-j,j) for j = 1 , … , n and i ∈ [ max ( 1 , j − k ) , j ].
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// k            host             input          number of sub- and
+//                                              super-diagonals of matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= k+1.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           input          <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication, if beta==0
+//                                              then y does not have to be a
+//                                              valid input.
+// y            device           in/out         <type> vector with n elements.
+// incy         host             input          stride between consecutive
+//                                              elements of y.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsbmv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           int k, const float *alpha, const float *A, int lda,
+                           const float *x, int incx, const float *beta,
+                           float *y, int incy);
+hcblasStatus_t hcblasDsbmv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           int k, const double *alpha, const double *A,
+                           int lda, const double *x, int incx,
+                           const double *beta, double *y, int incy);
+
 // HCBLAS Level-3 Function Reference
 
 // The Level-3 Basic Linear Algebra Subprograms (BLAS3) functions perform
@@ -789,4 +1547,449 @@ hcblasStatus_t hcblasZgemmBatched(
     const hcDoubleComplex *beta, hcDoubleComplex *Carray[], int ldc,
     int batchCount);
 
+// 3. hcblasGemmEx()
+
+// This function is an extension of hcblas<t>gemm that allows the user to
+// individually specify the data types for each of the A, B and C matrices
+// and the type in which the products are accumulated.
+// C = α op ( A ) op ( B ) + β C
+// A and B are converted to computeType as they are loaded, so no separate
+// conversion pass is required. alpha and beta point to values of
+// computeType. The supported combinations are
+
+// Atype          Btype          Ctype          computeType
+// ------------------------------------------------------------------
+// HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_16F
+// HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_32F
+// HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_32F   HCBLAS_R_32F
+// HCBLAS_R_32F   HCBLAS_R_32F   HCBLAS_R_32F   HCBLAS_R_32F
+// HCBLAS_R_64F   HCBLAS_R_64F   HCBLAS_R_64F   HCBLAS_R_64F
+// HCBLAS_C_32F   HCBLAS_C_32F   HCBLAS_C_32F   HCBLAS_C_32F
+// HCBLAS_C_64F   HCBLAS_C_64F   HCBLAS_C_64F   HCBLAS_C_64F
+// HCBLAS_R_8I    HCBLAS_R_8I    HCBLAS_R_32I   HCBLAS_R_32I
+// HCBLAS_R_16BF  HCBLAS_R_16BF  HCBLAS_R_16BF  HCBLAS_R_32F
+// HCBLAS_R_16BF  HCBLAS_R_16BF  HCBLAS_R_32F   HCBLAS_R_32F
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          computeType scalar used for
+//                                              multiplication.
+// A            device           input          Atype array of dimensions lda x
+//                                              k with lda>=max(1,m) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              m with lda>=max(1,k) otherwise.
+// Atype        host             input          storage type of matrix A.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A.
+// B            device           input          Btype array of dimension ldb x
+//                                              n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// Btype        host             input          storage type of matrix B.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          computeType scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            device           in/out         Ctype array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// Ctype        host             input          storage type of matrix C.
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C.
+// computeType  host             input          type used for accumulation and
+//                                              for alpha and beta.
+// algo         host             input          algorithm selection, must be
+//                                              HCBLAS_GEMM_DEFAULT.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0 or the type
+//                                 combination is not supported
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasGemmEx(hcblasHandle_t handle, hcblasOperation_t transa,
+                            hcblasOperation_t transb, int m, int n, int k,
+                            const void *alpha, const void *A,
+                            hcblasDataType_t Atype, int lda, const void *B,
+                            hcblasDataType_t Btype, int ldb, const void *beta,
+                            void *C, hcblasDataType_t Ctype, int ldc,
+                            hcblasDataType_t computeType,
+                            hcblasGemmAlgo_t algo);
+
+// 4. hcblasIgemm()
+
+// This function performs the matrix-matrix multiplication on 8 bit signed
+// integer operands with 32 bit integer accumulation
+// C = α op ( A ) op ( B ) + β C
+// hcblasIgemmRequant() computes the same product but requantises the int32
+// accumulator to 8 bit in the store phase
+// C = sat8 ( round ( scale[q] op ( A ) op ( B ) ) + zeroPoint[q] )
+// where q is the row or column of C selected by axis, round rounds half away
+// from zero and sat8 saturates to [-128, 127].
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          int scalar used for
+//                                              multiplication.
+// A            device           input          int8 array of dimensions lda x
+//                                              k with lda>=max(1,m) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              m with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A.
+// B            device           input          int8 array of dimension ldb x
+//                                              n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          int scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            device           in/out         int32 (hcblasIgemm) or int8
+//                                              (hcblasIgemmRequant) array of
+//                                              dimensions ldc x n with
+//                                              ldc>=max(1,m).
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C.
+// axis         host             input          whether scale and zeroPoint are
+//                                              indexed by row or column of C.
+// scale        device           input          float array of m (per row) or n
+//                                              (per column) elements.
+// zeroPoint    device           input          int array of m or n elements,
+//                                              may be NULL for symmetric
+//                                              quantisation.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0 or scale is NULL
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasIgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const int *alpha, const signed char *A, int lda,
+                           const signed char *B, int ldb, const int *beta,
+                           int *C, int ldc);
+
+hcblasStatus_t hcblasIgemmRequant(hcblasHandle_t handle,
+                                  hcblasOperation_t transa,
+                                  hcblasOperation_t transb, int m, int n,
+                                  int k, const signed char *A, int lda,
+                                  const signed char *B, int ldb,
+                                  signed char *C, int ldc,
+                                  hcblasQuantAxis_t axis, const float *scale,
+                                  const int *zeroPoint);
+
+// 5. hcblasSgemmEpilogue()
+
+// This function performs the single precision matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// and applies the epilogue described by hcblasEpilogue_t to every element
+// of C before it is stored, replacing separate scale, bias and activation
+// passes over C.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimensions lda
+//                                              x k with lda>=max(1,m) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              m with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A.
+// B            device           input          <type> array of dimension ldb
+//                                              x n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimensions ldc
+//                                              x n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C.
+// epilogue     host             input          scale, bias, activation and
+//                                              auxiliary output to apply.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0, epilogue is NULL,
+//                                 ldaux is too small or clampMin>clampMax
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmEpilogue(hcblasHandle_t handle,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int m, int n,
+                                   int k, const float *alpha, const float *A,
+                                   int lda, const float *B, int ldb,
+                                   const float *beta, float *C, int ldc,
+                                   const hcblasEpilogue_t *epilogue);
+
+// 6. hcblasSgemmGrouped()
+
+// This function performs the single precision matrix-matrix multiplication
+// C[i] = α op ( A[i] ) op ( B[i] ) + β C[i],  for i ∈ [0, groupCount - 1]
+// where every problem of the group has its own m, n, k and leading
+// dimensions. Unlike hcblasSgemmBatched() the shapes need not agree: all
+// problems are cut into blocks of C that are numbered in one index space,
+// most expensive problem first, and computed by a single kernel launch.
+// Problems with m[i] or n[i] equal to zero are skipped.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A[i]) that is
+//                                              non- or transpose.
+// transb       host             input          operation op(B[i]) that is
+//                                              non- or transpose.
+// m            host             input          array of groupCount numbers of
+//                                              rows of op(A[i]) and C[i].
+// n            host             input          array of groupCount numbers of
+//                                              columns of op(B[i]) and C[i].
+// k            host             input          array of groupCount numbers of
+//                                              columns of op(A[i]) and rows of
+//                                              op(B[i]).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// Aarray       host             input          array of device pointers to
+//                                              <type> arrays, as for
+//                                              hcblasSgemmBatched() with
+//                                              m[i], k[i] and lda[i].
+// lda          host             input          array of leading dimensions of
+//                                              the matrices A[i].
+// Barray       host             input          array of device pointers to
+//                                              <type> arrays, as for
+//                                              hcblasSgemmBatched() with
+//                                              k[i], n[i] and ldb[i].
+// ldb          host             input          array of leading dimensions of
+//                                              the matrices B[i].
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0 C
+//                                              does not have to be a valid
+//                                              input.
+// Carray       host             in/out         array of device pointers to
+//                                              <type> arrays of dimensions
+//                                              ldc[i] x n[i] with
+//                                              ldc[i]>=max(1,m[i]).
+// ldc          host             input          array of leading dimensions of
+//                                              the matrices C[i].
+// groupCount   host             input          number of problems in the
+//                                              group.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     groupCount<0, an array is NULL or some
+//                                 m[i],n[i],k[i]<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmGrouped(hcblasHandle_t handle,
+                                  hcblasOperation_t transa,
+                                  hcblasOperation_t transb, const int m[],
+                                  const int n[], const int k[],
+                                  const float *alpha,
+                                  const float *const Aarray[],
+                                  const int lda[],
+                                  const float *const Barray[],
+                                  const int ldb[], const float *beta,
+                                  float *const Carray[], const int ldc[],
+                                  int groupCount);
+
+// 7. hcblas<t>gemmOutOfCore()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// as hcblas<t>gemm() does, for A, B and C in host memory that need not fit
+// on the device. C is cut into tiles sized so that two buffers of panels of
+// op(A) and op(B) plus one tile of C fit in deviceBytes; each tile streams
+// its panels through the two buffers, copying one while the other is
+// multiplied. cpuFraction of the tiles are computed on the host at the same
+// time, by the CPU backend. On a CPU handle every tile runs on the host.
+// The call returns when C is complete.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// lda          host             input          leading dimension of A.
+// B            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// ldb          host             input          leading dimension of B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            host             in/out         <type> array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of C.
+// deviceBytes  host             input          device memory the call may
+//                                              use; 0 selects a quarter of
+//                                              the device's memory.
+// cpuFraction  host             input          fraction of the tiles of C
+//                                              computed on the host, in
+//                                              [0, 1].
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0 or k<1, cpuFraction is
+//                                 outside [0, 1] or deviceBytes cannot hold
+//                                 tiles of 64 x 64
+// HCBLAS_STATUS_EXECUTION_FAILED  the buffers could not be allocated or a
+//                                 tile failed to run
+
+hcblasStatus_t hcblasSgemmOutOfCore(hcblasHandle_t handle,
+                                    hcblasOperation_t transa,
+                                    hcblasOperation_t transb, int m, int n,
+                                    int k, const float *alpha, const float *A,
+                                    int lda, const float *B, int ldb,
+                                    const float *beta, float *C, int ldc,
+                                    size_t deviceBytes, float cpuFraction);
+
+hcblasStatus_t hcblasDgemmOutOfCore(hcblasHandle_t handle,
+                                    hcblasOperation_t transa,
+                                    hcblasOperation_t transb, int m, int n,
+                                    int k, const double *alpha,
+                                    const double *A, int lda, const double *B,
+                                    int ldb, const double *beta, double *C,
+                                    int ldc, size_t deviceBytes,
+                                    float cpuFraction);
+
+// 8. hcblasXt<t>gemm()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// as hcblas<t>gemm() does, on every device of handle at once, for A, B and
+// C in host memory. C is cut into square blocks that are shared out among
+// the devices in proportion to their compute units, keeping the blocks of a
+// block row together where the balance allows. Each device streams the rows
+// of op(A) and the columns of op(B) its blocks need as
+// hcblas<t>gemmOutOfCore() does, overlapping the copies with the
+// multiplication, and writes its blocks back into C. Matrices are column
+// major. The call returns when C is complete.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the hcblasXt
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// lda          host             input          leading dimension of A.
+// B            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// ldb          host             input          leading dimension of B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            host             in/out         <type> array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0 or k<1
+// HCBLAS_STATUS_EXECUTION_FAILED  the buffers could not be allocated or a
+//                                 device failed to run its blocks
+
+hcblasStatus_t hcblasXtSgemm(hcblasXtHandle_t handle, hcblasOperation_t transa,
+                             hcblasOperation_t transb, int m, int n, int k,
+                             const float *alpha, const float *A, int lda,
+                             const float *B, int ldb, const float *beta,
+                             float *C, int ldc);
+
+hcblasStatus_t hcblasXtDgemm(hcblasXtHandle_t handle, hcblasOperation_t transa,
+                             hcblasOperation_t transb, int m, int n, int k,
+                             const double *alpha, const double *A, int lda,
+                             const double *B, int ldb, const double *beta,
+                             double *C, int ldc);
+
 #endif  // LIB_INCLUDE_HCBLAS_H_
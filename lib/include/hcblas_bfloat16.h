@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* bfloat16 storage type and bit exact conversions to and from float. The
+* routines are usable both on the host and inside HCC kernels so the GEMM
+* tile loads and stores share the host rounding behaviour exactly.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_BFLOAT16_H_
+#define LIB_INCLUDE_HCBLAS_BFLOAT16_H_
+
+#ifdef __HCC__
+#define __HCBLAS_BF16_DECL_SUFFIX__ [[hc, cpu]]
+#else
+#define __HCBLAS_BF16_DECL_SUFFIX__
+#endif
+
+/* bfloat16 value: the upper 16 bits of an IEEE-754 binary32 */
+struct hcBfloat16 {
+  unsigned short data;
+};
+
+/* Widen bfloat16 to float; exact for every input including NaN payloads */
+inline float hcblasBfloat16ToFloat(hcBfloat16 value)
+    __HCBLAS_BF16_DECL_SUFFIX__ {
+  union {
+    unsigned int u;
+    float f;
+  } bits;
+  bits.u = static_cast<unsigned int>(value.data) << 16;
+  return bits.f;
+}
+
+/* Narrow float to bfloat16 rounding to nearest, ties to even. Overflow
+   rounds to infinity and NaN stays a (quiet) NaN with its sign. */
+inline hcBfloat16 hcblasFloatToBfloat16(float value)
+    __HCBLAS_BF16_DECL_SUFFIX__ {
+  union {
+    unsigned int u;
+    float f;
+  } bits;
+  bits.f = value;
+  hcBfloat16 result;
+  if ((bits.u & 0x7fffffffu) > 0x7f800000u) {
+    // Truncating could clear every mantissa bit and turn NaN into infinity
+    result.data = static_cast<unsigned short>((bits.u >> 16) | 0x0040u);
+    return result;
+  }
+  bits.u += 0x7fffu + ((bits.u >> 16) & 1u);
+  result.data = static_cast<unsigned short>(bits.u >> 16);
+  return result;
+}
+
+#endif  // LIB_INCLUDE_HCBLAS_BFLOAT16_H_
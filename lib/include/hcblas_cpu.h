@@ -0,0 +1,510 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+/*
+* CPU backend of the Hcblaslibrary API. HcblasCpuLibrary overrides every
+* routine with a host implementation: level 3 routines pack their operands
+* into cache blocked panels for register blocked micro kernels, the inner
+* loops are compiled for AVX-512, AVX2 and SSE and picked at run time
+* (HCBLAS_CPU_ISA narrows the choice), and the work is spread over a work
+* stealing thread pool (hcblas_thread_pool.h). Results follow the reference
+* BLAS, so the backend also serves as an oracle for the HCC kernels.
+*
+* Operands are read and written directly by host threads, so every pointer
+* handed to a CPU handle must be host accessible: host memory, or memory of
+* an accelerator whose device path is "cpu". The accelerator view arguments
+* are ignored and every routine has finished when it returns.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_CPU_H_
+#define LIB_INCLUDE_HCBLAS_CPU_H_
+
+#include "hcblaslib.h"
+
+/* Backend a handle created on accl gets by default: the one named by
+ HCBLAS_BACKEND ( "cpu" or "hcc" ) when it is set, the CPU backend for an
+ accelerator whose device path is "cpu", HCC otherwise. */
+hcblasBackend hcblasDefaultBackend(const hc::accelerator &accl);
+
+/* Creates a handle for av running on backend, loading the kernel module
+ for the target of av first if one is needed, or NULL. */
+Hcblaslibrary *hcblasNewLibrary(hc::accelerator_view *av,
+                                hcblasBackend backend);
+
+/* Instruction set the CPU kernels were picked for: "avx512", "avx2", "sse",
+ or "generic" off x86. */
+const char *hcblasCpuIsa();
+
+/* Instruction sets the host has CPU kernels for, best first. Writes up to
+ capacity of them to isas and returns how many there are. */
+int hcblasCpuIsas(const char *isas[], int capacity);
+
+/* Switches every CPU handle to the kernels for isa, one of hcblasCpuIsas().
+ Returns false, changing nothing, if the host has no kernels for it. Meant
+ for tests that check each kernel set; no CPU routine may be running. */
+bool hcblasCpuUseIsa(const char *isa);
+
+struct HcblasCpuLibrary : public Hcblaslibrary {
+ public:
+  explicit HcblasCpuLibrary(hc::accelerator_view *av)
+      : Hcblaslibrary(av, CpuBackend) {}
+
+  /* Level 1 - cpu_level1.cpp */
+
+  hcblasStatus hcblas_saxpy(hc::accelerator_view accl_view, const int N,
+                            const float &alpha, const float *X, const int incX,
+                            float *Y, const int incY, const __int64_t xOffset,
+                            const __int64_t yOffset) override;
+
+  hcblasStatus hcblas_saxpy(
+      hc::accelerator_view accl_view, const int N, const float &alpha,
+      const float *X, const int incX, const __int64_t X_batchOffset, float *Y,
+      const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+      const __int64_t yOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_daxpy(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      const double *X, const int incX, double *Y, const int incY,
+      const __int64_t xOffset, const __int64_t yOffset) override;
+
+  hcblasStatus hcblas_daxpy(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      const double *X, const int incX, const __int64_t X_batchOffset, double *Y,
+      const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+      const __int64_t yOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
+                            const float &alpha, float *X, const int incX,
+                            const __int64_t xOffset) override;
+
+  hcblasStatus hcblas_sscal(
+      hc::accelerator_view accl_view, const int N, const float &alpha, float *X,
+      const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
+                            const double &alpha, double *X, const int incX,
+                            const __int64_t xOffset) override;
+
+  hcblasStatus hcblas_dscal(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      double *X, const int incX, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_cscal(hc::accelerator_view accl_view, const int N,
+                            const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *X, const int incX,
+                            const __int64_t xOffset) override;
+
+  hcblasStatus hcblas_cscal(
+      hc::accelerator_view accl_view, const int N,
+      const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *X,
+      const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_zscal(hc::accelerator_view accl_view, const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *X, const int incX,
+                            const __int64_t xOffset) override;
+
+  hcblasStatus hcblas_zscal(
+      hc::accelerator_view accl_view, const int N,
+      const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *X,
+      const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_csscal(hc::accelerator_view accl_view, const int N,
+                             const float &alpha, hc::short_vector::float_2 *X,
+                             const int incX, const __int64_t xOffset) override;
+
+  hcblasStatus hcblas_csscal(
+      hc::accelerator_view accl_view, const int N, const float &alpha,
+      hc::short_vector::float_2 *X, const int incX, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_zdscal(hc::accelerator_view accl_view, const int N,
+                             const double &alpha, hc::short_vector::double_2 *X,
+                             const int incX, const __int64_t xOffset) override;
+
+  hcblasStatus hcblas_zdscal(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      hc::short_vector::double_2 *X, const int incX, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_scopy(hc::accelerator_view accl_view, const int N,
+                            const float *X, const int incX,
+                            const __int64_t xOffset, float *Y, const int incY,
+                            const __int64_t yOffset) override;
+
+  hcblasStatus hcblas_scopy(
+      hc::accelerator_view accl_view, const int N, const float *X,
+      const int incX, const __int64_t xOffset, float *Y, const int incY,
+      const __int64_t yOffset, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_dcopy(hc::accelerator_view accl_view, const int N,
+                            const double *X, const int incX,
+                            const __int64_t xOffset, double *Y, const int incY,
+                            const __int64_t yOffset) override;
+
+  hcblasStatus hcblas_dcopy(
+      hc::accelerator_view accl_view, const int N, const double *X,
+      const int incX, const __int64_t xOffset, double *Y, const int incY,
+      const __int64_t yOffset, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_sdot(
+      hc::accelerator_view accl_view, const int N, const float *X,
+      const int incX, const __int64_t xOffset, const float *Y, const int incY,
+      const __int64_t yOffset, float &dot) override;
+
+  hcblasStatus hcblas_sdot(
+      hc::accelerator_view accl_view, const int N, const float *X,
+      const int incX, const __int64_t xOffset, const float *Y, const int incY,
+      const __int64_t yOffset, float &dot, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_ddot(
+      hc::accelerator_view accl_view, const int N, const double *X,
+      const int incX, const __int64_t xOffset, const double *Y, const int incY,
+      const __int64_t yOffset, double &dot) override;
+
+  hcblasStatus hcblas_ddot(
+      hc::accelerator_view accl_view, const int N, const double *X,
+      const int incX, const __int64_t xOffset, const double *Y, const int incY,
+      const __int64_t yOffset, double &dot, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize) override;
+
+  hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
+                            float *X, const int incX, const __int64_t xOffset,
+                            float *Y) override;
+
+  hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
+                            float *X, const int incX, const __int64_t xOffset,
+                            float *Y, const __int64_t X_batchOffset,
+                            const int batchSize) override;
+
+  hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
+                            double *X, const int incX, const __int64_t xOffset,
+                            double *Y) override;
+
+  hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
+                            double *X, const int incX, const __int64_t xOffset,
+                            double *Y, const __int64_t X_batchOffset,
+                            const int batchSize) override;
+
+  /* Level 2 - cpu_level2.cpp */
+
+  hcblasStatus hcblas_sger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const int incX, const float *Y, const __int64_t yOffset, const int incY,
+      float *A, const __int64_t aOffset, const int lda) override;
+
+  hcblasStatus hcblas_sger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int incX, const float *Y,
+      const __int64_t yOffset, const __int64_t Y_batchOffset, const int incY,
+      float *A, const __int64_t aOffset, const __int64_t A_batchOffset,
+      const int lda, const int batchSize) override;
+
+  hcblasStatus hcblas_dger(hc::accelerator_view accl_view, hcblasOrder order,
+                           const int M, const int N, const double &alpha,
+                           const double *X, const __int64_t xOffset,
+                           const int incX, const double *Y,
+                           const __int64_t yOffset, const int incY, double *A,
+                           const __int64_t aOffset, const int lda) override;
+
+  hcblasStatus hcblas_dger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const double &alpha, const double *X,
+      const __int64_t xOffset, const __int64_t X_batchOffset, const int incX,
+      const double *Y, const __int64_t yOffset, const __int64_t Y_batchOffset,
+      const int incY, double *A, const __int64_t aOffset,
+      const __int64_t A_batchOffset, const int lda,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_sgemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const float &alpha, float *A,
+      const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+      const int incX, const float &beta, float *Y, const __int64_t yOffset,
+      const int incY) override;
+
+  hcblasStatus hcblas_sgemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const float &alpha, float *A,
+      const __int64_t aOffset, const __int64_t A_batchOffset, const int lda,
+      float *X, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int incX, const float &beta, float *Y, const __int64_t yOffset,
+      const __int64_t Y_batchOffset, const int incY,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_dgemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const double &alpha, double *A,
+      const __int64_t aOffset, const int lda, double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  hcblasStatus hcblas_dgemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const double &alpha, double *A,
+      const __int64_t aOffset, const __int64_t A_batchOffset, const int lda,
+      double *X, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int incX, const double &beta, double *Y, const __int64_t yOffset,
+      const __int64_t Y_batchOffset, const int incY,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_ssymv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const float &alpha, const float *A, const __int64_t aOffset,
+      const int lda, const float *X, const __int64_t xOffset, const int incX,
+      const float &beta, float *Y, const __int64_t yOffset,
+      const int incY) override;
+
+  hcblasStatus hcblas_dsymv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const double &alpha, const double *A,
+      const __int64_t aOffset, const int lda, const double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  hcblasStatus hcblas_chemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const hc::short_vector::float_2 &alpha,
+      const hc::short_vector::float_2 *A, const __int64_t aOffset,
+      const int lda, const hc::short_vector::float_2 *X,
+      const __int64_t xOffset, const int incX,
+      const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  hcblasStatus hcblas_strmv(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose type,
+                            hcblasDiag diag, const int N, const float *A,
+                            const __int64_t aOffset, const int lda, float *X,
+                            const __int64_t xOffset, const int incX) override;
+
+  hcblasStatus hcblas_dtrmv(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose type,
+                            hcblasDiag diag, const int N, const double *A,
+                            const __int64_t aOffset, const int lda, double *X,
+                            const __int64_t xOffset, const int incX) override;
+
+  hcblasStatus hcblas_strsv(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose type,
+                            hcblasDiag diag, const int N, const float *A,
+                            const __int64_t aOffset, const int lda, float *X,
+                            const __int64_t xOffset, const int incX) override;
+
+  hcblasStatus hcblas_dtrsv(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose type,
+                            hcblasDiag diag, const int N, const double *A,
+                            const __int64_t aOffset, const int lda, double *X,
+                            const __int64_t xOffset, const int incX) override;
+
+  hcblasStatus hcblas_ssyr(hc::accelerator_view accl_view, hcblasOrder order,
+                           hcblasUplo uplo, const int N, const float &alpha,
+                           const float *X, const __int64_t xOffset,
+                           const int incX, float *A, const __int64_t aOffset,
+                           const int lda) override;
+
+  hcblasStatus hcblas_dsyr(hc::accelerator_view accl_view, hcblasOrder order,
+                           hcblasUplo uplo, const int N, const double &alpha,
+                           const double *X, const __int64_t xOffset,
+                           const int incX, double *A, const __int64_t aOffset,
+                           const int lda) override;
+
+  hcblasStatus hcblas_ssyr2(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const int incX, const float *Y, const __int64_t yOffset, const int incY,
+      float *A, const __int64_t aOffset, const int lda) override;
+
+  hcblasStatus hcblas_dsyr2(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, const int N, const double &alpha,
+                            const double *X, const __int64_t xOffset,
+                            const int incX, const double *Y,
+                            const __int64_t yOffset, const int incY, double *A,
+                            const __int64_t aOffset, const int lda) override;
+
+  hcblasStatus hcblas_sgbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const int KL, const int KU, const float &alpha,
+      const float *A, const __int64_t aOffset, const int lda, const float *X,
+      const __int64_t xOffset, const int incX, const float &beta, float *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  hcblasStatus hcblas_dgbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const int KL, const int KU, const double &alpha,
+      const double *A, const __int64_t aOffset, const int lda, const double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  hcblasStatus hcblas_ssbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const int K, const float &alpha, const float *A,
+      const __int64_t aOffset, const int lda, const float *X,
+      const __int64_t xOffset, const int incX, const float &beta, float *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  hcblasStatus hcblas_dsbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const int K, const double &alpha, const double *A,
+      const __int64_t aOffset, const int lda, const double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY) override;
+
+  /* Level 3 - cpu_level3.cpp */
+
+  hcblasStatus hcblas_sgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const float &alpha, float *A, const __int64_t lda, float *B,
+      const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+      const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset) override;
+
+  hcblasStatus hcblas_dgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const double &alpha, double *A, const __int64_t lda, double *B,
+      const __int64_t ldb, const double &beta, double *C, const __int64_t ldc,
+      const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset) override;
+
+  hcblasStatus hcblas_hgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::half &alpha, hc::half *A, const __int64_t lda, hc::half *B,
+      const __int64_t ldb, const hc::half &beta, hc::half *C,
+      const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset) override;
+
+  hcblasStatus hcblas_sgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const float &alpha, float *A[], const __int64_t lda,
+      const __int64_t A_batchOffset, float *B[], const __int64_t ldb,
+      const __int64_t B_batchOffset, const float &beta, float *C[],
+      const __int64_t ldc, const __int64_t C_batchOffset,
+      const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_sgemm_grouped(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int *M, const int *N, const int *K,
+      const float &alpha, const float *const A[], const int *lda,
+      const float *const B[], const int *ldb, const float &beta,
+      float *const C[], const int *ldc, const int groupCount) override;
+
+  hcblasStatus hcblas_dgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const double &alpha, double *A[], const __int64_t lda,
+      const __int64_t A_batchOffset, double *B[], const __int64_t ldb,
+      const __int64_t B_batchOffset, const double &beta, double *C[],
+      const __int64_t ldc, const __int64_t C_batchOffset,
+      const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_cgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+      const __int64_t aOffset, const __int64_t lda,
+      hc::short_vector::float_2 *B, const __int64_t bOffset,
+      const __int64_t ldb, const hc::short_vector::float_2 &beta,
+      hc::short_vector::float_2 *C, const __int64_t cOffset,
+      const __int64_t ldc) override;
+
+  hcblasStatus hcblas_zgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+      const __int64_t aOffset, const __int64_t lda,
+      hc::short_vector::double_2 *B, const __int64_t bOffset,
+      const __int64_t ldb, const hc::short_vector::double_2 &beta,
+      hc::short_vector::double_2 *C, const __int64_t cOffset,
+      const __int64_t ldc) override;
+
+  hcblasStatus hcblas_cgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
+      const __int64_t aOffset, const __int64_t A_batchOffset,
+      const __int64_t lda, hc::short_vector::float_2 *B[],
+      const __int64_t bOffset, const __int64_t B_batchOffset,
+      const __int64_t ldb, const hc::short_vector::float_2 &beta,
+      hc::short_vector::float_2 *C[], const __int64_t cOffset,
+      const __int64_t C_batchOffset, const __int64_t ldc,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_zgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+      const __int64_t aOffset, const __int64_t A_batchOffset,
+      const __int64_t lda, hc::short_vector::double_2 *B[],
+      const __int64_t bOffset, const __int64_t B_batchOffset,
+      const __int64_t ldb, const hc::short_vector::double_2 &beta,
+      hc::short_vector::double_2 *C[], const __int64_t cOffset,
+      const __int64_t C_batchOffset, const __int64_t ldc,
+      const int batchSize) override;
+
+  hcblasStatus hcblas_gemmex(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const void *alpha, const void *A, hcblasDatatype Atype,
+      const __int64_t aOffset, const __int64_t lda, const void *B,
+      hcblasDatatype Btype, const __int64_t bOffset, const __int64_t ldb,
+      const void *beta, void *C, hcblasDatatype Ctype, const __int64_t cOffset,
+      const __int64_t ldc, hcblasDatatype computeType,
+      const hcblasEpilogue *epilogue = NULL) override;
+
+  bool hcblas_gemmex_supported(hcblasDatatype Atype, hcblasDatatype Btype,
+                               hcblasDatatype Ctype, hcblasDatatype computeType,
+                               bool epilogue = false) override;
+
+  hcblasStatus hcblas_igemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const int &alpha, const signed char *A, const __int64_t lda,
+      const signed char *B, const __int64_t ldb, const int &beta, int *C,
+      const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset) override;
+
+  hcblasStatus hcblas_igemm_requant(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const signed char *A, const __int64_t lda, const signed char *B,
+      const __int64_t ldb, signed char *C, const __int64_t ldc,
+      hcblasQuantAxis axis, const float *scale, const int *zeroPoint,
+      const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset) override;
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_CPU_H_
@@ -0,0 +1,204 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Per-handle cache of kernel decisions. Workloads issue the same GEMM shape
+* over and over, and picking its kernel walks the selector ladders every
+* time. The cache maps the call signature (precision, device, order,
+* transposes, sizes, leading dimensions and operand alignment) to the
+* launcher the selectors resolved, so a repeated call skips them.
+*
+* Lookups and inserts never lock or wait. Each slot carries a sequence
+* number that is odd while the slot is written: readers that see it odd or
+* changed treat the slot as a miss, and a writer that finds the slot busy
+* drops its insert. Like a hardware cache it has a fixed size and evicts
+* on collision. Nothing here depends on HCC.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_DECISION_CACHE_H_
+#define LIB_INCLUDE_HCBLAS_DECISION_CACHE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#define HCBLAS_DECISION_KEY_WORDS 6
+
+/* Call signature a decision depends on, packed into words */
+struct hcblasDecisionKey {
+  uint64_t word[HCBLAS_DECISION_KEY_WORDS];
+
+  size_t hash() const {
+    uint64_t h = 0x9e3779b97f4a7c15ull;
+    for (int w = 0; w < HCBLAS_DECISION_KEY_WORDS; w++) {
+      h = (h ^ word[w]) * 0xbf58476d1ce4e5b9ull;
+      h ^= h >> 31;
+    }
+    return static_cast<size_t>(h);
+  }
+};
+
+/* Alignment bits of one GEMM operand: bit 0 is set if its first element
+ is 16 byte aligned, bit 1 if every column (row) starts 16 byte aligned
+ too. Vector loads need both. */
+inline unsigned hcblasOperandAlignment(const void *base, int64_t offset,
+                                       int64_t ld, size_t elementBytes) {
+  uintptr_t first = reinterpret_cast<uintptr_t>(base) + offset * elementBytes;
+  unsigned bits = (first % 16 == 0) ? 1u : 0u;
+  if ((ld * elementBytes) % 16 == 0) {
+    bits |= bits << 1;
+  }
+  return bits;
+}
+
+/* All three operands allow 16 byte vector loads and stores */
+#define HCBLAS_GEMM_VECTOR_ALIGNED 0x3f
+
+/* hcblasOperandAlignment bits of A, B and C in bits 0-1, 2-3 and 4-5 */
+inline unsigned hcblasGemmAlignment(const void *A, int64_t aOffset,
+                                    int64_t lda, const void *B,
+                                    int64_t bOffset, int64_t ldb,
+                                    const void *C, int64_t cOffset,
+                                    int64_t ldc, size_t elementBytes) {
+  return hcblasOperandAlignment(A, aOffset, lda, elementBytes) |
+         hcblasOperandAlignment(B, bOffset, ldb, elementBytes) << 2 |
+         hcblasOperandAlignment(C, cOffset, ldc, elementBytes) << 4;
+}
+
+/* Key of a GEMM call. precision is an hcblasDatatype, device the
+ accelerator's seqnum, order and transposes as the routines take them, and
+ alignment the hcblasGemmAlignment bits. alphaZero: alpha == 0 selects a
+ kernel of its own. */
+inline hcblasDecisionKey hcblasGemmKey(int precision, int device, int order,
+                                       int transA, int transB, bool alphaZero,
+                                       int M, int N, int K, int64_t lda,
+                                       int64_t ldb, int64_t ldc,
+                                       unsigned alignment) {
+  hcblasDecisionKey key;
+  key.word[0] = static_cast<uint64_t>(precision & 0xff) |
+                static_cast<uint64_t>(order & 0xff) << 8 |
+                static_cast<uint64_t>(transA & 0xff) << 16 |
+                static_cast<uint64_t>(transB & 0xff) << 24 |
+                static_cast<uint64_t>(alphaZero) << 32 |
+                static_cast<uint64_t>(alignment & 0x3f) << 33 |
+                static_cast<uint64_t>(device & 0xffff) << 40;
+  key.word[1] = static_cast<uint64_t>(static_cast<uint32_t>(M)) << 32 |
+                static_cast<uint32_t>(N);
+  key.word[2] = static_cast<uint32_t>(K);
+  key.word[3] = static_cast<uint64_t>(lda);
+  key.word[4] = static_cast<uint64_t>(ldb);
+  key.word[5] = static_cast<uint64_t>(ldc);
+  return key;
+}
+
+/* N slots (a power of two) mapping keys to values of type V, which must be
+ trivially copyable, e.g. a function pointer. A key is looked for in
+ kProbes consecutive slots from its hash. */
+template <typename V, size_t N>
+class hcblasDecisionCache {
+ public:
+  hcblasDecisionCache() : hitCount(0), missCount(0) {
+    for (size_t s = 0; s < N; s++) {
+      slots[s].sequence.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /* Sets *value and counts a hit if key is cached, else counts a miss */
+  bool find(const hcblasDecisionKey &key, V *value) {
+    size_t home = key.hash();
+    for (size_t p = 0; p < kProbes; p++) {
+      const Slot &slot = slots[(home + p) & (N - 1)];
+      unsigned before = slot.sequence.load(std::memory_order_acquire);
+      // Never written, or being written now
+      if (before == 0 || (before & 1)) {
+        continue;
+      }
+      bool match = true;
+      for (int w = 0; w < HCBLAS_DECISION_KEY_WORDS && match; w++) {
+        match = slot.key[w].load(std::memory_order_relaxed) == key.word[w];
+      }
+      V found = slot.value.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (match && slot.sequence.load(std::memory_order_relaxed) == before) {
+        *value = found;
+        hitCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    missCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  /* Caches value for key in the first free slot it probes, else in its
+   home slot. Dropped if that slot is being written by another thread. */
+  void insert(const hcblasDecisionKey &key, V value) {
+    size_t home = key.hash();
+    Slot *slot = &slots[home & (N - 1)];
+    for (size_t p = 0; p < kProbes; p++) {
+      Slot &probe = slots[(home + p) & (N - 1)];
+      if (probe.sequence.load(std::memory_order_relaxed) == 0) {
+        slot = &probe;
+        break;
+      }
+    }
+    unsigned before = slot->sequence.load(std::memory_order_relaxed);
+    if ((before & 1) ||
+        !slot->sequence.compare_exchange_strong(before, before + 1,
+                                                std::memory_order_relaxed)) {
+      return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int w = 0; w < HCBLAS_DECISION_KEY_WORDS; w++) {
+      slot->key[w].store(key.word[w], std::memory_order_relaxed);
+    }
+    slot->value.store(value, std::memory_order_relaxed);
+    slot->sequence.store(before + 2, std::memory_order_release);
+  }
+
+  unsigned long long hits() const {
+    return hitCount.load(std::memory_order_relaxed);
+  }
+
+  unsigned long long misses() const {
+    return missCount.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static const size_t kProbes = 4;
+
+  struct Slot {
+    // Odd while the slot is written, 0 until it first is
+    std::atomic<unsigned> sequence;
+    std::atomic<uint64_t> key[HCBLAS_DECISION_KEY_WORDS];
+    std::atomic<V> value;
+  };
+
+  Slot slots[N];
+  std::atomic<unsigned long long> hitCount;
+  std::atomic<unsigned long long> missCount;
+
+  hcblasDecisionCache(const hcblasDecisionCache &);
+  hcblasDecisionCache &operator=(const hcblasDecisionCache &);
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_DECISION_CACHE_H_
@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Device properties and an occupancy model for launch decisions.
+* hcblasDeviceProps is filled once per accelerator from what the runtime
+* reports; everything else in this header is a pure function of it, so
+* launch decisions can be checked against any GPU profile on the CPU.
+*
+* Dispatchers consult it wherever the number of work groups is a free
+* choice: the split-K partition, the launch counts of the level 1
+* reductions (sdot, ddot, sasum, dasum), the sdot second pass, and the
+* grouped and tiny batched SGEMM kernels, whose groups loop over the work
+* so that no more of them are launched than the device holds. The tuned
+* GEMM, batched GEMM and level 2 kernels give every output tile or row a
+* work group of its own; their grids follow from the problem shape.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_DEVICE_H_
+#define LIB_INCLUDE_HCBLAS_DEVICE_H_
+
+#include <cstddef>
+
+struct hcblasDeviceProps {
+  int computeUnits;
+  int wavefrontSize;
+  int simdsPerCU;
+  int maxWavesPerSimd;
+  // Vector registers available to one lane of a SIMD
+  int vgprsPerSimd;
+  int maxGroupsPerCU;
+  size_t ldsBytesPerCU;
+  size_t maxLdsPerGroup;
+  // Peak clocks in MHz, 0 when the runtime does not report them
+  int coreClockMHz;
+  int memoryClockMHz;
+};
+
+/* What one work group of a kernel needs. vgprs is the per lane register
+ count, 0 if unknown. */
+struct hcblasKernelResources {
+  int groupSize;
+  size_t ldsBytes;
+  int vgprs;
+};
+
+/* The profile the kernels were originally tuned against: 40 compute units
+ of a GCN part with 64 wide wavefronts and 64KB of LDS */
+hcblasDeviceProps hcblasDefaultDeviceProps();
+
+/* Work groups of the kernel one compute unit can hold at once, limited by
+ wave slots, registers, LDS and the per CU group limit. 0 if the kernel
+ cannot be launched on the device at all. */
+int hcblasGroupsPerCU(const hcblasDeviceProps &props,
+                      const hcblasKernelResources &kernel);
+
+/* Work groups of the kernel the whole device holds at once */
+long long hcblasResidentGroups(const hcblasDeviceProps &props,
+                               const hcblasKernelResources &kernel);
+
+/* Work groups per batch to launch for a kernel whose groups stride over
+ their work, when each of batches independent batches has work for groups
+ of them: all of them if the device holds them at once, else an equal
+ share of what it holds, but never less than one */
+long long hcblasGridGroups(const hcblasDeviceProps &props,
+                           const hcblasKernelResources &kernel,
+                           long long groups, long long batches);
+
+#endif  // LIB_INCLUDE_HCBLAS_DEVICE_H_
@@ -0,0 +1,74 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Ragged edges for the tiled GEMM kernels. The fastest SGEMM kernels cover
+* C in whole 64x64 or 128x128 tiles and K in whole 16 deep steps, without
+* bounds checks. For other shapes the product is cut into the largest
+* tile aligned interior, which those kernels run, and up to three
+* remainder blocks (a K tail, a strip of rows and a strip of columns) that
+* a bounds checked kernel runs. Nothing here depends on HCC.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_EDGE_H_
+#define LIB_INCLUDE_HCBLAS_EDGE_H_
+
+/* The interior must be at least this many tiles wide in M and N ... */
+#define HCBLAS_EDGE_MIN_TILES 4
+
+/* ... and hold at least this share, in percent, of the multiply-adds */
+#define HCBLAS_EDGE_MIN_INTERIOR 75
+
+#define HCBLAS_EDGE_MAX_BLOCKS 4
+
+/* Tile aligned interior [0, M0) x [0, N0) x [0, K0) of an M x N x K
+ product; all zero when the edge path does not pay off. */
+struct hcblasEdgeSplit {
+  int M0;
+  int N0;
+  int K0;
+};
+
+/* Block of C rows [row, row + rows) and columns [col, col + cols), summed
+ over K steps [k, k + depth). An accumulate block adds its product to C
+ (beta = 1) instead of scaling C by beta. */
+struct hcblasEdgeBlock {
+  int row;
+  int col;
+  int k;
+  int rows;
+  int cols;
+  int depth;
+  bool accumulate;
+};
+
+/* Interior for output tiles of tile x tile elements and K steps of kUnit */
+hcblasEdgeSplit hcblasEdgePartition(int M, int N, int K, int tile, int kUnit);
+
+/* Fills blocks with the interior of split followed by the remainder blocks
+ of an M x N x K product, in the order they must run; returns how many.
+ Every element of C is covered by exactly one non accumulating block. */
+int hcblasEdgeBlocks(int M, int N, int K, hcblasEdgeSplit split,
+                     hcblasEdgeBlock blocks[HCBLAS_EDGE_MAX_BLOCKS]);
+
+#endif  // LIB_INCLUDE_HCBLAS_EDGE_H_
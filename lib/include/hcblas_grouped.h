@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Host side tile scheduler for grouped GEMM. A group is a list of independent
+* GEMM problems, each with its own M, N and K. The scheduler cuts every C
+* into blocks of tileM x tileN and numbers the blocks of all problems in one
+* flat index space, so a single launch with one work group per block covers
+* the whole group. Problems are issued most expensive first, which lets the
+* long running blocks start early and the cheap ones fill in behind them.
+* Nothing here depends on HCC, so the schedule can be built and checked on
+* the CPU.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_GROUPED_H_
+#define LIB_INCLUDE_HCBLAS_GROUPED_H_
+
+#include <vector>
+
+/* The blocks of one problem: tiles [firstTile, firstTile + tilesM * tilesN)
+ of the flat index space. Block t of the range sits at block row
+ t % tilesM and block column t / tilesM of C. */
+struct hcblasGroupedRange {
+  int problem;
+  int tilesM;
+  int tilesN;
+  long long firstTile;
+  long long cost;
+};
+
+class hcblasGroupedSchedule {
+ public:
+  hcblasGroupedSchedule(int tileM, int tileN);
+
+  /* Builds the schedule for groupCount problems. Problems with M or N equal
+   to zero own no blocks and are left out. Returns false, leaving the
+   schedule empty, if a dimension is negative or the tile sizes are not
+   positive. The result depends only on the arguments: ties in cost are
+   broken by problem index. */
+  bool build(const int *M, const int *N, const int *K, int groupCount);
+
+  long long tileCount() const { return total; }
+  const std::vector<hcblasGroupedRange> &ranges() const { return order; }
+
+  /* Maps a flat tile index to its problem and block coordinates. Returns
+   false if tile is outside [0, tileCount()). */
+  bool locate(long long tile, int *problem, int *tileRow,
+              int *tileCol) const;
+
+ private:
+  int tileM;
+  int tileN;
+  long long total;
+  std::vector<hcblasGroupedRange> order;
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_GROUPED_H_
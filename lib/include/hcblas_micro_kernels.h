@@ -0,0 +1,118 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Bounds checked MICRO_NBK GEMM kernels for any M, N and K. One template,
+* gemm_MICRO_NBK_M_N_K_TS16, covers every element type, transpose and micro
+* tile size. Each variant a selector can pick is explicitly instantiated in
+* a translation unit of its own under <routine>/variants/, so a lean build
+* (HCBLAS_LEAN_KERNELS) compiles only those its selection table names. The
+* definition is in hcblas_micro_kernels_impl.h, included only by those
+* translation units.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_MICRO_KERNELS_H_
+#define LIB_INCLUDE_HCBLAS_MICRO_KERNELS_H_
+
+#include <hc.hpp>
+#include <cstddef>
+#include "include/hcblaslib.h"
+
+template <typename T, bool transA, bool transB, int MTILE>
+hcblasStatus gemm_MICRO_NBK_M_N_K_TS16(hc::accelerator_view accl_view,
+                                       const T *A, __int64_t aOffset,
+                                       const T *B, __int64_t bOffset, T *C,
+                                       __int64_t cOffset, int M, int N, int K,
+                                       int lda, int ldb, int ldc, T alpha,
+                                       T beta);
+
+/* Pointer to a gemm_MICRO_NBK_M_N_K_TS16 variant of element type T */
+template <typename T>
+struct hcblasMicroKernel {
+  typedef hcblasStatus (*type)(hc::accelerator_view accl_view, const T *A,
+                               __int64_t aOffset, const T *B,
+                               __int64_t bOffset, T *C, __int64_t cOffset,
+                               int M, int N, int K, int lda, int ldb, int ldc,
+                               T alpha, T beta);
+};
+
+/* Built variant of gemm_MICRO_NBK_M_N_K_TS16 for the transposes and micro
+ tile size. A variant left out of a lean build resolves to the TS16XMTS2
+ kernel of the same transposes, which is always built. Specialised for each
+ element type by the routine's variant table. */
+template <typename T>
+typename hcblasMicroKernel<T>::type gemm_MICRO_NBK_M_N_K_variant(bool transA,
+                                                                bool transB,
+                                                                int MTILE);
+
+/* Entry of a variant table: the kernel, NULL when a lean build left it out,
+ and its name as the HCBLAS_LAYER trace prints it */
+template <typename T>
+struct hcblasMicroVariant {
+  bool transA;
+  bool transB;
+  int MTILE;
+  typename hcblasMicroKernel<T>::type kernel;
+  const char *name;
+};
+
+#define HCBLAS_MICRO_VARIANT(T, transA, transB, MTILE, name)         \
+  {                                                                   \
+    transA, transB, MTILE,                                            \
+        gemm_MICRO_NBK_M_N_K_TS16<T, transA, transB, MTILE>, #name    \
+  }
+#define HCBLAS_MICRO_VARIANT_OMITTED(transA, transB, MTILE, name) \
+  { transA, transB, MTILE, NULL, #name }
+
+template <typename T, size_t count>
+typename hcblasMicroKernel<T>::type hcblasMicroVariantFind(
+    const hcblasMicroVariant<T> (&table)[count], bool transA, bool transB,
+    int MTILE) {
+  typename hcblasMicroKernel<T>::type fallback = NULL;
+  for (const hcblasMicroVariant<T> &entry : table) {
+    if (entry.transA != transA || entry.transB != transB) {
+      continue;
+    }
+    if (entry.MTILE == MTILE && entry.kernel) {
+      return entry.kernel;
+    }
+    if (entry.MTILE == 2) {
+      fallback = entry.kernel;
+    }
+  }
+  return fallback;
+}
+
+template <typename T, size_t count>
+const char *hcblasMicroVariantName(
+    const hcblasMicroVariant<T> (&table)[count],
+    typename hcblasMicroKernel<T>::type kernel) {
+  for (const hcblasMicroVariant<T> &entry : table) {
+    if (entry.kernel && entry.kernel == kernel) {
+      return entry.name;
+    }
+  }
+  return NULL;
+}
+
+#endif  // LIB_INCLUDE_HCBLAS_MICRO_KERNELS_H_
@@ -0,0 +1,148 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef LIB_INCLUDE_HCBLAS_MICRO_KERNELS_IMPL_H_
+#define LIB_INCLUDE_HCBLAS_MICRO_KERNELS_IMPL_H_
+
+#include "include/hcblas_micro_kernels.h"
+
+/* Definition of gemm_MICRO_NBK_M_N_K_TS16, included only by the variants/
+ translation units that instantiate it.
+
+ A MNK_TILESIZE x MNK_TILESIZE work group computes an MNK_BLOCK(MTILE) square
+ block of C, each work item an MTILE x MTILE micro tile strided by MNK_TILESIZE.
+ Both operands are staged K major in local memory with rows padded by one
+ element against bank conflicts; blocks on the edge of C or of K are zero
+ filled. */
+
+#define MNK_TILESIZE 16
+#define MNK_BLOCK(MTILE) (MNK_TILESIZE * (MTILE))
+#define MNK_BANK(MTILE) (MNK_BLOCK(MTILE) + 1)
+
+template <typename T, bool transA, bool transB, int MTILE>
+hcblasStatus gemm_MICRO_NBK_M_N_K_TS16(hc::accelerator_view accl_view,
+                                       const T *A, __int64_t aOffset,
+                                       const T *B, __int64_t bOffset, T *C,
+                                       __int64_t cOffset, int M, int N, int K,
+                                       int lda, int ldb, int ldc, T alpha,
+                                       T beta) {
+  int M_ = (M - 1) / MTILE + 1;
+  int N_ = (N - 1) / MTILE + 1;
+  int N_R = (N_ + (MNK_TILESIZE - 1)) & ~(MNK_TILESIZE - 1);
+  int M_R = (M_ + (MNK_TILESIZE - 1)) & ~(MNK_TILESIZE - 1);
+  int K_R = (K + (MNK_TILESIZE - 1)) & ~(MNK_TILESIZE - 1);
+  // Strides of A along M and K, and of B along N and K
+  __int64_t aStrideM = transA ? lda : 1;
+  __int64_t aStrideK = transA ? 1 : lda;
+  __int64_t bStrideN = transB ? 1 : ldb;
+  __int64_t bStrideK = transB ? ldb : 1;
+  hc::extent<2> grdExt(N_R, M_R);
+  hc::tiled_extent<2> t_ext = grdExt.tile(MNK_TILESIZE, MNK_TILESIZE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
+    T rC[MTILE][MTILE] = {{static_cast<T>(0)}};
+    T rA[MTILE];
+    T rB[MTILE];
+    tile_static T lA[MNK_TILESIZE * MNK_BANK(MTILE)];
+    tile_static T lB[MNK_TILESIZE * MNK_BANK(MTILE)];
+    int gidx = tidx.tile[1];
+    int gidy = tidx.tile[0];
+    int idx = tidx.local[1];
+    int idy = tidx.local[0];
+    // Neighbouring work items read neighbouring elements: along M (N) for
+    // an operand stored that way, along K for one stored transposed
+    int am = transA ? idy : idx;
+    int ak = transA ? idx : idy;
+    int bn = transB ? idx : idy;
+    int bk = transB ? idy : idx;
+    int alIndex = ak * MNK_BANK(MTILE) + am;
+    int blIndex = bk * MNK_BANK(MTILE) + bn;
+    int mBase = gidx * MNK_BLOCK(MTILE);
+    int nBase = gidy * MNK_BLOCK(MTILE);
+    int M_block = M_R / MNK_TILESIZE;
+    int N_block = N_R / MNK_TILESIZE;
+    int K_block = K_R / MNK_TILESIZE;
+    bool edge = gidx == M_block - 1 || gidy == N_block - 1;
+
+    for (int block_k = 0; block_k < K_block; ++block_k) {
+      int kBase = block_k * MNK_TILESIZE;
+      tidx.barrier.wait();
+
+      if (edge || block_k == K_block - 1) {
+        for (int sec = 0; sec < MTILE; ++sec) {
+          int secVal = sec * MNK_TILESIZE;
+          int m = mBase + am + secVal;
+          int n = nBase + bn + secVal;
+          lA[alIndex + secVal] =
+              (m < M && kBase + ak < K)
+                  ? A[aOffset + m * aStrideM + (kBase + ak) * aStrideK]
+                  : static_cast<T>(0);
+          lB[blIndex + secVal] =
+              (n < N && kBase + bk < K)
+                  ? B[bOffset + n * bStrideN + (kBase + bk) * bStrideK]
+                  : static_cast<T>(0);
+        }
+      } else {
+        for (int sec = 0; sec < MTILE; ++sec) {
+          int secVal = sec * MNK_TILESIZE;
+          lA[alIndex + secVal] = A[aOffset + (mBase + am + secVal) * aStrideM +
+                                   (kBase + ak) * aStrideK];
+          lB[blIndex + secVal] = B[bOffset + (nBase + bn + secVal) * bStrideN +
+                                   (kBase + bk) * bStrideK];
+        }
+      }
+
+      tidx.barrier.wait();
+
+      int offA = idx;
+      int offB = idy;
+
+      for (int iter = 0; iter < MNK_TILESIZE; ++iter) {
+        for (int i = 0; i < MTILE; ++i) {
+          rA[i] = lA[offA + i * MNK_TILESIZE];
+          rB[i] = lB[offB + i * MNK_TILESIZE];
+        }
+        offA += MNK_BANK(MTILE);
+        offB += MNK_BANK(MTILE);
+        for (int j = 0; j < MTILE; ++j) {
+          for (int i = 0; i < MTILE; ++i) {
+            rC[i][j] += rA[i] * rB[j];
+          }
+        }
+      }
+    }
+
+    for (int i = 0; i < MTILE; ++i) {
+      for (int j = 0; j < MTILE; ++j) {
+        int m = mBase + idx + i * MNK_TILESIZE;
+        int n = nBase + idy + j * MNK_TILESIZE;
+        if (!edge || (m < M && n < N)) {
+          __int64_t cIndex = cOffset + m + n * static_cast<__int64_t>(ldc);
+          C[cIndex] = alpha * rC[i][j] + beta * C[cIndex];
+        }
+      }
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+#endif  // LIB_INCLUDE_HCBLAS_MICRO_KERNELS_IMPL_H_
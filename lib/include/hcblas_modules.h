@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Routine modules. With HCBLAS_ROUTINE_MODULES (cmake/HcblasModules.cmake)
+* the GEMM routines are not linked into the library: each routine in each
+* precision is a module of its own, libhcblas-<routine>.so in the module
+* directory (hcblasModuleDirectory()), opened the first time the routine
+* runs or when hcblasWarmup() asks for it. Creating a handle or calling
+* any other routine then reads none of their kernels. The library keeps a
+* stub per routine that loads the module and calls through the table of
+* entry points the module exports. Nothing here depends on HCC, so the
+* loading logic can be checked on the CPU.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_MODULES_H_
+#define LIB_INCLUDE_HCBLAS_MODULES_H_
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+/* Routines that can be built as modules, in the bit order of
+ hcblasRoutine_t */
+enum hcblasModuleRoutine {
+  ModuleSgemm,
+  ModuleDgemm,
+  ModuleHgemm,
+  ModuleCgemm,
+  ModuleZgemm,
+  ModuleRoutines
+};
+
+/* Name of routine in its module file and entry table, e.g. "sgemm" */
+const char *hcblasModuleRoutineName(hcblasModuleRoutine routine);
+
+/* File of the module of routine in directory */
+std::string hcblasRoutineModuleFile(const std::string &directory,
+                                    hcblasModuleRoutine routine);
+
+class hcblasModuleRegistry {
+ public:
+  /* Opens the module of routine and returns its entry table, NULL if it
+   cannot */
+  typedef const void *(*Loader)(hcblasModuleRoutine routine);
+  /* Told how long each module took to load */
+  typedef void (*Reporter)(hcblasModuleRoutine routine, double milliseconds);
+
+  // modules has bit 1 << r set for each routine r built as a module
+  hcblasModuleRegistry(unsigned modules, Loader loader,
+                       Reporter reporter = NULL);
+
+  bool isModule(hcblasModuleRoutine routine) const {
+    return (modules >> routine) & 1u;
+  }
+
+  /* Entry table of routine, loading its module on the first call. NULL if
+   the routine is built in or its module failed to load; a failed load is
+   not retried. Once loaded the lookup takes no lock. */
+  const void *entries(hcblasModuleRoutine routine);
+
+  /* Time the module of routine took to load: 0 if the routine is built in,
+   negative if the module is not loaded (yet, or it failed to). */
+  double loadMilliseconds(hcblasModuleRoutine routine) const;
+
+ private:
+  enum State { Unloaded, Loaded, Failed };
+
+  struct Slot {
+    // Published last: table and milliseconds are set once it is Loaded
+    std::atomic<int> state;
+    const void *table;
+    double milliseconds;
+  };
+
+  const unsigned modules;
+  Loader loader;
+  Reporter reporter;
+  Slot slots[ModuleRoutines];
+  // Serialises loads, so every module is opened once
+  std::mutex lock;
+
+  hcblasModuleRegistry(const hcblasModuleRegistry &);
+  hcblasModuleRegistry &operator=(const hcblasModuleRegistry &);
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_MODULES_H_
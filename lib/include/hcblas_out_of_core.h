@@ -0,0 +1,143 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Host side engine of the out-of-core GEMM, for operands that stay in host
+* memory because they need not fit on the device. C is cut into tiles and
+* each tile is computed in K deep steps: the panels of op(A) and op(B) for
+* a step are brought into one of two buffer slots while the previous step
+* is multiplied out of the other, so copies overlap the arithmetic and the
+* device only ever holds two slots and one tile of C. A tunable fraction
+* of the tiles can go to a second executor, normally the CPU, that works
+* through its share at the same time. The engine only decides what goes
+* where and in which order; executors do the copies and the arithmetic,
+* so the schedule can be run and checked with the CPU executing every
+* tile. Problems are column major; row major callers swap the operands.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_OUT_OF_CORE_H_
+#define LIB_INCLUDE_HCBLAS_OUT_OF_CORE_H_
+
+#include <cstddef>
+#include <vector>
+
+// Smallest tile side the schedule accepts; tiles not covering their whole
+// dimension are cut to a multiple of it
+#define HCBLAS_OUT_OF_CORE_MIN_TILE 64
+
+/* A block of C: rows row0 to row0 + rows - 1 and columns col0 to
+ col0 + cols - 1. onHost marks the tiles of the host executor. */
+struct hcblasOutOfCoreTile {
+  long long row0;
+  long long col0;
+  int rows;
+  int cols;
+  bool onHost;
+};
+
+/* One step of a tile: op(A)(row0 : row0 + rows, k0 : k0 + depth) times
+ op(B)(k0 : k0 + depth, col0 : col0 + cols), accumulated into the tile
+ through buffer slot 0 or 1. first marks the step that applies beta to C
+ and last the one after which the tile is complete. */
+struct hcblasOutOfCoreStep {
+  int tile;
+  long long k0;
+  int depth;
+  int slot;
+  bool first;
+  bool last;
+};
+
+class hcblasOutOfCoreSchedule {
+ public:
+  hcblasOutOfCoreSchedule();
+
+  /* Cuts an M x N x K problem with elements of elementSize bytes so that
+   two slots of panels and a tile of C, 2 * (tileM * tileK + tileK * tileN)
+   + tileM * tileN elements, fit in deviceBytes: K is cut as for a cube
+   and the tile of C then grows as far as the remaining space allows.
+   Tiles run down the columns of C; hostFraction of them, rounded to the
+   nearest, go to the host executor, taken from the end of that order.
+   Returns false, leaving the schedule empty, if a dimension is not
+   positive, hostFraction is outside [0, 1] or deviceBytes cannot hold
+   tiles of HCBLAS_OUT_OF_CORE_MIN_TILE a side. */
+  bool build(int M, int N, int K, size_t elementSize, size_t deviceBytes,
+             double hostFraction);
+
+  /* As above for the blocks of C listed in regions, for instance the share
+   of C one of several devices computes: tiles are sized for the largest
+   region and cut within each region in turn. Also returns false if
+   regions is empty or one of them has no rows or columns. */
+  bool build(int K, size_t elementSize, size_t deviceBytes,
+             double hostFraction,
+             const std::vector<hcblasOutOfCoreTile> &regions);
+
+  int tileM() const { return tileRows; }
+  int tileN() const { return tileCols; }
+  int tileK() const { return tileDepth; }
+  const std::vector<hcblasOutOfCoreTile> &tiles() const { return blocks; }
+  int hostTiles() const { return hostCount; }
+
+  /* The steps of the device (onHost false) or host tiles in issue order.
+   Slots alternate from one step to the next, across tiles too. */
+  std::vector<hcblasOutOfCoreStep> steps(bool onHost) const;
+
+ private:
+  int problemK;
+  int tileRows;
+  int tileCols;
+  int tileDepth;
+  int hostCount;
+  std::vector<hcblasOutOfCoreTile> blocks;
+};
+
+/* What the engine drives. load and multiply may return before their work
+ is done; the engine calls drain(slot) before it loads a slot again and
+ finish() once every step has been issued. A false return stops the
+ executor's run. */
+class hcblasOutOfCoreExecutor {
+ public:
+  virtual ~hcblasOutOfCoreExecutor() {}
+
+  // Starts bringing the panels of step into its slot
+  virtual bool load(const hcblasOutOfCoreStep &step) = 0;
+
+  // Accumulates the panels in the slot of step into its tile once they
+  // have arrived, and writes the tile back to C after its last step
+  virtual bool multiply(const hcblasOutOfCoreStep &step) = 0;
+
+  // Waits until nothing issued reads the slot any more
+  virtual bool drain(int slot) = 0;
+
+  // Waits for everything issued and for C to be written back
+  virtual bool finish() = 0;
+};
+
+/* Runs schedule: device works through the device tiles on the calling
+ thread while host, which may be NULL if there are no host tiles, works
+ through the others on a second thread. Each executor loads step s + 1
+ before it multiplies step s. Returns false if either executor failed. */
+bool hcblasOutOfCoreRun(const hcblasOutOfCoreSchedule &schedule,
+                        hcblasOutOfCoreExecutor *device,
+                        hcblasOutOfCoreExecutor *host);
+
+#endif  // LIB_INCLUDE_HCBLAS_OUT_OF_CORE_H_
@@ -0,0 +1,59 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Split-K partitioning for GEMM. When C has too few output tiles to fill
+* the device, the K dimension is cut into chunks that separate work groups
+* reduce independently; a second pass adds the partial products in a fixed
+* order, so the result does not depend on scheduling. The partition is a
+* pure host function so the choice can be checked without a GPU.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_SPLITK_H_
+#define LIB_INCLUDE_HCBLAS_SPLITK_H_
+
+#include <cstddef>
+
+/* Upper bound on the number of K chunks */
+#define HCBLAS_SPLITK_MAX_SPLITS 64
+
+/* Upper bound, in elements, on the partial products kept for one call */
+#define HCBLAS_SPLITK_MAX_WORKSPACE (64 << 20)
+
+/* Chunk s covers [s * kChunk, min(K, (s + 1) * kChunk)). Every chunk is
+ non empty; splits == 1 means the problem should not be split. */
+struct hcblasSplitK {
+  int splits;
+  int kChunk;
+};
+
+/* Partition of K for an M x N x K product computed in tileM x tileN output
+ tiles. K is split only while the tile count is below targetGroups, the
+ number of work groups the device runs at once. Chunks are multiples of
+ kUnit and at least minChunk long, and the partial products fit in
+ HCBLAS_SPLITK_MAX_WORKSPACE. */
+hcblasSplitK hcblasSplitKPartition(int M, int N, int K, int tileM, int tileN,
+                                   int kUnit, int minChunk,
+                                   int targetGroups);
+
+#endif  // LIB_INCLUDE_HCBLAS_SPLITK_H_
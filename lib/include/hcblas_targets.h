@@ -0,0 +1,93 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Kernel registry. The HCC kernels are built for a configurable list of GPU
+* targets (HCBLAS_AMDGPU_TARGETS in cmake/HcblasTargets.cmake). Either all
+* of their code objects are linked into the library, or only those of the
+* first target are and every other target gets a module of its own,
+* libhcblas-<target>.so, that is loaded only when a device of that target
+* is in use. The registry knows which targets are where and picks the code
+* objects for a device from the name the runtime reports; nothing here
+* depends on HCC, so the selection can be checked on the CPU.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_TARGETS_H_
+#define LIB_INCLUDE_HCBLAS_TARGETS_H_
+
+#include <string>
+#include <vector>
+
+/* Target of a device name as runtimes report it: "gfx906",
+ "gfx906:sramecc+:xnack-" and "amdgcn-amd-amdhsa--gfx906" are all
+ "gfx906". Empty if the name does not contain a gfx target. */
+std::string hcblasTargetName(const std::string &device);
+
+/* Targets of a comma or semicolon separated list, as hcblasTargetName
+ gives them, in order and without repeats; entries that are not targets
+ are dropped. */
+std::vector<std::string> hcblasParseTargets(const std::string &list);
+
+/* File of the kernel module of target in directory */
+std::string hcblasTargetModuleFile(const std::string &directory,
+                                   const std::string &target);
+
+/* Directory kernel modules are loaded from: HCBLAS_MODULE_PATH if set,
+ else the hcblas directory next to the library */
+std::string hcblasModuleDirectory();
+
+/* Where the code objects for a device come from: the library itself, a
+ module to load, or nowhere because its target was not built */
+enum hcblasTargetSource {
+  hcblasTargetMissing,
+  hcblasTargetBuiltin,
+  hcblasTargetModule
+};
+
+struct hcblasTargetSelection {
+  std::string target;
+  hcblasTargetSource source;
+  // File to load when source is hcblasTargetModule
+  std::string module;
+};
+
+class hcblasTargetRegistry {
+ public:
+  // builtin and modules are target lists for hcblasParseTargets
+  hcblasTargetRegistry(const std::string &builtin,
+                       const std::string &modules);
+
+  const std::vector<std::string> &builtinTargets() const { return builtin; }
+  const std::vector<std::string> &moduleTargets() const { return modules; }
+
+  /* Code objects for device: built in if the library carries its target,
+   else the module in moduleDir, else missing. */
+  hcblasTargetSelection select(const std::string &device,
+                               const std::string &moduleDir) const;
+
+ private:
+  std::vector<std::string> builtin;
+  std::vector<std::string> modules;
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_TARGETS_H_
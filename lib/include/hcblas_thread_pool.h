@@ -0,0 +1,97 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Work stealing thread pool used by the CPU backend. parallelFor splits an
+* index range into chunks and deals them out to one deque per worker. A
+* worker pops its own deque from the back and, once that is empty, steals
+* from the front of the others, so uneven chunks (triangular and banded
+* routines, grouped problems) even out without a central queue. The calling
+* thread runs chunks too until its range is done, which makes nested
+* parallelFor calls from inside a chunk safe.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_THREAD_POOL_H_
+#define LIB_INCLUDE_HCBLAS_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class hcblasThreadPool {
+ public:
+  typedef std::function<void(__int64_t begin, __int64_t end)> Body;
+
+  // Starts threads - 1 workers; the caller of parallelFor is the last one.
+  explicit hcblasThreadPool(int threads);
+  ~hcblasThreadPool();
+
+  // Pool shared by every CPU backend handle. It has HCBLAS_CPU_THREADS
+  // threads when that is set and one per hardware thread otherwise.
+  static hcblasThreadPool &instance();
+
+  int size() const { return static_cast<int>(queues.size()); }
+
+  // Calls body(begin, end) over disjoint chunks of at most grain indices
+  // covering [0, count) and returns once every chunk has run. Chunks may
+  // run on any thread and in any order.
+  void parallelFor(__int64_t count, __int64_t grain, const Body &body);
+
+ private:
+  struct Job {
+    const Body *body;
+    std::atomic<__int64_t> pending;
+  };
+
+  struct Task {
+    Job *job;
+    __int64_t begin;
+    __int64_t end;
+  };
+
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  hcblasThreadPool(const hcblasThreadPool &);
+  hcblasThreadPool &operator=(const hcblasThreadPool &);
+
+  bool take(size_t home, Task &task);
+  bool runOne(size_t home);
+  void workerLoop(size_t home);
+
+  std::vector<Queue *> queues;
+  std::vector<std::thread> workers;
+  std::atomic<__int64_t> queued;
+  std::mutex idleLock;
+  std::condition_variable idle;
+  bool stopping;
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_THREAD_POOL_H_
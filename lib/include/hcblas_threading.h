@@ -0,0 +1,174 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Building blocks for sharing one hcBLAS handle between threads. Per-handle
+* state that is read on every call (the default stream today, workspace and
+* tuning caches later) is published as an immutable snapshot behind an
+* atomic pointer, so readers never lock. Stream bindings private to one
+* thread live in a per handle table that every thread walks without locks.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_THREADING_H_
+#define LIB_INCLUDE_HCBLAS_THREADING_H_
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/* Value shared by many readers and replaced by occasional writers. read()
+ is wait free and the returned snapshot stays valid until the
+ hcblasPublished object is destroyed: replaced snapshots are retired, not
+ freed, because a reader on another thread may still be looking at them.
+ Publishing a value equal to a retired one brings that snapshot back, so
+ the memory held is bounded by the number of distinct values, not by the
+ number of writes. Writers are serialised. T needs operator==. */
+template <typename T>
+class hcblasPublished {
+ public:
+  explicit hcblasPublished(const T &initial) : current(new T(initial)) {}
+
+  ~hcblasPublished() {
+    delete current.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < retired.size(); i++) {
+      delete retired[i];
+    }
+  }
+
+  const T *read() const { return current.load(std::memory_order_acquire); }
+
+  void publish(const T &value) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    T *next = NULL;
+    if (*current.load(std::memory_order_relaxed) == value) return;
+    for (size_t i = 0; i < retired.size(); i++) {
+      if (*retired[i] == value) {
+        next = retired[i];
+        retired[i] = retired.back();
+        retired.pop_back();
+        break;
+      }
+    }
+    if (next == NULL) next = new T(value);
+    retired.push_back(current.exchange(next, std::memory_order_acq_rel));
+  }
+
+ private:
+  hcblasPublished(const hcblasPublished &);
+  hcblasPublished &operator=(const hcblasPublished &);
+
+  std::atomic<T *> current;
+  std::mutex writeMutex;
+  std::vector<T *> retired;
+};
+
+/* Per thread values of one handle. The handle owns the table: a thread
+ that binds gets a node of its own, pushed onto a lock free list that only
+ grows while the table lives, and destroying the table frees the nodes of
+ every thread at once. Only a node's own thread reads or writes its value,
+ so a value keeps its address until the table is destroyed; unbind just
+ marks it unused and a later bind reuses the node. Thread ids come from
+ threadId() and are never reused, so a thread can not pick up the node of
+ one that exited. */
+template <typename T>
+class hcblasThreadBindings {
+ public:
+  hcblasThreadBindings() : head(NULL) {}
+
+  ~hcblasThreadBindings() {
+    Node *node = head.load(std::memory_order_relaxed);
+    while (node != NULL) {
+      Node *next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  static unsigned long long threadId() {
+    static std::atomic<unsigned long long> counter(0);
+    static thread_local unsigned long long id = ++counter;
+    return id;
+  }
+
+  // Returns the calling thread's binding, or NULL.
+  const T *find() const {
+    const Node *node = own();
+    return node != NULL && node->bound ? &node->value : NULL;
+  }
+
+  void bind(const T &value) {
+    Node *node = own();
+    if (node != NULL) {
+      node->value = value;
+      node->bound = true;
+      return;
+    }
+    node = new Node(threadId(), value);
+    node->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(node->next, node,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+    }
+  }
+
+  void unbind() {
+    Node *node = own();
+    if (node != NULL) node->bound = false;
+  }
+
+  // Calls release on the value of every thread that is still bound. Only
+  // for the owner's destructor: no thread may use the table any more.
+  template <typename F>
+  void releaseBound(F release) {
+    for (Node *node = head.load(std::memory_order_acquire); node != NULL;
+         node = node->next) {
+      if (node->bound) release(node->value);
+    }
+  }
+
+ private:
+  hcblasThreadBindings(const hcblasThreadBindings &);
+  hcblasThreadBindings &operator=(const hcblasThreadBindings &);
+
+  struct Node {
+    Node(unsigned long long t, const T &v)
+        : thread(t), bound(true), value(v), next(NULL) {}
+    unsigned long long thread;
+    bool bound;
+    T value;
+    Node *next;
+  };
+
+  Node *own() const {
+    unsigned long long id = threadId();
+    for (Node *node = head.load(std::memory_order_acquire); node != NULL;
+         node = node->next) {
+      if (node->thread == id) return node;
+    }
+    return NULL;
+  }
+
+  std::atomic<Node *> head;
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_THREADING_H_
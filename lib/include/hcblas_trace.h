@@ -0,0 +1,157 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Opt-in call tracing. HCBLAS_LAYER=1 logs every BLAS call made through the
+* C API with its arguments and the internal kernel that was picked for it;
+* HCBLAS_LAYER=2 adds the device time of the call, taken from markers placed
+* on the accelerator view before and after it. HCBLAS_LAYER_FILE names the
+* output file (stderr by default) and HCBLAS_LAYER_FORMAT=json switches from
+* CSV to JSON lines.
+*
+* A traced call only fills a record and pushes it onto a ring owned by the
+* calling thread. A background thread drains the rings, waits for device
+* timings and does all formatting and I/O, so the caller never blocks on the
+* log. When a ring is full further records are dropped and counted rather
+* than stalling the caller.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_TRACE_H_
+#define LIB_INCLUDE_HCBLAS_TRACE_H_
+
+#include <hc.hpp>
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+
+#define HCBLAS_TRACE_NAME 96
+#define HCBLAS_TRACE_ARGS 320
+#define HCBLAS_TRACE_RING 256
+
+enum hcblasTraceFormat { TraceCsv, TraceJson };
+
+/* One traced call. args holds comma separated key=value pairs. */
+struct hcblasTraceRecord {
+  char call[HCBLAS_TRACE_NAME];
+  char kernel[HCBLAS_TRACE_NAME];
+  char args[HCBLAS_TRACE_ARGS];
+  int thread;
+  double hostUs;
+  bool timed;
+  hc::completion_future start;
+  hc::completion_future end;
+};
+
+/* Bounded queue with exactly one producer and one consumer thread. Neither
+ side locks or waits: push fails when the ring is full, pop when empty. */
+template <typename T, size_t N>
+class hcblasTraceRing {
+ public:
+  hcblasTraceRing() : head(0), tail(0), dropped(0) {}
+
+  bool push(const T &value) {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == N) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    slots[h % N] = value;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T *value) {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *value = slots[t % N];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  unsigned long long droppedCount() const {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  T slots[N];
+  std::atomic<size_t> head;
+  std::atomic<size_t> tail;
+  std::atomic<unsigned long long> dropped;
+};
+
+/* 0: off, 1: calls, 2: calls and device time. Read from HCBLAS_LAYER the
+ first time it is needed. */
+int hcblasTraceLevel();
+
+/* Overrides the environment, e.g. for tests. path NULL means stderr.
+ Records already queued are written to the previous destination first. */
+void hcblasTraceConfigure(int level, const char *path,
+                          hcblasTraceFormat format);
+
+/* Writes out everything recorded so far, waiting for pending timings */
+void hcblasTraceFlush();
+
+/* Names the internal kernel chosen for the call being traced on this
+ thread. Does nothing when no call is being traced. */
+void hcblasTraceKernel(const char *format, ...);
+
+/* Formats one record as a CSV or JSON line, without the newline. A negative
+ deviceUs leaves the device time out. Returns the length written. */
+size_t hcblasTraceFormatRecord(const hcblasTraceRecord &record,
+                               double deviceUs, hcblasTraceFormat format,
+                               char *out, size_t size);
+
+/* Traces the enclosing C API call from construction to destruction. The
+ argument list is only formatted when tracing is on. */
+class hcblasTraceCall {
+ public:
+  hcblasTraceCall(const hc::accelerator_view &view, const char *call,
+                  const char *format, ...)
+      : active(false) {
+    if (hcblasTraceLevel() > 0) {
+      va_list args;
+      va_start(args, format);
+      begin(view, call, format, args);
+      va_end(args);
+    }
+  }
+
+  ~hcblasTraceCall() {
+    if (active) {
+      end();
+    }
+  }
+
+ private:
+  void begin(const hc::accelerator_view &view, const char *call,
+             const char *format, va_list args);
+  void end();
+
+  bool active;
+  hcblasTraceCall(const hcblasTraceCall &);
+  hcblasTraceCall &operator=(const hcblasTraceCall &);
+};
+
+#endif  // LIB_INCLUDE_HCBLAS_TRACE_H_
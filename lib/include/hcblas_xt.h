@@ -0,0 +1,97 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Host side scheduler of the multi-device (XT) GEMM. C is cut into square
+* blocks that are shared out among the devices in proportion to their
+* throughput: blocks are handed out largest first, each to the device that
+* would finish it earliest, preferring a device that already holds a
+* block of the same block row so that it reuses those rows of op(A). Each
+* device then computes its blocks as an out-of-core GEMM
+* (hcblas_out_of_core.h), streaming the rows of op(A) and the columns of
+* op(B) it needs while it multiplies, and writes them back into C.
+* Nothing here depends on HCC, so the schedule can be built and run against
+* simulated devices on the CPU.
+*/
+
+#ifndef LIB_INCLUDE_HCBLAS_XT_H_
+#define LIB_INCLUDE_HCBLAS_XT_H_
+
+#include <functional>
+#include <vector>
+#include "hcblas_out_of_core.h"
+
+// Side of the blocks of C handed to the devices unless the caller sets one
+#define HCBLAS_XT_BLOCK_DIM 2048
+
+/* Block of C, rows row0 to row0 + rows - 1 and columns col0 to
+ col0 + cols - 1, computed by device. */
+struct hcblasXtBlock {
+  long long row0;
+  long long col0;
+  int rows;
+  int cols;
+  int device;
+};
+
+class hcblasXtSchedule {
+ public:
+  hcblasXtSchedule();
+
+  /* Cuts an M x N x K problem into blocks of blockDim a side and assigns
+   them to weights.size() devices, device d doing weights[d] units of work
+   per unit of time. Returns false, leaving the schedule empty, if a
+   dimension or blockDim is not positive, there is no device or a weight
+   is not positive. The result depends only on the arguments: remaining
+   ties go to the lowest device index. */
+  bool build(int M, int N, int K, int blockDim,
+             const std::vector<double> &weights);
+
+  // Blocks in column order, down the columns of C
+  const std::vector<hcblasXtBlock> &blocks() const { return assigned; }
+  int devices() const { return static_cast<int>(busy.size()); }
+
+  // The blocks of device, in column order, as out-of-core regions
+  std::vector<hcblasOutOfCoreTile> regions(int device) const;
+
+  // Multiply-adds given to device divided by its weight
+  double finishTime(int device) const;
+
+ private:
+  std::vector<hcblasXtBlock> assigned;
+  std::vector<double> speed;
+  std::vector<double> busy;
+};
+
+/* Work of one device: computes the regions of C given, returning false on
+ failure. Called on a thread of its own for every device that has blocks,
+ so work for different devices runs concurrently. */
+typedef std::function<bool(int device,
+                           const std::vector<hcblasOutOfCoreTile> &regions)>
+    hcblasXtWork;
+
+/* Runs work for every device of schedule that has blocks and returns once
+ all of them have finished; false if any of them failed. */
+bool hcblasXtRun(const hcblasXtSchedule &schedule, const hcblasXtWork &work);
+
+#endif  // LIB_INCLUDE_HCBLAS_XT_H_
@@ -36,6 +36,10 @@ THE SOFTWARE.
 #include <hc_short_vector.hpp>
 #include <iostream>
 #include <vector>
+#include "hcblas_bfloat16.h"
+#include "hcblas_decision_cache.h"
+#include "hcblas_device.h"
+#include "hcblas_threading.h"
 
 
 #define __HC_FP16_DECL_SUFFIX__ [[hc]]
@@ -50,6 +54,60 @@ enum hcblasOrder : unsigned short { RowMajor, ColMajor };
  matrix ( NO_TRANSPOSE, TRANSPOSE, CONJUGATE) */
 enum hcblasTranspose { NoTrans = 'n', Trans = 't' };
 
+/* enumerator to define which triangle of a symmetric/triangular matrix is
+ referenced ( UPPER, LOWER ) */
+enum hcblasUplo { Upper = 'u', Lower = 'l' };
+
+/* enumerator to define whether a triangular matrix has an implicit unit
+ diagonal ( NON_UNIT, UNIT ) */
+enum hcblasDiag { NonUnit = 'n', Unit = 'u' };
+
+/* enumerator to define the storage type of a GEMMEX operand or the type used
+ for accumulation ( HALF, FLOAT, DOUBLE, COMPLEX, DOUBLE_COMPLEX, INT8, INT32,
+ BFLOAT16 ) */
+enum hcblasDatatype {
+  HalfType,
+  FloatType,
+  DoubleType,
+  ComplexType,
+  DoubleComplexType,
+  Int8Type,
+  Int32Type,
+  Bfloat16Type
+};
+
+/* enumerator to define along which dimension of C the requantisation scale
+ and zero point of IGEMM vary ( PER_ROW, PER_COLUMN ) */
+enum hcblasQuantAxis { PerRow, PerColumn };
+
+/* enumerator to define the activation applied by a GEMM epilogue ( NONE,
+ RELU, GELU, SIGMOID, CLAMP ) */
+enum hcblasActivation {
+  ActivationNone,
+  ActivationRelu,
+  ActivationGelu,
+  ActivationSigmoid,
+  ActivationClamp
+};
+
+/* Epilogue applied in the store phase of GEMM, per element of C
+   v = alpha * scale[q] * op(A) * op(B) + beta * C + bias[p]
+   aux = v (when aux is not NULL), C = activation(v)
+ p and q are the row or column of C selected by biasAxis and scaleAxis. bias
+ and scale are device arrays in the compute type and may be NULL. */
+struct hcblasEpilogue {
+  const float *bias;
+  hcblasQuantAxis biasAxis;
+  const float *scale;
+  hcblasQuantAxis scaleAxis;
+  hcblasActivation activation;
+  float clampMin;
+  float clampMax;
+  void *aux;
+  __int64_t auxOffset;
+  __int64_t ldaux;
+};
+
 union SP_FP32 {
   unsigned int u;
   float f;
@@ -63,12 +121,105 @@ struct hc_Complex {
   float img;
 };
 
-/* Class which implements the blas ( SGEMM, CGEMM, SGEMV, SGER, SAXPY )  */
+/* Stream a handle launches on: the accelerator view plus the opaque stream
+ id handed back to hipBLAS */
+struct hcblasStreamBinding {
+  hcblasStreamBinding(const hc::accelerator_view &view, void *id)
+      : acclView(view), stream(id) {}
+  bool operator==(const hcblasStreamBinding &other) const {
+    return acclView == other.acclView && stream == other.stream;
+  }
+  hc::accelerator_view acclView;
+  void *stream;
+};
+
+/* One launch recorded by plan capture. The kernel was resolved when the
+ call was captured and launch unpacks the argument block to start it.
+ Device operands sit in operand[] so a plan can be retargeted to other
+ buffers without capturing again. */
+#define HCBLAS_PLAN_OPERANDS 3
+#define HCBLAS_PLAN_DIMS 6
+
+struct hcblasPlanStep;
+typedef hcblasStatus (*hcblasPlanLaunch)(hc::accelerator_view accl_view,
+                                         const hcblasPlanStep &step);
+typedef void (*hcblasPlanKernel)();
+
+struct hcblasPlanStep {
+  hcblasPlanLaunch launch;
+  hcblasPlanKernel kernel;
+  void *operand[HCBLAS_PLAN_OPERANDS];
+  __int64_t offset[HCBLAS_PLAN_OPERANDS];
+  __int64_t dim[HCBLAS_PLAN_DIMS];
+  double scalar[2];
+};
+
+/* Launches recorded between hcblasBeginCapture and hcblasEndCapture.
+ Replaying runs the steps in order without repeating argument checks or
+ kernel selection. */
+struct hcblasPlan {
+  std::vector<hcblasPlanStep> steps;
+
+  hcblasStatus launch(hc::accelerator_view accl_view) const {
+    for (size_t i = 0; i < steps.size(); i++) {
+      hcblasStatus status = steps[i].launch(accl_view, steps[i]);
+      if (status != HCBLAS_SUCCEEDS) return status;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // Points every operand equal to from at to instead; returns how many
+  // operands changed.
+  int rebind(const void *from, void *to) {
+    int count = 0;
+    for (size_t i = 0; i < steps.size(); i++) {
+      for (int j = 0; j < HCBLAS_PLAN_OPERANDS; j++) {
+        if (steps[i].operand[j] == from) {
+          steps[i].operand[j] = to;
+          count++;
+        }
+      }
+    }
+    return count;
+  }
+};
+
+/* enumerator to define where a handle executes its routines ( HCC kernels on
+ the accelerator, host threads on the CPU ) */
+enum hcblasBackend { HccBackend, CpuBackend };
+
+/* Properties of accl. The runtime is queried the first time an accelerator
+ is seen; later calls return the cached copy without locking. */
+hcblasDeviceProps hcblasDeviceProperties(const hc::accelerator &accl);
+
+/* Loads the kernel module for the target of accl if the library was built
+ with modules (hcblas_targets.h) and does not carry that target itself.
+ Returns false if the module is needed but cannot be loaded. */
+bool hcblasLoadTargetKernels(const hc::accelerator &accl);
+
+/* Class which implements the blas ( SGEMM, CGEMM, SGEMV, SGER, SAXPY )
+
+ Thread safety: one handle may be shared by any number of threads. The
+ routines below take their accelerator view explicitly and keep no state in
+ the handle. The C API resolves the view per call through acclView(): the
+ calling thread's binding (bindThreadAcclView) wins over the handle default
+ (setDefaultAcclView). Per-handle state that calls read must be published
+ through hcblasPublished so readers stay lock free. Plan capture is per
+ thread as well.
+
+ The routines are virtual so that a backend can replace all of them:
+ HcblasCpuLibrary (hcblas_cpu.h) runs them on host threads instead of
+ launching HCC kernels. */
 struct Hcblaslibrary {
  public:
   // Constructor to initialize the library with the given hc::accelerator
-  explicit Hcblaslibrary(hc::accelerator_view *av)
-      : currentAccl(av->get_accelerator()), currentAcclView(*av) {
+  explicit Hcblaslibrary(hc::accelerator_view *av,
+                         hcblasBackend kind = HccBackend)
+      : currentAccl(av->get_accelerator()),
+        deviceProps(hcblasDeviceProperties(currentAccl)),
+        backend(kind),
+        currentAcclView(*av),
+        defaultBinding(hcblasStreamBinding(*av, NULL)) {
     std::vector<hc::accelerator> accs = hc::accelerator::get_all();
     for (int i = 0; i < accs.size(); i++) {
       if (accs[i] == this->currentAccl) {
@@ -82,109 +233,186 @@ struct Hcblaslibrary {
     this->Order = ColMajor;
   }
 
-  ~Hcblaslibrary() {
+  virtual ~Hcblaslibrary() {
     // Deinitialize the library
     this->initialized = false;
+    // Plans still being captured with the handle, on any thread, can no
+    // longer be ended
+    capturePlans.releaseBound([](hcblasPlan *plan) { delete plan; });
   }
 
   // Add current Accerator field
   hc::accelerator currentAccl;
 
+  // Properties of currentAccl, read once when the handle is created
+  hcblasDeviceProps deviceProps;
+
+  // Properties dispatchers should size launches on accl with: deviceProps
+  // for the handle's own accelerator, the process wide copy for another
+  // one a stream binding may point at.
+  hcblasDeviceProps deviceProperties(const hc::accelerator &accl) const {
+    return accl == currentAccl ? deviceProps : hcblasDeviceProperties(accl);
+  }
+
+  // Where the routines of this handle run. Subclasses for other backends
+  // override the routines below; see hcblas_cpu.h.
+  const hcblasBackend backend;
+
   // Filed to check if library is initialized
   bool initialized = false;
 
+  // View the handle was created on. Stream changes do not touch it; use
+  // acclView() for the view a call should launch on.
   hc::accelerator_view currentAcclView;
 
-  // StreamInfo
-  void *currentStream = NULL;
-
   hcblasOrder Order;
 
+  // Binding used by the calling thread: its own if it has one, else the
+  // handle default.
+  const hcblasStreamBinding &binding() const {
+    const hcblasStreamBinding *local = threadBindings.find();
+    return local ? *local : *defaultBinding.read();
+  }
+
+  hc::accelerator_view acclView() const { return binding().acclView; }
+
+  void *stream() const { return binding().stream; }
+
+  void setDefaultAcclView(const hc::accelerator_view &view, void *stream) {
+    defaultBinding.publish(hcblasStreamBinding(view, stream));
+  }
+
+  // Binds view to the calling thread only; other threads are unaffected.
+  void bindThreadAcclView(const hc::accelerator_view &view, void *stream) {
+    threadBindings.bind(hcblasStreamBinding(view, stream));
+  }
+
+  void unbindThreadAcclView() {
+    threadBindings.unbind();
+  }
+
+  // Plan the calling thread is capturing into with this handle, or NULL.
+  // The C API checks it on entry: hcblasSgemm, hcblasSgemv and hcblasSaxpy
+  // record through the *_capture routines and every other call is refused.
+  // The member routines never look at it, so one routine calling another
+  // internally always runs it.
+  hcblasPlan *capturePlan() const {
+    hcblasPlan *const *plan = capturePlans.find();
+    return plan ? *plan : NULL;
+  }
+
+  void beginCapture(hcblasPlan *plan) {
+    capturePlans.bind(plan);
+  }
+
+  void endCapture() {
+    capturePlans.unbind();
+  }
+
+  // Kernels GEMM calls of this handle resolved to, by call signature.
+  // See hcblas_decision_cache.h.
+  hcblasDecisionCache<hcblasPlanKernel, 256> gemmDecisions;
+
+ private:
+  hcblasPublished<hcblasStreamBinding> defaultBinding;
+  // Bindings of every thread that bound a view or captures a plan; freed
+  // with the handle
+  hcblasThreadBindings<hcblasStreamBinding> threadBindings;
+  hcblasThreadBindings<hcblasPlan *> capturePlans;
+
+ public:
   /* SAXPY - Y = alpha * X + Y                                    */
   /* SAXPY - Overloaded function with arguments of type hc::array */
 
-  hcblasStatus hcblas_saxpy(hc::accelerator_view accl_view, const int N,
-                            const float &alpha, const float *X, const int incX,
-                            float *Y, const int incY, const __int64_t xOffset,
-                            const __int64_t yOffset);
+  virtual hcblasStatus hcblas_saxpy(
+      hc::accelerator_view accl_view, const int N, const float &alpha,
+      const float *X, const int incX, float *Y, const int incY,
+      const __int64_t xOffset, const __int64_t yOffset);
+
+  /* SAXPY - as the overload above, but when plan is not NULL the launch is
+   appended to it instead of run. Only the HCC backend captures. */
+  hcblasStatus hcblas_saxpy_capture(
+      hcblasPlan *plan, hc::accelerator_view accl_view, const int N,
+      const float &alpha, const float *X, const int incX, float *Y,
+      const int incY, const __int64_t xOffset, const __int64_t yOffset);
 
   /* SAXPY - Overloaded function with arguments related to batch processing */
 
-  hcblasStatus hcblas_saxpy(hc::accelerator_view accl_view, const int N,
-                            const float &alpha, const float *X, const int incX,
-                            const __int64_t X_batchOffset, float *Y,
-                            const int incY, const __int64_t Y_batchOffset,
-                            const __int64_t xOffset, const __int64_t yOffset,
-                            const int batchSize);
+  virtual hcblasStatus hcblas_saxpy(
+      hc::accelerator_view accl_view, const int N, const float &alpha,
+      const float *X, const int incX, const __int64_t X_batchOffset, float *Y,
+      const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+      const __int64_t yOffset, const int batchSize);
 
   /* DAXPY - Y = alpha * X + Y                                    */
   /* DAXPY - Overloaded function with arguments of type hc::array */
 
-  hcblasStatus hcblas_daxpy(hc::accelerator_view accl_view, const int N,
-                            const double &alpha, const double *X,
-                            const int incX, double *Y, const int incY,
-                            const __int64_t xOffset, const __int64_t yOffset);
+  virtual hcblasStatus hcblas_daxpy(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      const double *X, const int incX, double *Y, const int incY,
+      const __int64_t xOffset, const __int64_t yOffset);
 
   /* DAXPY - Overloaded function with arguments related to batch processing */
 
-  hcblasStatus hcblas_daxpy(hc::accelerator_view accl_view, const int N,
-                            const double &alpha, const double *X,
-                            const int incX, const __int64_t X_batchOffset,
-                            double *Y, const int incY,
-                            const __int64_t Y_batchOffset,
-                            const __int64_t xOffset, const __int64_t yOffset,
-                            const int batchSize);
+  virtual hcblasStatus hcblas_daxpy(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      const double *X, const int incX, const __int64_t X_batchOffset, double *Y,
+      const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+      const __int64_t yOffset, const int batchSize);
 
   /* SGER - A = alpha * X * Y' + A                               */
   /* SGER - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_sger(hc::accelerator_view accl_view, hcblasOrder order,
-                           const int M, const int N, const float &alpha,
-                           const float *X, const __int64_t xOffset,
-                           const int incX, const float *Y,
-                           const __int64_t yOffset, const int incY, float *A,
-                           const __int64_t aOffset, const int lda);
+  virtual hcblasStatus hcblas_sger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const int incX, const float *Y, const __int64_t yOffset, const int incY,
+      float *A, const __int64_t aOffset, const int lda);
 
   /* SGER - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_sger(hc::accelerator_view accl_view, hcblasOrder order,
-                           const int M, const int N, const float &alpha,
-                           const float *X, const __int64_t xOffset,
-                           const __int64_t X_batchOffset, const int incX,
-                           const float *Y, const __int64_t yOffset,
-                           const __int64_t Y_batchOffset, const int incY,
-                           float *A, const __int64_t aOffset,
-                           const __int64_t A_batchOffset, const int lda,
-                           const int batchSize);
+  virtual hcblasStatus hcblas_sger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int incX, const float *Y,
+      const __int64_t yOffset, const __int64_t Y_batchOffset, const int incY,
+      float *A, const __int64_t aOffset, const __int64_t A_batchOffset,
+      const int lda, const int batchSize);
 
   /* DGER - A = alpha * X * Y' + A                               */
-  hcblasStatus hcblas_dger(hc::accelerator_view accl_view, hcblasOrder order,
-                           const int M, const int N, const double &alpha,
-                           const double *X, const __int64_t xOffset,
-                           const int incX, const double *Y,
-                           const __int64_t yOffset, const int incY, double *A,
-                           const __int64_t aOffset, const int lda);
+  virtual hcblasStatus hcblas_dger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const double &alpha, const double *X,
+      const __int64_t xOffset, const int incX, const double *Y,
+      const __int64_t yOffset, const int incY, double *A,
+      const __int64_t aOffset, const int lda);
 
   /* DGER - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_dger(hc::accelerator_view accl_view, hcblasOrder order,
-                           const int M, const int N, const double &alpha,
-                           const double *X, const __int64_t xOffset,
-                           const __int64_t X_batchOffset, const int incX,
-                           const double *Y, const __int64_t yOffset,
-                           const __int64_t Y_batchOffset, const int incY,
-                           double *A, const __int64_t aOffset,
-                           const __int64_t A_batchOffset, const int lda,
-                           const int batchSize);
+  virtual hcblasStatus hcblas_dger(
+      hc::accelerator_view accl_view, hcblasOrder order, const int M,
+      const int N, const double &alpha, const double *X,
+      const __int64_t xOffset, const __int64_t X_batchOffset, const int incX,
+      const double *Y, const __int64_t yOffset, const __int64_t Y_batchOffset,
+      const int incY, double *A, const __int64_t aOffset,
+      const __int64_t A_batchOffset, const int lda, const int batchSize);
 
   /* SGEMV - Y = alpha * op(A) * X + beta * Y                     */
-  hcblasStatus hcblas_sgemv(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose type, const int M, const int N,
-                            const float &alpha, float *A,
-                            const __int64_t aOffset, const int lda, float *X,
-                            const __int64_t xOffset, const int incX,
-                            const float &beta, float *Y,
-                            const __int64_t yOffset, const int incY);
+  virtual hcblasStatus hcblas_sgemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const float &alpha, float *A,
+      const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+      const int incX, const float &beta, float *Y, const __int64_t yOffset,
+      const int incY);
+
+  /* SGEMV - as the overload above, but when plan is not NULL the launch is
+   appended to it instead of run. Only the HCC backend captures. */
+  hcblasStatus hcblas_sgemv_capture(
+      hcblasPlan *plan, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose type, const int M, const int N, const float &alpha,
+      float *A, const __int64_t aOffset, const int lda, float *X,
+      const __int64_t xOffset, const int incX, const float &beta, float *Y,
+      const __int64_t yOffset, const int incY);
 
   /* SGEMV - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_sgemv(
+  virtual hcblasStatus hcblas_sgemv(
       hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
       const int M, const int N, const float &alpha, float *A,
       const __int64_t aOffset, const __int64_t A_batchOffset, const int lda,
@@ -193,16 +421,15 @@ struct Hcblaslibrary {
       const __int64_t Y_batchOffset, const int incY, const int batchSize);
 
   /* DGEMV - Y = alpha * op(A) * X + beta * Y                     */
-  hcblasStatus hcblas_dgemv(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose type, const int M, const int N,
-                            const double &alpha, double *A,
-                            const __int64_t aOffset, const int lda, double *X,
-                            const __int64_t xOffset, const int incX,
-                            const double &beta, double *Y,
-                            const __int64_t yOffset, const int incY);
+  virtual hcblasStatus hcblas_dgemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const double &alpha, double *A,
+      const __int64_t aOffset, const int lda, double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY);
 
   /* DGEMV - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_dgemv(
+  virtual hcblasStatus hcblas_dgemv(
       hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
       const int M, const int N, const double &alpha, double *A,
       const __int64_t aOffset, const __int64_t A_batchOffset, const int lda,
@@ -210,88 +437,232 @@ struct Hcblaslibrary {
       const int incX, const double &beta, double *Y, const __int64_t yOffset,
       const __int64_t Y_batchOffset, const int incY, const int batchSize);
 
+  /* SSYMV - Y = alpha * A * X + beta * Y, A symmetric             */
+  virtual hcblasStatus hcblas_ssymv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const float &alpha, const float *A, const __int64_t aOffset,
+      const int lda, const float *X, const __int64_t xOffset, const int incX,
+      const float &beta, float *Y, const __int64_t yOffset, const int incY);
+
+  /* DSYMV - Y = alpha * A * X + beta * Y, A symmetric             */
+  virtual hcblasStatus hcblas_dsymv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const double &alpha, const double *A,
+      const __int64_t aOffset, const int lda, const double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY);
+
+  /* CHEMV - Y = alpha * A * X + beta * Y, A hermitian             */
+  virtual hcblasStatus hcblas_chemv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const hc::short_vector::float_2 &alpha,
+      const hc::short_vector::float_2 *A, const __int64_t aOffset,
+      const int lda, const hc::short_vector::float_2 *X,
+      const __int64_t xOffset, const int incX,
+      const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *Y,
+      const __int64_t yOffset, const int incY);
+
+  /* STRMV - X = op(A) * X, A triangular                           */
+  virtual hcblasStatus hcblas_strmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      hcblasTranspose type, hcblasDiag diag, const int N, const float *A,
+      const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+      const int incX);
+
+  /* DTRMV - X = op(A) * X, A triangular                           */
+  virtual hcblasStatus hcblas_dtrmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      hcblasTranspose type, hcblasDiag diag, const int N, const double *A,
+      const __int64_t aOffset, const int lda, double *X,
+      const __int64_t xOffset, const int incX);
+
+  /* STRSV - X = inv(op(A)) * X, A triangular                      */
+  virtual hcblasStatus hcblas_strsv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      hcblasTranspose type, hcblasDiag diag, const int N, const float *A,
+      const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+      const int incX);
+
+  /* DTRSV - X = inv(op(A)) * X, A triangular                      */
+  virtual hcblasStatus hcblas_dtrsv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      hcblasTranspose type, hcblasDiag diag, const int N, const double *A,
+      const __int64_t aOffset, const int lda, double *X,
+      const __int64_t xOffset, const int incX);
+
+  /* SSYR - A = alpha * X * X' + A, A symmetric                    */
+  virtual hcblasStatus hcblas_ssyr(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const int incX, float *A, const __int64_t aOffset, const int lda);
+
+  /* DSYR - A = alpha * X * X' + A, A symmetric                    */
+  virtual hcblasStatus hcblas_dsyr(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const double &alpha, const double *X,
+      const __int64_t xOffset, const int incX, double *A,
+      const __int64_t aOffset, const int lda);
+
+  /* SSYR2 - A = alpha * X * Y' + alpha * Y * X' + A, A symmetric  */
+  virtual hcblasStatus hcblas_ssyr2(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const float &alpha, const float *X, const __int64_t xOffset,
+      const int incX, const float *Y, const __int64_t yOffset, const int incY,
+      float *A, const __int64_t aOffset, const int lda);
+
+  /* DSYR2 - A = alpha * X * Y' + alpha * Y * X' + A, A symmetric  */
+  virtual hcblasStatus hcblas_dsyr2(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const double &alpha, const double *X,
+      const __int64_t xOffset, const int incX, const double *Y,
+      const __int64_t yOffset, const int incY, double *A,
+      const __int64_t aOffset, const int lda);
+
+  /* SGBMV - Y = alpha * op(A) * X + beta * Y, A banded            */
+  virtual hcblasStatus hcblas_sgbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const int KL, const int KU, const float &alpha,
+      const float *A, const __int64_t aOffset, const int lda, const float *X,
+      const __int64_t xOffset, const int incX, const float &beta, float *Y,
+      const __int64_t yOffset, const int incY);
+
+  /* DGBMV - Y = alpha * op(A) * X + beta * Y, A banded            */
+  virtual hcblasStatus hcblas_dgbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+      const int M, const int N, const int KL, const int KU, const double &alpha,
+      const double *A, const __int64_t aOffset, const int lda, const double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY);
+
+  /* SSBMV - Y = alpha * A * X + beta * Y, A symmetric banded      */
+  virtual hcblasStatus hcblas_ssbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const int K, const float &alpha, const float *A,
+      const __int64_t aOffset, const int lda, const float *X,
+      const __int64_t xOffset, const int incX, const float &beta, float *Y,
+      const __int64_t yOffset, const int incY);
+
+  /* DSBMV - Y = alpha * A * X + beta * Y, A symmetric banded      */
+  virtual hcblasStatus hcblas_dsbmv(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+      const int N, const int K, const double &alpha, const double *A,
+      const __int64_t aOffset, const int lda, const double *X,
+      const __int64_t xOffset, const int incX, const double &beta, double *Y,
+      const __int64_t yOffset, const int incY);
+
   /* SGEMM - C = alpha * op(A) * op(B) + beta * C                 */
   /* SGEMM - Overloaded function with arguments of type dev pointer */
-  hcblasStatus hcblas_sgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const float &alpha, float *A, const __int64_t lda,
-                            float *B, const __int64_t ldb, const float &beta,
-                            float *C, const __int64_t ldc,
-                            const __int64_t aOffset, const __int64_t bOffset,
-                            const __int64_t cOffset);
-
-  hcblasStatus hcblas_dgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const double &alpha, double *A, const __int64_t lda,
-                            double *B, const __int64_t ldb, const double &beta,
-                            double *C, const __int64_t ldc,
-                            const __int64_t aOffset, const __int64_t bOffset,
-                            const __int64_t cOffset);
-
-  hcblasStatus hcblas_hgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const hc::half &alpha, hc::half *A,
-                            const __int64_t lda, hc::half *B,
-                            const __int64_t ldb, const hc::half &beta,
-                            hc::half *C, const __int64_t ldc,
-                            const __int64_t aOffset, const __int64_t bOffset,
-                            const __int64_t cOffset);
+  virtual hcblasStatus hcblas_sgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const float &alpha, float *A, const __int64_t lda, float *B,
+      const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+      const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset);
+
+  /* SGEMM - as the overload above, but when plan is not NULL the launch is
+   appended to it instead of run. Only the HCC backend captures. */
+  hcblasStatus hcblas_sgemm_capture(
+      hcblasPlan *plan, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const float &alpha, float *A, const __int64_t lda,
+      float *B, const __int64_t ldb, const float &beta, float *C,
+      const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset);
+
+  virtual hcblasStatus hcblas_dgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const double &alpha, double *A, const __int64_t lda, double *B,
+      const __int64_t ldb, const double &beta, double *C, const __int64_t ldc,
+      const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset);
+
+  virtual hcblasStatus hcblas_hgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::half &alpha, hc::half *A, const __int64_t lda, hc::half *B,
+      const __int64_t ldb, const hc::half &beta, hc::half *C,
+      const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset);
 
   /* SGEMM - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_sgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const float &alpha, float *A[], const __int64_t lda,
-                            const __int64_t A_batchOffset, float *B[],
-                            const __int64_t ldb, const __int64_t B_batchOffset,
-                            const float &beta, float *C[], const __int64_t ldc,
-                            const __int64_t C_batchOffset,
-                            const __int64_t aOffset, const __int64_t bOffset,
-                            const __int64_t cOffset, const int batchSize);
+  virtual hcblasStatus hcblas_sgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const float &alpha, float *A[], const __int64_t lda,
+      const __int64_t A_batchOffset, float *B[], const __int64_t ldb,
+      const __int64_t B_batchOffset, const float &beta, float *C[],
+      const __int64_t ldc, const __int64_t C_batchOffset,
+      const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+      const int batchSize);
+
+  /* SGEMM - Grouped: problem i computes                                */
+  /* SGEMM - C[i] = alpha * op(A[i]) * op(B[i]) + beta * C[i] with its own */
+  /* SGEMM - M[i], N[i], K[i] and leading dimensions, all in one launch.   */
+  /* SGEMM - The shape arrays and pointer arrays live in host memory.      */
+  virtual hcblasStatus hcblas_sgemm_grouped(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int *M, const int *N, const int *K,
+      const float &alpha, const float *const A[], const int *lda,
+      const float *const B[], const int *ldb, const float &beta,
+      float *const C[], const int *ldc, const int groupCount);
+
+  /* SGEMM - Out of core: C = alpha * op(A) * op(B) + beta * C with A, B  */
+  /* SGEMM - and C in host memory, streamed through deviceBytes of device */
+  /* SGEMM - memory (0: a quarter of the device's). hostFraction of the   */
+  /* SGEMM - tiles of C run on the CPU backend meanwhile; all of them do  */
+  /* SGEMM - on a CPU handle.                                             */
+  virtual hcblasStatus hcblas_sgemm_out_of_core(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const float &alpha, const float *A, const __int64_t lda, const float *B,
+      const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+      const size_t deviceBytes, const float hostFraction);
 
   /*  DGEMM - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_dgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const double &alpha, double *A[],
-                            const __int64_t lda, const __int64_t A_batchOffset,
-                            double *B[], const __int64_t ldb,
-                            const __int64_t B_batchOffset, const double &beta,
-                            double *C[], const __int64_t ldc,
-                            const __int64_t C_batchOffset,
-                            const __int64_t aOffset, const __int64_t bOffset,
-                            const __int64_t cOffset, const int batchSize);
+  virtual hcblasStatus hcblas_dgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const double &alpha, double *A[], const __int64_t lda,
+      const __int64_t A_batchOffset, double *B[], const __int64_t ldb,
+      const __int64_t B_batchOffset, const double &beta, double *C[],
+      const __int64_t ldc, const __int64_t C_batchOffset,
+      const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+      const int batchSize);
+
+  /* DGEMM - Out of core: as hcblas_sgemm_out_of_core in double precision */
+  virtual hcblasStatus hcblas_dgemm_out_of_core(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const double &alpha, const double *A, const __int64_t lda,
+      const double *B, const __int64_t ldb, const double &beta, double *C,
+      const __int64_t ldc, const size_t deviceBytes, const float hostFraction);
+
   /* CGEMM - C = alpha * op(A) * op(B) + beta * C                   */
   /* CGEMM - Overloaded function with arguments of type hc::array   */
-  hcblasStatus hcblas_cgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const hc::short_vector::float_2 &alpha,
-                            hc::short_vector::float_2 *A,
-                            const __int64_t aOffset, const __int64_t lda,
-                            hc::short_vector::float_2 *B,
-                            const __int64_t bOffset, const __int64_t ldb,
-                            const hc::short_vector::float_2 &beta,
-                            hc::short_vector::float_2 *C,
-                            const __int64_t cOffset, const __int64_t ldc);
-
-  hcblasStatus hcblas_zgemm(hc::accelerator_view accl_view, hcblasOrder order,
-                            hcblasTranspose typeA, hcblasTranspose typeB,
-                            const int M, const int N, const int K,
-                            const hc::short_vector::double_2 &alpha,
-                            hc::short_vector::double_2 *A,
-                            const __int64_t aOffset, const __int64_t lda,
-                            hc::short_vector::double_2 *B,
-                            const __int64_t bOffset, const __int64_t ldb,
-                            const hc::short_vector::double_2 &beta,
-                            hc::short_vector::double_2 *C,
-                            const __int64_t cOffset, const __int64_t ldc);
+  virtual hcblasStatus hcblas_cgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+      const __int64_t aOffset, const __int64_t lda,
+      hc::short_vector::float_2 *B, const __int64_t bOffset,
+      const __int64_t ldb, const hc::short_vector::float_2 &beta,
+      hc::short_vector::float_2 *C, const __int64_t cOffset,
+      const __int64_t ldc);
+
+  virtual hcblasStatus hcblas_zgemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+      const __int64_t aOffset, const __int64_t lda,
+      hc::short_vector::double_2 *B, const __int64_t bOffset,
+      const __int64_t ldb, const hc::short_vector::double_2 &beta,
+      hc::short_vector::double_2 *C, const __int64_t cOffset,
+      const __int64_t ldc);
 
   /* CGEMM - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_cgemm(
+  virtual hcblasStatus hcblas_cgemm(
       hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
       hcblasTranspose typeB, const int M, const int N, const int K,
       const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
@@ -303,7 +674,7 @@ struct Hcblaslibrary {
       const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize);
 
   /* ZGEMM - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_zgemm(
+  virtual hcblasStatus hcblas_zgemm(
       hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
       hcblasTranspose typeB, const int M, const int N, const int K,
       const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
@@ -314,168 +685,248 @@ struct Hcblaslibrary {
       hc::short_vector::double_2 *C[], const __int64_t cOffset,
       const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize);
 
+  /* GEMMEX - C = alpha * op(A) * op(B) + beta * C                    */
+  /* GEMMEX - A, B and C each have their own storage type; the product is */
+  /* accumulated in computeType, which is also the type of alpha and beta */
+  /* GEMMEX - an epilogue, if given, is fused into the store of C; it is  */
+  /* supported when computeType is FloatType                              */
+  virtual hcblasStatus hcblas_gemmex(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const void *alpha, const void *A, hcblasDatatype Atype,
+      const __int64_t aOffset, const __int64_t lda, const void *B,
+      hcblasDatatype Btype, const __int64_t bOffset, const __int64_t ldb,
+      const void *beta, void *C, hcblasDatatype Ctype, const __int64_t cOffset,
+      const __int64_t ldc, hcblasDatatype computeType,
+      const hcblasEpilogue *epilogue = NULL);
+
+  /* GEMMEX - true if the type combination has a registered kernel */
+  virtual bool hcblas_gemmex_supported(
+      hcblasDatatype Atype, hcblasDatatype Btype, hcblasDatatype Ctype,
+      hcblasDatatype computeType, bool epilogue = false);
+
+  /* IGEMM - C = alpha * op(A) * op(B) + beta * C                    */
+  /* IGEMM - A and B hold int8 values, products are accumulated in int32 */
+  virtual hcblasStatus hcblas_igemm(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const int &alpha, const signed char *A, const __int64_t lda,
+      const signed char *B, const __int64_t ldb, const int &beta, int *C,
+      const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset);
+
+  /* IGEMM - C = sat8(round(scale[q] * op(A) * op(B)) + zeroPoint[q])      */
+  /* IGEMM - q is the row or column of C selected by axis; zeroPoint may be */
+  /* IGEMM - NULL. The int32 accumulator is requantised before it is stored */
+  virtual hcblasStatus hcblas_igemm_requant(
+      hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+      hcblasTranspose typeB, const int M, const int N, const int K,
+      const signed char *A, const __int64_t lda, const signed char *B,
+      const __int64_t ldb, signed char *C, const __int64_t ldc,
+      hcblasQuantAxis axis, const float *scale, const int *zeroPoint,
+      const __int64_t aOffset, const __int64_t bOffset,
+      const __int64_t cOffset);
+
   /* SSCAL - X = alpha * X */
   /* SSCAL - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
-                            const float &alpha, float *X, const int incX,
-                            const __int64_t xOffset);
+  virtual hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
+                                    const float &alpha, float *X,
+                                    const int incX, const __int64_t xOffset);
 
   /* SSCAL - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
-                            const float &alpha, float *X, const int incX,
-                            const __int64_t xOffset,
-                            const __int64_t X_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_sscal(
+      hc::accelerator_view accl_view, const int N, const float &alpha, float *X,
+      const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int batchSize);
 
   /* DSCAL - X = alpha * X */
   /* DSCAL - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
-                            const double &alpha, double *X, const int incX,
-                            const __int64_t xOffset);
+  virtual hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
+                                    const double &alpha, double *X,
+                                    const int incX, const __int64_t xOffset);
 
   /* DSCAL - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
-                            const double &alpha, double *X, const int incX,
-                            const __int64_t xOffset,
-                            const __int64_t X_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_dscal(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      double *X, const int incX, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int batchSize);
 
   /* CSCAL - X = alpha * X */
   /* CSCAL - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_cscal(hc::accelerator_view accl_view, const int N,
-                            const hc::short_vector::float_2 &alpha,
-                            hc::short_vector::float_2 *X, const int incX,
-                            const __int64_t xOffset);
+  virtual hcblasStatus hcblas_cscal(hc::accelerator_view accl_view, const int N,
+                                    const hc::short_vector::float_2 &alpha,
+                                    hc::short_vector::float_2 *X,
+                                    const int incX, const __int64_t xOffset);
 
   /* CSCAL - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_cscal(hc::accelerator_view accl_view, const int N,
-                            const hc::short_vector::float_2 &alpha,
-                            hc::short_vector::float_2 *X, const int incX,
-                            const __int64_t xOffset,
-                            const __int64_t X_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_cscal(
+      hc::accelerator_view accl_view, const int N,
+      const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *X,
+      const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int batchSize);
 
   /* ZSCAL - X = alpha * X */
   /* ZSCAL - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_zscal(hc::accelerator_view accl_view, const int N,
-                            const hc::short_vector::double_2 &alpha,
-                            hc::short_vector::double_2 *X, const int incX,
-                            const __int64_t xOffset);
+  virtual hcblasStatus hcblas_zscal(hc::accelerator_view accl_view, const int N,
+                                    const hc::short_vector::double_2 &alpha,
+                                    hc::short_vector::double_2 *X,
+                                    const int incX, const __int64_t xOffset);
 
   /* ZSCAL - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_zscal(hc::accelerator_view accl_view, const int N,
-                            const hc::short_vector::double_2 &alpha,
-                            hc::short_vector::double_2 *X, const int incX,
-                            const __int64_t xOffset,
-                            const __int64_t X_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_zscal(
+      hc::accelerator_view accl_view, const int N,
+      const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *X,
+      const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+      const int batchSize);
 
   /* CSSCAL - X = alpha * X */
   /* CSSCAL - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_csscal(hc::accelerator_view accl_view, const int N,
-                             const float &alpha, hc::short_vector::float_2 *X,
-                             const int incX, const __int64_t xOffset);
+  virtual hcblasStatus hcblas_csscal(
+      hc::accelerator_view accl_view, const int N, const float &alpha,
+      hc::short_vector::float_2 *X, const int incX, const __int64_t xOffset);
 
   /* CSSCAL - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_csscal(hc::accelerator_view accl_view, const int N,
-                             const float &alpha, hc::short_vector::float_2 *X,
-                             const int incX, const __int64_t xOffset,
-                             const __int64_t X_batchOffset,
-                             const int batchSize);
+  virtual hcblasStatus hcblas_csscal(
+      hc::accelerator_view accl_view, const int N, const float &alpha,
+      hc::short_vector::float_2 *X, const int incX, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int batchSize);
 
   /* ZDSCAL - X = alpha * X */
   /* ZDSCAL - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_zdscal(hc::accelerator_view accl_view, const int N,
-                             const double &alpha, hc::short_vector::double_2 *X,
-                             const int incX, const __int64_t xOffset);
+  virtual hcblasStatus hcblas_zdscal(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      hc::short_vector::double_2 *X, const int incX, const __int64_t xOffset);
 
   /* ZDSCAL - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_zdscal(hc::accelerator_view accl_view, const int N,
-                             const double &alpha, hc::short_vector::double_2 *X,
-                             const int incX, const __int64_t xOffset,
-                             const __int64_t X_batchOffset,
-                             const int batchSize);
+  virtual hcblasStatus hcblas_zdscal(
+      hc::accelerator_view accl_view, const int N, const double &alpha,
+      hc::short_vector::double_2 *X, const int incX, const __int64_t xOffset,
+      const __int64_t X_batchOffset, const int batchSize);
 
   /* SCOPY - Copies a vector X to a vector Y */
   /* SCOPY - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_scopy(hc::accelerator_view accl_view, const int N,
-                            const float *X, const int incX,
-                            const __int64_t xOffset, float *Y, const int incY,
-                            const __int64_t yOffset);
+  virtual hcblasStatus hcblas_scopy(hc::accelerator_view accl_view, const int N,
+                                    const float *X, const int incX,
+                                    const __int64_t xOffset, float *Y,
+                                    const int incY, const __int64_t yOffset);
 
   /* SCOPY - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_scopy(hc::accelerator_view accl_view, const int N,
-                            const float *X, const int incX,
-                            const __int64_t xOffset, float *Y, const int incY,
-                            const __int64_t yOffset,
-                            const __int64_t X_batchOffset,
-                            const __int64_t Y_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_scopy(
+      hc::accelerator_view accl_view, const int N, const float *X,
+      const int incX, const __int64_t xOffset, float *Y, const int incY,
+      const __int64_t yOffset, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize);
 
   /* DCOPY - Copies a vector X to a vector Y */
   /* DCOPY - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_dcopy(hc::accelerator_view accl_view, const int N,
-                            const double *X, const int incX,
-                            const __int64_t xOffset, double *Y, const int incY,
-                            const __int64_t yOffset);
+  virtual hcblasStatus hcblas_dcopy(hc::accelerator_view accl_view, const int N,
+                                    const double *X, const int incX,
+                                    const __int64_t xOffset, double *Y,
+                                    const int incY, const __int64_t yOffset);
 
   /* DCOPY - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_dcopy(hc::accelerator_view accl_view, const int N,
-                            const double *X, const int incX,
-                            const __int64_t xOffset, double *Y, const int incY,
-                            const __int64_t yOffset,
-                            const __int64_t X_batchOffset,
-                            const __int64_t Y_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_dcopy(
+      hc::accelerator_view accl_view, const int N, const double *X,
+      const int incX, const __int64_t xOffset, double *Y, const int incY,
+      const __int64_t yOffset, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize);
 
   /* SDOT - Single Precision Dot product */
   /* SDOT - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_sdot(hc::accelerator_view accl_view, const int N,
-                           const float *X, const int incX,
-                           const __int64_t xOffset, const float *Y,
-                           const int incY, const __int64_t yOffset, float &dot);
+  virtual hcblasStatus hcblas_sdot(
+      hc::accelerator_view accl_view, const int N, const float *X,
+      const int incX, const __int64_t xOffset, const float *Y, const int incY,
+      const __int64_t yOffset, float &dot);
 
   /* SDOT - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_sdot(hc::accelerator_view accl_view, const int N,
-                           const float *X, const int incX,
-                           const __int64_t xOffset, const float *Y,
-                           const int incY, const __int64_t yOffset, float &dot,
-                           const __int64_t X_batchOffset,
-                           const __int64_t Y_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_sdot(
+      hc::accelerator_view accl_view, const int N, const float *X,
+      const int incX, const __int64_t xOffset, const float *Y, const int incY,
+      const __int64_t yOffset, float &dot, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize);
 
   /* DDOT - Double Precision Dot product */
   /* DDOT - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_ddot(hc::accelerator_view accl_view, const int N,
-                           const double *X, const int incX,
-                           const __int64_t xOffset, const double *Y,
-                           const int incY, const __int64_t yOffset,
-                           double &dot);
+  virtual hcblasStatus hcblas_ddot(
+      hc::accelerator_view accl_view, const int N, const double *X,
+      const int incX, const __int64_t xOffset, const double *Y, const int incY,
+      const __int64_t yOffset, double &dot);
 
   /* DDOT - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_ddot(hc::accelerator_view accl_view, const int N,
-                           const double *X, const int incX,
-                           const __int64_t xOffset, const double *Y,
-                           const int incY, const __int64_t yOffset, double &dot,
-                           const __int64_t X_batchOffset,
-                           const __int64_t Y_batchOffset, const int batchSize);
+  virtual hcblasStatus hcblas_ddot(
+      hc::accelerator_view accl_view, const int N, const double *X,
+      const int incX, const __int64_t xOffset, const double *Y, const int incY,
+      const __int64_t yOffset, double &dot, const __int64_t X_batchOffset,
+      const __int64_t Y_batchOffset, const int batchSize);
 
   /* SASUM - Absolute value of a Vector - Single Precision */
   /* SASUM - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
-                            float *X, const int incX, const __int64_t xOffset,
-                            float *Y);
+  virtual hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
+                                    float *X, const int incX,
+                                    const __int64_t xOffset, float *Y);
 
   /* SASUM - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
-                            float *X, const int incX, const __int64_t xOffset,
-                            float *Y, const __int64_t X_batchOffset,
-                            const int batchSize);
+  virtual hcblasStatus hcblas_sasum(
+      hc::accelerator_view accl_view, const int N, float *X, const int incX,
+      const __int64_t xOffset, float *Y, const __int64_t X_batchOffset,
+      const int batchSize);
 
   /* DASUM - Absolute value of a Vector - Double Precision */
   /* DASUM - Overloaded function with arguments of type hc::array */
-  hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
-                            double *X, const int incX, const __int64_t xOffset,
-                            double *Y);
+  virtual hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
+                                    double *X, const int incX,
+                                    const __int64_t xOffset, double *Y);
 
   /* DASUM - Overloaded function with arguments related to batch processing */
-  hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
-                            double *X, const int incX, const __int64_t xOffset,
-                            double *Y, const __int64_t X_batchOffset,
-                            const int batchSize);
+  virtual hcblasStatus hcblas_dasum(
+      hc::accelerator_view accl_view, const int N, double *X, const int incX,
+      const __int64_t xOffset, double *Y, const __int64_t X_batchOffset,
+      const int batchSize);
+};
+
+/* Devices of a multi-device (XT) handle. Each device gets a handle of its
+ own; weights rate their throughput for the scheduler of hcblas_xt.h and
+ blockDim is the side of the blocks of C it shares out. The routines take
+ A, B and C in host memory and return once C is complete. */
+struct hcblasXtContext {
+ public:
+  // Starts on every accelerator of hc::accelerator::get_all() that is not
+  // the CPU or emulated, or on all of them if none is left
+  hcblasXtContext();
+
+  ~hcblasXtContext();
+
+  /* Replaces the devices by the accelerators at ids in
+   hc::accelerator::get_all(). Returns false, keeping the current devices,
+   if ids is empty, an id is out of range or repeated, or a handle cannot
+   be created. */
+  bool select(const std::vector<int> &ids);
+
+  std::vector<Hcblaslibrary *> devices;
+  std::vector<double> weights;
+  int blockDim;
+  bool initialized = false;
+
+  /* SGEMM - C = alpha * op(A) * op(B) + beta * C over all the devices */
+  hcblasStatus hcblas_sgemm(hcblasOrder order, hcblasTranspose typeA,
+                            hcblasTranspose typeB, const int M, const int N,
+                            const int K, const float &alpha, const float *A,
+                            const __int64_t lda, const float *B,
+                            const __int64_t ldb, const float &beta, float *C,
+                            const __int64_t ldc);
+
+  /* DGEMM - as hcblas_sgemm in double precision */
+  hcblasStatus hcblas_dgemm(hcblasOrder order, hcblasTranspose typeA,
+                            hcblasTranspose typeB, const int M, const int N,
+                            const int K, const double &alpha,
+                            const double *A, const __int64_t lda,
+                            const double *B, const __int64_t ldb,
+                            const double &beta, double *C,
+                            const __int64_t ldc);
+
+ private:
+  hcblasXtContext(const hcblasXtContext &);
+  hcblasXtContext &operator=(const hcblasXtContext &);
 };
 
 #endif  // LIB_INCLUDE_HCBLASLIB_H_
@@ -0,0 +1,49 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_cpu.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+hcblasBackend hcblasDefaultBackend(const hc::accelerator &accl) {
+  const char *name = getenv("HCBLAS_BACKEND");
+  if (name != NULL && strcmp(name, "cpu") == 0) {
+    return CpuBackend;
+  }
+  if (name != NULL && strcmp(name, "hcc") == 0) {
+    return HccBackend;
+  }
+  return accl.get_device_path() == L"cpu" ? CpuBackend : HccBackend;
+}
+
+Hcblaslibrary *hcblasNewLibrary(hc::accelerator_view *av,
+                                hcblasBackend backend) {
+  if (backend == CpuBackend) {
+    return new (std::nothrow) HcblasCpuLibrary(av);
+  }
+  if (!hcblasLoadTargetKernels(av->get_accelerator())) {
+    return NULL;
+  }
+  return new (std::nothrow) Hcblaslibrary(av);
+}
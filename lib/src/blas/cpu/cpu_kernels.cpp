@@ -0,0 +1,316 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Instruction set specific builds of the CPU inner loops. The loop bodies
+* are written once as plain C++ and inlined into a wrapper per target, so
+* the compiler vectorises each copy for that target; the loops keep
+* independent partial sums per lane so reductions vectorise without
+* reassociation. The GEMM micro kernels keep an mr x nr tile of C in
+* vector registers across the whole K step, with mr and nr picked per
+* target so the tile fills the register file without spilling. The table
+* is chosen once from what the host reports; tests switch between the
+* supported ones with hcblasCpuUseIsa().
+*/
+
+#include "./cpu_kernels.h"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// x86 builds carry SSE, AVX2 and AVX-512 copies; SSE2 is part of x86-64
+// so that one is the baseline. The accelerator pass of HCC never runs host
+// code, so it gets the generic copy only.
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(__HCC_ACCELERATOR__)
+#define CPU_KERNELS_X86 1
+#endif
+
+#define CPU_INLINE inline __attribute__((always_inline))
+
+// Partial sums kept per reduction: two 512 bit registers worth
+#define CPU_LANES(T) (128 / static_cast<int>(sizeof(T)))
+
+template <typename T>
+static CPU_INLINE void axpy_body(__int64_t n, T alpha, const T *__restrict x,
+                                 T *__restrict y) {
+  for (__int64_t i = 0; i < n; i++) {
+    y[i] += alpha * x[i];
+  }
+}
+
+template <typename T>
+static CPU_INLINE void scal_body(__int64_t n, T alpha, T *__restrict x) {
+  for (__int64_t i = 0; i < n; i++) {
+    x[i] *= alpha;
+  }
+}
+
+template <typename T>
+static CPU_INLINE T dot_body(__int64_t n, const T *__restrict x,
+                             const T *__restrict y) {
+  T acc[CPU_LANES(T)] = {};
+  __int64_t i = 0;
+  for (; i + CPU_LANES(T) <= n; i += CPU_LANES(T)) {
+    for (int l = 0; l < CPU_LANES(T); l++) {
+      acc[l] += x[i + l] * y[i + l];
+    }
+  }
+  T sum = 0;
+  for (int l = 0; l < CPU_LANES(T); l++) {
+    sum += acc[l];
+  }
+  for (; i < n; i++) {
+    sum += x[i] * y[i];
+  }
+  return sum;
+}
+
+template <typename T>
+static CPU_INLINE T asum_body(__int64_t n, const T *__restrict x) {
+  T acc[CPU_LANES(T)] = {};
+  __int64_t i = 0;
+  for (; i + CPU_LANES(T) <= n; i += CPU_LANES(T)) {
+    for (int l = 0; l < CPU_LANES(T); l++) {
+      acc[l] += std::fabs(x[i + l]);
+    }
+  }
+  T sum = 0;
+  for (int l = 0; l < CPU_LANES(T); l++) {
+    sum += acc[l];
+  }
+  for (; i < n; i++) {
+    sum += std::fabs(x[i]);
+  }
+  return sum;
+}
+
+// Vector types of 128, 256 and 512 bits for the micro kernels. Built on the
+// compiler vector extension so one body serves every target.
+typedef float cpu_v4sf __attribute__((vector_size(16)));
+typedef float cpu_v8sf __attribute__((vector_size(32)));
+typedef float cpu_v16sf __attribute__((vector_size(64)));
+typedef double cpu_v2df __attribute__((vector_size(16)));
+typedef double cpu_v4df __attribute__((vector_size(32)));
+typedef double cpu_v8df __attribute__((vector_size(64)));
+typedef int cpu_v4si __attribute__((vector_size(16)));
+typedef int cpu_v8si __attribute__((vector_size(32)));
+typedef int cpu_v16si __attribute__((vector_size(64)));
+
+// Vectors of A per micro panel step, and the rows mr that makes with
+// vectors V of T
+#define CPU_MICRO_VR 2
+#define CPU_MICRO_MR(V, T) \
+  (CPU_MICRO_VR * static_cast<int>(sizeof(V) / sizeof(T)))
+
+/* C += A * B for one micro panel pair. The CPU_MICRO_VR x NR accumulators
+ stay in registers for the whole of k; each step loads CPU_MICRO_VR
+ vectors of A and broadcasts NR values of B. The packed panels are dense,
+ so the loads need no masking; memcpy keeps them free of alignment and
+ aliasing assumptions and compiles to plain vector moves. */
+template <typename T, typename V, int NR>
+static CPU_INLINE void micro_body(int k, const T *__restrict A,
+                                  const T *__restrict B, T *__restrict C,
+                                  __int64_t ldc) {
+  const int lanes = sizeof(V) / sizeof(T);
+  const int mr = CPU_MICRO_MR(V, T);
+  V acc[NR][CPU_MICRO_VR];
+  for (int j = 0; j < NR; j++) {
+    for (int r = 0; r < CPU_MICRO_VR; r++) {
+      acc[j][r] = V{};
+    }
+  }
+  for (int p = 0; p < k; p++) {
+    V a[CPU_MICRO_VR];
+    for (int r = 0; r < CPU_MICRO_VR; r++) {
+      memcpy(&a[r], A + p * mr + r * lanes, sizeof(V));
+    }
+    for (int j = 0; j < NR; j++) {
+      V b = V{} + B[p * NR + j];
+      for (int r = 0; r < CPU_MICRO_VR; r++) {
+        acc[j][r] += a[r] * b;
+      }
+    }
+  }
+  for (int j = 0; j < NR; j++) {
+    for (int r = 0; r < CPU_MICRO_VR; r++) {
+      V c;
+      memcpy(&c, C + j * ldc + r * lanes, sizeof(V));
+      c += acc[j][r];
+      memcpy(C + j * ldc + r * lanes, &c, sizeof(V));
+    }
+  }
+}
+
+// Defines the wrappers for one target and the table that points at them.
+// VS, VD and VI are the float, double and int vectors of the target and NR
+// the columns of its micro kernels.
+#define CPU_KERNEL_SET(isa, attr, VS, VD, VI, NR)                             \
+  attr static void saxpy_##isa(__int64_t n, float a, const float *x,          \
+                               float *y) {                                    \
+    axpy_body(n, a, x, y);                                                    \
+  }                                                                           \
+  attr static void daxpy_##isa(__int64_t n, double a, const double *x,        \
+                               double *y) {                                   \
+    axpy_body(n, a, x, y);                                                    \
+  }                                                                           \
+  attr static void sscal_##isa(__int64_t n, float a, float *x) {              \
+    scal_body(n, a, x);                                                       \
+  }                                                                           \
+  attr static void dscal_##isa(__int64_t n, double a, double *x) {            \
+    scal_body(n, a, x);                                                       \
+  }                                                                           \
+  attr static float sdot_##isa(__int64_t n, const float *x, const float *y) { \
+    return dot_body(n, x, y);                                                 \
+  }                                                                           \
+  attr static double ddot_##isa(__int64_t n, const double *x,                 \
+                                const double *y) {                            \
+    return dot_body(n, x, y);                                                 \
+  }                                                                           \
+  attr static float sasum_##isa(__int64_t n, const float *x) {                \
+    return asum_body(n, x);                                                   \
+  }                                                                           \
+  attr static double dasum_##isa(__int64_t n, const double *x) {              \
+    return asum_body(n, x);                                                   \
+  }                                                                           \
+  attr static void sgemm_micro_##isa(int k, const float *A, const float *B,  \
+                                     float *C, __int64_t ldc) {               \
+    micro_body<float, VS, NR>(k, A, B, C, ldc);                               \
+  }                                                                           \
+  attr static void dgemm_micro_##isa(int k, const double *A,                  \
+                                     const double *B, double *C,              \
+                                     __int64_t ldc) {                         \
+    micro_body<double, VD, NR>(k, A, B, C, ldc);                              \
+  }                                                                           \
+  attr static void igemm_micro_##isa(int k, const int *A, const int *B,       \
+                                     int *C, __int64_t ldc) {                 \
+    micro_body<int, VI, NR>(k, A, B, C, ldc);                                 \
+  }                                                                           \
+  static const cpu_kernel_table table_##isa = {                               \
+      #isa,                                                                   \
+      saxpy_##isa,                                                            \
+      daxpy_##isa,                                                            \
+      sscal_##isa,                                                            \
+      dscal_##isa,                                                            \
+      sdot_##isa,                                                             \
+      ddot_##isa,                                                             \
+      sasum_##isa,                                                            \
+      dasum_##isa,                                                            \
+      {CPU_MICRO_MR(VS, float), NR, sgemm_micro_##isa},                       \
+      {CPU_MICRO_MR(VD, double), NR, dgemm_micro_##isa},                      \
+      {CPU_MICRO_MR(VI, int), NR, igemm_micro_##isa}};
+
+/* mr x nr per target: 8 x 4 floats for SSE's 16 registers, 16 x 6 for
+ AVX2's 16 and 32 x 8 for AVX-512's 32, leaving room for the A vectors and
+ the broadcast of B. */
+#ifdef CPU_KERNELS_X86
+CPU_KERNEL_SET(sse, , cpu_v4sf, cpu_v2df, cpu_v4si, 4)
+CPU_KERNEL_SET(avx2, __attribute__((target("avx2,fma"))), cpu_v8sf, cpu_v4df,
+               cpu_v8si, 6)
+CPU_KERNEL_SET(avx512, __attribute__((target("avx512f,avx2,fma"))),
+               cpu_v16sf, cpu_v8df, cpu_v16si, 8)
+#define table_baseline table_sse
+#else
+CPU_KERNEL_SET(generic, , cpu_v4sf, cpu_v2df, cpu_v4si, 4)
+#define table_baseline table_generic
+#endif
+
+int cpu_kernel_tables(const cpu_kernel_table *tables[CPU_KERNEL_TABLES]) {
+  int count = 0;
+#ifdef CPU_KERNELS_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    tables[count++] = &table_avx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    tables[count++] = &table_avx2;
+  }
+#endif
+  tables[count++] = &table_baseline;
+  return count;
+}
+
+static const cpu_kernel_table *cpu_find_kernels(const char *isa) {
+  const cpu_kernel_table *supported[CPU_KERNEL_TABLES];
+  int count = cpu_kernel_tables(supported);
+  for (int i = 0; isa != NULL && i < count; i++) {
+    if (strcmp(isa, supported[i]->isa) == 0) return supported[i];
+  }
+  return NULL;
+}
+
+// Table in use; picked on first use and replaced by hcblasCpuUseIsa()
+static std::atomic<const cpu_kernel_table *> cpu_active(NULL);
+
+const cpu_kernel_table &cpu_kernels() {
+  const cpu_kernel_table *table = cpu_active.load(std::memory_order_acquire);
+  if (table == NULL) {
+    const cpu_kernel_table *pick = cpu_find_kernels(getenv("HCBLAS_CPU_ISA"));
+    if (pick == NULL) {
+      const cpu_kernel_table *supported[CPU_KERNEL_TABLES];
+      cpu_kernel_tables(supported);
+      pick = supported[0];
+    }
+    // Keeps a table hcblasCpuUseIsa() stored in the meantime
+    if (cpu_active.compare_exchange_strong(table, pick,
+                                           std::memory_order_acq_rel)) {
+      table = pick;
+    }
+  }
+  return *table;
+}
+
+const char *hcblasCpuIsa() { return cpu_kernels().isa; }
+
+int hcblasCpuIsas(const char *isas[], int capacity) {
+  const cpu_kernel_table *supported[CPU_KERNEL_TABLES];
+  int count = cpu_kernel_tables(supported);
+  for (int i = 0; i < count && i < capacity; i++) {
+    isas[i] = supported[i]->isa;
+  }
+  return count;
+}
+
+bool hcblasCpuUseIsa(const char *isa) {
+  const cpu_kernel_table *table = cpu_find_kernels(isa);
+  if (table == NULL) return false;
+  cpu_active.store(table, std::memory_order_release);
+  return true;
+}
+
+void *cpu_arena(int slot, size_t bytes) {
+  // Over allocated by the alignment, and only ever grown, so the packed
+  // panels of one thread are reused from call to call
+  static thread_local std::vector<char> arenas[CPU_ARENA_SLOTS];
+  std::vector<char> &arena = arenas[slot];
+  if (arena.size() < bytes + CPU_ARENA_ALIGN) {
+    arena.resize(bytes + CPU_ARENA_ALIGN);
+  }
+  uintptr_t base = reinterpret_cast<uintptr_t>(arena.data());
+  uintptr_t aligned = (base + CPU_ARENA_ALIGN - 1) &
+                      ~static_cast<uintptr_t>(CPU_ARENA_ALIGN - 1);
+  return arena.data() + (aligned - base);
+}
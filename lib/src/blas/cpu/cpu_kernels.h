@@ -0,0 +1,145 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#ifndef LIB_SRC_BLAS_CPU_CPU_KERNELS_H_
+#define LIB_SRC_BLAS_CPU_CPU_KERNELS_H_
+
+#include "include/hcblas_cpu.h"
+#include "include/hcblas_thread_pool.h"
+
+/* Blocking of the CPU GEMM, after GotoBLAS. Each task owns a CPU_GEMM_MC x
+ CPU_GEMM_NC block of C and walks K in steps of CPU_GEMM_KC. The step of
+ op(A) is packed into micro panels of mr rows and stays in L2, the step of
+ op(B) into micro panels of nr columns, one of which stays in L1 while the
+ micro kernel sweeps the A panels; the whole B step fits the L3 share of a
+ core. CPU_GEMM_MC is a multiple of every mr. */
+#define CPU_GEMM_MC 128
+#define CPU_GEMM_NC 256
+#define CPU_GEMM_KC 256
+
+// Largest nr of any micro kernel, for sizing the packed B block
+#define CPU_GEMM_NR_MAX 8
+
+// Elements per task of the level 1 routines and rows or columns per task of
+// the level 2 routines
+#define CPU_LEVEL1_GRAIN 65536
+#define CPU_LEVEL2_GRAIN 64
+
+/* Register blocked GEMM micro kernel: C += A * B for an mr x k micro panel
+ of A (k steps of mr values) and a k x nr micro panel of B (k steps of nr
+ values), with C column major and leading dimension ldc. */
+template <typename T>
+struct cpu_gemm_micro {
+  int mr;
+  int nr;
+  void (*run)(int k, const T *A, const T *B, T *C, __int64_t ldc);
+};
+
+/* Inner loops compiled once per instruction set. All vectors are
+ contiguous; strided operands are handled by the callers. */
+struct cpu_kernel_table {
+  const char *isa;
+  void (*saxpy)(__int64_t n, float alpha, const float *x, float *y);
+  void (*daxpy)(__int64_t n, double alpha, const double *x, double *y);
+  void (*sscal)(__int64_t n, float alpha, float *x);
+  void (*dscal)(__int64_t n, double alpha, double *x);
+  float (*sdot)(__int64_t n, const float *x, const float *y);
+  double (*ddot)(__int64_t n, const double *x, const double *y);
+  float (*sasum)(__int64_t n, const float *x);
+  double (*dasum)(__int64_t n, const double *x);
+  cpu_gemm_micro<float> sgemm;
+  cpu_gemm_micro<double> dgemm;
+  cpu_gemm_micro<int> igemm;
+};
+
+// Tables the host supports, best first; returns how many were written
+#define CPU_KERNEL_TABLES 3
+int cpu_kernel_tables(const cpu_kernel_table *tables[CPU_KERNEL_TABLES]);
+
+// Table in use: the one hcblasCpuUseIsa() last picked, else the best one
+// the host supports, or the one named by HCBLAS_CPU_ISA ( "avx512", "avx2"
+// or "sse"; "generic" off x86 ) if the host supports that one.
+const cpu_kernel_table &cpu_kernels();
+
+// Overloads that let the templates below pick the table entry by type
+inline void cpu_axpy(__int64_t n, float alpha, const float *x, float *y) {
+  cpu_kernels().saxpy(n, alpha, x, y);
+}
+inline void cpu_axpy(__int64_t n, double alpha, const double *x, double *y) {
+  cpu_kernels().daxpy(n, alpha, x, y);
+}
+inline void cpu_scal(__int64_t n, float alpha, float *x) {
+  cpu_kernels().sscal(n, alpha, x);
+}
+inline void cpu_scal(__int64_t n, double alpha, double *x) {
+  cpu_kernels().dscal(n, alpha, x);
+}
+inline float cpu_dot(__int64_t n, const float *x, const float *y) {
+  return cpu_kernels().sdot(n, x, y);
+}
+inline double cpu_dot(__int64_t n, const double *x, const double *y) {
+  return cpu_kernels().ddot(n, x, y);
+}
+inline float cpu_asum(__int64_t n, const float *x) {
+  return cpu_kernels().sasum(n, x);
+}
+inline double cpu_asum(__int64_t n, const double *x) {
+  return cpu_kernels().dasum(n, x);
+}
+
+// Micro kernel for the accumulation type T of a GEMM
+template <typename T>
+const cpu_gemm_micro<T> &cpu_micro_kernel();
+template <>
+inline const cpu_gemm_micro<float> &cpu_micro_kernel<float>() {
+  return cpu_kernels().sgemm;
+}
+template <>
+inline const cpu_gemm_micro<double> &cpu_micro_kernel<double>() {
+  return cpu_kernels().dgemm;
+}
+template <>
+inline const cpu_gemm_micro<int> &cpu_micro_kernel<int>() {
+  return cpu_kernels().igemm;
+}
+
+/* Slots of cpu_arena, one per buffer a GEMM task keeps live at once */
+#define CPU_ARENA_PACK_A 0
+#define CPU_ARENA_PACK_B 1
+#define CPU_ARENA_ACC 2
+#define CPU_ARENA_SLOTS 3
+#define CPU_ARENA_ALIGN 64
+
+/* 64 byte aligned scratch of at least bytes, private to the calling thread.
+ It stays valid until the thread asks for the same slot again, so a
+ routine must not hold it across a call that may run other tasks. */
+void *cpu_arena(int slot, size_t bytes);
+
+// Runs body over [0, count) on the shared pool
+inline void cpu_parallel_for(__int64_t count, __int64_t grain,
+                             const hcblasThreadPool::Body &body) {
+  hcblasThreadPool::instance().parallelFor(count, grain, body);
+}
+
+#endif  // LIB_SRC_BLAS_CPU_CPU_KERNELS_H_
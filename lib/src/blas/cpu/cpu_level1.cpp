@@ -0,0 +1,429 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./cpu_kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Calls body(b, begin, end) for consecutive ranges [begin, end) of each of
+// batchSize vectors of n elements. Long vectors are split, short ones are
+// grouped, so every task covers about CPU_LEVEL1_GRAIN elements.
+template <typename F>
+static void level1_for(__int64_t n, int batchSize, const F &body) {
+  __int64_t chunks = (n + CPU_LEVEL1_GRAIN - 1) / CPU_LEVEL1_GRAIN;
+  __int64_t grain = std::max<__int64_t>(1, CPU_LEVEL1_GRAIN / n);
+  cpu_parallel_for(chunks * batchSize, grain,
+                   [&](__int64_t first, __int64_t last) {
+                     for (__int64_t t = first; t < last; t++) {
+                       __int64_t c = t % chunks;
+                       body(t / chunks, c * CPU_LEVEL1_GRAIN,
+                            std::min(n, (c + 1) * CPU_LEVEL1_GRAIN));
+                     }
+                   });
+}
+
+// Sum of partial(b, begin, end) over the same ranges as level1_for. The
+// partial sums are added in a fixed order, so the result does not depend on
+// the number of threads.
+template <typename T, typename F>
+static T level1_sum(__int64_t n, int batchSize, const F &partial) {
+  __int64_t chunks = (n + CPU_LEVEL1_GRAIN - 1) / CPU_LEVEL1_GRAIN;
+  __int64_t grain = std::max<__int64_t>(1, CPU_LEVEL1_GRAIN / n);
+  std::vector<T> parts(chunks * batchSize);
+  cpu_parallel_for(chunks * batchSize, grain,
+                   [&](__int64_t first, __int64_t last) {
+                     for (__int64_t t = first; t < last; t++) {
+                       __int64_t c = t % chunks;
+                       parts[t] = partial(t / chunks, c * CPU_LEVEL1_GRAIN,
+                                          std::min(n, (c + 1) *
+                                                          CPU_LEVEL1_GRAIN));
+                     }
+                   });
+  T sum = 0;
+  for (size_t t = 0; t < parts.size(); t++) {
+    sum += parts[t];
+  }
+  return sum;
+}
+
+template <typename T>
+static hcblasStatus axpy(int N, T alpha, const T *X, int incX,
+                         __int64_t X_batchOffset, T *Y, int incY,
+                         __int64_t Y_batchOffset, __int64_t xOffset,
+                         __int64_t yOffset, int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  level1_for(N, batchSize, [=](__int64_t b, __int64_t begin, __int64_t end) {
+    const T *x = X + xOffset + b * X_batchOffset;
+    T *y = Y + yOffset + b * Y_batchOffset;
+    if (incX == 1 && incY == 1) {
+      cpu_axpy(end - begin, alpha, x + begin, y + begin);
+      return;
+    }
+    for (__int64_t i = begin; i < end; i++) {
+      y[i * incY] += alpha * x[i * incX];
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+// X = alpha * X for real X, or for complex X and real alpha with R the
+// component type: the components are scaled as one real vector.
+template <typename T, typename R>
+static hcblasStatus scal(int N, R alpha, T *X, int incX, __int64_t xOffset,
+                         __int64_t X_batchOffset, int batchSize) {
+  if (X == NULL || N <= 0 || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  const int parts = sizeof(T) / sizeof(R);
+  level1_for(N, batchSize, [=](__int64_t b, __int64_t begin, __int64_t end) {
+    R *x = reinterpret_cast<R *>(X + xOffset + b * X_batchOffset);
+    if (incX == 1) {
+      cpu_scal((end - begin) * parts, alpha, x + begin * parts);
+      return;
+    }
+    for (__int64_t i = begin; i < end; i++) {
+      for (int p = 0; p < parts; p++) {
+        x[i * incX * parts + p] *= alpha;
+      }
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+// X = alpha * X for complex X and alpha
+template <typename T>
+static hcblasStatus scal_complex(int N, const T &alpha, T *X, int incX,
+                                 __int64_t xOffset, __int64_t X_batchOffset,
+                                 int batchSize) {
+  if (X == NULL || N <= 0 || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  level1_for(N, batchSize, [=](__int64_t b, __int64_t begin, __int64_t end) {
+    T *x = X + xOffset + b * X_batchOffset;
+    for (__int64_t i = begin; i < end; i++) {
+      T v = x[i * incX];
+      x[i * incX].x = alpha.x * v.x - alpha.y * v.y;
+      x[i * incX].y = alpha.x * v.y + alpha.y * v.x;
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+static hcblasStatus copy(int N, const T *X, int incX, __int64_t xOffset, T *Y,
+                         int incY, __int64_t yOffset, __int64_t X_batchOffset,
+                         __int64_t Y_batchOffset, int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  level1_for(N, batchSize, [=](__int64_t b, __int64_t begin, __int64_t end) {
+    const T *x = X + xOffset + b * X_batchOffset;
+    T *y = Y + yOffset + b * Y_batchOffset;
+    if (incX == 1 && incY == 1) {
+      std::copy(x + begin, x + end, y + begin);
+      return;
+    }
+    for (__int64_t i = begin; i < end; i++) {
+      y[i * incY] = x[i * incX];
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+// Like the HCC routines, the batched forms return the sum over the batch
+template <typename T>
+static hcblasStatus dot_product(int N, const T *X, int incX,
+                                __int64_t xOffset, const T *Y, int incY,
+                                __int64_t yOffset, T &result,
+                                __int64_t X_batchOffset,
+                                __int64_t Y_batchOffset, int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  result = level1_sum<T>(
+      N, batchSize, [=](__int64_t b, __int64_t begin, __int64_t end) {
+        const T *x = X + xOffset + b * X_batchOffset;
+        const T *y = Y + yOffset + b * Y_batchOffset;
+        if (incX == 1 && incY == 1) {
+          return cpu_dot(end - begin, x + begin, y + begin);
+        }
+        T sum = 0;
+        for (__int64_t i = begin; i < end; i++) {
+          sum += x[i * incX] * y[i * incY];
+        }
+        return sum;
+      });
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+static hcblasStatus asum(int N, const T *X, int incX, __int64_t xOffset,
+                         T *result, __int64_t X_batchOffset, int batchSize) {
+  if (X == NULL || result == NULL || N <= 0 || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  *result = level1_sum<T>(
+      N, batchSize, [=](__int64_t b, __int64_t begin, __int64_t end) {
+        const T *x = X + xOffset + b * X_batchOffset;
+        if (incX == 1) {
+          return cpu_asum(end - begin, x + begin);
+        }
+        T sum = 0;
+        for (__int64_t i = begin; i < end; i++) {
+          sum += std::fabs(x[i * incX]);
+        }
+        return sum;
+      });
+  return HCBLAS_SUCCEEDS;
+}
+
+/* SAXPY - Y = alpha * X + Y */
+hcblasStatus HcblasCpuLibrary::hcblas_saxpy(
+    hc::accelerator_view accl_view, const int N, const float &alpha,
+    const float *X, const int incX, float *Y, const int incY,
+    const __int64_t xOffset, const __int64_t yOffset) {
+  return axpy(N, alpha, X, incX, 0, Y, incY, 0, xOffset, yOffset, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_saxpy(
+    hc::accelerator_view accl_view, const int N, const float &alpha,
+    const float *X, const int incX, const __int64_t X_batchOffset, float *Y,
+    const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+    const __int64_t yOffset, const int batchSize) {
+  return axpy(N, alpha, X, incX, X_batchOffset, Y, incY, Y_batchOffset, xOffset,
+              yOffset, batchSize);
+}
+
+/* DAXPY - Y = alpha * X + Y */
+hcblasStatus HcblasCpuLibrary::hcblas_daxpy(
+    hc::accelerator_view accl_view, const int N, const double &alpha,
+    const double *X, const int incX, double *Y, const int incY,
+    const __int64_t xOffset, const __int64_t yOffset) {
+  return axpy(N, alpha, X, incX, 0, Y, incY, 0, xOffset, yOffset, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_daxpy(
+    hc::accelerator_view accl_view, const int N, const double &alpha,
+    const double *X, const int incX, const __int64_t X_batchOffset, double *Y,
+    const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+    const __int64_t yOffset, const int batchSize) {
+  return axpy(N, alpha, X, incX, X_batchOffset, Y, incY, Y_batchOffset, xOffset,
+              yOffset, batchSize);
+}
+
+/* SSCAL - X = alpha * X */
+hcblasStatus HcblasCpuLibrary::hcblas_sscal(
+    hc::accelerator_view accl_view, const int N, const float &alpha, float *X,
+    const int incX, const __int64_t xOffset) {
+  return scal(N, alpha, X, incX, xOffset, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_sscal(
+    hc::accelerator_view accl_view, const int N, const float &alpha, float *X,
+    const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+    const int batchSize) {
+  return scal(N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+}
+
+/* DSCAL - X = alpha * X */
+hcblasStatus HcblasCpuLibrary::hcblas_dscal(
+    hc::accelerator_view accl_view, const int N, const double &alpha, double *X,
+    const int incX, const __int64_t xOffset) {
+  return scal(N, alpha, X, incX, xOffset, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_dscal(
+    hc::accelerator_view accl_view, const int N, const double &alpha, double *X,
+    const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+    const int batchSize) {
+  return scal(N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+}
+
+/* CSCAL - X = alpha * X */
+hcblasStatus HcblasCpuLibrary::hcblas_cscal(
+    hc::accelerator_view accl_view, const int N,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *X,
+    const int incX, const __int64_t xOffset) {
+  return scal_complex(N, alpha, X, incX, xOffset, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_cscal(
+    hc::accelerator_view accl_view, const int N,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *X,
+    const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+    const int batchSize) {
+  return scal_complex(N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+}
+
+/* ZSCAL - X = alpha * X */
+hcblasStatus HcblasCpuLibrary::hcblas_zscal(
+    hc::accelerator_view accl_view, const int N,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *X,
+    const int incX, const __int64_t xOffset) {
+  return scal_complex(N, alpha, X, incX, xOffset, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_zscal(
+    hc::accelerator_view accl_view, const int N,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *X,
+    const int incX, const __int64_t xOffset, const __int64_t X_batchOffset,
+    const int batchSize) {
+  return scal_complex(N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+}
+
+/* CSSCAL - X = alpha * X with real alpha */
+hcblasStatus HcblasCpuLibrary::hcblas_csscal(
+    hc::accelerator_view accl_view, const int N, const float &alpha,
+    hc::short_vector::float_2 *X, const int incX, const __int64_t xOffset) {
+  return scal(N, alpha, X, incX, xOffset, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_csscal(
+    hc::accelerator_view accl_view, const int N, const float &alpha,
+    hc::short_vector::float_2 *X, const int incX, const __int64_t xOffset,
+    const __int64_t X_batchOffset, const int batchSize) {
+  return scal(N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+}
+
+/* ZDSCAL - X = alpha * X with real alpha */
+hcblasStatus HcblasCpuLibrary::hcblas_zdscal(
+    hc::accelerator_view accl_view, const int N, const double &alpha,
+    hc::short_vector::double_2 *X, const int incX, const __int64_t xOffset) {
+  return scal(N, alpha, X, incX, xOffset, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_zdscal(
+    hc::accelerator_view accl_view, const int N, const double &alpha,
+    hc::short_vector::double_2 *X, const int incX, const __int64_t xOffset,
+    const __int64_t X_batchOffset, const int batchSize) {
+  return scal(N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+}
+
+/* SCOPY - Y = X */
+hcblasStatus HcblasCpuLibrary::hcblas_scopy(
+    hc::accelerator_view accl_view, const int N, const float *X, const int incX,
+    const __int64_t xOffset, float *Y, const int incY,
+    const __int64_t yOffset) {
+  return copy(N, X, incX, xOffset, Y, incY, yOffset, 0, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_scopy(
+    hc::accelerator_view accl_view, const int N, const float *X, const int incX,
+    const __int64_t xOffset, float *Y, const int incY, const __int64_t yOffset,
+    const __int64_t X_batchOffset, const __int64_t Y_batchOffset,
+    const int batchSize) {
+  return copy(N, X, incX, xOffset, Y, incY, yOffset, X_batchOffset,
+              Y_batchOffset, batchSize);
+}
+
+/* DCOPY - Y = X */
+hcblasStatus HcblasCpuLibrary::hcblas_dcopy(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, double *Y, const int incY,
+    const __int64_t yOffset) {
+  return copy(N, X, incX, xOffset, Y, incY, yOffset, 0, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_dcopy(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, double *Y, const int incY,
+    const __int64_t yOffset, const __int64_t X_batchOffset,
+    const __int64_t Y_batchOffset, const int batchSize) {
+  return copy(N, X, incX, xOffset, Y, incY, yOffset, X_batchOffset,
+              Y_batchOffset, batchSize);
+}
+
+/* SDOT - dot = X' * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_sdot(
+    hc::accelerator_view accl_view, const int N, const float *X, const int incX,
+    const __int64_t xOffset, const float *Y, const int incY,
+    const __int64_t yOffset, float &dot) {
+  return dot_product(N, X, incX, xOffset, Y, incY, yOffset, dot, 0, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_sdot(
+    hc::accelerator_view accl_view, const int N, const float *X, const int incX,
+    const __int64_t xOffset, const float *Y, const int incY,
+    const __int64_t yOffset, float &dot, const __int64_t X_batchOffset,
+    const __int64_t Y_batchOffset, const int batchSize) {
+  return dot_product(N, X, incX, xOffset, Y, incY, yOffset, dot,
+                     X_batchOffset, Y_batchOffset, batchSize);
+}
+
+/* DDOT - dot = X' * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_ddot(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, const double *Y, const int incY,
+    const __int64_t yOffset, double &dot) {
+  return dot_product(N, X, incX, xOffset, Y, incY, yOffset, dot, 0, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_ddot(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, const double *Y, const int incY,
+    const __int64_t yOffset, double &dot, const __int64_t X_batchOffset,
+    const __int64_t Y_batchOffset, const int batchSize) {
+  return dot_product(N, X, incX, xOffset, Y, incY, yOffset, dot,
+                     X_batchOffset, Y_batchOffset, batchSize);
+}
+
+/* SASUM - Y = sum of |X| */
+hcblasStatus HcblasCpuLibrary::hcblas_sasum(
+    hc::accelerator_view accl_view, const int N, float *X, const int incX,
+    const __int64_t xOffset, float *Y) {
+  return asum(N, X, incX, xOffset, Y, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_sasum(
+    hc::accelerator_view accl_view, const int N, float *X, const int incX,
+    const __int64_t xOffset, float *Y, const __int64_t X_batchOffset,
+    const int batchSize) {
+  return asum(N, X, incX, xOffset, Y, X_batchOffset, batchSize);
+}
+
+/* DASUM - Y = sum of |X| */
+hcblasStatus HcblasCpuLibrary::hcblas_dasum(
+    hc::accelerator_view accl_view, const int N, double *X, const int incX,
+    const __int64_t xOffset, double *Y) {
+  return asum(N, X, incX, xOffset, Y, 0, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_dasum(
+    hc::accelerator_view accl_view, const int N, double *X, const int incX,
+    const __int64_t xOffset, double *Y, const __int64_t X_batchOffset,
+    const int batchSize) {
+  return asum(N, X, incX, xOffset, Y, X_batchOffset, batchSize);
+}
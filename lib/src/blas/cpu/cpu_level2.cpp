@@ -0,0 +1,780 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./cpu_kernels.h"
+#include <algorithm>
+#include <vector>
+
+// Calls body(b, begin, end) for blocks of CPU_LEVEL2_GRAIN rows (or
+// columns) [begin, end) of each of batchSize problems with n rows.
+template <typename F>
+static void level2_for(__int64_t n, int batchSize, const F &body) {
+  __int64_t blocks = (n + CPU_LEVEL2_GRAIN - 1) / CPU_LEVEL2_GRAIN;
+  cpu_parallel_for(blocks * batchSize, 1,
+                   [&](__int64_t first, __int64_t last) {
+                     for (__int64_t t = first; t < last; t++) {
+                       __int64_t c = t % blocks;
+                       body(t / blocks, c * CPU_LEVEL2_GRAIN,
+                            std::min(n, (c + 1) * CPU_LEVEL2_GRAIN));
+                     }
+                   });
+}
+
+// Index of element i of a strided vector of n elements; a negative
+// increment walks the vector backwards from its last element, as in BLAS.
+static inline __int64_t level2_index(__int64_t i, __int64_t n, int inc) {
+  return inc > 0 ? i * inc : (i - n + 1) * inc;
+}
+
+// Contiguous copy of the n elements of X, or X itself when it is contiguous
+template <typename T>
+static const T *level2_gather(const T *X, __int64_t n, int inc,
+                              std::vector<T> &buffer) {
+  if (inc == 1) {
+    return X;
+  }
+  buffer.resize(n);
+  for (__int64_t i = 0; i < n; i++) {
+    buffer[i] = X[level2_index(i, n, inc)];
+  }
+  return buffer.data();
+}
+
+// Y(begin:end) = alpha * sum + beta * Y(begin:end); Y is not read when beta
+// is zero
+template <typename T>
+static void level2_store(T *Y, int incY, __int64_t begin, __int64_t end,
+                         T alpha, T beta, const T *sum) {
+  for (__int64_t i = begin; i < end; i++) {
+    T &y = Y[i * incY];
+    y = (beta == 0) ? alpha * sum[i - begin]
+                    : alpha * sum[i - begin] + beta * y;
+  }
+}
+
+template <typename T>
+static hcblasStatus gemv(hcblasOrder order, hcblasTranspose type, int M, int N,
+                         T alpha, const T *A, __int64_t aOffset,
+                         __int64_t A_batchOffset, int lda, const T *X,
+                         __int64_t xOffset, __int64_t X_batchOffset, int incX,
+                         T beta, T *Y, __int64_t yOffset,
+                         __int64_t Y_batchOffset, int incY, int batchSize) {
+  if (X == NULL || Y == NULL || A == NULL || M <= 0 || N <= 0 || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // A row major matrix is the transpose of the same buffer read column major
+  bool trans = order ? (type != NoTrans) : (type == NoTrans);
+  int m = order ? M : N;
+  int n = order ? N : M;
+  int lenX = trans ? m : n;
+  int lenY = trans ? n : m;
+
+  // Gather every strided X once instead of once per block of Y
+  std::vector<T> xBuffer;
+  if (incX != 1) {
+    xBuffer.resize((size_t)lenX * batchSize);
+    for (int b = 0; b < batchSize; b++) {
+      const T *x = X + xOffset + b * X_batchOffset;
+      for (int i = 0; i < lenX; i++) {
+        xBuffer[(size_t)b * lenX + i] = x[(__int64_t)i * incX];
+      }
+    }
+  }
+
+  level2_for(lenY, batchSize, [&](__int64_t b, __int64_t r0, __int64_t r1) {
+    const T *a = A + aOffset + b * A_batchOffset;
+    const T *x = (incX == 1) ? X + xOffset + b * X_batchOffset
+                             : xBuffer.data() + b * lenX;
+    std::vector<T> sum(r1 - r0, T(0));
+    if (alpha != 0) {
+      if (trans) {
+        for (__int64_t r = r0; r < r1; r++) {
+          sum[r - r0] = cpu_dot(m, a + r * lda, x);
+        }
+      } else {
+        for (int j = 0; j < n; j++) {
+          cpu_axpy(r1 - r0, x[j], a + (__int64_t)j * lda + r0, sum.data());
+        }
+      }
+    }
+    level2_store(Y + yOffset + b * Y_batchOffset, incY, r0, r1, alpha, beta,
+                 sum.data());
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+static hcblasStatus ger(hcblasOrder order, int M, int N, T alpha, const T *X,
+                        __int64_t xOffset, __int64_t X_batchOffset, int incX,
+                        const T *Y, __int64_t yOffset, __int64_t Y_batchOffset,
+                        int incY, T *A, __int64_t aOffset,
+                        __int64_t A_batchOffset, int lda, int batchSize) {
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || M <= 0 || incX == 0 ||
+      incY == 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // A row major A += alpha * X * Y' is the column major A' += alpha * Y * X'
+  if (!order) {
+    std::swap(M, N);
+    std::swap(X, Y);
+    std::swap(xOffset, yOffset);
+    std::swap(X_batchOffset, Y_batchOffset);
+    std::swap(incX, incY);
+  }
+
+  level2_for(N, batchSize, [&](__int64_t b, __int64_t c0, __int64_t c1) {
+    std::vector<T> xBuffer;
+    const T *x =
+        level2_gather(X + xOffset + b * X_batchOffset, M, incX, xBuffer);
+    const T *y = Y + yOffset + b * Y_batchOffset;
+    T *a = A + aOffset + b * A_batchOffset;
+    for (__int64_t j = c0; j < c1; j++) {
+      cpu_axpy(M, alpha * y[level2_index(j, N, incY)], x, a + j * lda);
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+static hcblasStatus symv(hcblasOrder order, hcblasUplo uplo, int N, T alpha,
+                         const T *A, __int64_t aOffset, int lda, const T *X,
+                         __int64_t xOffset, int incX, T beta, T *Y,
+                         __int64_t yOffset, int incY) {
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // A row major symmetric matrix is the column major matrix with the other
+  // triangle stored
+  bool upper = (uplo == Upper);
+  if (!order) {
+    upper = !upper;
+  }
+
+  std::vector<T> xBuffer;
+  const T *x = level2_gather(X + xOffset, N, incX, xBuffer);
+  const T *a = A + aOffset;
+  // Rows [r0, r1) of Y take the stored columns r0 to r1 - 1 as dot products
+  // and the stored rows r0 to r1 - 1 of the other columns as column updates
+  level2_for(N, 1, [&](__int64_t, __int64_t r0, __int64_t r1) {
+    std::vector<T> sum(r1 - r0);
+    if (upper) {
+      for (__int64_t i = r0; i < r1; i++) {
+        sum[i - r0] = cpu_dot(i, a + i * lda, x);
+      }
+      for (__int64_t j = r0; j < N; j++) {
+        __int64_t end = std::min<__int64_t>(r1, j + 1);
+        cpu_axpy(end - r0, x[j], a + j * lda + r0, sum.data());
+      }
+    } else {
+      for (__int64_t i = r0; i < r1; i++) {
+        sum[i - r0] = cpu_dot(N - i - 1, a + i * lda + i + 1, x + i + 1);
+      }
+      for (__int64_t j = 0; j < r1; j++) {
+        __int64_t begin = std::max(r0, j);
+        cpu_axpy(r1 - begin, x[j], a + j * lda + begin,
+                 sum.data() + begin - r0);
+      }
+    }
+    level2_store(Y + yOffset, incY, r0, r1, alpha, beta, sum.data());
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+// X = op(A) * X
+template <typename T>
+static hcblasStatus trmv(hcblasOrder order, hcblasUplo uplo,
+                         hcblasTranspose type, hcblasDiag diag, int N,
+                         const T *A, __int64_t aOffset, int lda, T *X,
+                         __int64_t xOffset, int incX) {
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // A row major matrix is the transpose of the same buffer read column major
+  bool upper = (uplo == Upper);
+  bool trans = (type != NoTrans);
+  if (!order) {
+    upper = !upper;
+    trans = !trans;
+  }
+  int unit = (diag == Unit) ? 1 : 0;
+
+  std::vector<T> x(N);
+  for (int i = 0; i < N; i++) {
+    x[i] = X[xOffset + (__int64_t)i * incX];
+  }
+  const T *a = A + aOffset;
+  level2_for(N, 1, [&](__int64_t, __int64_t r0, __int64_t r1) {
+    std::vector<T> sum(r1 - r0);
+    if (trans) {
+      // Row i of op(A) is the stored part of column i
+      for (__int64_t i = r0; i < r1; i++) {
+        __int64_t begin = upper ? 0 : i + unit;
+        __int64_t end = upper ? i + 1 - unit : N;
+        sum[i - r0] = cpu_dot(end - begin, a + i * lda + begin, &x[begin]);
+      }
+    } else if (upper) {
+      for (__int64_t j = r0; j < N; j++) {
+        __int64_t end = std::min<__int64_t>(r1, j + 1 - unit);
+        if (end > r0) {
+          cpu_axpy(end - r0, x[j], a + j * lda + r0, sum.data());
+        }
+      }
+    } else {
+      for (__int64_t j = 0; j < r1; j++) {
+        __int64_t begin = std::max(r0, j + unit);
+        if (begin < r1) {
+          cpu_axpy(r1 - begin, x[j], a + j * lda + begin,
+                   sum.data() + begin - r0);
+        }
+      }
+    }
+    for (__int64_t i = r0; i < r1; i++) {
+      X[xOffset + i * incX] = sum[i - r0] + (unit ? x[i] : T(0));
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+// Solves op(A) * X = B in place by substitution. Every step depends on the
+// one before, so the routine runs on the calling thread.
+template <typename T>
+static hcblasStatus trsv(hcblasOrder order, hcblasUplo uplo,
+                         hcblasTranspose type, hcblasDiag diag, int N,
+                         const T *A, __int64_t aOffset, int lda, T *X,
+                         __int64_t xOffset, int incX) {
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // A row major matrix is the transpose of the same buffer read column major
+  bool upper = (uplo == Upper);
+  bool trans = (type != NoTrans);
+  if (!order) {
+    upper = !upper;
+    trans = !trans;
+  }
+  bool lowerOp = (upper == trans);
+  bool unit = (diag == Unit);
+
+  std::vector<T> x(N);
+  for (int i = 0; i < N; i++) {
+    x[i] = X[xOffset + (__int64_t)i * incX];
+  }
+  const T *a = A + aOffset;
+  for (__int64_t s = 0; s < N; s++) {
+    __int64_t i = lowerOp ? s : N - 1 - s;
+    const T *column = a + i * lda;
+    if (trans) {
+      // Row i of op(A) is column i of A
+      if (upper) {
+        x[i] -= cpu_dot(i, column, x.data());
+      } else {
+        x[i] -= cpu_dot(N - i - 1, column + i + 1, &x[i + 1]);
+      }
+      if (!unit) {
+        x[i] /= column[i];
+      }
+    } else {
+      if (!unit) {
+        x[i] /= column[i];
+      }
+      if (upper) {
+        cpu_axpy(i, -x[i], column, x.data());
+      } else {
+        cpu_axpy(N - i - 1, -x[i], column + i + 1, &x[i + 1]);
+      }
+    }
+  }
+  for (int i = 0; i < N; i++) {
+    X[xOffset + (__int64_t)i * incX] = x[i];
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+// A = alpha * X * Y' + alpha * Y * X' + A on one triangle, or
+// A = alpha * X * X' + A when Y is NULL
+template <typename T>
+static hcblasStatus syr2(hcblasOrder order, hcblasUplo uplo, int N, T alpha,
+                         const T *X, __int64_t xOffset, int incX, const T *Y,
+                         __int64_t yOffset, int incY, T *A, __int64_t aOffset,
+                         int lda) {
+  if (alpha == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool upper = (uplo == Upper);
+  if (!order) {
+    upper = !upper;
+  }
+
+  std::vector<T> xBuffer, yBuffer;
+  const T *x = level2_gather(X + xOffset, N, incX, xBuffer);
+  const T *y = (Y == NULL) ? NULL : level2_gather(Y + yOffset, N, incY,
+                                                  yBuffer);
+  T *a = A + aOffset;
+  level2_for(N, 1, [&](__int64_t, __int64_t c0, __int64_t c1) {
+    for (__int64_t j = c0; j < c1; j++) {
+      __int64_t begin = upper ? 0 : j;
+      __int64_t end = upper ? j + 1 : N;
+      T *column = a + j * lda;
+      if (y == NULL) {
+        cpu_axpy(end - begin, alpha * x[j], x + begin, column + begin);
+      } else {
+        cpu_axpy(end - begin, alpha * y[j], x + begin, column + begin);
+        cpu_axpy(end - begin, alpha * x[j], y + begin, column + begin);
+      }
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+static hcblasStatus gbmv(hcblasOrder order, hcblasTranspose type, int M, int N,
+                         int KL, int KU, T alpha, const T *A,
+                         __int64_t aOffset, int lda, const T *X,
+                         __int64_t xOffset, int incX, T beta, T *Y,
+                         __int64_t yOffset, int incY) {
+  if (X == NULL || Y == NULL || A == NULL || M <= 0 || N <= 0 || KL < 0 ||
+      KU < 0 || lda < KL + KU + 1 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // Row major band storage of A is column major band storage of A'
+  bool trans = order ? (type != NoTrans) : (type == NoTrans);
+  __int64_t m = order ? M : N;
+  __int64_t n = order ? N : M;
+  __int64_t kl = order ? KL : KU;
+  __int64_t ku = order ? KU : KL;
+  __int64_t lenX = trans ? m : n;
+  __int64_t lenY = trans ? n : m;
+
+  std::vector<T> xBuffer;
+  const T *x = level2_gather(X + xOffset, lenX, incX, xBuffer);
+  // A(i, j) is stored at a[j * lda + ku + i - j], so the band part of each
+  // column is contiguous
+  const T *a = A + aOffset + ku;
+  level2_for(lenY, 1, [&](__int64_t, __int64_t r0, __int64_t r1) {
+    std::vector<T> sum(r1 - r0, T(0));
+    if (trans) {
+      for (__int64_t r = r0; r < r1; r++) {
+        __int64_t begin = std::max<__int64_t>(0, r - ku);
+        __int64_t end = std::min(m, r + kl + 1);
+        if (begin < end) {
+          sum[r - r0] =
+              cpu_dot(end - begin, a + r * lda + begin - r, x + begin);
+        }
+      }
+    } else {
+      __int64_t last = std::min(n, r1 + ku);
+      for (__int64_t j = std::max<__int64_t>(0, r0 - kl); j < last; j++) {
+        __int64_t begin = std::max(r0, j - ku);
+        __int64_t end = std::min(r1, j + kl + 1);
+        if (begin < end) {
+          cpu_axpy(end - begin, x[j], a + j * lda + begin - j,
+                   sum.data() + begin - r0);
+        }
+      }
+    }
+    level2_store(Y + yOffset, incY, r0, r1, alpha, beta, sum.data());
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+static hcblasStatus sbmv(hcblasOrder order, hcblasUplo uplo, int N, int K,
+                         T alpha, const T *A, __int64_t aOffset, int lda,
+                         const T *X, __int64_t xOffset, int incX, T beta, T *Y,
+                         __int64_t yOffset, int incY) {
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || K < 0 || lda < K + 1 ||
+      incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // Row major band storage of one triangle is column major band storage of
+  // the other
+  bool upper = (uplo == Upper);
+  if (!order) {
+    upper = !upper;
+  }
+
+  std::vector<T> xBuffer;
+  const T *x = level2_gather(X + xOffset, N, incX, xBuffer);
+  // A(i, j) is stored at a[j * lda + i - j], shifted by K for the upper
+  // triangle
+  const T *a = A + aOffset + (upper ? K : 0);
+  level2_for(N, 1, [&](__int64_t, __int64_t r0, __int64_t r1) {
+    std::vector<T> sum(r1 - r0);
+    if (upper) {
+      for (__int64_t i = r0; i < r1; i++) {
+        __int64_t begin = std::max<__int64_t>(0, i - K);
+        sum[i - r0] = cpu_dot(i - begin, a + i * lda + begin - i, x + begin);
+      }
+      __int64_t last = std::min<__int64_t>(N, r1 + K);
+      for (__int64_t j = r0; j < last; j++) {
+        __int64_t begin = std::max<__int64_t>(r0, j - K);
+        __int64_t end = std::min<__int64_t>(r1, j + 1);
+        if (begin < end) {
+          cpu_axpy(end - begin, x[j], a + j * lda + begin - j,
+                   sum.data() + begin - r0);
+        }
+      }
+    } else {
+      for (__int64_t i = r0; i < r1; i++) {
+        __int64_t end = std::min<__int64_t>(N, i + K + 1);
+        sum[i - r0] = cpu_dot(end - i - 1, a + i * lda + 1, x + i + 1);
+      }
+      for (__int64_t j = std::max<__int64_t>(0, r0 - K); j < r1; j++) {
+        __int64_t begin = std::max(r0, j);
+        __int64_t end = std::min<__int64_t>(r1, j + K + 1);
+        if (begin < end) {
+          cpu_axpy(end - begin, x[j], a + j * lda + begin - j,
+                   sum.data() + begin - r0);
+        }
+      }
+    }
+    level2_store(Y + yOffset, incY, r0, r1, alpha, beta, sum.data());
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+
+/* SGER - A = alpha * X * Y' + A */
+hcblasStatus HcblasCpuLibrary::hcblas_sger(
+    hc::accelerator_view accl_view, hcblasOrder order, const int M, const int N,
+    const float &alpha, const float *X, const __int64_t xOffset, const int incX,
+    const float *Y, const __int64_t yOffset, const int incY, float *A,
+    const __int64_t aOffset, const int lda) {
+  return ger(order, M, N, alpha, X, xOffset, 0, incX, Y, yOffset, 0, incY, A,
+             aOffset, 0, lda, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_sger(
+    hc::accelerator_view accl_view, hcblasOrder order, const int M, const int N,
+    const float &alpha, const float *X, const __int64_t xOffset,
+    const __int64_t X_batchOffset, const int incX, const float *Y,
+    const __int64_t yOffset, const __int64_t Y_batchOffset, const int incY,
+    float *A, const __int64_t aOffset, const __int64_t A_batchOffset,
+    const int lda, const int batchSize) {
+  return ger(order, M, N, alpha, X, xOffset, X_batchOffset, incX, Y, yOffset,
+             Y_batchOffset, incY, A, aOffset, A_batchOffset, lda, batchSize);
+}
+
+/* DGER - A = alpha * X * Y' + A */
+hcblasStatus HcblasCpuLibrary::hcblas_dger(
+    hc::accelerator_view accl_view, hcblasOrder order, const int M, const int N,
+    const double &alpha, const double *X, const __int64_t xOffset,
+    const int incX, const double *Y, const __int64_t yOffset, const int incY,
+    double *A, const __int64_t aOffset, const int lda) {
+  return ger(order, M, N, alpha, X, xOffset, 0, incX, Y, yOffset, 0, incY, A,
+             aOffset, 0, lda, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_dger(
+    hc::accelerator_view accl_view, hcblasOrder order, const int M, const int N,
+    const double &alpha, const double *X, const __int64_t xOffset,
+    const __int64_t X_batchOffset, const int incX, const double *Y,
+    const __int64_t yOffset, const __int64_t Y_batchOffset, const int incY,
+    double *A, const __int64_t aOffset, const __int64_t A_batchOffset,
+    const int lda, const int batchSize) {
+  return ger(order, M, N, alpha, X, xOffset, X_batchOffset, incX, Y, yOffset,
+             Y_batchOffset, incY, A, aOffset, A_batchOffset, lda, batchSize);
+}
+
+/* SGEMV - Y = alpha * op(A) * X + beta * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_sgemv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const float &alpha, float *A,
+    const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+    const int incX, const float &beta, float *Y, const __int64_t yOffset,
+    const int incY) {
+  return gemv(order, type, M, N, alpha, A, aOffset, 0, lda, X, xOffset, 0, incX,
+              beta, Y, yOffset, 0, incY, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_sgemv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const float &alpha, float *A,
+    const __int64_t aOffset, const __int64_t A_batchOffset, const int lda,
+    float *X, const __int64_t xOffset, const __int64_t X_batchOffset,
+    const int incX, const float &beta, float *Y, const __int64_t yOffset,
+    const __int64_t Y_batchOffset, const int incY, const int batchSize) {
+  return gemv(order, type, M, N, alpha, A, aOffset, A_batchOffset, lda, X,
+              xOffset, X_batchOffset, incX, beta, Y, yOffset, Y_batchOffset,
+              incY, batchSize);
+}
+
+/* DGEMV - Y = alpha * op(A) * X + beta * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_dgemv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const double &alpha, double *A,
+    const __int64_t aOffset, const int lda, double *X, const __int64_t xOffset,
+    const int incX, const double &beta, double *Y, const __int64_t yOffset,
+    const int incY) {
+  return gemv(order, type, M, N, alpha, A, aOffset, 0, lda, X, xOffset, 0, incX,
+              beta, Y, yOffset, 0, incY, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_dgemv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const double &alpha, double *A,
+    const __int64_t aOffset, const __int64_t A_batchOffset, const int lda,
+    double *X, const __int64_t xOffset, const __int64_t X_batchOffset,
+    const int incX, const double &beta, double *Y, const __int64_t yOffset,
+    const __int64_t Y_batchOffset, const int incY, const int batchSize) {
+  return gemv(order, type, M, N, alpha, A, aOffset, A_batchOffset, lda, X,
+              xOffset, X_batchOffset, incX, beta, Y, yOffset, Y_batchOffset,
+              incY, batchSize);
+}
+
+/* SSYMV - Y = alpha * A * X + beta * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_ssymv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const float &alpha, const float *A, const __int64_t aOffset,
+    const int lda, const float *X, const __int64_t xOffset, const int incX,
+    const float &beta, float *Y, const __int64_t yOffset, const int incY) {
+  return symv(order, uplo, N, alpha, A, aOffset, lda, X, xOffset, incX, beta, Y,
+              yOffset, incY);
+}
+
+/* DSYMV - Y = alpha * A * X + beta * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_dsymv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const double &alpha, const double *A, const __int64_t aOffset,
+    const int lda, const double *X, const __int64_t xOffset, const int incX,
+    const double &beta, double *Y, const __int64_t yOffset, const int incY) {
+  return symv(order, uplo, N, alpha, A, aOffset, lda, X, xOffset, incX, beta, Y,
+              yOffset, incY);
+}
+
+/* CHEMV - Y = alpha * A * X + beta * Y */
+hcblasStatus HcblasCpuLibrary::hcblas_chemv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const hc::short_vector::float_2 &alpha,
+    const hc::short_vector::float_2 *A, const __int64_t aOffset, const int lda,
+    const hc::short_vector::float_2 *X, const __int64_t xOffset, const int incX,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *Y,
+    const __int64_t yOffset, const int incY) {
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha.x == 0 && alpha.y == 0 && beta.x == 1 && beta.y == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  __int64_t rowStride = order ? 1 : lda;
+  __int64_t colStride = order ? lda : 1;
+  bool upper = (uplo == Upper);
+  const hc::short_vector::float_2 *a = A + aOffset;
+  level2_for(N, 1, [&](__int64_t, __int64_t r0, __int64_t r1) {
+    for (__int64_t i = r0; i < r1; i++) {
+      float sumReal = 0.0f, sumImg = 0.0f;
+      for (__int64_t j = 0; j < N; j++) {
+        // The other triangle is conj(A(j, i)); the imaginary part of the
+        // diagonal is assumed to be zero
+        bool stored = upper ? (i <= j) : (i >= j);
+        hc::short_vector::float_2 v =
+            stored ? a[i * rowStride + j * colStride]
+                   : a[j * rowStride + i * colStride];
+        float ar = v.x;
+        float ai = (i == j) ? 0.0f : (stored ? v.y : -v.y);
+        hc::short_vector::float_2 x = X[xOffset + j * incX];
+        sumReal += ar * x.x - ai * x.y;
+        sumImg += ar * x.y + ai * x.x;
+      }
+      __int64_t Y_index = yOffset + i * incY;
+      float outReal = alpha.x * sumReal - alpha.y * sumImg;
+      float outImg = alpha.x * sumImg + alpha.y * sumReal;
+      if (beta.x != 0 || beta.y != 0) {
+        hc::short_vector::float_2 y = Y[Y_index];
+        outReal += beta.x * y.x - beta.y * y.y;
+        outImg += beta.x * y.y + beta.y * y.x;
+      }
+      Y[Y_index] = hc::short_vector::float_2(outReal, outImg);
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+/* STRMV - X = op(A) * X */
+hcblasStatus HcblasCpuLibrary::hcblas_strmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const float *A,
+    const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+    const int incX) {
+  return trmv(order, uplo, type, diag, N, A, aOffset, lda, X, xOffset, incX);
+}
+
+/* DTRMV - X = op(A) * X */
+hcblasStatus HcblasCpuLibrary::hcblas_dtrmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const double *A,
+    const __int64_t aOffset, const int lda, double *X, const __int64_t xOffset,
+    const int incX) {
+  return trmv(order, uplo, type, diag, N, A, aOffset, lda, X, xOffset, incX);
+}
+
+/* STRSV - solves op(A) * X = B */
+hcblasStatus HcblasCpuLibrary::hcblas_strsv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const float *A,
+    const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+    const int incX) {
+  return trsv(order, uplo, type, diag, N, A, aOffset, lda, X, xOffset, incX);
+}
+
+/* DTRSV - solves op(A) * X = B */
+hcblasStatus HcblasCpuLibrary::hcblas_dtrsv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const double *A,
+    const __int64_t aOffset, const int lda, double *X, const __int64_t xOffset,
+    const int incX) {
+  return trsv(order, uplo, type, diag, N, A, aOffset, lda, X, xOffset, incX);
+}
+
+/* SSYR - A = alpha * X * X' + A */
+hcblasStatus HcblasCpuLibrary::hcblas_ssyr(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const float &alpha, const float *X, const __int64_t xOffset,
+    const int incX, float *A, const __int64_t aOffset, const int lda) {
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2<float>(order, uplo, N, alpha, X, xOffset, incX, NULL, 0, 0, A,
+                     aOffset, lda);
+}
+
+/* DSYR - A = alpha * X * X' + A */
+hcblasStatus HcblasCpuLibrary::hcblas_dsyr(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const double &alpha, const double *X, const __int64_t xOffset,
+    const int incX, double *A, const __int64_t aOffset, const int lda) {
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2<double>(order, uplo, N, alpha, X, xOffset, incX, NULL, 0, 0, A,
+                      aOffset, lda);
+}
+
+/* SSYR2 - A = alpha * X * Y' + alpha * Y * X' + A */
+hcblasStatus HcblasCpuLibrary::hcblas_ssyr2(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const float &alpha, const float *X, const __int64_t xOffset,
+    const int incX, const float *Y, const __int64_t yOffset, const int incY,
+    float *A, const __int64_t aOffset, const int lda) {
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2(order, uplo, N, alpha, X, xOffset, incX, Y, yOffset, incY, A,
+              aOffset, lda);
+}
+
+/* DSYR2 - A = alpha * X * Y' + alpha * Y * X' + A */
+hcblasStatus HcblasCpuLibrary::hcblas_dsyr2(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const double &alpha, const double *X, const __int64_t xOffset,
+    const int incX, const double *Y, const __int64_t yOffset, const int incY,
+    double *A, const __int64_t aOffset, const int lda) {
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2(order, uplo, N, alpha, X, xOffset, incX, Y, yOffset, incY, A,
+              aOffset, lda);
+}
+
+/* SGBMV - Y = alpha * op(A) * X + beta * Y for a band matrix A */
+hcblasStatus HcblasCpuLibrary::hcblas_sgbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const int KL, const int KU, const float &alpha,
+    const float *A, const __int64_t aOffset, const int lda, const float *X,
+    const __int64_t xOffset, const int incX, const float &beta, float *Y,
+    const __int64_t yOffset, const int incY) {
+  return gbmv(order, type, M, N, KL, KU, alpha, A, aOffset, lda, X, xOffset,
+              incX, beta, Y, yOffset, incY);
+}
+
+/* DGBMV - Y = alpha * op(A) * X + beta * Y for a band matrix A */
+hcblasStatus HcblasCpuLibrary::hcblas_dgbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const int KL, const int KU, const double &alpha,
+    const double *A, const __int64_t aOffset, const int lda, const double *X,
+    const __int64_t xOffset, const int incX, const double &beta, double *Y,
+    const __int64_t yOffset, const int incY) {
+  return gbmv(order, type, M, N, KL, KU, alpha, A, aOffset, lda, X, xOffset,
+              incX, beta, Y, yOffset, incY);
+}
+
+/* SSBMV - Y = alpha * A * X + beta * Y for a symmetric band matrix A */
+hcblasStatus HcblasCpuLibrary::hcblas_ssbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const int K, const float &alpha, const float *A,
+    const __int64_t aOffset, const int lda, const float *X,
+    const __int64_t xOffset, const int incX, const float &beta, float *Y,
+    const __int64_t yOffset, const int incY) {
+  return sbmv(order, uplo, N, K, alpha, A, aOffset, lda, X, xOffset, incX, beta,
+              Y, yOffset, incY);
+}
+
+/* DSBMV - Y = alpha * A * X + beta * Y for a symmetric band matrix A */
+hcblasStatus HcblasCpuLibrary::hcblas_dsbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const int K, const double &alpha, const double *A,
+    const __int64_t aOffset, const int lda, const double *X,
+    const __int64_t xOffset, const int incX, const double &beta, double *Y,
+    const __int64_t yOffset, const int incY) {
+  return sbmv(order, uplo, N, K, alpha, A, aOffset, lda, X, xOffset, incX, beta,
+              Y, yOffset, incY);
+}
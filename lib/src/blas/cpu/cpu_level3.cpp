@@ -0,0 +1,757 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./cpu_kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/* Conversion of a stored operand to the compute type while it is packed */
+template <typename TS, typename T>
+static inline TS cpu_load(T value) {
+  return static_cast<TS>(value);
+}
+
+template <>
+inline float cpu_load<float, hcBfloat16>(hcBfloat16 value) {
+  return hcblasBfloat16ToFloat(value);
+}
+
+/* Conversion of the compute type result back to the storage type of C */
+template <typename TC, typename TS>
+static inline TC cpu_store(TS value) {
+  return static_cast<TC>(value);
+}
+
+template <>
+inline hcBfloat16 cpu_store<hcBfloat16, float>(float value) {
+  return hcblasFloatToBfloat16(value);
+}
+
+/* One column major problem of a batch or group: op(A) is M x K and op(B)
+ is K x N */
+template <typename TA, typename TB>
+struct gemm_problem {
+  const TA *A;
+  __int64_t lda;
+  const TB *B;
+  __int64_t ldb;
+  int M;
+  int N;
+  int K;
+};
+
+/* Packs rows x k elements, element (r, p) at src[r * rs + p * ps] and
+ converted to TS, into micro panels of width rows: panel q holds rows
+ q * width on, as k steps of width values, zero padded past rows. op(A) is
+ packed by rows and op(B) by columns, so either transpose is read straight
+ from the caller's matrix. */
+template <typename TS, typename T>
+static void gemm_pack(const T *src, __int64_t rs, __int64_t ps, int rows,
+                      int k, int width, TS *packed) {
+  for (int r0 = 0; r0 < rows; r0 += width) {
+    int w = std::min(width, rows - r0);
+    TS *panel = packed + (__int64_t)r0 * k;
+    for (int p = 0; p < k; p++) {
+      const T *s = src + r0 * rs + p * ps;
+      int r = 0;
+      for (; r < w; r++) {
+        panel[p * width + r] = cpu_load<TS>(s[r * rs]);
+      }
+      for (; r < width; r++) {
+        panel[p * width + r] = TS(0);
+      }
+    }
+  }
+}
+
+/*
+ * Blocked GEMM over a list of column major problems. Every task owns a
+ * CPU_GEMM_MC x CPU_GEMM_NC block of one C and accumulates op(A) * op(B)
+ * for it in TS. Each CPU_GEMM_KC deep step packs op(A) into mr row and
+ * op(B) into nr column micro panels (converted to TS) in the thread's
+ * arenas, then the micro kernel of the host's instruction set updates the
+ * block one mr x nr tile at a time, the B panel outermost so it stays in
+ * L1. The finished block is passed element by element to
+ * store(p, i, j, acc), which applies alpha, beta and any epilogue, so no
+ * routine needs a second pass over C.
+ */
+template <typename TS, typename TA, typename TB, typename Store>
+static void gemm_driver(bool transA, bool transB,
+                        const std::vector<gemm_problem<TA, TB> > &problems,
+                        const Store &store) {
+  // Tiles of problem p are first[p] to first[p + 1] - 1
+  std::vector<__int64_t> first(problems.size() + 1, 0);
+  for (size_t p = 0; p < problems.size(); p++) {
+    __int64_t tilesM = (problems[p].M + CPU_GEMM_MC - 1) / CPU_GEMM_MC;
+    __int64_t tilesN = (problems[p].N + CPU_GEMM_NC - 1) / CPU_GEMM_NC;
+    first[p + 1] = first[p] + tilesM * tilesN;
+  }
+  const cpu_gemm_micro<TS> &micro = cpu_micro_kernel<TS>();
+
+  cpu_parallel_for(first.back(), 1, [&](__int64_t begin, __int64_t end) {
+    const size_t columns = CPU_GEMM_NC + CPU_GEMM_NR_MAX;
+    TS *acc = static_cast<TS *>(
+        cpu_arena(CPU_ARENA_ACC, sizeof(TS) * CPU_GEMM_MC * columns));
+    TS *packA = static_cast<TS *>(
+        cpu_arena(CPU_ARENA_PACK_A, sizeof(TS) * CPU_GEMM_MC * CPU_GEMM_KC));
+    TS *packB = static_cast<TS *>(
+        cpu_arena(CPU_ARENA_PACK_B, sizeof(TS) * CPU_GEMM_KC * columns));
+    for (__int64_t t = begin; t < end; t++) {
+      int p = std::upper_bound(first.begin(), first.end(), t) - first.begin() -
+              1;
+      const gemm_problem<TA, TB> &problem = problems[p];
+      __int64_t tilesM = (problem.M + CPU_GEMM_MC - 1) / CPU_GEMM_MC;
+      __int64_t i0 = ((t - first[p]) % tilesM) * CPU_GEMM_MC;
+      __int64_t j0 = ((t - first[p]) / tilesM) * CPU_GEMM_NC;
+      int m = std::min<__int64_t>(CPU_GEMM_MC, problem.M - i0);
+      int n = std::min<__int64_t>(CPU_GEMM_NC, problem.N - j0);
+      // acc holds the block padded to whole micro tiles
+      __int64_t ldacc = (m + micro.mr - 1) / micro.mr * micro.mr;
+      int columnsN = (n + micro.nr - 1) / micro.nr * micro.nr;
+
+      std::fill(acc, acc + ldacc * columnsN, TS(0));
+      for (int k0 = 0; k0 < problem.K; k0 += CPU_GEMM_KC) {
+        int k = std::min(CPU_GEMM_KC, problem.K - k0);
+        if (transA) {
+          gemm_pack(problem.A + i0 * problem.lda + k0, problem.lda, 1, m, k,
+                    micro.mr, packA);
+        } else {
+          gemm_pack(problem.A + k0 * problem.lda + i0, 1, problem.lda, m, k,
+                    micro.mr, packA);
+        }
+        if (transB) {
+          gemm_pack(problem.B + k0 * problem.ldb + j0, 1, problem.ldb, n, k,
+                    micro.nr, packB);
+        } else {
+          gemm_pack(problem.B + j0 * problem.ldb + k0, problem.ldb, 1, n, k,
+                    micro.nr, packB);
+        }
+        for (int jr = 0; jr < n; jr += micro.nr) {
+          for (int ir = 0; ir < m; ir += micro.mr) {
+            micro.run(k, packA + (__int64_t)ir * k, packB + (__int64_t)jr * k,
+                      acc + jr * ldacc + ir, ldacc);
+          }
+        }
+      }
+
+      for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+          store(p, i0 + i, j0 + j, acc[j * ldacc + i]);
+        }
+      }
+    }
+  });
+}
+
+// One GEMM in either order. store receives the elements of the column major
+// C, or of C' for a row major C, whose leading dimension is the same.
+template <typename TS, typename TA, typename TB, typename Store>
+static void gemm_ordered(hcblasOrder order, hcblasTranspose typeA,
+                         hcblasTranspose typeB, int M, int N, int K,
+                         const TA *A, __int64_t lda, const TB *B,
+                         __int64_t ldb, const Store &store) {
+  if (order) {
+    gemm_problem<TA, TB> problem = {A, lda, B, ldb, M, N, K};
+    gemm_driver<TS>(typeA == Trans, typeB == Trans,
+                    std::vector<gemm_problem<TA, TB> >(1, problem), store);
+  } else {
+    // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+    gemm_problem<TB, TA> problem = {B, ldb, A, lda, N, M, K};
+    gemm_driver<TS>(typeB == Trans, typeA == Trans,
+                    std::vector<gemm_problem<TB, TA> >(1, problem), store);
+  }
+}
+
+/* C = alpha * op(A) * op(B) + beta * C for each of batchSize problems,
+ accumulating in TS. The single GEMMs pass a batch of one. */
+template <typename T, typename TS>
+static hcblasStatus gemm(hcblasOrder order, hcblasTranspose typeA,
+                         hcblasTranspose typeB, int M, int N, int K, TS alpha,
+                         T *const *A, __int64_t lda, __int64_t A_batchOffset,
+                         T *const *B, __int64_t ldb, __int64_t B_batchOffset,
+                         TS beta, T *const *C, __int64_t ldc,
+                         __int64_t C_batchOffset, __int64_t aOffset,
+                         __int64_t bOffset, __int64_t cOffset, int batchSize) {
+  if (A == NULL || B == NULL || C == NULL || M <= 0 || N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+  std::vector<gemm_problem<T, T> > problems(batchSize);
+  for (int b = 0; b < batchSize; b++) {
+    if (A[b] == NULL || B[b] == NULL || C[b] == NULL) {
+      return HCBLAS_INVALID;
+    }
+    const T *a = A[b] + aOffset + A_batchOffset;
+    const T *bm = B[b] + bOffset + B_batchOffset;
+    gemm_problem<T, T> &problem = problems[b];
+    problem.A = order ? a : bm;
+    problem.lda = order ? lda : ldb;
+    problem.B = order ? bm : a;
+    problem.ldb = order ? ldb : lda;
+    problem.M = order ? M : N;
+    problem.N = order ? N : M;
+    // alpha == 0 leaves C = beta * C, so the product is skipped
+    problem.K = (alpha == TS(0)) ? 0 : K;
+  }
+
+  gemm_driver<TS>(order ? typeA == Trans : typeB == Trans,
+                  order ? typeB == Trans : typeA == Trans, problems,
+                  [=](int p, __int64_t i, __int64_t j, TS acc) {
+                    T &c = C[p][cOffset + C_batchOffset + j * ldc + i];
+                    TS value = alpha * acc;
+                    if (beta != TS(0)) {
+                      value += beta * static_cast<TS>(c);
+                    }
+                    c = static_cast<T>(value);
+                  });
+  return HCBLAS_SUCCEEDS;
+}
+
+// C = alpha * op(A) * op(B) + beta * C for complex T; the product is formed
+// with plain loops over CPU_GEMM_MC x CPU_GEMM_NC blocks of C
+template <typename T>
+static hcblasStatus complex_gemm(hcblasOrder order, hcblasTranspose typeA,
+                                 hcblasTranspose typeB, int M, int N, int K,
+                                 const T &alpha, T *const *A,
+                                 __int64_t aOffset, __int64_t A_batchOffset,
+                                 __int64_t lda, T *const *B, __int64_t bOffset,
+                                 __int64_t B_batchOffset, __int64_t ldb,
+                                 const T &beta, T *const *C, __int64_t cOffset,
+                                 __int64_t C_batchOffset, __int64_t ldc,
+                                 int batchSize) {
+  if (A == NULL || B == NULL || C == NULL || M <= 0 || N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+  for (int b = 0; b < batchSize; b++) {
+    if (A[b] == NULL || B[b] == NULL || C[b] == NULL) {
+      return HCBLAS_INVALID;
+    }
+  }
+
+  // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+  bool transA = order ? typeA == Trans : typeB == Trans;
+  bool transB = order ? typeB == Trans : typeA == Trans;
+  int m = order ? M : N;
+  int n = order ? N : M;
+  int k = (alpha.x == 0 && alpha.y == 0) ? 0 : K;
+  __int64_t tilesM = (m + CPU_GEMM_MC - 1) / CPU_GEMM_MC;
+  __int64_t tilesN = (n + CPU_GEMM_NC - 1) / CPU_GEMM_NC;
+
+  cpu_parallel_for(tilesM * tilesN * batchSize, 1, [&](__int64_t begin,
+                                                       __int64_t end) {
+    std::vector<T> acc(CPU_GEMM_MC);
+    for (__int64_t t = begin; t < end; t++) {
+      int b = t / (tilesM * tilesN);
+      __int64_t i0 = (t % tilesM) * CPU_GEMM_MC;
+      __int64_t j0 = ((t / tilesM) % tilesN) * CPU_GEMM_NC;
+      __int64_t i1 = std::min<__int64_t>(m, i0 + CPU_GEMM_MC);
+      __int64_t j1 = std::min<__int64_t>(n, j0 + CPU_GEMM_NC);
+      const T *a = order ? A[b] + aOffset + A_batchOffset
+                         : B[b] + bOffset + B_batchOffset;
+      const T *bm = order ? B[b] + bOffset + B_batchOffset
+                          : A[b] + aOffset + A_batchOffset;
+      __int64_t lda_ = order ? lda : ldb;
+      __int64_t ldb_ = order ? ldb : lda;
+      T *c = C[b] + cOffset + C_batchOffset;
+
+      for (__int64_t j = j0; j < j1; j++) {
+        std::fill(acc.begin(), acc.end(), T(0, 0));
+        for (__int64_t p = 0; p < k; p++) {
+          T y = transB ? bm[p * ldb_ + j] : bm[j * ldb_ + p];
+          for (__int64_t i = i0; i < i1; i++) {
+            T x = transA ? a[i * lda_ + p] : a[p * lda_ + i];
+            acc[i - i0].x += x.x * y.x - x.y * y.y;
+            acc[i - i0].y += x.x * y.y + x.y * y.x;
+          }
+        }
+        for (__int64_t i = i0; i < i1; i++) {
+          T &out = c[j * ldc + i];
+          T s = acc[i - i0];
+          T value(alpha.x * s.x - alpha.y * s.y, alpha.x * s.y + alpha.y * s.x);
+          if (beta.x != 0 || beta.y != 0) {
+            value.x += beta.x * out.x - beta.y * out.y;
+            value.y += beta.x * out.y + beta.y * out.x;
+          }
+          out = value;
+        }
+      }
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+/* Epilogue with the axes resolved for column major storage of C, as in the
+ HCC gemmex kernel */
+struct cpu_epilogue {
+  const float *bias;
+  bool biasColumn;
+  const float *scale;
+  bool scaleColumn;
+  int activation;
+  float clampMin;
+  float clampMax;
+  __int64_t auxOffset;
+  __int64_t ldaux;
+};
+
+static inline float cpu_activate(float x, const cpu_epilogue &ep) {
+  switch (ep.activation) {
+    case ActivationRelu:
+      return x > 0.0f ? x : 0.0f;
+    case ActivationGelu:
+      // tanh approximation of x * Phi(x)
+      return 0.5f * x *
+             (1.0f + tanhf(0.7978845608f * (x + 0.044715f * x * x * x)));
+    case ActivationSigmoid:
+      return 1.0f / (1.0f + expf(-x));
+    case ActivationClamp:
+      return x < ep.clampMin ? ep.clampMin
+                             : (x > ep.clampMax ? ep.clampMax : x);
+    default:
+      return x;
+  }
+}
+
+typedef hcblasStatus (*cpu_gemmex_launcher)(
+    HcblasCpuLibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue);
+
+/* Mixed precision GEMM: A and B are converted to the compute type TS while
+ they are packed and the epilogue is applied in the store of each element */
+template <typename TA, typename TB, typename TC, typename TS>
+static hcblasStatus gemmex_template(
+    HcblasCpuLibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  TS alphaS = *static_cast<const TS *>(alpha);
+  TS betaS = *static_cast<const TS *>(beta);
+  cpu_epilogue ep = {NULL, false, NULL, false, ActivationNone, 0, 0, 0, 0};
+  TC *aux = NULL;
+  if (epilogue != NULL) {
+    // Rows of a row major C are the columns of the transposed problem
+    hcblasQuantAxis columnAxis = order ? PerColumn : PerRow;
+    ep.bias = epilogue->bias;
+    ep.biasColumn = epilogue->biasAxis == columnAxis;
+    ep.scale = epilogue->scale;
+    ep.scaleColumn = epilogue->scaleAxis == columnAxis;
+    ep.activation = epilogue->activation;
+    ep.clampMin = epilogue->clampMin;
+    ep.clampMax = epilogue->clampMax;
+    ep.auxOffset = epilogue->auxOffset;
+    ep.ldaux = epilogue->ldaux;
+    aux = static_cast<TC *>(epilogue->aux);
+  }
+  TC *c = static_cast<TC *>(C) + cOffset;
+
+  gemm_ordered<TS>(
+      order, typeA, typeB, M, N, (alphaS == TS(0)) ? 0 : K,
+      static_cast<const TA *>(A) + aOffset, lda,
+      static_cast<const TB *>(B) + bOffset, ldb,
+      [=](int, __int64_t gm, __int64_t gn, TS acc) {
+        TS value = alphaS * acc;
+        if (ep.scale != NULL) {
+          value *= static_cast<TS>(ep.scale[ep.scaleColumn ? gn : gm]);
+        }
+        if (betaS != TS(0)) {
+          value += betaS * cpu_load<TS>(c[gn * ldc + gm]);
+        }
+        if (ep.bias != NULL) {
+          value += static_cast<TS>(ep.bias[ep.biasColumn ? gn : gm]);
+        }
+        if (aux != NULL) {
+          aux[ep.auxOffset + gn * ep.ldaux + gm] = cpu_store<TC>(value);
+        }
+        if (ep.activation != ActivationNone) {
+          value =
+              static_cast<TS>(cpu_activate(static_cast<float>(value), ep));
+        }
+        c[gn * ldc + gm] = cpu_store<TC>(value);
+      });
+  return HCBLAS_SUCCEEDS;
+}
+
+/* Complex and int8 problems use the typed routines of the backend */
+static hcblasStatus gemmex_cgemm(
+    HcblasCpuLibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  typedef hc::short_vector::float_2 T;
+  return lib->hcblas_cgemm(
+      accl_view, order, typeA, typeB, M, N, K, *static_cast<const T *>(alpha),
+      const_cast<T *>(static_cast<const T *>(A)), aOffset, lda,
+      const_cast<T *>(static_cast<const T *>(B)), bOffset, ldb,
+      *static_cast<const T *>(beta), static_cast<T *>(C), cOffset, ldc);
+}
+
+static hcblasStatus gemmex_zgemm(
+    HcblasCpuLibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  typedef hc::short_vector::double_2 T;
+  return lib->hcblas_zgemm(
+      accl_view, order, typeA, typeB, M, N, K, *static_cast<const T *>(alpha),
+      const_cast<T *>(static_cast<const T *>(A)), aOffset, lda,
+      const_cast<T *>(static_cast<const T *>(B)), bOffset, ldb,
+      *static_cast<const T *>(beta), static_cast<T *>(C), cOffset, ldc);
+}
+
+static hcblasStatus gemmex_igemm(
+    HcblasCpuLibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  return lib->hcblas_igemm(
+      accl_view, order, typeA, typeB, M, N, K, *static_cast<const int *>(alpha),
+      static_cast<const signed char *>(A), lda,
+      static_cast<const signed char *>(B), ldb, *static_cast<const int *>(beta),
+      static_cast<int *>(C), ldc, aOffset, bOffset, cOffset);
+}
+
+struct cpu_gemmex_entry {
+  hcblasDatatype Atype;
+  hcblasDatatype Btype;
+  hcblasDatatype Ctype;
+  hcblasDatatype computeType;
+  cpu_gemmex_launcher launch;
+  // Whether the combination accepts an epilogue; the HCC table decides,
+  // so both backends accept the same calls
+  bool fused;
+};
+
+/* Supported ( A, B, C, compute ) type combinations. HALF x HALF -> HALF
+ accumulates in float on the CPU. */
+static const cpu_gemmex_entry cpu_gemmex_table[] = {
+    {FloatType, FloatType, FloatType, FloatType,
+     gemmex_template<float, float, float, float>, true},
+    {DoubleType, DoubleType, DoubleType, DoubleType,
+     gemmex_template<double, double, double, double>, false},
+    {HalfType, HalfType, HalfType, HalfType,
+     gemmex_template<hc::half, hc::half, hc::half, float>, false},
+    {ComplexType, ComplexType, ComplexType, ComplexType, gemmex_cgemm, false},
+    {DoubleComplexType, DoubleComplexType, DoubleComplexType,
+     DoubleComplexType, gemmex_zgemm, false},
+    {HalfType, HalfType, FloatType, FloatType,
+     gemmex_template<hc::half, hc::half, float, float>, true},
+    {HalfType, HalfType, HalfType, FloatType,
+     gemmex_template<hc::half, hc::half, hc::half, float>, true},
+    {Int8Type, Int8Type, Int32Type, Int32Type, gemmex_igemm, false},
+    {Bfloat16Type, Bfloat16Type, Bfloat16Type, FloatType,
+     gemmex_template<hcBfloat16, hcBfloat16, hcBfloat16, float>, true},
+    {Bfloat16Type, Bfloat16Type, FloatType, FloatType,
+     gemmex_template<hcBfloat16, hcBfloat16, float, float>, true},
+};
+
+static const cpu_gemmex_entry *cpu_gemmex_lookup(hcblasDatatype Atype,
+                                                 hcblasDatatype Btype,
+                                                 hcblasDatatype Ctype,
+                                                 hcblasDatatype computeType) {
+  for (size_t i = 0; i < sizeof(cpu_gemmex_table) / sizeof(cpu_gemmex_table[0]);
+       i++) {
+    const cpu_gemmex_entry &entry = cpu_gemmex_table[i];
+    if (entry.Atype == Atype && entry.Btype == Btype && entry.Ctype == Ctype &&
+        entry.computeType == computeType) {
+      return &entry;
+    }
+  }
+  return NULL;
+}
+
+/* SGEMM - C = alpha * op(A) * op(B) + beta * C */
+hcblasStatus HcblasCpuLibrary::hcblas_sgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const float &alpha, float *A, const __int64_t lda, float *B,
+    const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
+  return gemm<float, float>(order, typeA, typeB, M, N, K, alpha, &A, lda, 0, &B,
+                            ldb, 0, beta, &C, ldc, 0, aOffset, bOffset, cOffset,
+                            1);
+}
+
+/* DGEMM - C = alpha * op(A) * op(B) + beta * C */
+hcblasStatus HcblasCpuLibrary::hcblas_dgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const double &alpha, double *A, const __int64_t lda, double *B,
+    const __int64_t ldb, const double &beta, double *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
+  return gemm<double, double>(order, typeA, typeB, M, N, K, alpha, &A, lda, 0,
+                              &B, ldb, 0, beta, &C, ldc, 0, aOffset, bOffset,
+                              cOffset, 1);
+}
+
+/* HGEMM - C = alpha * op(A) * op(B) + beta * C, accumulated in float */
+hcblasStatus HcblasCpuLibrary::hcblas_hgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::half &alpha, hc::half *A, const __int64_t lda, hc::half *B,
+    const __int64_t ldb, const hc::half &beta, hc::half *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
+  return gemm<hc::half, float>(order, typeA, typeB, M, N, K,
+                               static_cast<float>(alpha), &A, lda, 0, &B, ldb,
+                               0, static_cast<float>(beta), &C, ldc, 0, aOffset,
+                               bOffset, cOffset, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_sgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const float &alpha, float *A[], const __int64_t lda,
+    const __int64_t A_batchOffset, float *B[], const __int64_t ldb,
+    const __int64_t B_batchOffset, const float &beta, float *C[],
+    const __int64_t ldc, const __int64_t C_batchOffset, const __int64_t aOffset,
+    const __int64_t bOffset, const __int64_t cOffset, const int batchSize) {
+  return gemm<float, float>(order, typeA, typeB, M, N, K, alpha, A, lda,
+                            A_batchOffset, B, ldb, B_batchOffset, beta, C, ldc,
+                            C_batchOffset, aOffset, bOffset, cOffset,
+                            batchSize);
+}
+
+/* SGEMM_GROUPED - C[p] = alpha * op(A[p]) * op(B[p]) + beta * C[p] */
+hcblasStatus HcblasCpuLibrary::hcblas_sgemm_grouped(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int *M, const int *N, const int *K,
+    const float &alpha, const float *const A[], const int *lda,
+    const float *const B[], const int *ldb, const float &beta, float *const C[],
+    const int *ldc, const int groupCount) {
+  if (groupCount == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+  if (groupCount < 0 || M == NULL || N == NULL || K == NULL || A == NULL ||
+      B == NULL || C == NULL || lda == NULL || ldb == NULL || ldc == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+  std::vector<gemm_problem<float, float> > problems;
+  std::vector<int> index;
+  for (int p = 0; p < groupCount; p++) {
+    if (M[p] < 0 || N[p] < 0 || K[p] < 0 || C[p] == NULL ||
+        (K[p] > 0 && (A[p] == NULL || B[p] == NULL))) {
+      return HCBLAS_INVALID;
+    }
+    if (M[p] == 0 || N[p] == 0) {
+      continue;
+    }
+    gemm_problem<float, float> problem = {
+        order ? A[p] : B[p], order ? lda[p] : ldb[p], order ? B[p] : A[p],
+        order ? ldb[p] : lda[p], order ? M[p] : N[p], order ? N[p] : M[p],
+        K[p]};
+    problems.push_back(problem);
+    index.push_back(p);
+  }
+
+  float a = alpha;
+  float b = beta;
+  gemm_driver<float>(order ? typeA == Trans : typeB == Trans,
+                     order ? typeB == Trans : typeA == Trans, problems,
+                     [&](int q, __int64_t i, __int64_t j, float acc) {
+                       int p = index[q];
+                       float &c = C[p][j * ldc[p] + i];
+                       c = (b == 0) ? a * acc : a * acc + b * c;
+                     });
+  return HCBLAS_SUCCEEDS;
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_dgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const double &alpha, double *A[], const __int64_t lda,
+    const __int64_t A_batchOffset, double *B[], const __int64_t ldb,
+    const __int64_t B_batchOffset, const double &beta, double *C[],
+    const __int64_t ldc, const __int64_t C_batchOffset, const __int64_t aOffset,
+    const __int64_t bOffset, const __int64_t cOffset, const int batchSize) {
+  return gemm<double, double>(order, typeA, typeB, M, N, K, alpha, A, lda,
+                              A_batchOffset, B, ldb, B_batchOffset, beta, C,
+                              ldc, C_batchOffset, aOffset, bOffset, cOffset,
+                              batchSize);
+}
+
+/* CGEMM - C = alpha * op(A) * op(B) + beta * C */
+hcblasStatus HcblasCpuLibrary::hcblas_cgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::float_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return complex_gemm(order, typeA, typeB, M, N, K, alpha, &A, aOffset, 0, lda,
+                      &B, bOffset, 0, ldb, beta, &C, cOffset, 0, ldc, 1);
+}
+
+/* ZGEMM - C = alpha * op(A) * op(B) + beta * C */
+hcblasStatus HcblasCpuLibrary::hcblas_zgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::double_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return complex_gemm(order, typeA, typeB, M, N, K, alpha, &A, aOffset, 0, lda,
+                      &B, bOffset, 0, ldb, beta, &C, cOffset, 0, ldc, 1);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_cgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::float_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return complex_gemm(order, typeA, typeB, M, N, K, alpha, A, aOffset,
+                      A_batchOffset, lda, B, bOffset, B_batchOffset, ldb, beta,
+                      C, cOffset, C_batchOffset, ldc, batchSize);
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_zgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return complex_gemm(order, typeA, typeB, M, N, K, alpha, A, aOffset,
+                      A_batchOffset, lda, B, bOffset, B_batchOffset, ldb, beta,
+                      C, cOffset, C_batchOffset, ldc, batchSize);
+}
+
+/* GEMMEX - C = alpha * op(A) * op(B) + beta * C with mixed types */
+hcblasStatus HcblasCpuLibrary::hcblas_gemmex(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const void *alpha, const void *A, hcblasDatatype Atype,
+    const __int64_t aOffset, const __int64_t lda, const void *B,
+    hcblasDatatype Btype, const __int64_t bOffset, const __int64_t ldb,
+    const void *beta, void *C, hcblasDatatype Ctype, const __int64_t cOffset,
+    const __int64_t ldc, hcblasDatatype computeType,
+    const hcblasEpilogue *epilogue) {
+  // Quick return if possible
+  if (alpha == NULL || beta == NULL || A == NULL || B == NULL || C == NULL ||
+      M <= 0 || N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  const cpu_gemmex_entry *entry =
+      cpu_gemmex_lookup(Atype, Btype, Ctype, computeType);
+
+  // Unsupported type combination
+  if (entry == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  if (epilogue != NULL &&
+      (!entry->fused ||
+       (epilogue->aux != NULL && epilogue->ldaux < (order ? M : N)) ||
+       (epilogue->activation == ActivationClamp &&
+        epilogue->clampMin > epilogue->clampMax))) {
+    return HCBLAS_INVALID;
+  }
+  return entry->launch(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                       aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc,
+                       epilogue);
+}
+
+bool HcblasCpuLibrary::hcblas_gemmex_supported(
+    hcblasDatatype Atype, hcblasDatatype Btype, hcblasDatatype Ctype,
+    hcblasDatatype computeType, bool epilogue) {
+  const cpu_gemmex_entry *entry =
+      cpu_gemmex_lookup(Atype, Btype, Ctype, computeType);
+  return entry != NULL && (!epilogue || entry->fused);
+}
+
+/* IGEMM - C = alpha * op(A) * op(B) + beta * C with int8 inputs */
+hcblasStatus HcblasCpuLibrary::hcblas_igemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const int &alpha, const signed char *A, const __int64_t lda,
+    const signed char *B, const __int64_t ldb, const int &beta, int *C,
+    const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || M <= 0 || N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  int a = alpha;
+  int b = beta;
+  int *c = C + cOffset;
+  gemm_ordered<int>(order, typeA, typeB, M, N, K, A + aOffset, lda,
+                    B + bOffset, ldb,
+                    [=](int, __int64_t i, __int64_t j, int acc) {
+                      int &out = c[j * ldc + i];
+                      out = a * acc + (b != 0 ? b * out : 0);
+                    });
+  return HCBLAS_SUCCEEDS;
+}
+
+hcblasStatus HcblasCpuLibrary::hcblas_igemm_requant(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const signed char *A, const __int64_t lda, const signed char *B,
+    const __int64_t ldb, signed char *C, const __int64_t ldc,
+    hcblasQuantAxis axis, const float *scale, const int *zeroPoint,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || scale == NULL || M <= 0 ||
+      N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // Rows of the row major C are the columns of the transposed problem
+  bool perColumn = order ? axis == PerColumn : axis == PerRow;
+  signed char *c = C + cOffset;
+  gemm_ordered<int>(order, typeA, typeB, M, N, K, A + aOffset, lda,
+                    B + bOffset, ldb,
+                    [=](int, __int64_t i, __int64_t j, int acc) {
+                      __int64_t q = perColumn ? j : i;
+                      float v = acc * scale[q];
+                      if (zeroPoint != NULL) {
+                        v += zeroPoint[q];
+                      }
+                      // Round half away from zero, then saturate
+                      v += (v < 0.0f) ? -0.5f : 0.5f;
+                      v = std::min(127.0f, std::max(-128.0f, v));
+                      c[j * ldc + i] = static_cast<signed char>(v);
+                    });
+  return HCBLAS_SUCCEEDS;
+}
@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_thread_pool.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+// Queue the calling thread pops from the back: its own for a worker of
+// homePool, the shared queue 0 for everybody else.
+thread_local const hcblasThreadPool *homePool = NULL;
+thread_local size_t homeIndex = 0;
+
+}  // namespace
+
+hcblasThreadPool::hcblasThreadPool(int threads) : queued(0), stopping(false) {
+  if (threads < 1) threads = 1;
+  for (int i = 0; i < threads; i++) {
+    queues.push_back(new Queue());
+  }
+  for (int i = 1; i < threads; i++) {
+    workers.push_back(std::thread(&hcblasThreadPool::workerLoop, this, i));
+  }
+}
+
+hcblasThreadPool::~hcblasThreadPool() {
+  {
+    std::lock_guard<std::mutex> guard(idleLock);
+    stopping = true;
+  }
+  idle.notify_all();
+  for (size_t i = 0; i < workers.size(); i++) {
+    workers[i].join();
+  }
+  for (size_t i = 0; i < queues.size(); i++) {
+    delete queues[i];
+  }
+}
+
+hcblasThreadPool &hcblasThreadPool::instance() {
+  static hcblasThreadPool pool([] {
+    const char *env = getenv("HCBLAS_CPU_THREADS");
+    int threads = env ? atoi(env) : 0;
+    if (threads <= 0) {
+      threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    return threads > 0 ? threads : 1;
+  }());
+  return pool;
+}
+
+void hcblasThreadPool::parallelFor(__int64_t count, __int64_t grain,
+                                   const Body &body) {
+  if (count <= 0) return;
+  if (grain < 1) grain = 1;
+  __int64_t chunks = (count + grain - 1) / grain;
+  if (chunks == 1 || queues.size() == 1) {
+    body(0, count);
+    return;
+  }
+
+  Job job;
+  job.body = &body;
+  job.pending.store(chunks, std::memory_order_relaxed);
+  size_t home = homePool == this ? homeIndex : 0;
+  // Deal the chunks round robin, starting with the caller's own queue
+  for (__int64_t c = 0; c < chunks; c++) {
+    Task task = {&job, c * grain, std::min(count, (c + 1) * grain)};
+    Queue &queue = *queues[(home + c) % queues.size()];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    queue.tasks.push_back(task);
+  }
+  {
+    std::lock_guard<std::mutex> guard(idleLock);
+    queued.fetch_add(chunks, std::memory_order_release);
+  }
+  idle.notify_all();
+
+  // Help out until every chunk of this job has finished. Chunks of other
+  // jobs may run here as well, which is what keeps nested calls from
+  // waiting on each other.
+  while (job.pending.load(std::memory_order_acquire) != 0) {
+    if (runOne(home)) continue;
+    std::unique_lock<std::mutex> lock(idleLock);
+    idle.wait(lock, [&] {
+      return job.pending.load(std::memory_order_acquire) == 0 ||
+             queued.load(std::memory_order_acquire) > 0;
+    });
+  }
+}
+
+bool hcblasThreadPool::take(size_t home, Task &task) {
+  for (size_t i = 0; i < queues.size(); i++) {
+    Queue &queue = *queues[(home + i) % queues.size()];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.tasks.empty()) continue;
+    // Own work newest first, stolen work oldest first
+    if (i == 0) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+    } else {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+    queued.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+  }
+  return false;
+}
+
+bool hcblasThreadPool::runOne(size_t home) {
+  Task task;
+  if (!take(home, task)) return false;
+  (*task.job->body)(task.begin, task.end);
+  if (task.job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard<std::mutex> guard(idleLock);
+    idle.notify_all();
+  }
+  return true;
+}
+
+void hcblasThreadPool::workerLoop(size_t home) {
+  homePool = this;
+  homeIndex = home;
+  for (;;) {
+    if (runOne(home)) continue;
+    std::unique_lock<std::mutex> lock(idleLock);
+    idle.wait(lock, [&] {
+      return stopping || queued.load(std::memory_order_acquire) > 0;
+    });
+    if (stopping && queued.load(std::memory_order_acquire) == 0) return;
+  }
+}
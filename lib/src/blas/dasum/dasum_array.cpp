@@ -27,11 +27,15 @@ THE SOFTWARE.
 
 #define TILE_SIZE 256
 
-void dasum_HC(hc::accelerator_view accl_view, __int64_t n, double* xView,
+void dasum_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+              __int64_t n, double* xView,
               __int64_t incx, __int64_t xOffset, double* Y) {
   *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(double) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, 1);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -142,12 +146,16 @@ void dasum_HC(hc::accelerator_view accl_view, __int64_t n, double* xView,
   hc::am_free(dev_global_buffer);
 }
 
-void dasum_HC(hc::accelerator_view accl_view, __int64_t n, double* xView,
+void dasum_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+              __int64_t n, double* xView,
               __int64_t incx, __int64_t xOffset, double* Y,
               __int64_t X_batchOffset, int batchSize) {
   *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(double) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, batchSize);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -268,7 +276,9 @@ hcblasStatus Hcblaslibrary::hcblas_dasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  dasum_HC(accl_view, N, X, incX, xOffset, Y);
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  dasum_HC(accl_view, props, N, X, incX, xOffset, Y);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -284,7 +294,10 @@ hcblasStatus Hcblaslibrary::hcblas_dasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  dasum_HC(accl_view, N, X, incX, xOffset, Y, X_batchOffset, batchSize);
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  dasum_HC(accl_view, props, N, X, incX, xOffset, Y, X_batchOffset,
+           batchSize);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -27,12 +27,16 @@ THE SOFTWARE.
 
 #define TILE_SIZE 256
 
-double ddot_HC(hc::accelerator_view accl_view, __int64_t n, const double *xView,
+double ddot_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+               __int64_t n, const double *xView,
                __int64_t incx, __int64_t xOffset, const double *yView,
                __int64_t incy, __int64_t yOffset, double out) {
   out = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(double) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, 1);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -147,7 +151,8 @@ double ddot_HC(hc::accelerator_view accl_view, __int64_t n, const double *xView,
   return out;
 }
 
-double ddot_HC(hc::accelerator_view accl_view, __int64_t n, const double *xView,
+double ddot_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+               __int64_t n, const double *xView,
                __int64_t incx, __int64_t xOffset, const double *yView,
                __int64_t incy, __int64_t yOffset, double out,
                const __int64_t X_batchOffset, const __int64_t Y_batchOffset,
@@ -155,8 +160,11 @@ double ddot_HC(hc::accelerator_view accl_view, __int64_t n, const double *xView,
 
 {
   out = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(double) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, batchSize);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -282,7 +290,9 @@ hcblasStatus Hcblaslibrary::hcblas_ddot(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  dot = ddot_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, dot);
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  dot = ddot_HC(accl_view, props, N, X, incX, xOffset, Y, incY, yOffset, dot);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -297,7 +307,9 @@ hcblasStatus Hcblaslibrary::hcblas_ddot(
     return HCBLAS_INVALID;
   }
 
-  dot = ddot_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, dot,
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  dot = ddot_HC(accl_view, props, N, X, incX, xOffset, Y, incY, yOffset, dot,
                 X_batchOffset, Y_batchOffset, batchSize);
   return HCBLAS_SUCCEEDS;
 }
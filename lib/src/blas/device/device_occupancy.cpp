@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_device.h"
+#include <algorithm>
+
+hcblasDeviceProps hcblasDefaultDeviceProps() {
+  hcblasDeviceProps props;
+  props.computeUnits = 40;
+  props.wavefrontSize = 64;
+  props.simdsPerCU = 4;
+  props.maxWavesPerSimd = 10;
+  props.vgprsPerSimd = 256;
+  props.maxGroupsPerCU = 16;
+  props.ldsBytesPerCU = 65536;
+  props.maxLdsPerGroup = 65536;
+  props.coreClockMHz = 0;
+  props.memoryClockMHz = 0;
+  return props;
+}
+
+int hcblasGroupsPerCU(const hcblasDeviceProps &props,
+                      const hcblasKernelResources &kernel) {
+  if (kernel.groupSize <= 0 || props.wavefrontSize <= 0 ||
+      kernel.ldsBytes > props.maxLdsPerGroup) {
+    return 0;
+  }
+
+  int wavesPerGroup =
+      (kernel.groupSize + props.wavefrontSize - 1) / props.wavefrontSize;
+  int wavesPerSimd = props.maxWavesPerSimd;
+  if (kernel.vgprs > 0) {
+    wavesPerSimd = std::min(wavesPerSimd, props.vgprsPerSimd / kernel.vgprs);
+  }
+  int groups = props.simdsPerCU * wavesPerSimd / wavesPerGroup;
+  if (kernel.ldsBytes > 0) {
+    groups = std::min(groups,
+                      static_cast<int>(props.ldsBytesPerCU / kernel.ldsBytes));
+  }
+  return std::max(0, std::min(groups, props.maxGroupsPerCU));
+}
+
+long long hcblasResidentGroups(const hcblasDeviceProps &props,
+                               const hcblasKernelResources &kernel) {
+  return static_cast<long long>(hcblasGroupsPerCU(props, kernel)) *
+         props.computeUnits;
+}
+
+long long hcblasGridGroups(const hcblasDeviceProps &props,
+                           const hcblasKernelResources &kernel,
+                           long long groups, long long batches) {
+  long long share =
+      hcblasResidentGroups(props, kernel) / std::max(1LL, batches);
+  return std::max(1LL, std::min(groups, share));
+}
@@ -0,0 +1,105 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <atomic>
+#include <cstdint>
+
+#if defined(__has_include)
+#if __has_include(<hsa/hsa_ext_amd.h>)
+#include <hsa/hsa.h>
+#include <hsa/hsa_ext_amd.h>
+#define HCBLAS_HAVE_HSA 1
+#endif
+#endif
+
+#define HCBLAS_MAX_DEVICE_PROPS 64
+
+// Properties are read once per accelerator and never change afterwards, so
+// lookups after the first are a single acquire load
+static std::atomic<const hcblasDeviceProps *>
+    deviceProps[HCBLAS_MAX_DEVICE_PROPS];
+
+// Starts from the default profile and overrides whatever the runtime
+// reports for this accelerator
+static hcblasDeviceProps device_query(const hc::accelerator &accl) {
+  hcblasDeviceProps props = hcblasDefaultDeviceProps();
+  unsigned int cus = accl.get_cu_count();
+  if (cus > 0) {
+    props.computeUnits = cus;
+  }
+  size_t lds = accl.get_max_tile_static_size();
+  if (lds > 0) {
+    props.ldsBytesPerCU = lds;
+    props.maxLdsPerGroup = lds;
+  }
+#ifdef HCBLAS_HAVE_HSA
+  hc::accelerator queried = accl;
+  hsa_agent_t *agent = static_cast<hsa_agent_t *>(queried.get_hsa_agent());
+  if (agent != NULL) {
+    uint32_t value = 0;
+    if (hsa_agent_get_info(*agent, HSA_AGENT_INFO_WAVEFRONT_SIZE, &value) ==
+            HSA_STATUS_SUCCESS &&
+        value > 0) {
+      props.wavefrontSize = value;
+    }
+    value = 0;
+    if (hsa_agent_get_info(*agent,
+                           static_cast<hsa_agent_info_t>(
+                               HSA_AMD_AGENT_INFO_MAX_CLOCK_FREQUENCY),
+                           &value) == HSA_STATUS_SUCCESS) {
+      props.coreClockMHz = value;
+    }
+    value = 0;
+    if (hsa_agent_get_info(*agent,
+                           static_cast<hsa_agent_info_t>(
+                               HSA_AMD_AGENT_INFO_MEMORY_MAX_FREQUENCY),
+                           &value) == HSA_STATUS_SUCCESS) {
+      props.memoryClockMHz = value;
+    }
+  }
+#endif
+  return props;
+}
+
+hcblasDeviceProps hcblasDeviceProperties(const hc::accelerator &accl) {
+  uint64_t seqnum = accl.get_seqnum();
+  if (seqnum >= HCBLAS_MAX_DEVICE_PROPS) {
+    return device_query(accl);
+  }
+
+  const hcblasDeviceProps *props =
+      deviceProps[seqnum].load(std::memory_order_acquire);
+  if (props == NULL) {
+    const hcblasDeviceProps *queried =
+        new hcblasDeviceProps(device_query(accl));
+    // Another thread may have got there first; keep its copy
+    if (deviceProps[seqnum].compare_exchange_strong(
+            props, queried, std::memory_order_acq_rel)) {
+      props = queried;
+    } else {
+      delete queried;
+    }
+  }
+  return *props;
+}
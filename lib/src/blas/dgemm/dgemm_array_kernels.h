@@ -24,6 +24,7 @@ THE SOFTWARE.
 #define LIB_SRC_BLAS_DGEMM_DGEMM_ARRAY_KERNELS_H_
 
 #include "include/hcblaslib.h"
+#include "include/hcblas_micro_kernels.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -347,25 +348,17 @@ THE SOFTWARE.
   offA++;                                       \
   offB++;
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_Mx16_NX16_KX64_TS16XMS4(
-    hc::accelerator_view accl_view, double *A, __int64_t aOffset, double *B,
-    __int64_t bOffset, double *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, double alpha, double beta);
+/* Signature of the gemm_MICRO_NBK_M_N_K_TS16 variants */
+typedef hcblasMicroKernel<double>::type dgemm_kernel;
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_M_N_K_TS16XMS4(
-    hc::accelerator_view accl_view, double *A, __int64_t aOffset, double *B,
-    __int64_t bOffset, double *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, double alpha, double beta);
+/* Built gemm_MICRO_NBK_M_N_K_TS16 variants of the DGEMM variant table */
+template <>
+dgemm_kernel gemm_MICRO_NBK_M_N_K_variant<double>(bool transA, bool transB,
+                                                  int MTILE);
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_Mx16_NX16_KX96_TS16XMS6(
-    hc::accelerator_view accl_view, double *A, __int64_t aOffset, double *B,
-    __int64_t bOffset, double *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransAB_STEP_NBK_M_N_K_TS16XMS6(
-    hc::accelerator_view accl_view, double *A, __int64_t aOffset, double *B,
-    __int64_t bOffset, double *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, double alpha, double beta);
+/* Trace name of a gemm_MICRO_NBK_M_N_K_TS16 variant, NULL for any other
+ kernel */
+const char *gemm_variant_kernel_name(dgemm_kernel kernel);
 
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX064_NX064_KX16_TS16XMTS4(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
@@ -377,12 +370,16 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
+/* gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2 moving A,
+ B and C with double_2 accesses. Every operand must be 16 byte aligned with
+ a leading dimension that keeps it so (HCBLAS_GEMM_VECTOR_ALIGNED). */
+hcblasStatus
+gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2_VEC(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
+hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
@@ -392,26 +389,6 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
@@ -433,21 +410,6 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
@@ -474,21 +436,6 @@ hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, double *A,
                            int lda, int ldb, int ldc, double alpha,
                            double beta);
 
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
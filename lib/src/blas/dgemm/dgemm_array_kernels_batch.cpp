@@ -113,94 +113,6 @@ hcblasStatus gemm_NoTransAB_batch_STEP_TS8XSS8(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB_batch_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, double *A[], __int64_t aOffset,
-    __int64_t A_batchOffset, double *B[], __int64_t bOffset,
-    __int64_t B_batchOffset, double *C[], __int64_t cOffset,
-    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
-    double alpha, double beta, int batchSize) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<3> grdExt(batchSize, (N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
-    int elt = tidx.tile[0];
-    double *A_mat = A[elt];
-    double *B_mat = B[elt];
-    double *C_mat = C[elt];
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    double rC[1][1] = {{0.0}};
-    double rA[1][STEPTILERATIO];
-    double rB[1][STEPTILERATIO];
-    tile_static double lA[STEPTILEPROD + STEPSIZE];  // 8*8+8
-    tile_static double lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[2];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[2];
-    int idy = tidx.local[1];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] =
-              B_mat[bOffset + B_batchOffset + (gidy * TILESIZE + idyT) * ldb +
-                    idxT + i * STEPSIZE + (TILESIZE * sec)];
-        } else {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] =
-              A_mat[aOffset + A_batchOffset + gidx * TILESIZE + idxT +
-                    idyT * lda + i * (lda << shiftFactor) +
-                    (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index = cOffset + C_batchOffset + gidx * TILESIZE + idx +
-                          (gidy * TILESIZE + idy) * ldc;
-      C_mat[C_index] =
-          (hc::fast_math::isnan(static_cast<float>(C_mat[C_index])) ||
-           hc::fast_math::isinf(static_cast<float>(C_mat[C_index])))
-              ? 0
-              : C_mat[C_index];
-      C_mat[C_index] = alpha * rC[0][0] + beta * C_mat[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 hcblasStatus gemm_NoTransAB_batch_MICRO_NBK_TS16XMTS2(
     hc::accelerator_view accl_view, double *A[], __int64_t aOffset,
     __int64_t A_batchOffset, double *B[], __int64_t bOffset,
@@ -652,96 +564,6 @@ hcblasStatus gemm_NoTransA_batch_STEP_TS8XSS8(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransA_batch_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, double *A[], __int64_t aOffset,
-    __int64_t A_batchOffset, double *B[], __int64_t bOffset,
-    __int64_t B_batchOffset, double *C[], __int64_t cOffset,
-    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
-    double alpha, double beta, int batchSize) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<3> grdExt(batchSize, (N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = hc::fast_math::log2f(STEPSIZE);
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    double rC[1][1] = {{0.0}};
-    double rA[1][STEPTILERATIO];
-    double rB[1][STEPTILERATIO];
-    tile_static double lA[STEPTILEPROD + STEPSIZE];
-    tile_static double lB[STEPTILEPROD + STEPSIZE];
-    int elt = tidx.tile[0];
-    double *A_mat = A[elt];
-    double *B_mat = B[elt];
-    double *C_mat = C[elt];
-    int gidx = tidx.tile[2];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[2];
-    int idy = tidx.local[1];
-    int idt = (idy << tilemulshift) + idx;
-    int idyT = idt >> tilemulshift;
-    int idxT = idt & (TILESIZE - 1);
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxT + idyTOffset;
-        int kIndex = iOffset + idyT + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idxT < N && kIndex < K) {
-          lB[localIdx] =
-              B_mat[bOffset + B_batchOffset + gidyOffset + idxT + kIndex * ldb];
-        }
-
-        if (gidxOffset + idxT < M && kIndex < K) {
-          lA[localIdx] =
-              A_mat[aOffset + A_batchOffset + gidxOffset + idxT + kIndex * lda];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(BANKTILESIZE);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = gidxOffset + idx;
-    int ccolprod = (gidyOffset + idy) * ldc;
-
-    if (crow < M && ccolprod / ldc < N) {
-      __int64_t C_index = cOffset + C_batchOffset + crow + ccolprod;
-      C_mat[C_index] =
-          (hc::fast_math::isnan(static_cast<float>(C_mat[C_index])) ||
-           hc::fast_math::isinf(static_cast<float>(C_mat[C_index])))
-              ? 0
-              : C_mat[C_index];
-      C_mat[C_index] = alpha * rC[0][0] + beta * C_mat[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 hcblasStatus gemm_NoTransA_batch_STEP_TS16XSS16(
     hc::accelerator_view accl_view, double *A[], __int64_t aOffset,
     __int64_t A_batchOffset, double *B[], __int64_t bOffset,
@@ -1014,97 +836,6 @@ hcblasStatus gemm_NoTransA_batch_MICRO_TS16XMTS2(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransB_batch_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, double *A[], __int64_t aOffset,
-    __int64_t A_batchOffset, double *B[], __int64_t bOffset,
-    __int64_t B_batchOffset, double *C[], __int64_t cOffset,
-    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
-    double alpha, double beta, int batchSize) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<3> grdExt(batchSize, (N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
-    int elt = tidx.tile[0];
-    double *A_mat = A[elt];
-    double *B_mat = B[elt];
-    double *C_mat = C[elt];
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    double rC[1][1] = {{0.0}};
-    double rA[1][STEPTILERATIO];
-    double rB[1][STEPTILERATIO];
-    tile_static double lA[STEPTILEPROD + STEPSIZE];
-    tile_static double lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[2];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[2];
-    int idy = tidx.local[1];
-    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
-    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
-    int idxS = ids & (STEPSIZE - 1);
-    int idyT = (idt) >> tilemulshift;
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxS + idyTOffset;
-        int kIndex = iOffset + idxS + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idyT < N && kIndex < K) {
-          lB[localIdx] = B_mat[bOffset + B_batchOffset +
-                               (gidyOffset + idyT) * ldb + kIndex];
-        }
-
-        if (gidxOffset + idyT < M && kIndex < K) {
-          lA[localIdx] = A_mat[aOffset + A_batchOffset +
-                               (gidxOffset + idyT) * lda + kIndex];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int piter = 0; piter < TILESIZE; ++piter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = gidxOffset + idx;
-    int ccolprod = (gidyOffset + idy) * ldc;
-
-    if (crow < M && ccolprod / ldc < N) {
-      __int64_t C_index = cOffset + C_batchOffset + crow + ccolprod;
-      C_mat[C_index] =
-          (hc::fast_math::isnan(static_cast<float>(C_mat[C_index])) ||
-           hc::fast_math::isinf(static_cast<float>(C_mat[C_index])))
-              ? 0
-              : C_mat[C_index];
-      C_mat[C_index] = alpha * rC[0][0] + beta * C_mat[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 hcblasStatus gemm_NoTransB_batch_STEP_TS8XSS8(
     hc::accelerator_view accl_view, double *A[], __int64_t aOffset,
     __int64_t A_batchOffset, double *B[], __int64_t bOffset,
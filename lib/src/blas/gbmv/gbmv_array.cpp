@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_math.hpp>
+
+#define BLOCK_SIZE 256
+
+/*
+ * General band matrix-vector product on BLAS band storage: for a column
+ * major matrix element A(i, j) lives at AB[ku + i - j + j * lda]. Each
+ * thread produces one element of Y and only visits the (kl + ku + 1) wide
+ * band of its row (op(A) = A) or column (op(A) = A').
+ */
+template <typename T>
+static void gbmv_HC(hc::accelerator_view accl_view, bool trans, int m, int n,
+                    int kl, int ku, T alpha, const T *A, __int64_t aOffset,
+                    __int64_t lda, const T *X, __int64_t xOffset,
+                    __int64_t incX, T beta, T *Y, __int64_t yOffset,
+                    __int64_t incY) {
+  int lenY = trans ? n : m;
+  __int64_t size = (lenY + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int r = tidx.global[0];
+    if (r >= lenY) return;
+
+    T sum = 0;
+    if (!trans) {
+      int jStart = (r - kl > 0) ? r - kl : 0;
+      int jEnd = (r + ku < n - 1) ? r + ku : n - 1;
+      for (int j = jStart; j <= jEnd; ++j) {
+        sum += A[aOffset + j * lda + ku + r - j] * X[xOffset + j * incX];
+      }
+    } else {
+      int iStart = (r - ku > 0) ? r - ku : 0;
+      int iEnd = (r + kl < m - 1) ? r + kl : m - 1;
+      for (int i = iStart; i <= iEnd; ++i) {
+        sum += A[aOffset + r * lda + ku + i - r] * X[xOffset + i * incX];
+      }
+    }
+
+    __int64_t Y_index = yOffset + r * incY;
+    if (beta == 0) {
+      Y[Y_index] = alpha * sum;
+    } else {
+      Y[Y_index] = beta * Y[Y_index] + alpha * sum;
+    }
+  }) ;
+}
+
+template <typename T>
+static hcblasStatus gbmv(hc::accelerator_view accl_view, hcblasOrder order,
+                         hcblasTranspose type, const int M, const int N,
+                         const int KL, const int KU, const T alpha, const T *A,
+                         const __int64_t aOffset, const int lda, const T *X,
+                         const __int64_t xOffset, const int incX, const T beta,
+                         T *Y, const __int64_t yOffset, const int incY) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || A == NULL || M <= 0 || N <= 0 || KL < 0 ||
+      KU < 0 || lda < KL + KU + 1 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // Row major band storage of A is column major band storage of A'
+  if (order) {
+    gbmv_HC<T>(accl_view, type != NoTrans, M, N, KL, KU, alpha, A, aOffset,
+               lda, X, xOffset, incX, beta, Y, yOffset, incY);
+  } else {
+    gbmv_HC<T>(accl_view, type == NoTrans, N, M, KU, KL, alpha, A, aOffset,
+               lda, X, xOffset, incX, beta, Y, yOffset, incY);
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+/* SGBMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_sgbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const int KL, const int KU, const float &alpha,
+    const float *A, const __int64_t aOffset, const int lda, const float *X,
+    const __int64_t xOffset, const int incX, const float &beta, float *Y,
+    const __int64_t yOffset, const int incY) {
+  return gbmv<float>(accl_view, order, type, M, N, KL, KU, alpha, A, aOffset,
+                     lda, X, xOffset, incX, beta, Y, yOffset, incY);
+}
+
+/* DGBMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dgbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
+    const int M, const int N, const int KL, const int KU, const double &alpha,
+    const double *A, const __int64_t aOffset, const int lda, const double *X,
+    const __int64_t xOffset, const int incX, const double &beta, double *Y,
+    const __int64_t yOffset, const int incY) {
+  return gbmv<double>(accl_view, order, type, M, N, KL, KU, alpha, A, aOffset,
+                      lda, X, xOffset, incX, beta, Y, yOffset, incY);
+}
@@ -0,0 +1,100 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./gemm_out_of_core.h"
+#include "include/hcblas_cpu.h"
+#include <memory>
+
+/* Out-of-core GEMM on host operands. A CPU handle runs every tile on the
+ host; otherwise hostFraction of the tiles go to a CPU backend next to
+ the device. */
+template <typename T>
+static hcblasStatus gemm_out_of_core(
+    Hcblaslibrary *library, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb, T beta,
+    T *C, __int64_t ldc, size_t deviceBytes, float hostFraction) {
+  if (A == NULL || B == NULL || C == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  gemm_ooc_problem<T> problem = gemm_ooc_column_major(
+      order, typeA, typeB, alpha, A, lda, B, ldb, beta, C, ldc);
+
+  bool cpuHandle = library->backend == CpuBackend;
+  if (cpuHandle) {
+    hostFraction = 1;
+  }
+  if (deviceBytes == 0) {
+    deviceBytes = gemm_ooc_device_bytes(accl_view);
+  }
+  hcblasOutOfCoreSchedule schedule;
+  if (!schedule.build(order ? M : N, order ? N : M, K, sizeof(T), deviceBytes,
+                      hostFraction)) {
+    return HCBLAS_INVALID;
+  }
+
+  std::unique_ptr<gemm_ooc_device<T> > device;
+  if (schedule.hostTiles() < static_cast<int>(schedule.tiles().size())) {
+    device.reset(new gemm_ooc_device<T>(library, accl_view, problem, schedule));
+    if (!device->allocated()) {
+      return HCBLAS_INVALID;
+    }
+  }
+  std::unique_ptr<HcblasCpuLibrary> cpu;
+  if (!cpuHandle && schedule.hostTiles() > 0) {
+    cpu.reset(new HcblasCpuLibrary(&accl_view));
+  }
+  gemm_ooc_host<T> host(cpuHandle ? library : cpu.get(), accl_view, problem,
+                        schedule);
+
+  if (!hcblasOutOfCoreRun(schedule, device.get(), &host)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+// Sgemm Out of core: A, B and C are host memory and are streamed through
+// deviceBytes of device memory, or a quarter of the device's when it is 0
+hcblasStatus Hcblaslibrary::hcblas_sgemm_out_of_core(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const float &alpha, const float *A, const __int64_t lda, const float *B,
+    const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+    const size_t deviceBytes, const float hostFraction) {
+  return gemm_out_of_core(this, accl_view, order, typeA, typeB, M, N, K,
+                          alpha, A, lda, B, ldb, beta, C, ldc, deviceBytes,
+                          hostFraction);
+}
+
+// Dgemm Out of core: as hcblas_sgemm_out_of_core in double precision
+hcblasStatus Hcblaslibrary::hcblas_dgemm_out_of_core(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const double &alpha, const double *A, const __int64_t lda,
+    const double *B, const __int64_t ldb, const double &beta, double *C,
+    const __int64_t ldc, const size_t deviceBytes, const float hostFraction) {
+  return gemm_out_of_core(this, accl_view, order, typeA, typeB, M, N, K,
+                          alpha, A, lda, B, ldb, beta, C, ldc, deviceBytes,
+                          hostFraction);
+}
@@ -0,0 +1,300 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Executors of the out-of-core GEMM (hcblas_out_of_core.h), shared by the
+* single device routines and the multi-device XT routines.
+*/
+
+#ifndef LIB_SRC_BLAS_GEMM_OUT_OF_CORE_GEMM_OUT_OF_CORE_H_
+#define LIB_SRC_BLAS_GEMM_OUT_OF_CORE_GEMM_OUT_OF_CORE_H_
+
+#include "include/hcblaslib.h"
+#include "include/hcblas_out_of_core.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <cstring>
+
+// Device memory an out-of-core GEMM uses when the caller leaves it to the
+// library: a quarter of the device's, or this much if it does not report it
+#define OUT_OF_CORE_DEFAULT_BYTES (256 << 20)
+
+// One column major problem as the executors see it
+template <typename T>
+struct gemm_ooc_problem {
+  bool transA;
+  bool transB;
+  const T *A;
+  __int64_t lda;
+  const T *B;
+  __int64_t ldb;
+  T *C;
+  __int64_t ldc;
+  T alpha;
+  T beta;
+};
+
+inline hcblasStatus gemm_ooc_call(Hcblaslibrary *library,
+                                 hc::accelerator_view view, bool transA,
+                                 bool transB, int M, int N, int K,
+                                 float alpha, const float *A, __int64_t lda,
+                                 const float *B, __int64_t ldb, float beta,
+                                 float *C, __int64_t ldc) {
+  return library->hcblas_sgemm(
+      view, ColMajor, transA ? Trans : NoTrans, transB ? Trans : NoTrans, M,
+      N, K, alpha, const_cast<float *>(A), lda, const_cast<float *>(B), ldb,
+      beta, C, ldc, 0, 0, 0);
+}
+
+inline hcblasStatus gemm_ooc_call(Hcblaslibrary *library,
+                                 hc::accelerator_view view, bool transA,
+                                 bool transB, int M, int N, int K,
+                                 double alpha, const double *A,
+                                 __int64_t lda, const double *B,
+                                 __int64_t ldb, double beta, double *C,
+                                 __int64_t ldc) {
+  return library->hcblas_dgemm(
+      view, ColMajor, transA ? Trans : NoTrans, transB ? Trans : NoTrans, M,
+      N, K, alpha, const_cast<double *>(A), lda, const_cast<double *>(B), ldb,
+      beta, C, ldc, 0, 0, 0);
+}
+
+// Copies a height x width column major block between leading dimensions
+template <typename T>
+inline void gemm_ooc_copy(const T *src, __int64_t ldSrc, int height,
+                         int width, T *dst, __int64_t ldDst) {
+  for (int j = 0; j < width; j++) {
+    memcpy(dst + j * ldDst, src + j * ldSrc, sizeof(T) * height);
+  }
+}
+
+/* Executor for the accelerator. load packs the panels of a step into the
+ pinned staging buffers of its slot and starts their copies to the device;
+ multiply waits for them, queues the GEMM on the tile of C kept on the
+ device and marks the queue, and drain waits for that marker. The tile of
+ C goes up before its first step and comes back after its last. */
+template <typename T>
+class gemm_ooc_device : public hcblasOutOfCoreExecutor {
+ public:
+  gemm_ooc_device(Hcblaslibrary *library, hc::accelerator_view view,
+                  const gemm_ooc_problem<T> &problem,
+                  const hcblasOutOfCoreSchedule &schedule)
+      : library(library), view(view), problem(problem), schedule(schedule) {
+    hc::accelerator accl = view.get_accelerator();
+    size_t sizeA = sizeof(T) * schedule.tileM() * schedule.tileK();
+    size_t sizeB = sizeof(T) * schedule.tileK() * schedule.tileN();
+    size_t sizeC = sizeof(T) * schedule.tileM() * schedule.tileN();
+    for (int s = 0; s < 2; s++) {
+      panelA[s] = static_cast<T *>(hc::am_alloc(sizeA, accl, 0));
+      panelB[s] = static_cast<T *>(hc::am_alloc(sizeB, accl, 0));
+      stageA[s] = static_cast<T *>(hc::am_alloc(sizeA, accl, amHostPinned));
+      stageB[s] = static_cast<T *>(hc::am_alloc(sizeB, accl, amHostPinned));
+    }
+    tileC = static_cast<T *>(hc::am_alloc(sizeC, accl, 0));
+    stageC = static_cast<T *>(hc::am_alloc(sizeC, accl, amHostPinned));
+  }
+
+  ~gemm_ooc_device() {
+    for (int s = 0; s < 2; s++) {
+      if (panelA[s]) hc::am_free(panelA[s]);
+      if (panelB[s]) hc::am_free(panelB[s]);
+      if (stageA[s]) hc::am_free(stageA[s]);
+      if (stageB[s]) hc::am_free(stageB[s]);
+    }
+    if (tileC) hc::am_free(tileC);
+    if (stageC) hc::am_free(stageC);
+  }
+
+  bool allocated() const {
+    return panelA[0] && panelA[1] && panelB[0] && panelB[1] && stageA[0] &&
+           stageA[1] && stageB[0] && stageB[1] && tileC && stageC;
+  }
+
+  bool load(const hcblasOutOfCoreStep &step) override {
+    const hcblasOutOfCoreTile &tile = schedule.tiles()[step.tile];
+    int slot = step.slot;
+    // op(A) is rows x depth and op(B) depth x cols; a transposed operand is
+    // packed as stored, so the panels keep the caller's transposes
+    if (problem.transA) {
+      gemm_ooc_copy(problem.A + step.k0 + tile.row0 * problem.lda,
+                    problem.lda, step.depth, tile.rows, stageA[slot],
+                    step.depth);
+    } else {
+      gemm_ooc_copy(problem.A + tile.row0 + step.k0 * problem.lda,
+                    problem.lda, tile.rows, step.depth, stageA[slot],
+                    tile.rows);
+    }
+    if (problem.transB) {
+      gemm_ooc_copy(problem.B + tile.col0 + step.k0 * problem.ldb,
+                    problem.ldb, tile.cols, step.depth, stageB[slot],
+                    tile.cols);
+    } else {
+      gemm_ooc_copy(problem.B + step.k0 + tile.col0 * problem.ldb,
+                    problem.ldb, step.depth, tile.cols, stageB[slot],
+                    step.depth);
+    }
+    size_t depth = step.depth;
+    copiedA[slot] = view.copy_async(stageA[slot], panelA[slot],
+                                    sizeof(T) * depth * tile.rows);
+    copiedB[slot] = view.copy_async(stageB[slot], panelB[slot],
+                                    sizeof(T) * depth * tile.cols);
+    return true;
+  }
+
+  bool multiply(const hcblasOutOfCoreStep &step) override {
+    const hcblasOutOfCoreTile &tile = schedule.tiles()[step.tile];
+    int slot = step.slot;
+    size_t sizeC = sizeof(T) * tile.rows * tile.cols;
+    T beta = T(1);
+    if (step.first) {
+      // With beta == 0 the tile starts from zero, so C need not be valid
+      beta = problem.beta;
+      if (beta == T(0)) {
+        memset(stageC, 0, sizeC);
+      } else {
+        gemm_ooc_copy(problem.C + tile.row0 + tile.col0 * problem.ldc,
+                      problem.ldc, tile.rows, tile.cols, stageC, tile.rows);
+      }
+      view.copy(stageC, tileC, sizeC);
+    }
+
+    copiedA[slot].wait();
+    copiedB[slot].wait();
+    hcblasStatus status = gemm_ooc_call(
+        library, view, problem.transA, problem.transB, tile.rows, tile.cols,
+        step.depth, problem.alpha, panelA[slot],
+        problem.transA ? step.depth : tile.rows, panelB[slot],
+        problem.transB ? tile.cols : step.depth, beta, tileC, tile.rows);
+    if (status != HCBLAS_SUCCEEDS) {
+      return false;
+    }
+    done[slot] = view.create_marker();
+
+    if (step.last) {
+      done[slot].wait();
+      view.copy(tileC, stageC, sizeC);
+      gemm_ooc_copy(stageC, tile.rows, tile.rows, tile.cols,
+                    problem.C + tile.row0 + tile.col0 * problem.ldc,
+                    problem.ldc);
+    }
+    return true;
+  }
+
+  bool drain(int slot) override {
+    done[slot].wait();
+    return true;
+  }
+
+  bool finish() override {
+    view.wait();
+    return true;
+  }
+
+ private:
+  Hcblaslibrary *library;
+  hc::accelerator_view view;
+  const gemm_ooc_problem<T> &problem;
+  const hcblasOutOfCoreSchedule &schedule;
+  T *panelA[2];
+  T *panelB[2];
+  T *stageA[2];
+  T *stageB[2];
+  T *tileC;
+  T *stageC;
+  hc::completion_future copiedA[2];
+  hc::completion_future copiedB[2];
+  hc::completion_future done[2];
+};
+
+/* Executor for the host. The operands already live in host memory, so
+ nothing is loaded and each step is a GEMM of the CPU backend straight on
+ the caller's matrices. */
+template <typename T>
+class gemm_ooc_host : public hcblasOutOfCoreExecutor {
+ public:
+  gemm_ooc_host(Hcblaslibrary *library, hc::accelerator_view view,
+                const gemm_ooc_problem<T> &problem,
+                const hcblasOutOfCoreSchedule &schedule)
+      : library(library), view(view), problem(problem), schedule(schedule) {}
+
+  bool load(const hcblasOutOfCoreStep &) override { return true; }
+
+  bool multiply(const hcblasOutOfCoreStep &step) override {
+    const hcblasOutOfCoreTile &tile = schedule.tiles()[step.tile];
+    const T *A = problem.transA
+                     ? problem.A + step.k0 + tile.row0 * problem.lda
+                     : problem.A + tile.row0 + step.k0 * problem.lda;
+    const T *B = problem.transB
+                     ? problem.B + tile.col0 + step.k0 * problem.ldb
+                     : problem.B + step.k0 + tile.col0 * problem.ldb;
+    T *C = problem.C + tile.row0 + tile.col0 * problem.ldc;
+    return gemm_ooc_call(library, view, problem.transA, problem.transB,
+                         tile.rows, tile.cols, step.depth, problem.alpha, A,
+                         problem.lda, B, problem.ldb,
+                         step.first ? problem.beta : T(1), C,
+                         problem.ldc) == HCBLAS_SUCCEEDS;
+  }
+
+  bool drain(int) override { return true; }
+
+  bool finish() override { return true; }
+
+ private:
+  Hcblaslibrary *library;
+  hc::accelerator_view view;
+  const gemm_ooc_problem<T> &problem;
+  const hcblasOutOfCoreSchedule &schedule;
+};
+
+// Device memory budget for an out-of-core GEMM on view when the caller
+// leaves it to the library
+inline size_t gemm_ooc_device_bytes(const hc::accelerator_view &view) {
+  // get_dedicated_memory() is in KB
+  size_t bytes = view.get_accelerator().get_dedicated_memory() * 256;
+  return bytes ? bytes : OUT_OF_CORE_DEFAULT_BYTES;
+}
+
+/* The column major form of a GEMM: row major C = op(A) * op(B) is column
+ major C' = op(B)' * op(A)' */
+template <typename T>
+gemm_ooc_problem<T> gemm_ooc_column_major(hcblasOrder order,
+                                          hcblasTranspose typeA,
+                                          hcblasTranspose typeB, T alpha,
+                                          const T *A, __int64_t lda,
+                                          const T *B, __int64_t ldb, T beta,
+                                          T *C, __int64_t ldc) {
+  gemm_ooc_problem<T> problem;
+  problem.transA = order ? typeA == Trans : typeB == Trans;
+  problem.transB = order ? typeB == Trans : typeA == Trans;
+  problem.A = order ? A : B;
+  problem.lda = order ? lda : ldb;
+  problem.B = order ? B : A;
+  problem.ldb = order ? ldb : lda;
+  problem.C = C;
+  problem.ldc = ldc;
+  problem.alpha = alpha;
+  problem.beta = beta;
+  return problem;
+}
+
+#endif  // LIB_SRC_BLAS_GEMM_OUT_OF_CORE_GEMM_OUT_OF_CORE_H_
@@ -0,0 +1,174 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_out_of_core.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+hcblasOutOfCoreSchedule::hcblasOutOfCoreSchedule()
+    : problemK(0), tileRows(0), tileCols(0), tileDepth(0), hostCount(0) {}
+
+// Cuts a tile side that does not cover its dimension to a multiple of
+// HCBLAS_OUT_OF_CORE_MIN_TILE
+static int out_of_core_side(double fits, int dimension) {
+  if (fits >= dimension) {
+    return dimension;
+  }
+  long long side = static_cast<long long>(fits);
+  return side - side % HCBLAS_OUT_OF_CORE_MIN_TILE;
+}
+
+bool hcblasOutOfCoreSchedule::build(int M, int N, int K, size_t elementSize,
+                                    size_t deviceBytes,
+                                    double hostFraction) {
+  hcblasOutOfCoreTile whole;
+  whole.row0 = 0;
+  whole.col0 = 0;
+  whole.rows = M;
+  whole.cols = N;
+  whole.onHost = false;
+  return build(K, elementSize, deviceBytes, hostFraction,
+               std::vector<hcblasOutOfCoreTile>(1, whole));
+}
+
+bool hcblasOutOfCoreSchedule::build(
+    int K, size_t elementSize, size_t deviceBytes, double hostFraction,
+    const std::vector<hcblasOutOfCoreTile> &regions) {
+  blocks.clear();
+  problemK = tileRows = tileCols = tileDepth = hostCount = 0;
+  if (regions.empty() || K <= 0 || elementSize == 0 ||
+      !(hostFraction >= 0 && hostFraction <= 1)) {
+    return false;
+  }
+  int M = 0;
+  int N = 0;
+  for (size_t r = 0; r < regions.size(); r++) {
+    if (regions[r].rows <= 0 || regions[r].cols <= 0) {
+      return false;
+    }
+    M = std::max(M, regions[r].rows);
+    N = std::max(N, regions[r].cols);
+  }
+  const int minTile = HCBLAS_OUT_OF_CORE_MIN_TILE;
+  double capacity = static_cast<double>(deviceBytes / elementSize);
+  if (capacity < 5.0 * minTile * minTile) {
+    return false;
+  }
+
+  // A cube tile t a side needs 5 t^2 elements. With the depth fixed the
+  // largest square tile x solves x^2 + 4 depth x = capacity, and once the
+  // rows are fixed the columns take whatever is left.
+  int depth = out_of_core_side(std::sqrt(capacity / 5), K);
+  double square = std::sqrt(4.0 * depth * depth + capacity) - 2.0 * depth;
+  int rows = out_of_core_side(square, M);
+  int cols = out_of_core_side(
+      (capacity - 2.0 * rows * depth) / (2.0 * depth + rows), N);
+
+  problemK = K;
+  tileRows = rows;
+  tileCols = cols;
+  tileDepth = depth;
+  for (size_t r = 0; r < regions.size(); r++) {
+    const hcblasOutOfCoreTile &region = regions[r];
+    for (int col = 0; col < region.cols; col += cols) {
+      for (int row = 0; row < region.rows; row += rows) {
+        hcblasOutOfCoreTile tile;
+        tile.row0 = region.row0 + row;
+        tile.col0 = region.col0 + col;
+        tile.rows = std::min(rows, region.rows - row);
+        tile.cols = std::min(cols, region.cols - col);
+        tile.onHost = false;
+        blocks.push_back(tile);
+      }
+    }
+  }
+  hostCount = static_cast<int>(std::floor(hostFraction * blocks.size() + 0.5));
+  for (size_t t = blocks.size() - hostCount; t < blocks.size(); t++) {
+    blocks[t].onHost = true;
+  }
+  return true;
+}
+
+std::vector<hcblasOutOfCoreStep> hcblasOutOfCoreSchedule::steps(
+    bool onHost) const {
+  std::vector<hcblasOutOfCoreStep> result;
+  for (size_t t = 0; t < blocks.size(); t++) {
+    if (blocks[t].onHost != onHost) {
+      continue;
+    }
+    for (long long k0 = 0; k0 < problemK; k0 += tileDepth) {
+      hcblasOutOfCoreStep step;
+      step.tile = static_cast<int>(t);
+      step.k0 = k0;
+      step.depth =
+          static_cast<int>(std::min<long long>(tileDepth, problemK - k0));
+      step.slot = static_cast<int>(result.size() % 2);
+      step.first = k0 == 0;
+      step.last = k0 + tileDepth >= problemK;
+      result.push_back(step);
+    }
+  }
+  return result;
+}
+
+// Software pipeline of one executor: the load of step s + 1 is issued
+// before step s is multiplied, once the multiply of step s - 1 that used
+// the same slot is done with it
+static bool out_of_core_pipeline(const hcblasOutOfCoreSchedule &schedule,
+                                 bool onHost,
+                                 hcblasOutOfCoreExecutor *executor) {
+  std::vector<hcblasOutOfCoreStep> steps = schedule.steps(onHost);
+  if (steps.empty()) {
+    return true;
+  }
+  if (executor == NULL) {
+    return false;
+  }
+  bool ok = executor->load(steps[0]);
+  for (size_t s = 0; ok && s < steps.size(); s++) {
+    if (s + 1 < steps.size()) {
+      ok = executor->drain(steps[s + 1].slot) && executor->load(steps[s + 1]);
+    }
+    ok = ok && executor->multiply(steps[s]);
+  }
+  // Nothing may be left in flight on the executor's buffers
+  bool finished = executor->finish();
+  return ok && finished;
+}
+
+bool hcblasOutOfCoreRun(const hcblasOutOfCoreSchedule &schedule,
+                        hcblasOutOfCoreExecutor *device,
+                        hcblasOutOfCoreExecutor *host) {
+  if (schedule.hostTiles() == 0 ||
+      schedule.hostTiles() == static_cast<int>(schedule.tiles().size())) {
+    return out_of_core_pipeline(schedule, false, device) &&
+           out_of_core_pipeline(schedule, true, host);
+  }
+  bool hostOk = false;
+  std::thread worker(
+      [&] { hostOk = out_of_core_pipeline(schedule, true, host); });
+  bool deviceOk = out_of_core_pipeline(schedule, false, device);
+  worker.join();
+  return deviceOk && hostOk;
+}
@@ -0,0 +1,146 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "./gemm_out_of_core.h"
+#include "include/hcblas_cpu.h"
+#include "include/hcblas_xt.h"
+#include <algorithm>
+
+hcblasXtContext::hcblasXtContext() : blockDim(HCBLAS_XT_BLOCK_DIM) {
+  std::vector<hc::accelerator> accs = hc::accelerator::get_all();
+  std::vector<int> gpus;
+  std::vector<int> all;
+  for (int i = 0; i < static_cast<int>(accs.size()); i++) {
+    all.push_back(i);
+    if (accs[i].get_device_path() != L"cpu" && !accs[i].get_is_emulated()) {
+      gpus.push_back(i);
+    }
+  }
+  select(gpus.empty() ? all : gpus);
+}
+
+hcblasXtContext::~hcblasXtContext() {
+  initialized = false;
+  for (size_t d = 0; d < devices.size(); d++) {
+    delete devices[d];
+  }
+}
+
+bool hcblasXtContext::select(const std::vector<int> &ids) {
+  std::vector<hc::accelerator> accs = hc::accelerator::get_all();
+  if (ids.empty()) {
+    return false;
+  }
+  for (size_t i = 0; i < ids.size(); i++) {
+    if (ids[i] < 0 || ids[i] >= static_cast<int>(accs.size()) ||
+        std::count(ids.begin(), ids.end(), ids[i]) > 1) {
+      return false;
+    }
+  }
+
+  std::vector<Hcblaslibrary *> chosen;
+  std::vector<double> rates;
+  for (size_t i = 0; i < ids.size(); i++) {
+    const hc::accelerator &accl = accs[ids[i]];
+    hc::accelerator_view view = accl.get_default_view();
+    Hcblaslibrary *library =
+        hcblasNewLibrary(&view, hcblasDefaultBackend(accl));
+    if (library == NULL) {
+      for (size_t d = 0; d < chosen.size(); d++) {
+        delete chosen[d];
+      }
+      return false;
+    }
+    chosen.push_back(library);
+    // Compute units stand in for throughput; hosts report none
+    unsigned int units = accl.get_cu_count();
+    rates.push_back(units ? units : 1);
+  }
+  for (size_t d = 0; d < devices.size(); d++) {
+    delete devices[d];
+  }
+  devices = chosen;
+  weights = rates;
+  initialized = true;
+  return true;
+}
+
+/* Multi-device GEMM on host operands: the scheduler shares the blocks of C
+ out among the devices and each device runs its blocks as an out-of-core
+ GEMM on a thread of its own, or straight on the host for a CPU device. */
+template <typename T>
+static hcblasStatus gemm_xt(hcblasXtContext *xt, hcblasOrder order,
+                            hcblasTranspose typeA, hcblasTranspose typeB,
+                            int M, int N, int K, T alpha, const T *A,
+                            __int64_t lda, const T *B, __int64_t ldb, T beta,
+                            T *C, __int64_t ldc) {
+  if (A == NULL || B == NULL || C == NULL) {
+    return HCBLAS_INVALID;
+  }
+  gemm_ooc_problem<T> problem = gemm_ooc_column_major(
+      order, typeA, typeB, alpha, A, lda, B, ldb, beta, C, ldc);
+  hcblasXtSchedule schedule;
+  if (!schedule.build(order ? M : N, order ? N : M, K, xt->blockDim,
+                      xt->weights)) {
+    return HCBLAS_INVALID;
+  }
+
+  bool ok = hcblasXtRun(
+      schedule,
+      [&](int d, const std::vector<hcblasOutOfCoreTile> &regions) {
+        Hcblaslibrary *library = xt->devices[d];
+        hc::accelerator_view view = library->currentAcclView;
+        bool onHost = library->backend == CpuBackend;
+        hcblasOutOfCoreSchedule tiles;
+        if (!tiles.build(K, sizeof(T), gemm_ooc_device_bytes(view),
+                         onHost ? 1 : 0, regions)) {
+          return false;
+        }
+        if (onHost) {
+          gemm_ooc_host<T> host(library, view, problem, tiles);
+          return hcblasOutOfCoreRun(tiles, NULL, &host);
+        }
+        gemm_ooc_device<T> device(library, view, problem, tiles);
+        return device.allocated() && hcblasOutOfCoreRun(tiles, &device, NULL);
+      });
+  return ok ? HCBLAS_SUCCEEDS : HCBLAS_INVALID;
+}
+
+hcblasStatus hcblasXtContext::hcblas_sgemm(
+    hcblasOrder order, hcblasTranspose typeA, hcblasTranspose typeB,
+    const int M, const int N, const int K, const float &alpha, const float *A,
+    const __int64_t lda, const float *B, const __int64_t ldb,
+    const float &beta, float *C, const __int64_t ldc) {
+  return gemm_xt(this, order, typeA, typeB, M, N, K, alpha, A, lda, B, ldb,
+                 beta, C, ldc);
+}
+
+hcblasStatus hcblasXtContext::hcblas_dgemm(
+    hcblasOrder order, hcblasTranspose typeA, hcblasTranspose typeB,
+    const int M, const int N, const int K, const double &alpha,
+    const double *A, const __int64_t lda, const double *B,
+    const __int64_t ldb, const double &beta, double *C, const __int64_t ldc) {
+  return gemm_xt(this, order, typeA, typeB, M, N, K, alpha, A, lda, B, ldb,
+                 beta, C, ldc);
+}
@@ -0,0 +1,152 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas_xt.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+hcblasXtSchedule::hcblasXtSchedule() {}
+
+bool hcblasXtSchedule::build(int M, int N, int K, int blockDim,
+                             const std::vector<double> &weights) {
+  assigned.clear();
+  busy.clear();
+  speed.clear();
+  if (M <= 0 || N <= 0 || K <= 0 || blockDim <= 0 || weights.empty()) {
+    return false;
+  }
+  for (size_t d = 0; d < weights.size(); d++) {
+    if (!(weights[d] > 0) || !std::isfinite(weights[d])) {
+      return false;
+    }
+  }
+
+  for (long long col0 = 0; col0 < N; col0 += blockDim) {
+    for (long long row0 = 0; row0 < M; row0 += blockDim) {
+      hcblasXtBlock block;
+      block.row0 = row0;
+      block.col0 = col0;
+      block.rows = static_cast<int>(std::min<long long>(blockDim, M - row0));
+      block.cols = static_cast<int>(std::min<long long>(blockDim, N - col0));
+      block.device = -1;
+      assigned.push_back(block);
+    }
+  }
+
+  // Largest first, so the ragged blocks at the edges of C even out the
+  // finish times at the end
+  std::vector<size_t> order(assigned.size());
+  for (size_t b = 0; b < order.size(); b++) {
+    order[b] = b;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t x, size_t y) {
+    return static_cast<long long>(assigned[x].rows) * assigned[x].cols >
+           static_cast<long long>(assigned[y].rows) * assigned[y].cols;
+  });
+
+  int devices = static_cast<int>(weights.size());
+  int blockRows = (M + blockDim - 1) / blockDim;
+  speed = weights;
+  busy.assign(devices, 0.0);
+  std::vector<std::vector<bool> > holdsRow(devices,
+                                           std::vector<bool>(blockRows));
+  for (size_t i = 0; i < order.size(); i++) {
+    hcblasXtBlock &block = assigned[order[i]];
+    int row = static_cast<int>(block.row0 / blockDim);
+    double work = static_cast<double>(block.rows) * block.cols * K;
+    int best = 0;
+    double bestFinish = (busy[0] + work) / speed[0];
+    for (int d = 1; d < devices; d++) {
+      double finish = (busy[d] + work) / speed[d];
+      // Finish times equal up to rounding count as a tie
+      bool tie = std::fabs(finish - bestFinish) <= 1e-12 * bestFinish;
+      if ((!tie && finish < bestFinish) ||
+          (tie && holdsRow[d][row] && !holdsRow[best][row])) {
+        best = d;
+        bestFinish = finish;
+      }
+    }
+    block.device = best;
+    busy[best] += work;
+    holdsRow[best][row] = true;
+  }
+  return true;
+}
+
+std::vector<hcblasOutOfCoreTile> hcblasXtSchedule::regions(
+    int device) const {
+  std::vector<hcblasOutOfCoreTile> result;
+  for (size_t b = 0; b < assigned.size(); b++) {
+    if (assigned[b].device != device) {
+      continue;
+    }
+    hcblasOutOfCoreTile region;
+    region.row0 = assigned[b].row0;
+    region.col0 = assigned[b].col0;
+    region.rows = assigned[b].rows;
+    region.cols = assigned[b].cols;
+    region.onHost = false;
+    result.push_back(region);
+  }
+  return result;
+}
+
+double hcblasXtSchedule::finishTime(int device) const {
+  if (device < 0 || device >= devices()) {
+    return 0;
+  }
+  return busy[device] / speed[device];
+}
+
+bool hcblasXtRun(const hcblasXtSchedule &schedule, const hcblasXtWork &work) {
+  std::vector<std::vector<hcblasOutOfCoreTile> > regions;
+  std::vector<int> active;
+  for (int d = 0; d < schedule.devices(); d++) {
+    regions.push_back(schedule.regions(d));
+    if (!regions[d].empty()) {
+      active.push_back(d);
+    }
+  }
+  if (active.empty()) {
+    return true;
+  }
+  // The first device runs on the calling thread, the others on their own
+  std::vector<char> ok(schedule.devices(), 0);
+  std::vector<std::thread> workers;
+  for (size_t a = 1; a < active.size(); a++) {
+    int d = active[a];
+    workers.push_back(std::thread([&, d] { ok[d] = work(d, regions[d]); }));
+  }
+  ok[active[0]] = work(active[0], regions[active[0]]);
+  for (size_t w = 0; w < workers.size(); w++) {
+    workers[w].join();
+  }
+  for (size_t a = 0; a < active.size(); a++) {
+    if (!ok[active[a]]) {
+      return false;
+    }
+  }
+  return true;
+}
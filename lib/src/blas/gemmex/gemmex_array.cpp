@@ -0,0 +1,421 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_math.hpp>
+
+#define GEMMEX_TS 16
+#define GEMMEX_MICRO 4
+#define GEMMEX_TILE (GEMMEX_TS * GEMMEX_MICRO)
+#define GEMMEX_KTILE 16
+
+/* Conversion of a stored operand to the compute type during tile loads */
+template <typename TS, typename T>
+static inline TS gemmex_load(T value) [[hc]] {
+  return static_cast<TS>(value);
+}
+
+template <>
+inline float gemmex_load<float, hcBfloat16>(hcBfloat16 value) [[hc]] {
+  return hcblasBfloat16ToFloat(value);
+}
+
+/* Conversion of the compute type result back to the storage type of C */
+template <typename TC, typename TS>
+static inline TC gemmex_store(TS value) [[hc]] {
+  return static_cast<TC>(value);
+}
+
+template <>
+inline hcBfloat16 gemmex_store<hcBfloat16, float>(float value) [[hc]] {
+  return hcblasFloatToBfloat16(value);
+}
+
+/* Device side copy of hcblasEpilogue with the axes resolved for column major
+   storage of C. aux is passed to the kernel separately, typed as C. */
+struct gemmex_epilogue {
+  const float *bias;
+  bool biasColumn;
+  const float *scale;
+  bool scaleColumn;
+  int activation;
+  float clampMin;
+  float clampMax;
+  __int64_t auxOffset;
+  __int64_t ldaux;
+};
+
+static inline float gemmex_activate(float x,
+                                    const gemmex_epilogue &ep) [[hc]] {
+  switch (ep.activation) {
+    case ActivationRelu:
+      return x > 0.0f ? x : 0.0f;
+    case ActivationGelu:
+      // tanh approximation of x * Phi(x)
+      return 0.5f * x *
+             (1.0f + hc::fast_math::tanhf(0.7978845608f *
+                                          (x + 0.044715f * x * x * x)));
+    case ActivationSigmoid:
+      return 1.0f / (1.0f + hc::fast_math::expf(-x));
+    case ActivationClamp:
+      return x < ep.clampMin ? ep.clampMin
+                             : (x > ep.clampMax ? ep.clampMax : x);
+    default:
+      return x;
+  }
+}
+
+/*
+ * Mixed precision GEMM on column major operands. A and B are converted to
+ * the compute type TS while they are staged into LDS, so no separate
+ * conversion pass over the inputs is needed. Each 16x16 work group computes
+ * a 64x64 block of C with a 4x4 micro tile per work item; all loads and
+ * stores are bounds checked, so any M, N, K is accepted. The epilogue is
+ * applied to each element in the store phase while it is still in registers.
+ */
+template <typename TA, typename TB, typename TC, typename TS>
+static void gemmex_HC(hc::accelerator_view accl_view, bool transA,
+                      bool transB, int M, int N, int K, TS alpha, const TA *A,
+                      __int64_t aOffset, __int64_t lda, const TB *B,
+                      __int64_t bOffset, __int64_t ldb, TS beta, TC *C,
+                      __int64_t cOffset, __int64_t ldc,
+                      gemmex_epilogue ep, TC *aux) {
+  int M_ = ((M + GEMMEX_TILE - 1) / GEMMEX_TILE) * GEMMEX_TS;
+  int N_ = ((N + GEMMEX_TILE - 1) / GEMMEX_TILE) * GEMMEX_TS;
+  hc::extent<2> grdExt(N_, M_);
+  hc::tiled_extent<2> t_ext = grdExt.tile(GEMMEX_TS, GEMMEX_TS);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
+    int tx = tidx.local[1];
+    int ty = tidx.local[0];
+    int tid = ty * GEMMEX_TS + tx;
+    int row0 = tidx.tile[1] * GEMMEX_TILE;
+    int col0 = tidx.tile[0] * GEMMEX_TILE;
+    tile_static TS lA[GEMMEX_KTILE][GEMMEX_TILE + 1];
+    tile_static TS lB[GEMMEX_KTILE][GEMMEX_TILE + 1];
+    TS rC[GEMMEX_MICRO][GEMMEX_MICRO];
+    TS rA[GEMMEX_MICRO];
+    TS rB[GEMMEX_MICRO];
+
+    for (int i = 0; i < GEMMEX_MICRO; ++i)
+      for (int j = 0; j < GEMMEX_MICRO; ++j) rC[i][j] = 0;
+
+    for (int kk = 0; kk < K; kk += GEMMEX_KTILE) {
+      // Each work item stages four elements of A and of B, walking the
+      // contiguous dimension of each operand with consecutive work items
+      for (int l = 0; l < GEMMEX_MICRO; ++l) {
+        int idx = tid + l * GEMMEX_TS * GEMMEX_TS;
+        int m = transA ? idx / GEMMEX_KTILE : idx % GEMMEX_TILE;
+        int k = transA ? idx % GEMMEX_KTILE : idx / GEMMEX_TILE;
+        int gm = row0 + m;
+        int gk = kk + k;
+        lA[k][m] = (gm < M && gk < K)
+                       ? gemmex_load<TS>(transA ? A[aOffset + gm * lda + gk]
+                                                : A[aOffset + gk * lda + gm])
+                       : static_cast<TS>(0);
+
+        int n = transB ? idx % GEMMEX_TILE : idx / GEMMEX_KTILE;
+        k = transB ? idx / GEMMEX_TILE : idx % GEMMEX_KTILE;
+        int gn = col0 + n;
+        gk = kk + k;
+        lB[k][n] = (gn < N && gk < K)
+                       ? gemmex_load<TS>(transB ? B[bOffset + gk * ldb + gn]
+                                                : B[bOffset + gn * ldb + gk])
+                       : static_cast<TS>(0);
+      }
+
+      tidx.barrier.wait();
+
+      for (int k = 0; k < GEMMEX_KTILE; ++k) {
+        for (int i = 0; i < GEMMEX_MICRO; ++i) {
+          rA[i] = lA[k][tx + i * GEMMEX_TS];
+          rB[i] = lB[k][ty + i * GEMMEX_TS];
+        }
+        for (int i = 0; i < GEMMEX_MICRO; ++i)
+          for (int j = 0; j < GEMMEX_MICRO; ++j) rC[i][j] += rA[i] * rB[j];
+      }
+
+      tidx.barrier.wait();
+    }
+
+    for (int j = 0; j < GEMMEX_MICRO; ++j) {
+      int gn = col0 + ty + j * GEMMEX_TS;
+      for (int i = 0; i < GEMMEX_MICRO; ++i) {
+        int gm = row0 + tx + i * GEMMEX_TS;
+        if (gm < M && gn < N) {
+          __int64_t C_index = cOffset + gn * ldc + gm;
+          TS value = alpha * rC[i][j];
+          if (ep.scale != NULL) {
+            value *= static_cast<TS>(ep.scale[ep.scaleColumn ? gn : gm]);
+          }
+          if (beta != static_cast<TS>(0)) {
+            value += beta * gemmex_load<TS>(C[C_index]);
+          }
+          if (ep.bias != NULL) {
+            value += static_cast<TS>(ep.bias[ep.biasColumn ? gn : gm]);
+          }
+          if (aux != NULL) {
+            aux[ep.auxOffset + gn * ep.ldaux + gm] = gemmex_store<TC>(value);
+          }
+          if (ep.activation != ActivationNone) {
+            value = static_cast<TS>(
+                gemmex_activate(static_cast<float>(value), ep));
+          }
+          C[C_index] = gemmex_store<TC>(value);
+        }
+      }
+    }
+  });
+}
+
+typedef hcblasStatus (*gemmex_launcher)(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue);
+
+template <typename TA, typename TB, typename TC, typename TS>
+static hcblasStatus gemmex_template(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  TS alphaS = *static_cast<const TS *>(alpha);
+  TS betaS = *static_cast<const TS *>(beta);
+  gemmex_epilogue ep = {NULL, false, NULL, false, ActivationNone, 0, 0, 0, 0};
+  TC *aux = NULL;
+  if (epilogue != NULL) {
+    // Rows of a row major C are the columns of the transposed problem
+    hcblasQuantAxis columnAxis = order ? PerColumn : PerRow;
+    ep.bias = epilogue->bias;
+    ep.biasColumn = epilogue->biasAxis == columnAxis;
+    ep.scale = epilogue->scale;
+    ep.scaleColumn = epilogue->scaleAxis == columnAxis;
+    ep.activation = epilogue->activation;
+    ep.clampMin = epilogue->clampMin;
+    ep.clampMax = epilogue->clampMax;
+    ep.auxOffset = epilogue->auxOffset;
+    ep.ldaux = epilogue->ldaux;
+    aux = static_cast<TC *>(epilogue->aux);
+  }
+  if (order) {
+    gemmex_HC<TA, TB, TC, TS>(accl_view, typeA == Trans, typeB == Trans, M, N,
+                              K, alphaS, static_cast<const TA *>(A), aOffset,
+                              lda, static_cast<const TB *>(B), bOffset, ldb,
+                              betaS, static_cast<TC *>(C), cOffset, ldc, ep,
+                              aux);
+  } else {
+    // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+    gemmex_HC<TB, TA, TC, TS>(accl_view, typeB == Trans, typeA == Trans, N, M,
+                              K, alphaS, static_cast<const TB *>(B), bOffset,
+                              ldb, static_cast<const TA *>(A), aOffset, lda,
+                              betaS, static_cast<TC *>(C), cOffset, ldc, ep,
+                              aux);
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+/* Homogeneous types keep using the tuned per precision kernels */
+static hcblasStatus gemmex_sgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  return lib->hcblas_sgemm(
+      accl_view, order, typeA, typeB, M, N, K,
+      *static_cast<const float *>(alpha),
+      const_cast<float *>(static_cast<const float *>(A)), lda,
+      const_cast<float *>(static_cast<const float *>(B)), ldb,
+      *static_cast<const float *>(beta), static_cast<float *>(C), ldc,
+      aOffset, bOffset, cOffset);
+}
+
+static hcblasStatus gemmex_dgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  return lib->hcblas_dgemm(
+      accl_view, order, typeA, typeB, M, N, K,
+      *static_cast<const double *>(alpha),
+      const_cast<double *>(static_cast<const double *>(A)), lda,
+      const_cast<double *>(static_cast<const double *>(B)), ldb,
+      *static_cast<const double *>(beta), static_cast<double *>(C), ldc,
+      aOffset, bOffset, cOffset);
+}
+
+static hcblasStatus gemmex_hgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  return lib->hcblas_hgemm(
+      accl_view, order, typeA, typeB, M, N, K,
+      *static_cast<const hc::half *>(alpha),
+      const_cast<hc::half *>(static_cast<const hc::half *>(A)), lda,
+      const_cast<hc::half *>(static_cast<const hc::half *>(B)), ldb,
+      *static_cast<const hc::half *>(beta), static_cast<hc::half *>(C), ldc,
+      aOffset, bOffset, cOffset);
+}
+
+static hcblasStatus gemmex_cgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  typedef hc::short_vector::float_2 T;
+  return lib->hcblas_cgemm(
+      accl_view, order, typeA, typeB, M, N, K, *static_cast<const T *>(alpha),
+      const_cast<T *>(static_cast<const T *>(A)), aOffset, lda,
+      const_cast<T *>(static_cast<const T *>(B)), bOffset, ldb,
+      *static_cast<const T *>(beta), static_cast<T *>(C), cOffset, ldc);
+}
+
+static hcblasStatus gemmex_zgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  typedef hc::short_vector::double_2 T;
+  return lib->hcblas_zgemm(
+      accl_view, order, typeA, typeB, M, N, K, *static_cast<const T *>(alpha),
+      const_cast<T *>(static_cast<const T *>(A)), aOffset, lda,
+      const_cast<T *>(static_cast<const T *>(B)), bOffset, ldb,
+      *static_cast<const T *>(beta), static_cast<T *>(C), cOffset, ldc);
+}
+
+/* int8 inputs with int32 accumulation use the packed igemm kernels */
+static hcblasStatus gemmex_igemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, int M, int N, int K,
+    const void *alpha, const void *A, __int64_t aOffset, __int64_t lda,
+    const void *B, __int64_t bOffset, __int64_t ldb, const void *beta, void *C,
+    __int64_t cOffset, __int64_t ldc, const hcblasEpilogue *epilogue) {
+  return lib->hcblas_igemm(
+      accl_view, order, typeA, typeB, M, N, K, *static_cast<const int *>(alpha),
+      static_cast<const signed char *>(A), lda,
+      static_cast<const signed char *>(B), ldb, *static_cast<const int *>(beta),
+      static_cast<int *>(C), ldc, aOffset, bOffset, cOffset);
+}
+
+struct gemmex_entry {
+  hcblasDatatype Atype;
+  hcblasDatatype Btype;
+  hcblasDatatype Ctype;
+  hcblasDatatype computeType;
+  gemmex_launcher launch;
+  // Launcher used when an epilogue is requested, NULL if not supported
+  gemmex_launcher fused;
+};
+
+/* Supported ( A, B, C, compute ) type combinations */
+static const gemmex_entry gemmex_table[] = {
+    {FloatType, FloatType, FloatType, FloatType, gemmex_sgemm,
+     gemmex_template<float, float, float, float>},
+    {DoubleType, DoubleType, DoubleType, DoubleType, gemmex_dgemm, NULL},
+    {HalfType, HalfType, HalfType, HalfType, gemmex_hgemm, NULL},
+    {ComplexType, ComplexType, ComplexType, ComplexType, gemmex_cgemm, NULL},
+    {DoubleComplexType, DoubleComplexType, DoubleComplexType,
+     DoubleComplexType, gemmex_zgemm, NULL},
+    {HalfType, HalfType, FloatType, FloatType,
+     gemmex_template<hc::half, hc::half, float, float>,
+     gemmex_template<hc::half, hc::half, float, float>},
+    {HalfType, HalfType, HalfType, FloatType,
+     gemmex_template<hc::half, hc::half, hc::half, float>,
+     gemmex_template<hc::half, hc::half, hc::half, float>},
+    {Int8Type, Int8Type, Int32Type, Int32Type, gemmex_igemm, NULL},
+    {Bfloat16Type, Bfloat16Type, Bfloat16Type, FloatType,
+     gemmex_template<hcBfloat16, hcBfloat16, hcBfloat16, float>,
+     gemmex_template<hcBfloat16, hcBfloat16, hcBfloat16, float>},
+    {Bfloat16Type, Bfloat16Type, FloatType, FloatType,
+     gemmex_template<hcBfloat16, hcBfloat16, float, float>,
+     gemmex_template<hcBfloat16, hcBfloat16, float, float>},
+};
+
+static const gemmex_entry *gemmex_lookup(hcblasDatatype Atype,
+                                         hcblasDatatype Btype,
+                                         hcblasDatatype Ctype,
+                                         hcblasDatatype computeType) {
+  for (int i = 0; i < sizeof(gemmex_table) / sizeof(gemmex_table[0]); i++) {
+    const gemmex_entry &entry = gemmex_table[i];
+    if (entry.Atype == Atype && entry.Btype == Btype && entry.Ctype == Ctype &&
+        entry.computeType == computeType) {
+      return &entry;
+    }
+  }
+  return NULL;
+}
+
+bool Hcblaslibrary::hcblas_gemmex_supported(hcblasDatatype Atype,
+                                            hcblasDatatype Btype,
+                                            hcblasDatatype Ctype,
+                                            hcblasDatatype computeType,
+                                            bool epilogue) {
+  const gemmex_entry *entry = gemmex_lookup(Atype, Btype, Ctype, computeType);
+  return entry != NULL && (!epilogue || entry->fused != NULL);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_gemmex(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const void *alpha, const void *A, hcblasDatatype Atype,
+    const __int64_t aOffset, const __int64_t lda, const void *B,
+    hcblasDatatype Btype, const __int64_t bOffset, const __int64_t ldb,
+    const void *beta, void *C, hcblasDatatype Ctype, const __int64_t cOffset,
+    const __int64_t ldc, hcblasDatatype computeType,
+    const hcblasEpilogue *epilogue) {
+  // Quick return if possible
+  if (alpha == NULL || beta == NULL || A == NULL || B == NULL || C == NULL ||
+      M <= 0 || N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  const gemmex_entry *entry = gemmex_lookup(Atype, Btype, Ctype, computeType);
+
+  // Unsupported type combination
+  if (entry == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  if (epilogue != NULL) {
+    if (entry->fused == NULL ||
+        (epilogue->aux != NULL && epilogue->ldaux < (order ? M : N)) ||
+        (epilogue->activation == ActivationClamp &&
+         epilogue->clampMin > epilogue->clampMax)) {
+      return HCBLAS_INVALID;
+    }
+    return entry->fused(this, accl_view, order, typeA, typeB, M, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc,
+                        epilogue);
+  }
+
+  return entry->launch(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                       aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc,
+                       NULL);
+}
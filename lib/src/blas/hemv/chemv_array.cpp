@@ -0,0 +1,198 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <hc_math.hpp>
+
+#define HEMV_BLOCK 32
+#define BLOCK_SIZE 256
+
+/*
+ * CHEMV follows the two pass scheme of SYMV: every block of the stored
+ * triangle is loaded once into LDS and produces a partial for its own rows
+ * and a conjugated partial for the mirrored rows. Partials land in distinct
+ * workspace slots that the second pass reduces in a fixed order.
+ *
+ * The Hermitian mirror of a row major matrix is not a plain triangle swap
+ * (the off diagonal elements would also need conjugating), so element
+ * (r, c) is addressed through explicit row and column strides instead.
+ */
+static void hemv_partials(hc::accelerator_view accl_view, bool upper, int n,
+                          const hc::short_vector::float_2 *A,
+                          __int64_t aOffset, __int64_t rowStride,
+                          __int64_t colStride,
+                          const hc::short_vector::float_2 *X,
+                          __int64_t xOffset, __int64_t incX,
+                          hc::short_vector::float_2 *work, int numBlocks) {
+  hc::extent<2> compute_domain(numBlocks, numBlocks * HEMV_BLOCK);
+  hc::parallel_for_each(accl_view, compute_domain.tile(1, HEMV_BLOCK), [=
+  ](hc::tiled_index<2> tidx)[[hc]] {
+    int I = tidx.tile[0];
+    int J = tidx.tile[1];
+    int tx = tidx.local[1];
+
+    if (upper ? (I > J) : (I < J)) return;
+
+    tile_static float lAreal[HEMV_BLOCK][HEMV_BLOCK + 1];
+    tile_static float lAimg[HEMV_BLOCK][HEMV_BLOCK + 1];
+    tile_static float lxIreal[HEMV_BLOCK], lxIimg[HEMV_BLOCK];
+    tile_static float lxJreal[HEMV_BLOCK], lxJimg[HEMV_BLOCK];
+    int row0 = I * HEMV_BLOCK;
+    int col0 = J * HEMV_BLOCK;
+    int row = row0 + tx;
+
+    for (int c = 0; c < HEMV_BLOCK; ++c) {
+      int col = col0 + c;
+      if (row < n && col < n) {
+        hc::short_vector::float_2 a =
+            A[aOffset + row * rowStride + col * colStride];
+        lAreal[tx][c] = a.x;
+        // The imaginary part of the diagonal is assumed to be zero
+        lAimg[tx][c] = (row == col) ? 0.0f : a.y;
+      } else {
+        lAreal[tx][c] = 0.0f;
+        lAimg[tx][c] = 0.0f;
+      }
+    }
+    if (row < n) {
+      hc::short_vector::float_2 x = X[xOffset + row * incX];
+      lxIreal[tx] = x.x;
+      lxIimg[tx] = x.y;
+    } else {
+      lxIreal[tx] = 0.0f;
+      lxIimg[tx] = 0.0f;
+    }
+    if (col0 + tx < n) {
+      hc::short_vector::float_2 x = X[xOffset + (col0 + tx) * incX];
+      lxJreal[tx] = x.x;
+      lxJimg[tx] = x.y;
+    } else {
+      lxJreal[tx] = 0.0f;
+      lxJimg[tx] = 0.0f;
+    }
+
+    tidx.barrier.wait();
+
+    float rowReal = 0.0f, rowImg = 0.0f;
+    if (I == J) {
+      for (int c = 0; c < HEMV_BLOCK; ++c) {
+        bool stored = upper ? (tx <= c) : (tx >= c);
+        float ar = stored ? lAreal[tx][c] : lAreal[c][tx];
+        float ai = stored ? lAimg[tx][c] : -lAimg[c][tx];
+        rowReal += ar * lxJreal[c] - ai * lxJimg[c];
+        rowImg += ar * lxJimg[c] + ai * lxJreal[c];
+      }
+      if (row < n) {
+        work[(__int64_t)I * n + row] =
+            hc::short_vector::float_2(rowReal, rowImg);
+      }
+    } else {
+      float colReal = 0.0f, colImg = 0.0f;
+      for (int c = 0; c < HEMV_BLOCK; ++c) {
+        rowReal += lAreal[tx][c] * lxJreal[c] - lAimg[tx][c] * lxJimg[c];
+        rowImg += lAreal[tx][c] * lxJimg[c] + lAimg[tx][c] * lxJreal[c];
+        // conj(A(c, tx)) * x(c)
+        colReal += lAreal[c][tx] * lxIreal[c] + lAimg[c][tx] * lxIimg[c];
+        colImg += lAreal[c][tx] * lxIimg[c] - lAimg[c][tx] * lxIreal[c];
+      }
+      if (row < n) {
+        work[(__int64_t)J * n + row] =
+            hc::short_vector::float_2(rowReal, rowImg);
+      }
+      if (col0 + tx < n) {
+        work[(__int64_t)I * n + col0 + tx] =
+            hc::short_vector::float_2(colReal, colImg);
+      }
+    }
+  }) ;
+}
+
+static void hemv_reduce(hc::accelerator_view accl_view, int n,
+                        const hc::short_vector::float_2 *work, int numBlocks,
+                        hc::short_vector::float_2 alpha,
+                        hc::short_vector::float_2 beta,
+                        hc::short_vector::float_2 *Y, __int64_t yOffset,
+                        __int64_t incY) {
+  __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int i = tidx.global[0];
+    if (i < n) {
+      float sumReal = 0.0f, sumImg = 0.0f;
+      for (int s = 0; s < numBlocks; ++s) {
+        hc::short_vector::float_2 w = work[(__int64_t)s * n + i];
+        sumReal += w.x;
+        sumImg += w.y;
+      }
+      __int64_t Y_index = yOffset + i * incY;
+      float outReal = alpha.x * sumReal - alpha.y * sumImg;
+      float outImg = alpha.x * sumImg + alpha.y * sumReal;
+      if (beta.x != 0 || beta.y != 0) {
+        hc::short_vector::float_2 y = Y[Y_index];
+        outReal += beta.x * y.x - beta.y * y.y;
+        outImg += beta.x * y.y + beta.y * y.x;
+      }
+      Y[Y_index] = hc::short_vector::float_2(outReal, outImg);
+    }
+  }) ;
+}
+
+/* CHEMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_chemv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const hc::short_vector::float_2 &alpha,
+    const hc::short_vector::float_2 *A, const __int64_t aOffset, const int lda,
+    const hc::short_vector::float_2 *X, const __int64_t xOffset,
+    const int incX, const hc::short_vector::float_2 &beta,
+    hc::short_vector::float_2 *Y, const __int64_t yOffset, const int incY) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha.x == 0 && alpha.y == 0 && beta.x == 1 && beta.y == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  __int64_t rowStride = order ? 1 : lda;
+  __int64_t colStride = order ? lda : 1;
+  int numBlocks = (N + HEMV_BLOCK - 1) / HEMV_BLOCK;
+  hc::accelerator accl = accl_view.get_accelerator();
+  hc::short_vector::float_2 *work = (hc::short_vector::float_2 *)hc::am_alloc(
+      sizeof(hc::short_vector::float_2) * numBlocks * N, accl, 0);
+  if (work == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  hemv_partials(accl_view, uplo == Upper, N, A, aOffset, rowStride, colStride,
+                X, xOffset, incX, work, numBlocks);
+  hemv_reduce(accl_view, N, work, numBlocks, alpha, beta, Y, yOffset, incY);
+
+  accl_view.wait();
+  hc::am_free(work);
+  return HCBLAS_SUCCEEDS;
+}
@@ -21,12 +21,15 @@ THE SOFTWARE.
 */
 
 #include "./hgemm_array_kernels.h"
+#include "include/hcblas_trace.h"
 #include <hc_math.hpp>
 
-hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
+hcblasStatus gemm_NoTransB_STEP_TS8XSS8(hc::accelerator_view accl_view,
+                                        hc::half *A, __int64_t aOffset,
+                                        hc::half *B, __int64_t bOffset,
+                                        hc::half *C, __int64_t cOffset, int M,
+                                        int N, int K, int lda, int ldb, int ldc,
+                                        hc::half alpha, hc::half beta) {
 #define TILESIZE 8
 #define STEPSIZE 8
   hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -34,12 +37,11 @@ hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(
   hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
   hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
     int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1];
+    hc::half rC[1][1] = {{(hc::half)0}};
     hc::half rA[1][STEPSIZE / TILESIZE];
     hc::half rB[1][STEPSIZE / TILESIZE];
-    tile_static hc::half lA[TILESIZE * STEPSIZE];  // 8*8+8
+    tile_static hc::half lA[TILESIZE * STEPSIZE];
     tile_static hc::half lB[TILESIZE * STEPSIZE];
-    rC[0][0] = 0;
     int gidx = tidx.tile[1];
     int gidy = tidx.tile[0];
     int idx = tidx.local[1];
@@ -53,26 +55,23 @@ hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(
     do {
       tidx.barrier.wait();
 
-      // Load Sections of A and B into respective shared memory slots
       for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
         if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * TILESIZE + idxT + (TILESIZE * TILESIZE * sec)] =
+            i * STEPSIZE + idxT + (sec * TILESIZE) < K) {
+          lB[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] =
               B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (TILESIZE * sec)];
+                (sec * TILESIZE)];
         } else {
-          lB[idyT * TILESIZE + idxT + (TILESIZE * TILESIZE * sec)] = 0;
+          lB[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] = 0;
         }
 
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * TILESIZE + idyT + (TILESIZE * TILESIZE * sec)] =
-              A[aOffset + gidx * TILESIZE + idxT + idyT * lda +
-                i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
+        if (gidx * TILESIZE + idyT < M &&
+            i * STEPSIZE + idxT + (sec * TILESIZE) < K) {
+          lA[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] =
+              A[aOffset + (gidx * TILESIZE + idyT) * lda + idxT + i * STEPSIZE +
+                (sec * TILESIZE)];
         } else {
-          lA[idxT * TILESIZE + idyT + (TILESIZE * TILESIZE * sec)] = 0;
+          lA[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] = 0;
         }
       }
 
@@ -92,84 +91,7 @@ hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(
 
     if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
       __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransAB_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{0.0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];  // 8*8+8
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] =
-              B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (TILESIZE * sec)];
-        } else {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] =
-              A[aOffset + gidx * TILESIZE + idxT + idyT * lda +
-                i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
+          cOffset + (gidx * TILESIZE + idx) + (gidy * TILESIZE + idy) * ldc;
       C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
       C[C_index] = alpha * rC[0][0] + beta * C[C_index];
     }
@@ -179,7 +101,7 @@ hcblasStatus gemm_NoTransAB_STEP_NBK_TS8XSS8(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_TS16XSS16(
+hcblasStatus gemm_NoTransB_STEP_NBK_TS16XSS16(
     hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
     __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
     int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
@@ -189,45 +111,46 @@ hcblasStatus gemm_NoTransAB_STEP_NBK_TS16XSS16(
                        (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
   hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
   hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
+    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
+    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
+    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
     hc::half rC[1][1] = {{0.0}};
     hc::half rA[1][STEPTILERATIO];
     hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];  // 8*8+8
+    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
     tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
     int gidx = tidx.tile[1];
     int gidy = tidx.tile[0];
     int idx = tidx.local[1];
     int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
+    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
+    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
+    int idxS = ids & (STEPSIZE - 1);
+    int idyT = (idt) >> tilemulshift;
+    int gidyOffset = gidy << tilemulshift;
+    int gidxOffset = gidx << tilemulshift;
+    int idyTOffset = idyT * BANKTILESIZE;
     int i = 0;
 
     do {
       tidx.barrier.wait();
+      int iOffset = i << shiftfactor;
 
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] =
-              B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (TILESIZE * sec)];
-        } else {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] = 0;
+      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
+        int secOffset = sec << tilemulshift;
+        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
+        int localIdx = secStartPt + idxS + idyTOffset;
+        int kIndex = iOffset + idxS + secOffset;
+        // Initialize the local memory with zero
+        lB[localIdx] = 0;
+        lA[localIdx] = 0;
+
+        if (gidyOffset + idyT < N && kIndex < K) {
+          lB[localIdx] = B[bOffset + (gidyOffset + idyT) * ldb + kIndex];
         }
 
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] =
-              A[aOffset + gidx * TILESIZE + idxT + idyT * lda +
-                i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] = 0;
+        if (gidxOffset + idyT < M && kIndex < K) {
+          lA[localIdx] = A[aOffset + (gidxOffset + idyT) * lda + kIndex];
         }
       }
 
@@ -235,7 +158,7 @@ hcblasStatus gemm_NoTransAB_STEP_NBK_TS16XSS16(
       int offA = idx * BANKTILESIZE;
       int offB = idy * BANKTILESIZE;
 
-      for (int iter = 0; iter < TILESIZE; ++iter) {
+      for (int piter = 0; piter < TILESIZE; ++piter) {
         MS1x1_NOBANK(1);
       }
 
@@ -243,10 +166,11 @@ hcblasStatus gemm_NoTransAB_STEP_NBK_TS16XSS16(
     } while (--block_k > 0);
 
     tidx.barrier.wait();
+    int crow = gidxOffset + idx;
+    int ccolprod = (gidyOffset + idy) * ldc;
 
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
+    if (crow < M && ccolprod / ldc < N) {
+      __int64_t C_index = cOffset + crow + ccolprod;
       C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
       C[C_index] = alpha * rC[0][0] + beta * C[C_index];
     }
@@ -256,7 +180,7 @@ hcblasStatus gemm_NoTransAB_STEP_NBK_TS16XSS16(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_TS16XMTS2(
+hcblasStatus gemm_NoTransB_MICRO_NBK_TS16XMTS2(
     hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
     __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
     int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
@@ -279,19 +203,20 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_TS16XMTS2(
     int idx = tidx.local[1];
     int idy = tidx.local[0];
     int idt = (idy << shiftTS) + idx;
-    int idxT = idt & (TILESIZE - 1);
-    int idyT = idt >> shiftTS;
+    int idxT = idt % TILESIZE;
+    int idyT = idt / TILESIZE;
     int block_k = 0;
 
     do {
-      int colIndex = (block_k << shiftTS) + idyT;
-      int lIndex = (idyT * BANKMICROTILESIZE) + idxT;
+      int colIndex = (block_k << shiftTS) + idxT;
+      int lIndex = (idxT * BANKMICROTILESIZE) + idyT;
       tidx.barrier.wait();
 
       for (int sec = 0; sec < MICROTILESIZE; ++sec) {
         int secVal = sec << shiftTS;
-        int BrowIndex = (gidy * MICROTILEPROD) + idxT + secVal;
-        int ArowIndex = (gidx * MICROTILEPROD) + idxT + secVal;
+        int BrowIndex = (gidy * MICROTILEPROD) + idyT + secVal;
+        int ArowIndex = (gidx * MICROTILEPROD) + idyT + secVal;
+        tidx.barrier.wait();
 
         if (BrowIndex < N && colIndex < K) {
           lB[lIndex + secVal] = B[bOffset + BrowIndex * ldb + colIndex];
@@ -300,7 +225,7 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_TS16XMTS2(
         }
 
         if (ArowIndex < M && colIndex < K) {
-          lA[lIndex + secVal] = A[aOffset + ArowIndex + colIndex * lda];
+          lA[lIndex + secVal] = A[aOffset + ArowIndex * lda + colIndex];
         } else {
           lA[lIndex + secVal] = 0;
         }
@@ -315,7 +240,7 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_TS16XMTS2(
       }
 
       tidx.barrier.wait();
-    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) / TILESIZE));
+    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) >> shiftTS));
 
     int xIndex = (gidx * MICROTILEPROD) + idx;
     int yIndex = ((gidy * MICROTILEPROD) + idy) * ldc;
@@ -338,7 +263,7 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_TS16XMTS2(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB_MICRO_TS16XMTS2(
+hcblasStatus gemm_NoTransB_MICRO_TS16XMTS2(
     hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
     __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
     int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
@@ -368,22 +293,24 @@ hcblasStatus gemm_NoTransAB_MICRO_TS16XMTS2(
       tidx.barrier.wait();
 
       for (int sec = 0; sec < MICROTILESIZE; ++sec) {
-        if (gidy * TILESIZE * MICROTILESIZE + idyT + (sec * TILESIZE) < N &&
-            block_k * TILESIZE + idxT < K) {
-          lB[(idxT * TILESIZE * MICROTILESIZE) + idyT + (sec * TILESIZE)] =
+        if (gidy * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < N &&
+            block_k * TILESIZE + idyT < K) {
+          lB[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
               B[bOffset +
-                (gidy * TILESIZE * MICROTILESIZE + idyT + sec * TILESIZE) *
+                (gidy * TILESIZE * MICROTILESIZE + idxT + sec * TILESIZE) *
                     ldb +
-                idxT + block_k * TILESIZE];
+                idyT + block_k * TILESIZE];
         } else {
-          lB[(idxT * TILESIZE * MICROTILESIZE) + idyT + (sec * TILESIZE)] = 0;
+          lB[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
         }
 
         if (gidx * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < M &&
             block_k * TILESIZE + idyT < K) {
           lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              A[aOffset + (gidx * TILESIZE * MICROTILESIZE) + idxT +
-                (sec * TILESIZE) + idyT * lda + block_k * (lda * TILESIZE)];
+              A[aOffset +
+                (gidx * TILESIZE * MICROTILESIZE + idxT + sec * TILESIZE) *
+                    lda +
+                idyT + block_k * TILESIZE];
         } else {
           lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
         }
@@ -421,20 +348,18 @@ hcblasStatus gemm_NoTransAB_MICRO_TS16XMTS2(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransA_STEP_NBK_TS16XSS16(
+hcblasStatus gemm_TransAB_STEP_NBK_TS8XSS8(
     hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
     __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
     int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define STEPSIZE 16
+#define TILESIZE 8
+#define STEPSIZE 8
   hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
                        (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
   hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
   hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = hc::fast_math::log2f(STEPSIZE);
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    hc::half rC[1][1] = {{0.0}};
+    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
+    hc::half rC[1][1] = {{(hc::half)0}};
     hc::half rA[1][STEPTILERATIO];
     hc::half rB[1][STEPTILERATIO];
     tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
@@ -443,53 +368,51 @@ hcblasStatus gemm_NoTransA_STEP_NBK_TS16XSS16(
     int gidy = tidx.tile[0];
     int idx = tidx.local[1];
     int idy = tidx.local[0];
-    int idt = (idy << tilemulshift) + idx;
-    int idyT = idt >> tilemulshift;
-    int idxT = idt & (TILESIZE - 1);
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
+    int idt = TILESIZE * idy + idx;
+    int idxT = idt % TILESIZE;
+    int idyT = idt / TILESIZE;
+    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
     int i = 0;
 
     do {
       tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxT + idyTOffset;
-        int kIndex = iOffset + idyT + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
 
-        if (gidyOffset + idxT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + gidyOffset + idxT + kIndex * ldb];
+      for (int sec = 0; sec < STEPSIZE / TILESIZE; sec++) {
+        if (gidy * TILESIZE + idxT < N &&
+            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
+          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] =
+              B[bOffset + gidy * TILESIZE + idxT +
+                ((idyT + (sec * TILESIZE)) * ldb) + i * (ldb << shiftFactor)];
+        } else {
+          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] = 0;
         }
 
-        if (gidxOffset + idxT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + gidxOffset + idxT + kIndex * lda];
+        if (gidx * TILESIZE + idxT < M &&
+            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
+          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] =
+              A[aOffset + (gidx * TILESIZE + idxT) * lda + idyT + i * STEPSIZE +
+                (sec * TILESIZE)];
+        } else {
+          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] = 0;
         }
       }
 
       tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
+      int offA = idx * BANKTILESIZE;
+      int offB = idy * BANKTILESIZE;
 
       for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(BANKTILESIZE);
+        MS1x1_NOBANK(1);
       }
 
       i++;
     } while (--block_k > 0);
 
     tidx.barrier.wait();
-    int crow = gidxOffset + idx;
-    int ccolprod = (gidyOffset + idy) * ldc;
 
-    if (crow < M && ccolprod / ldc < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
+    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
+      __int64_t C_index =
+          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
       C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
       C[C_index] = alpha * rC[0][0] + beta * C[C_index];
     }
@@ -499,20 +422,18 @@ hcblasStatus gemm_NoTransA_STEP_NBK_TS16XSS16(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransA_STEP_NBK_TS8XSS8(
+hcblasStatus gemm_TransAB_STEP_NBK_TS16XSS16(
     hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
     __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
     int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
+#define TILESIZE 16
+#define STEPSIZE 16
   hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
                        (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
   hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
   hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = hc::fast_math::log2f(STEPSIZE);
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    hc::half rC[1][1] = {{0.0}};
+    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
+    hc::half rC[1][1] = {{(hc::half)0}};
     hc::half rA[1][STEPTILERATIO];
     hc::half rB[1][STEPTILERATIO];
     tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
@@ -521,195 +442,41 @@ hcblasStatus gemm_NoTransA_STEP_NBK_TS8XSS8(
     int gidy = tidx.tile[0];
     int idx = tidx.local[1];
     int idy = tidx.local[0];
-    int idt = (idy << tilemulshift) + idx;
-    int idyT = idt >> tilemulshift;
-    int idxT = idt & (TILESIZE - 1);
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
+    int idt = TILESIZE * idy + idx;
+    int idxT = idt % TILESIZE;
+    int idyT = idt / TILESIZE;
+    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
     int i = 0;
 
     do {
       tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxT + idyTOffset;
-        int kIndex = iOffset + idyT + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
 
-        if (gidyOffset + idxT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + gidyOffset + idxT + kIndex * ldb];
+      for (int sec = 0; sec < STEPSIZE / TILESIZE; sec++) {
+        if (gidy * TILESIZE + idxT < N &&
+            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
+          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] =
+              B[bOffset + gidy * TILESIZE + idxT +
+                ((idyT + (sec * TILESIZE)) * ldb) + i * (ldb << shiftFactor)];
+        } else {
+          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] = 0;
         }
 
-        if (gidxOffset + idxT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + gidxOffset + idxT + kIndex * lda];
+        if (gidx * TILESIZE + idxT < M &&
+            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
+          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] =
+              A[aOffset + (gidx * TILESIZE + idxT) * lda + idyT + i * STEPSIZE +
+                (sec * TILESIZE)];
+        } else {
+          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] = 0;
         }
       }
 
       tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
+      int offA = idx * BANKTILESIZE;
+      int offB = idy * BANKTILESIZE;
 
       for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(BANKTILESIZE);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = gidxOffset + idx;
-    int ccolprod = (gidyOffset + idy) * ldc;
-
-    if (crow < M && ccolprod / ldc < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransA_STEP_TS8XSS8(hc::accelerator_view accl_view,
-                                        hc::half *A, __int64_t aOffset,
-                                        hc::half *B, __int64_t bOffset,
-                                        hc::half *C, __int64_t cOffset, int M,
-                                        int N, int K, int lda, int ldb, int ldc,
-                                        hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{(hc::half)0}};
-    hc::half rA[1][STEPSIZE / TILESIZE];
-    hc::half rB[1][STEPSIZE / TILESIZE];
-    tile_static hc::half lA[TILESIZE * STEPSIZE];
-    tile_static hc::half lB[TILESIZE * STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        if (gidy * TILESIZE + idxT < N &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lB[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] =
-              B[bOffset + gidy * TILESIZE + idxT +
-                (idyT + (sec * TILESIZE)) * ldb + i * (ldb << shiftFactor)];
-        } else {
-          lB[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] = 0;
-        }
-
-        if (gidx * TILESIZE + idxT < M &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lA[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] =
-              A[aOffset + gidx * TILESIZE + idxT +
-                (idyT + (sec * TILESIZE)) * lda + i * (lda << shiftFactor)];
-        } else {
-          lA[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-      int offset = TILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1(offset, offset);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransA_STEP_TS16XSS16(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define STEPSIZE 16
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{(hc::half)0}};
-    hc::half rA[1][STEPSIZE / TILESIZE];
-    hc::half rB[1][STEPSIZE / TILESIZE];
-    tile_static hc::half lA[TILESIZE * STEPSIZE];
-    tile_static hc::half lB[TILESIZE * STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        if (gidy * TILESIZE + idxT < N &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lB[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] =
-              B[bOffset + gidy * TILESIZE + idxT +
-                (idyT + (sec * TILESIZE)) * ldb + i * (ldb << shiftFactor)];
-        } else {
-          lB[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] = 0;
-        }
-
-        if (gidx * TILESIZE + idxT < M &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lA[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] =
-              A[aOffset + gidx * TILESIZE + idxT +
-                (idyT + (sec * TILESIZE)) * lda + i * (lda << shiftFactor)];
-        } else {
-          lA[(idyT + (sec * TILESIZE)) * TILESIZE + idxT] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-      int offset = TILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1(offset, offset);
+        MS1x1_NOBANK(1);
       }
 
       i++;
@@ -729,89 +496,7 @@ hcblasStatus gemm_NoTransA_STEP_TS16XSS16(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransA_MICRO_NBK_TS16XMTS2(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define MICROTILESIZE 2
-  int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
-  int N_ = hc::fast_math::fmaxf(1, (N / MICROTILESIZE + 1));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M_ + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftTS = hc::fast_math::log2f(TILESIZE);
-    hc::half rC[MICROTILESIZE][MICROTILESIZE] = {{(hc::half)0}};
-    hc::half rA[1][MICROTILESIZE];
-    hc::half rB[1][MICROTILESIZE];
-    tile_static hc::half lA[TOTMICROTILEPROD + TILESIZE];
-    tile_static hc::half lB[TOTMICROTILEPROD + TILESIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = (idy << shiftTS) + idx;
-    int idxT = idt & (TILESIZE - 1);
-    int idyT = idt >> shiftTS;
-    int block_k = 0;
-
-    do {
-      int colIndex = (block_k << shiftTS) + idyT;
-      int lIndex = (idyT * BANKMICROTILESIZE) + idxT;
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < MICROTILESIZE; ++sec) {
-        int secVal = sec << shiftTS;
-        int BrowIndex = (gidy * MICROTILEPROD) + idxT + secVal;
-        int ArowIndex = (gidx * MICROTILEPROD) + idxT + secVal;
-
-        if (BrowIndex < N && colIndex < K) {
-          lB[lIndex + secVal] = B[bOffset + BrowIndex + colIndex * ldb];
-        } else {
-          lB[lIndex + secVal] = 0;
-        }
-
-        if (ArowIndex < M && colIndex < K) {
-          lA[lIndex + secVal] = A[aOffset + ArowIndex + colIndex * lda];
-        } else {
-          lA[lIndex + secVal] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MTS_NOBANK;
-      }
-
-      tidx.barrier.wait();
-    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) >> shiftTS));
-
-    int xIndex = (gidx * MICROTILEPROD) + idx;
-    int yIndex = ((gidy * MICROTILEPROD) + idy) * ldc;
-
-    for (int row = 0; row < MICROTILESIZE; row++) {
-      for (int col = 0; col < MICROTILESIZE; col++) {
-        if (xIndex + (col << shiftTS) < M &&
-            (yIndex / ldc) + (row << shiftTS) < N) {
-          __int64_t C_index = cOffset + (xIndex + (col << shiftTS)) + yIndex +
-                              (row << shiftTS) * ldc;
-          C[C_index] =
-              (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-          C[C_index] = alpha * rC[col][row] + beta * C[C_index];
-        }
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef MICROTILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransA_MICRO_TS16XMTS2(
+hcblasStatus gemm_TransAB_MICRO_TS16XMTS2(
     hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
     __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
     int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
@@ -853,8 +538,10 @@ hcblasStatus gemm_NoTransA_MICRO_TS16XMTS2(
         if (gidx * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < M &&
             block_k * TILESIZE + idyT < K) {
           lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              A[aOffset + (gidx * TILESIZE * MICROTILESIZE) + idxT +
-                (sec * TILESIZE) + idyT * lda + block_k * (lda * TILESIZE)];
+              A[aOffset +
+                (gidx * TILESIZE * MICROTILESIZE + idxT + sec * TILESIZE) *
+                    lda +
+                idyT + block_k * TILESIZE];
         } else {
           lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
         }
@@ -892,858 +579,10 @@ hcblasStatus gemm_NoTransA_MICRO_TS16XMTS2(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransB_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    hc::half rC[1][1] = {{0.0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
-    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
-    int idxS = ids & (STEPSIZE - 1);
-    int idyT = (idt) >> tilemulshift;
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxS + idyTOffset;
-        int kIndex = iOffset + idxS + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idyT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + (gidyOffset + idyT) * ldb + kIndex];
-        }
-
-        if (gidxOffset + idyT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + (gidxOffset + idyT) * lda + kIndex];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int piter = 0; piter < TILESIZE; ++piter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = gidxOffset + idx;
-    int ccolprod = (gidyOffset + idy) * ldc;
-
-    if (crow < M && ccolprod / ldc < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransB_STEP_TS8XSS8(hc::accelerator_view accl_view,
-                                        hc::half *A, __int64_t aOffset,
-                                        hc::half *B, __int64_t bOffset,
-                                        hc::half *C, __int64_t cOffset, int M,
-                                        int N, int K, int lda, int ldb, int ldc,
-                                        hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{(hc::half)0}};
-    hc::half rA[1][STEPSIZE / TILESIZE];
-    hc::half rB[1][STEPSIZE / TILESIZE];
-    tile_static hc::half lA[TILESIZE * STEPSIZE];
-    tile_static hc::half lB[TILESIZE * STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        if (gidy * TILESIZE + idyT < N &&
-            i * STEPSIZE + idxT + (sec * TILESIZE) < K) {
-          lB[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] =
-              B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (sec * TILESIZE)];
-        } else {
-          lB[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] = 0;
-        }
-
-        if (gidx * TILESIZE + idyT < M &&
-            i * STEPSIZE + idxT + (sec * TILESIZE) < K) {
-          lA[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] =
-              A[aOffset + (gidx * TILESIZE + idyT) * lda + idxT + i * STEPSIZE +
-                (sec * TILESIZE)];
-        } else {
-          lA[(sec * TILESIZE * TILESIZE) + idxT + idyT * TILESIZE] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * TILESIZE;
-      int offB = idy * TILESIZE;
-      int offset = 1;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1(offset, offset);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + (gidx * TILESIZE + idx) + (gidy * TILESIZE + idy) * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransB_STEP_NBK_TS16XSS16(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define STEPSIZE 16
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    hc::half rC[1][1] = {{0.0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
-    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
-    int idxS = ids & (STEPSIZE - 1);
-    int idyT = (idt) >> tilemulshift;
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxS + idyTOffset;
-        int kIndex = iOffset + idxS + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idyT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + (gidyOffset + idyT) * ldb + kIndex];
-        }
-
-        if (gidxOffset + idyT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + (gidxOffset + idyT) * lda + kIndex];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int piter = 0; piter < TILESIZE; ++piter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = gidxOffset + idx;
-    int ccolprod = (gidyOffset + idy) * ldc;
-
-    if (crow < M && ccolprod / ldc < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_TS16XMTS2(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define MICROTILESIZE 2
-  int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
-  int N_ = hc::fast_math::fmaxf(1, (N / MICROTILESIZE + 1));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M_ + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftTS = hc::fast_math::log2f(TILESIZE);
-    hc::half rC[MICROTILESIZE][MICROTILESIZE] = {{(hc::half)0}};
-    hc::half rA[1][MICROTILESIZE];
-    hc::half rB[1][MICROTILESIZE];
-    tile_static hc::half lA[TOTMICROTILEPROD + TILESIZE];
-    tile_static hc::half lB[TOTMICROTILEPROD + TILESIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = (idy << shiftTS) + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = 0;
-
-    do {
-      int colIndex = (block_k << shiftTS) + idxT;
-      int lIndex = (idxT * BANKMICROTILESIZE) + idyT;
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < MICROTILESIZE; ++sec) {
-        int secVal = sec << shiftTS;
-        int BrowIndex = (gidy * MICROTILEPROD) + idyT + secVal;
-        int ArowIndex = (gidx * MICROTILEPROD) + idyT + secVal;
-        tidx.barrier.wait();
-
-        if (BrowIndex < N && colIndex < K) {
-          lB[lIndex + secVal] = B[bOffset + BrowIndex * ldb + colIndex];
-        } else {
-          lB[lIndex + secVal] = 0;
-        }
-
-        if (ArowIndex < M && colIndex < K) {
-          lA[lIndex + secVal] = A[aOffset + ArowIndex * lda + colIndex];
-        } else {
-          lA[lIndex + secVal] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MTS_NOBANK;
-      }
-
-      tidx.barrier.wait();
-    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) >> shiftTS));
-
-    int xIndex = (gidx * MICROTILEPROD) + idx;
-    int yIndex = ((gidy * MICROTILEPROD) + idy) * ldc;
-
-    for (int row = 0; row < MICROTILESIZE; row++) {
-      for (int col = 0; col < MICROTILESIZE; col++) {
-        if (xIndex + (col << shiftTS) < M &&
-            (yIndex / ldc) + (row << shiftTS) < N) {
-          __int64_t C_index = cOffset + (xIndex + (col << shiftTS)) + yIndex +
-                              (row << shiftTS) * ldc;
-          C[C_index] =
-              (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-          C[C_index] = alpha * rC[col][row] + beta * C[C_index];
-        }
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef MICROTILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransB_MICRO_TS16XMTS2(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define MICROTILESIZE 2
-  int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
-  int N_ = hc::fast_math::fmaxf(1, (N / MICROTILESIZE + 1));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M_ + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    hc::half rC[MICROTILESIZE][MICROTILESIZE] = {{(hc::half)0}};
-    hc::half rA[1][MICROTILESIZE];
-    hc::half rB[1][MICROTILESIZE];
-    tile_static hc::half lA[TILESIZE * TILESIZE * MICROTILESIZE];
-    tile_static hc::half lB[TILESIZE * TILESIZE * MICROTILESIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < MICROTILESIZE; ++sec) {
-        if (gidy * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < N &&
-            block_k * TILESIZE + idyT < K) {
-          lB[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              B[bOffset +
-                (gidy * TILESIZE * MICROTILESIZE + idxT + sec * TILESIZE) *
-                    ldb +
-                idyT + block_k * TILESIZE];
-        } else {
-          lB[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
-        }
-
-        if (gidx * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < M &&
-            block_k * TILESIZE + idyT < K) {
-          lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              A[aOffset +
-                (gidx * TILESIZE * MICROTILESIZE + idxT + sec * TILESIZE) *
-                    lda +
-                idyT + block_k * TILESIZE];
-        } else {
-          lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MTS;
-      }
-
-      tidx.barrier.wait();
-    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) / TILESIZE));
-
-    int xIndex = gidx * TILESIZE * MICROTILESIZE + idx;
-    int yIndex = (gidy * TILESIZE * MICROTILESIZE + idy) * ldc;
-
-    for (int row = 0; row < MICROTILESIZE; row++) {
-      for (int col = 0; col < MICROTILESIZE; col++) {
-        if (xIndex + (TILESIZE * col) < M &&
-            (yIndex / ldc) + (TILESIZE * row) < N) {
-          __int64_t C_index = cOffset + (xIndex + TILESIZE * col) + yIndex +
-                              (TILESIZE * row) * ldc;
-          C[C_index] =
-              (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-          C[C_index] = alpha * rC[col][row] + beta * C[C_index];
-        }
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef MICROTILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_TransAB_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{(hc::half)0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; sec++) {
-        if (gidy * TILESIZE + idxT < N &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] =
-              B[bOffset + gidy * TILESIZE + idxT +
-                ((idyT + (sec * TILESIZE)) * ldb) + i * (ldb << shiftFactor)];
-        } else {
-          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] = 0;
-        }
-
-        if (gidx * TILESIZE + idxT < M &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] =
-              A[aOffset + (gidx * TILESIZE + idxT) * lda + idyT + i * STEPSIZE +
-                (sec * TILESIZE)];
-        } else {
-          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_TransAB_STEP_NBK_TS16XSS16(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define STEPSIZE 16
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{(hc::half)0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; sec++) {
-        if (gidy * TILESIZE + idxT < N &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] =
-              B[bOffset + gidy * TILESIZE + idxT +
-                ((idyT + (sec * TILESIZE)) * ldb) + i * (ldb << shiftFactor)];
-        } else {
-          lB[((idxT + sec * TILESIZE) * BANKTILESIZE) + idyT] = 0;
-        }
-
-        if (gidx * TILESIZE + idxT < M &&
-            i * STEPSIZE + idyT + (sec * TILESIZE) < K) {
-          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] =
-              A[aOffset + (gidx * TILESIZE + idxT) * lda + idyT + i * STEPSIZE +
-                (sec * TILESIZE)];
-        } else {
-          lA[(sec * BANKNUMTILEELMTS) + idyT + idxT * BANKTILESIZE] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_TransAB_MICRO_TS16XMTS2(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 16
-#define MICROTILESIZE 2
-  int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
-  int N_ = hc::fast_math::fmaxf(1, (N / MICROTILESIZE + 1));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M_ + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    hc::half rC[MICROTILESIZE][MICROTILESIZE] = {{(hc::half)0}};
-    hc::half rA[1][MICROTILESIZE];
-    hc::half rB[1][MICROTILESIZE];
-    tile_static hc::half lA[TILESIZE * TILESIZE * MICROTILESIZE];
-    tile_static hc::half lB[TILESIZE * TILESIZE * MICROTILESIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < MICROTILESIZE; ++sec) {
-        if (gidy * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < N &&
-            block_k * TILESIZE + idyT < K) {
-          lB[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              B[bOffset + (gidy * TILESIZE * MICROTILESIZE) + idxT +
-                (sec * TILESIZE) + idyT * ldb + block_k * (ldb * TILESIZE)];
-        } else {
-          lB[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
-        }
-
-        if (gidx * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < M &&
-            block_k * TILESIZE + idyT < K) {
-          lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              A[aOffset +
-                (gidx * TILESIZE * MICROTILESIZE + idxT + sec * TILESIZE) *
-                    lda +
-                idyT + block_k * TILESIZE];
-        } else {
-          lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MTS;
-      }
-
-      tidx.barrier.wait();
-    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) / TILESIZE));
-
-    int xIndex = gidx * TILESIZE * MICROTILESIZE + idx;
-    int yIndex = (gidy * TILESIZE * MICROTILESIZE + idy) * ldc;
-
-    for (int row = 0; row < MICROTILESIZE; row++) {
-      for (int col = 0; col < MICROTILESIZE; col++) {
-        if (xIndex + (TILESIZE * col) < M &&
-            (yIndex / ldc) + (TILESIZE * row) < N) {
-          __int64_t C_index = cOffset + (xIndex + TILESIZE * col) + yIndex +
-                              (TILESIZE * row) * ldc;
-          C[C_index] =
-              (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-          C[C_index] = alpha * rC[col][row] + beta * C[C_index];
-        }
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef MICROTILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-// Kernel 1
-
-/*
- * Inputs and Outputs are processed in Column major form
- * Matrix-Matrix-Multiplication using local memory as a buffer
- * that has [TILESIZE x TILESIZE] elements
- *
- * Dimensions:
- *   Matrix A is [MxK] and A is transposed
- *   Matrix B is [KxN] and B is transposed
- *   Matrix C is [MxN]
- *
- * Global Index Space
- *   global_size[0] := global_size[0] % TILESIZE == 0 && global_size[0] >= N
- *   global_size[1] := global_size[1] % TILESIZE == 0 && global_size[1] >= M
- *
- * Local Index Space
- *   local_size[0] := TILESIZE
- *   local_size[1] := TILESIZE
- *
- * Number of Threads in each local workgroup
- *   localThreadCount := TILESIZE*TILESIZE
- */
-
-hcblasStatus gemm_TransAB_K1(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE;
-    // first index of first thread reading B in local workgroup
-    int b_bgn = TILESIZE * tile_x;
-    // last index of first thread reading B in local workgroup -- unused in code
-    // int b_end = b_bgn + N*(K-1);
-    // step taken by each thread reading B in local workgroup
-    int b_stp = TILESIZE * N;
-    // accumulates the result
-    hc::half sum = 0.0;
-    int global_x = 0;
-    int global_y = 0;
-    // local memory for matrix A
-    tile_static hc::half localMemA[TILESIZE][TILESIZE];
-    // local memory for matrix B
-    tile_static hc::half localMemB[TILESIZE][TILESIZE];
-
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_x + global_x < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + lda * thread_y + thread_x];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      if (thread_y + global_y < K) {
-        localMemB[thread_y][thread_x] =
-            B[b + bOffset + ldb * thread_y + thread_x];
-      } else {
-        // needed on AMD
-        localMemB[thread_y][thread_x] = 0.0;
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        sum += localMemA[thread_y][k] * localMemB[k][thread_x];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      int c = TILESIZE * tile_y + TILESIZE * tile_x * ldc;
-
-      if (c + cOffset + thread_y + thread_x * M < M * N) {
-        __int64_t C_index = c + cOffset + thread_y + thread_x * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-/*
- * Matrix-Matrix-Multiplication using local memory as a buffer
- * that has [TILESIZE x TILESIZE] elements
- *
- * Dimensions:
- *   Matrix A is [MxK] and A is no transposed
- *   Matrix B is [KxN] and B is not transposed
- *   Matrix C is [MxN]
- *
- * Global Index Space
- *   global_size[0] := global_size[0] % TILESIZE == 0 && global_size[0] >= N
- *   global_size[1] := global_size[1] % TILESIZE == 0 && global_size[1] >= M
- *
- * Local Index Space
- *   local_size[0] := TILESIZE
- *   local_size[1] := TILESIZE
- *
- * Number of Threads in each local workgroup
- *   localThreadCount := TILESIZE*TILESIZE
- */
-hcblasStatus gemm_NoTransAB_K2(hc::accelerator_view accl_view, hc::half *A,
-                               __int64_t aOffset, hc::half *B,
-                               __int64_t bOffset, hc::half *C,
-                               __int64_t cOffset, int M, int N, int K, int lda,
-                               int ldb, int ldc, hc::half alpha,
-                               hc::half beta) {
-#define TILESIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + M * K;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE * M;
-    // first index of first thread reading A in local workgroup
-    int b_bgn = K * TILESIZE * tile_x;
-    // step taken by each thread reading A
-    int b_stp = TILESIZE;
-    // accumulates the result
-    hc::half sum = 0.0;
-    int global_x = 0;
-    int global_y = 0;
-
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE][TILESIZE];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE][TILESIZE];
-
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_x + global_x < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + lda * thread_x + thread_y];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      if (thread_y + global_y < K) {
-        localMemB[thread_y][thread_x] =
-            B[b + bOffset + ldb * thread_x + thread_y];
-      } else {
-        // needed on AMD
-        localMemB[thread_y][thread_x] = 0.0;
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        sum += localMemA[thread_y][k] * localMemB[k][thread_x];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      int c = TILESIZE * tile_y + TILESIZE * tile_x * ldc;
-
-      if (c + cOffset + thread_y + thread_x * M < M * N) {
-        __int64_t C_index = c + cOffset + thread_y + thread_x * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-  return HCBLAS_SUCCEEDS;
-}
+// Kernel 1
 
 /*
+ * Inputs and Outputs are processed in Column major form
  * Matrix-Matrix-Multiplication using local memory as a buffer
  * that has [TILESIZE x TILESIZE] elements
  *
@@ -1763,106 +602,6 @@ hcblasStatus gemm_NoTransAB_K2(hc::accelerator_view accl_view, hc::half *A,
  * Number of Threads in each local workgroup
  *   localThreadCount := TILESIZE*TILESIZE
  */
-hcblasStatus gemm_TransAB_K3(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#undef TILESIZE
-#define TILESIZE 16
-#define HC_WPT 4
-#define HC_RTS 16
-  int N_ = hc::fast_math::fmaxf(1, (N / HC_WPT));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE;
-    // first index of first thread reading B in local workgroup
-    int b_bgn = TILESIZE * tile_x * HC_WPT;
-    // step taken by each thread reading B in local workgroup
-    int b_stp = TILESIZE * N;
-    int global_x = 0;
-    int global_y = 0;
-    // local memory for matrix A
-    tile_static hc::half localMemA[TILESIZE][TILESIZE];
-    // local memory for matrix B
-    tile_static hc::half localMemB[TILESIZE][TILESIZE * HC_WPT];
-    // Initialise the accumulation registers
-    hc::half acc[HC_WPT];
-
-    for (int w = 0; w < HC_WPT; w++) {
-      acc[w] = 0.0;
-    }
-
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_x + global_x < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + lda * thread_y + thread_x];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      for (int w = 0; w < HC_WPT; w++) {
-        // each thread in workgroup reads one element of matrix B from global to
-        // local memory
-        if (thread_y + global_y < K) {
-          localMemB[thread_y][thread_x + w * HC_RTS] =
-              B[b + bOffset + ldb * thread_y + thread_x + w * HC_RTS];
-        } else {
-          // needed on AMD
-          localMemB[thread_y][thread_x + w * HC_RTS] = 0.0;
-        }
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        for (int w = 0; w < HC_WPT; w++) {
-          acc[w] +=
-              localMemA[thread_y][k] * localMemB[k][thread_x + w * HC_RTS];
-        }
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    for (int w = 0; w < HC_WPT; w++) {
-      if (tile_y * TILESIZE + thread_y < M &&
-          (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) < N) {
-        __int64_t C_index =
-            cOffset + tile_y * TILESIZE + thread_y +
-            (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = acc[w] + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef HC_RTS
-#undef HC_WPT
-  return HCBLAS_SUCCEEDS;
-}
 
 /*
  * Matrix-Matrix-Multiplication using local memory as a buffer
@@ -1885,463 +624,31 @@ hcblasStatus gemm_TransAB_K3(hc::accelerator_view accl_view, hc::half *A,
  *   localThreadCount := TILESIZE*TILESIZE
  */
 
-hcblasStatus gemm_NoTransA_K4(hc::accelerator_view accl_view, hc::half *A,
-                              __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                              hc::half *C, __int64_t cOffset, int M, int N,
-                              int K, int lda, int ldb, int ldc, hc::half alpha,
-                              hc::half beta) {
-#undef TILESIZE
-#define TILESIZE 16
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + M * K;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE * M;
-    // first index of first thread reading B in local workgroup
-    int b_bgn = TILESIZE * tile_x;
-    // step taken by each thread reading B in local workgroup
-    int b_stp = TILESIZE * N;
-    // accumulates the result
-    hc::half sum = 0.0;
-    int global_x = 0;
-    int global_y = 0;
-
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE][TILESIZE];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE][TILESIZE];
-
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_x + global_x < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + lda * thread_x + thread_y];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      if (thread_y + global_y < K) {
-        localMemB[thread_y][thread_x] =
-            B[b + bOffset + ldb * thread_y + thread_x];
-      } else {
-        // needed on AMD
-        localMemB[thread_y][thread_x] = 0.0;
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        sum += localMemA[thread_y][k] * localMemB[k][thread_x];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      int c = TILESIZE * tile_y + TILESIZE * tile_x * ldc;
-
-      if (c + cOffset + thread_y + thread_x * M < M * N) {
-        __int64_t C_index = c + cOffset + thread_y + thread_x * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-/*
- * Matrix-Matrix-Multiplication using local memory as a buffer
- * that has [TILESIZE x TILESIZE] elements
- *
- * Dimensions:
- *   Matrix A is [MxK] and A is transposed
- *   Matrix B is [KxN] and B is not transposed
- *   Matrix C is [MxN]
- *
- * Global Index Space
- *   global_size[0] := global_size[0] % TILESIZE == 0 && global_size[0] >= N
- *   global_size[1] := global_size[1] % TILESIZE == 0 && global_size[1] >= M
- *
- * Local Index Space
- *   local_size[0] := TILESIZE
- *   local_size[1] := TILESIZE
- *
- * Number of Threads in each local workgroup
- *   localThreadCount := TILESIZE*TILESIZE
- */
-hcblasStatus gemm_NoTransB_K5(hc::accelerator_view accl_view, hc::half *A,
-                              __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                              hc::half *C, __int64_t cOffset, int M, int N,
-                              int K, int lda, int ldb, int ldc, hc::half alpha,
-                              hc::half beta) {
-#define TILESIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE;
-    // first index of first thread reading A in local workgroup
-    int b_bgn = K * TILESIZE * tile_x;
-    // step taken by each thread reading A
-    int b_stp = TILESIZE;
-    // accumulates the result
-    hc::half sum = 0.0;
-    int global_x = 0;
-    int global_y = 0;
-
-    // each work group moves horizontally over matrix A and vertically over
-    // matrix B
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE][TILESIZE];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE][TILESIZE];
-
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_y + global_y < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + thread_y + thread_x * lda];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      if (thread_x + global_x < K) {
-        localMemB[thread_y][thread_x] =
-            B[b + bOffset + thread_x + thread_y * ldb];
-      } else {
-        // needed on AMD
-        localMemB[thread_y][thread_x] = 0.0;
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        sum += localMemA[k][thread_y] * localMemB[thread_x][k];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      int c = TILESIZE * tile_y + TILESIZE * tile_x * ldc;
-
-      if (c + cOffset + thread_y + thread_x * M < M * N) {
-        __int64_t C_index = c + cOffset + thread_y + thread_x * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-/*
- * Matrix-Matrix-Multiplication using local memory as a buffer
- * that has [TILESIZE_1D_X x TILESIZE_1D_Y] elements
- * and satisfies
- *
- * TILESIZE_1D_Y % TILESIZE_1D_X == 0
- *
- * Dimensions:
- *   Matrix A is [MxK] and A is transposed
- *   Matrix B is [KxN] and B is transposed
- *   Matrix C is [MxN]
- *
- * Global Index Space
- *   global_size[0] := global_size[0] % TILESIZE_1D_X == 0 && global_size[0] >=
- * N
- *   global_size[1] := global_size[1] % TILESIZE_1D_Y == 0 && global_size[1] >=
- * M
- *
- * Local Index Space
- *   local_size[0] := TILESIZE_1D_X
- *   local_size[1] := TILESIZE_1D_Y
- *
- * Number of Threads in each local workgroup
- *   localThreadCount := TILESIZE_1D_X*TILESIZE_1D_Y
- */
-hcblasStatus gemm_TransAB_K6(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE_1D_Y 32
-#define TILESIZE_1D_X 8
-#define TILESIZE_X 8
-#define TILESIZE_Y 32
-  hc::extent<2> grdExt((N + (TILESIZE_1D_X - 1)) & ~(TILESIZE_1D_X - 1),
-                       (M + (TILESIZE_1D_Y - 1)) & ~(TILESIZE_1D_Y - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE_1D_X, TILESIZE_1D_Y);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE_1D_X x TILESIZE_1D_Y]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE_Y * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE_Y;
-    // first index of first thread reading B in local workgroup
-    int b_bgn = TILESIZE_X * tile_x;
-    // step taken by each thread reading B in local workgroup
-    int b_stp = TILESIZE_Y * N;
-    unsigned int idx = 0;
-    // accumulates the result
-    hc::half sum = 0.0;
-
-    // each work group moves horizontally over matrix A and vertically over
-    // matrix B
-    for (int a = a_bgn, b = b_bgn; a <= a_end; a += a_stp, b += b_stp) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE_Y][TILESIZE_Y];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE_Y][TILESIZE_X];
-
-      // each thread in workgroup reads several element of matrix A from global
-      // to local memory due to the buffer not being quadratic
-      for (int i = 0; i < TILESIZE_Y / TILESIZE_X; i++) {
-        idx = a + lda * thread_y + thread_x + i * TILESIZE_X;
-
-        if (idx < M * K) {
-          localMemA[thread_y][thread_x + i * TILESIZE_X] =
-              alpha * A[aOffset + idx];
-        } else {
-          // needed on AMD
-          localMemA[thread_y][thread_x + i * TILESIZE_X] = 0.0;
-        }
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      idx = b + ldb * thread_y + thread_x;
-
-      if (idx < K * N) {
-        localMemB[thread_y][thread_x] = B[bOffset + idx];
-      } else {
-        // needed on AMD
-        localMemB[thread_y][thread_x] = 0.0;
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-      // compute limit for loop to stop accumulating when the boundary of the
-      // matrix is reached
-      int limit = TILESIZE_Y;
-
-      if (K % TILESIZE_Y != 0 && a == a_end) {
-        limit = K / TILESIZE_Y;
-      }
-
-      if (K < TILESIZE_Y) {
-        limit = K;
-      }
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < limit; ++k) {
-        sum += localMemA[thread_y][k] * localMemB[k][thread_x];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      int c = TILESIZE_Y * tile_y + TILESIZE_X * tile_x * ldc;
-
-      if (c + cOffset + M * thread_x + thread_y < M * N) {
-        __int64_t C_index = c + cOffset + ldc * thread_x + thread_y;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE_1D_Y
-#undef TILESIZE_1D_X
-#undef TILESIZE_X
-#undef TILESIZE_Y
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
  * Matrix-Matrix-Multiplication using local memory as a buffer
  * that has [TILESIZE_1D_X x TILESIZE_1D_Y] elements
  * and satisfies
  *
- * TILESIZE_1D_X % TILESIZE_1D_Y == 0
- *
- * Dimensions:
- *   Matrix A is [MxK] and A is transposed
- *   Matrix B is [KxN] and B is transposed
- *   Matrix C is [MxN]
- *
- * Global Index Space
- *   global_size[0] := global_size[0] % TILESIZE_1D_X == 0 && global_size[0] >=
- * N
- *   global_size[1] := global_size[1] % TILESIZE_1D_Y == 0 && global_size[1] >=
- * M
- *
- * Local Index Space
- *   local_size[0] := TILESIZE_1D_X
- *   local_size[1] := TILESIZE_1D_Y
- *
- * Number of Threads in each local workgroup
- *   localThreadCount := TILESIZE_1D_X*TILESIZE_1D_Y
- */
-
-hcblasStatus gemm_TransAB_K7(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE_1D_Y 8
-#define TILESIZE_1D_X 32
-#define TILESIZE_X 32
-#define TILESIZE_Y 8
-  hc::extent<2> grdExt((N + (TILESIZE_1D_X - 1)) & ~(TILESIZE_1D_X - 1),
-                       (M + (TILESIZE_1D_Y - 1)) & ~(TILESIZE_1D_Y - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE_1D_X, TILESIZE_1D_Y);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE_1D_X x TILESIZE_1D_Y]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE_Y * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE_X;
-    // first index of first thread reading B in local workgroup
-    int b_bgn = TILESIZE_X * tile_x;
-    // step taken by each thread reading B in local workgroup
-    int b_stp = TILESIZE_X * N;
-    unsigned int idx = 0;
-    // accumulates the result
-    hc::half sum = 0.0;
-
-    // each work group moves horizontally over matrix A and vertically over
-    // matrix B
-    for (int a = a_bgn, b = b_bgn; a <= a_end; a += a_stp, b += b_stp) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE_Y][TILESIZE_X];
-      // local memory for matrix A
-      tile_static hc::half localMemB[TILESIZE_X][TILESIZE_X];
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      idx = a + lda * thread_y + thread_x;
-
-      if (idx < M * K) {
-        localMemA[thread_y][thread_x] = alpha * A[idx];
-      } else {  // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads several element of matrix B from global
-      // to local memory due to the buffer not being quadratic
-      for (int i = 0; i < TILESIZE_X / TILESIZE_Y; i++) {
-        idx = b + ldb * thread_y + thread_x + i * ldb * TILESIZE_Y;
-
-        if (idx < K * N) {
-          localMemB[thread_y + i * TILESIZE_Y][thread_x] = B[idx];
-        } else {  // needed on AMD
-          localMemB[thread_y + i * TILESIZE_Y][thread_x] = 0.0;
-        }
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-      // compute limit for loop to stop accumulating when the boundary of the
-      // matrix is reached
-      int limit = TILESIZE_X;
-
-      if (K % TILESIZE_X != 0 && a == a_end) {
-        limit = K / TILESIZE_X;
-      }
-
-      if (K < TILESIZE_X) {
-        limit = K;
-      }
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < limit; ++k) {
-        sum += localMemA[thread_y][k] * localMemB[k][thread_x];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      int c = TILESIZE_Y * tile_y + TILESIZE_X * tile_x * ldc;
-
-      if (c + M * thread_x + thread_y < M * N) {
-        __int64_t C_index = c + cOffset + ldc * thread_x + thread_y;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE_1D_Y
-#undef TILESIZE_1D_X
-#undef TILESIZE_X
-#undef TILESIZE_Y
-  return HCBLAS_SUCCEEDS;
-}
+ * TILESIZE_1D_X % TILESIZE_1D_Y == 0
+ *
+ * Dimensions:
+ *   Matrix A is [MxK] and A is transposed
+ *   Matrix B is [KxN] and B is transposed
+ *   Matrix C is [MxN]
+ *
+ * Global Index Space
+ *   global_size[0] := global_size[0] % TILESIZE_1D_X == 0 && global_size[0] >=
+ * N
+ *   global_size[1] := global_size[1] % TILESIZE_1D_Y == 0 && global_size[1] >=
+ * M
+ *
+ * Local Index Space
+ *   local_size[0] := TILESIZE_1D_X
+ *   local_size[1] := TILESIZE_1D_Y
+ *
+ * Number of Threads in each local workgroup
+ *   localThreadCount := TILESIZE_1D_X*TILESIZE_1D_Y
+ */
 
 /*
  * Matrix-Matrix-Multiplication for the case when K == 1 using
@@ -2367,71 +674,6 @@ hcblasStatus gemm_TransAB_K7(hc::accelerator_view accl_view, hc::half *A,
  *   localThreadCount := TILESIZE_1D_X*TILESIZE_1D_Y
  */
 
-hcblasStatus gemm_TransAB_K8(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE_1D_Y 1
-#define TILESIZE_1D_X 256
-#define TILESIZE_X 16
-#define TILESIZE_Y 16
-  hc::extent<2> grdExt((N + (TILESIZE_1D_X - 1)) & ~(TILESIZE_1D_X - 1),
-                       (M + (TILESIZE_1D_Y - 1)) & ~(TILESIZE_1D_Y - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE_1D_X, TILESIZE_1D_Y);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    unsigned int idx = 0;
-    // local memory for matrix A
-    tile_static hc::half localMemA[TILESIZE_1D_Y];
-    // local memory for matrix B
-    tile_static hc::half localMemB[TILESIZE_1D_X];
-    // each thread in workgroup reads one element of matrix A from global to
-    // local memory
-    idx = tidx.global[1];
-
-    if (thread_x == 0) {
-      if (idx < M) {
-        localMemA[thread_y] = alpha * A[aOffset + idx];
-      } else {  // needed on AMD
-        localMemA[thread_y] = 0.0;
-      }
-    }
-
-    // each thread in workgroup reads one element of matrix B from global to
-    // local memory
-    idx = tidx.global[0];
-
-    if (thread_y == 0) {
-      if (idx < N) {
-        localMemB[thread_x] = B[bOffset + idx];
-      } else {  // needed on AMD
-        localMemB[thread_x] = 0.0;
-      }
-    }
-
-    // Synchronize the reads of A and B
-    tidx.barrier.wait();
-
-    // multiply matrix A and matrix B and write all results back to global
-    // memory
-    if (tidx.global[0] < N && tidx.global[1] < M) {
-      idx = tidx.global[1] + tidx.global[0] * ldc;
-      __int64_t C_index = cOffset + idx;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] =
-          localMemA[thread_y] * localMemB[thread_x] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE_1D_Y
-#undef TILESIZE_1D_X
-#undef TILESIZE_X
-#undef TILESIZE_Y
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
  * Matrix-Matrix-Multiplication for the case when K == 1 without using a single
  * local variable
@@ -2455,41 +697,6 @@ hcblasStatus gemm_TransAB_K8(hc::accelerator_view accl_view, hc::half *A,
  *   localThreadCount := TILESIZE_1D_X*TILESIZE_1D_Y
  */
 
-hcblasStatus gemm_TransAB_K9(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE_1D_Y 1
-#define TILESIZE_1D_X 256
-#define TILESIZE_X 16
-#define TILESIZE_Y 16
-  hc::extent<2> grdExt((N + (TILESIZE_1D_X - 1)) & ~(TILESIZE_1D_X - 1),
-                       (M + (TILESIZE_1D_Y - 1)) & ~(TILESIZE_1D_Y - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE_1D_X, TILESIZE_1D_Y);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // global index of each thread
-    int gx = tidx.global[0];
-    int gy = tidx.global[1];
-    hc::half localVarA = alpha * A[aOffset + gy];
-    // Synchronize the reads of A
-    tidx.barrier.wait();
-
-    // multiply matrix A and matrix B and write all results back to global
-    // memory
-    if (gx < N && gy < M) {
-      __int64_t C_index = cOffset + gy + gx * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = localVarA * B[bOffset + gx] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE_1D_Y
-#undef TILESIZE_1D_X
-#undef TILESIZE_X
-#undef TILESIZE_Y
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
  * Matrix-Matrix-Multiplication using local memory as a buffer
  * that has [TILESIZE x TILESIZE] elements
@@ -2511,50 +718,6 @@ hcblasStatus gemm_TransAB_K9(hc::accelerator_view accl_view, hc::half *A,
  *   localThreadCount := TILESIZE*TILESIZE
  */
 
-hcblasStatus gemm_TransAB_K10(hc::accelerator_view accl_view, hc::half *A,
-                              __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                              hc::half *C, __int64_t cOffset, int M, int N,
-                              int K, int lda, int ldb, int ldc, hc::half alpha,
-                              hc::half beta) {
-#define TILESIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [&](hc::tiled_index<2> tidx)[[hc]] {
-    int global_idx_i = tidx.global[0];
-    // local registers
-    hc::half privateMemA[256];
-
-    for (int k = 0; k < 256; k++) {
-      privateMemA[k] = alpha * A[aOffset + global_idx_i * lda + k];
-    }
-
-    tile_static hc::half localMemB[256];
-
-    for (int idx_n = 0; idx_n < N; idx_n++) {
-      for (int i = 0; i < t_ext[0]; i++) {
-        int idx_k = i * tidx.tile_dim[0] + tidx.local[0];
-        int idx_B = idx_k * ldb + idx_n;
-        localMemB[bOffset + idx_k] = B[bOffset + idx_B];
-      }
-
-      tidx.barrier.wait();
-      // multiply matrix A and B using local memory
-      hc::half sum = 0.0;
-
-      for (int k = 0; k < K; k++) {
-        sum += privateMemA[k] * localMemB[k];
-      }
-
-      __int64_t C_index = cOffset + global_idx_i + idx_n * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = sum + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
  * Matrix-Matrix-Multiplication using local memory as a buffer
  * that has [TILESIZE x TILESIZE] elements
@@ -2576,42 +739,6 @@ hcblasStatus gemm_TransAB_K10(hc::accelerator_view accl_view, hc::half *A,
  *   localThreadCount := TILESIZE*TILESIZE
  */
 
-hcblasStatus gemm_TransAB_11(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE 16
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int global_idx_i = tidx.global[0];
-    hc::half privateMemA[256];
-
-    for (int k = 0; k < 256; k++) {
-      privateMemA[k] = alpha * A[aOffset + global_idx_i * lda + k];
-    }
-
-    for (int idx_n = 0; idx_n < N; idx_n++) {
-      // multiply matrix A and B using local memory
-      hc::half sum = 0.0;
-
-      for (int k = 0; k < K; k++) {
-        int idx_k = global_idx_i;
-        int idx_B = idx_k * ldb + k;
-        sum += privateMemA[k] * B[bOffset + idx_B];
-      }
-
-      __int64_t C_index = cOffset + global_idx_i + idx_n * ldc;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = sum + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
  * Matrix-Matrix-Multiplication using local memory as a buffer
  * that has [TILESIZE x TILESIZE] elements
@@ -2633,550 +760,22 @@ hcblasStatus gemm_TransAB_11(hc::accelerator_view accl_view, hc::half *A,
  *   localThreadCount := TILESIZE*TILESIZE
  */
 
-hcblasStatus gemm_TransAB_12(hc::accelerator_view accl_view, hc::half *A,
-                             __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                             hc::half *C, __int64_t cOffset, int M, int N,
-                             int K, int lda, int ldb, int ldc, hc::half alpha,
-                             hc::half beta) {
-#define TILESIZE 8
-#define GN N / 32  // (N has to be in power of 32)
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_y = tidx.tile[1];
-    // local index of each thread inside tile
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // global coordinates for each elemnt in C
-    int x = tidx.global[0];
-    int y = tidx.global[1];
-    int group_size_n = N / GN;
-    int group_n = x / group_size_n;
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE;
-    // accumulates the result
-    hc::half sum = 0.0;
-    int global_x = 0;
-    int global_y = 0;
-    int addr;
-    // local memory for matrix A
-    tile_static hc::half localMemA[TILESIZE][TILESIZE];
-    // local memory for matrix B
-    tile_static hc::half localMemB[TILESIZE][TILESIZE];
-
-    for (int a = a_bgn; a <= a_end;
-         a += a_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      addr = a + lda * thread_y + thread_x;
-
-      if ((thread_x + global_x) < K && addr < M * K) {
-        localMemA[thread_y][thread_x] = alpha * A[aOffset + addr];
-      } else {  // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      addr = group_n * (group_size_n * ldb) + (x % group_size_n) +
-             (thread_y + global_y) * group_size_n;
-
-      if (thread_y + global_y < K && addr < K * N) {
-        localMemB[thread_y][thread_x] = B[bOffset + addr];
-      } else {  // needed on AMD
-        localMemB[thread_y][thread_x] = 0.0;
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        sum += localMemA[thread_y][k] * localMemB[k][thread_x];
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    if (x < N && y < M) {
-      addr =
-          group_n * group_size_n * ldc + y * group_size_n + (x % group_size_n);
-
-      if (addr < M * N) {
-        __int64_t C_index = cOffset + addr;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = sum + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransAB_K3(hc::accelerator_view accl_view, hc::half *A,
-                               __int64_t aOffset, hc::half *B,
-                               __int64_t bOffset, hc::half *C,
-                               __int64_t cOffset, int M, int N, int K, int lda,
-                               int ldb, int ldc, hc::half alpha,
-                               hc::half beta) {
-#undef TILESIZE
-#define TILESIZE 16
-#define HC_WPT 4
-#define HC_RTS 16
-  int N_ = hc::fast_math::fmaxf(1, (N / HC_WPT));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + M * K;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE * M;
-    // first index of first thread reading A in local workgroup
-    int b_bgn = K * TILESIZE * tile_x * HC_WPT;
-    // step taken by each thread reading A
-    int b_stp = TILESIZE;
-    // accumulates the result
-    int global_x = 0;
-    int global_y = 0;
-    hc::half acc[HC_WPT];
-
-    for (int w = 0; w < HC_WPT; w++) {
-      acc[w] = 0.0;
-    }
-
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE][TILESIZE];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE][TILESIZE * HC_WPT];
-
-      // Initialise the accumulation registers
-
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-
-      if (thread_x + global_x < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + lda * thread_x + thread_y];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      for (int w = 0; w < HC_WPT; w++) {
-        if (thread_y + global_y < K) {
-          localMemB[thread_y][thread_x + w * HC_RTS] =
-              B[b + bOffset + ldb * (thread_x + w * HC_RTS) + thread_y];
-        } else {
-          // needed on AMD
-          localMemB[thread_y][thread_x + w * HC_RTS] = 0.0;
-        }
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      for (int k = 0; k < TILESIZE; k++) {
-        for (int w = 0; w < HC_WPT; w++) {
-          acc[w] +=
-              localMemA[thread_y][k] * localMemB[k][thread_x + w * HC_RTS];
-        }
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-
-    for (int w = 0; w < HC_WPT; w++) {
-      if (tile_y * TILESIZE + thread_y < M &&
-          (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) < N) {
-        __int64_t C_index =
-            cOffset + tile_y * TILESIZE + thread_y +
-            (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = acc[w] + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef HC_RTS
-#undef HC_WPT
-  return HCBLAS_SUCCEEDS;
-}
-hcblasStatus gemm_NoTransA_K3(hc::accelerator_view accl_view, hc::half *A,
-                              __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                              hc::half *C, __int64_t cOffset, int M, int N,
-                              int K, int lda, int ldb, int ldc, hc::half alpha,
-                              hc::half beta)
-
-{
-#undef TILESIZE
-#define TILESIZE 16
-#define HC_WPT 4
-#define HC_RTS 16
-  int N_ = hc::fast_math::fmaxf(1, (N / HC_WPT));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + M * K;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE * M;
-    // first index of first thread reading B in local workgroup
-    int b_bgn = TILESIZE * tile_x * HC_WPT;
-    // step taken by each thread reading B in local workgroup
-    int b_stp = TILESIZE * N;
-    // accumulates the result
-    int global_x = 0;
-    int global_y = 0;
-    hc::half acc[HC_WPT];
-
-    for (int w = 0; w < HC_WPT; w++) {
-      acc[w] = 0.0;
-    }
-
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE][TILESIZE];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE][TILESIZE * HC_WPT];
-
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_x + global_x < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + lda * thread_x + thread_y];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      for (int w = 0; w < HC_WPT; w++) {
-        if (thread_y + global_y < K) {
-          localMemB[thread_y][thread_x + w * HC_RTS] =
-              B[b + bOffset + ldb * thread_y + thread_x + w * HC_RTS];
-        } else {
-          // needed on AMD
-          localMemB[thread_y][thread_x + w * HC_RTS] = 0.0;
-        }
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        for (int w = 0; w < HC_WPT; w++) {
-          acc[w] +=
-              localMemA[thread_y][k] * localMemB[k][thread_x + w * HC_RTS];
-        }
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-
-    for (int w = 0; w < HC_WPT; w++) {
-      if (tile_y * TILESIZE + thread_y < M &&
-          (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) < N) {
-        __int64_t C_index =
-            cOffset + tile_y * TILESIZE + thread_y +
-            (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = acc[w] + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef HC_RTS
-#undef HC_WPT
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransB_K3(hc::accelerator_view accl_view, hc::half *A,
-                              __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                              hc::half *C, __int64_t cOffset, int M, int N,
-                              int K, int lda, int ldb, int ldc, hc::half alpha,
-                              hc::half beta)
-
-{
-#undef TILESIZE
-#define TILESIZE 16
-#define HC_WPT 4
-#define HC_RTS 16
-  int N_ = hc::fast_math::fmaxf(1, (N / HC_WPT));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    // coordinates for each tile of [TILESIZE x TILESIZE]
-    int tile_x = tidx.tile[0];
-    int tile_y = tidx.tile[1];
-    // local index of each thread
-    int thread_x = tidx.local[0];
-    int thread_y = tidx.local[1];
-    // first index of first thread reading A in local workgroup
-    int a_bgn = K * TILESIZE * tile_y;
-    // last index to first thread reading A in local workgroup
-    int a_end = a_bgn + K - 1;
-    // step taken by each thread reading A
-    int a_stp = TILESIZE;
-    // first index of first thread reading A in local workgroup
-    int b_bgn = K * TILESIZE * tile_x * HC_WPT;
-    // step taken by each thread reading A
-    int b_stp = TILESIZE;
-    // accumulates the result
-    int global_x = 0;
-    int global_y = 0;
-    hc::half acc[HC_WPT];
-
-    for (int w = 0; w < HC_WPT; w++) {
-      acc[w] = 0.0;
-    }
-
-    // each work group moves horizontally over matrix A and vertically over
-    // matrix B
-    for (int a = a_bgn, b = b_bgn; a <= a_end;
-         a += a_stp, b += b_stp, global_x += TILESIZE, global_y += TILESIZE) {
-      // local memory for matrix A
-      tile_static hc::half localMemA[TILESIZE][TILESIZE];
-      // local memory for matrix B
-      tile_static hc::half localMemB[TILESIZE * HC_WPT][TILESIZE];
-
-      // each thread in workgroup reads one element of matrix A from global to
-      // local memory
-      if (thread_y + global_y < K) {
-        localMemA[thread_y][thread_x] =
-            alpha * A[a + aOffset + thread_y + thread_x * lda];
-      } else {
-        // needed on AMD
-        localMemA[thread_y][thread_x] = 0.0;
-      }
-
-      // each thread in workgroup reads one element of matrix B from global to
-      // local memory
-      for (int w = 0; w < HC_WPT; w++) {
-        if (thread_x + global_x < K) {
-          localMemB[thread_y + w * HC_RTS][thread_x] =
-              B[b + bOffset + thread_x + (thread_y + w * HC_RTS) * ldb];
-        } else {
-          // needed on AMD
-          localMemB[thread_y + w * HC_RTS][thread_x] = 0.0;
-        }
-      }
-
-      // Synchronize the reads of A and B
-      tidx.barrier.wait();
-
-      // multiply matrix A and B using local memory
-      for (int k = 0; k < TILESIZE; k++) {
-        for (int w = 0; w < HC_WPT; w++) {
-          acc[w] +=
-              localMemA[k][thread_y] * localMemB[thread_x + w * HC_RTS][k];
-        }
-      }
-
-      // Synchronize all sub-results
-      tidx.barrier.wait();
-    }
-
-    // write all results back to global memory
-    for (int w = 0; w < HC_WPT; w++) {
-      if (tile_y * TILESIZE + thread_y < M &&
-          (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) < N) {
-        __int64_t C_index =
-            cOffset + tile_y * TILESIZE + thread_y +
-            (tile_x * TILESIZE * HC_WPT + thread_x + w * HC_RTS) * ldc;
-        C[C_index] =
-            (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-        C[C_index] = acc[w] + beta * C[C_index];
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef HC_RTS
-#undef HC_WPT
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransAB_largeK(hc::accelerator_view accl_view, hc::half *A,
-                                   __int64_t aOffset, hc::half *B,
-                                   __int64_t bOffset, hc::half *C,
-                                   __int64_t cOffset, int M, int N, int K,
-                                   int lda, int ldb, int ldc, hc::half alpha,
-                                   hc::half beta) {
-#define GEMM_BLOCK 256
-  hc::extent<2> grdExt(N, M * GEMM_BLOCK);
-  hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int threadIdx = tidx.local[1];
-    int Row = tidx.tile[0];
-    int Col = tidx.tile[1];
-    tile_static hc::half sh[GEMM_BLOCK];
-    sh[threadIdx] = 0;
-
-    for (int tileId = 0;
-         tileId < ((K + GEMM_BLOCK - 1) & ~(GEMM_BLOCK - 1)) / GEMM_BLOCK;
-         tileId++) {
-      if (tileId * GEMM_BLOCK + threadIdx < K && Col < M && Row < N) {
-        sh[threadIdx] +=
-            A[aOffset + Col + (tileId * GEMM_BLOCK + threadIdx) * lda] *
-            B[bOffset + Row * ldb + tileId * GEMM_BLOCK + threadIdx];
-      }
-    }
-
-    tidx.barrier.wait();
-
-    for (int stride = GEMM_BLOCK / 2; stride >= 1; stride /= 2) {
-      if (threadIdx < stride) {
-        sh[threadIdx] += sh[threadIdx + stride];
-      }
-
-      tidx.barrier.wait();
-    }
-
-    if (threadIdx == 0 && Col < M && Row < N) {
-      __int64_t C_index = cOffset + Row * ldc + Col;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] *= beta;
-      C[C_index] += sh[0] * alpha;
-    }
-  }) ;
-#undef GEMM_BLOCK
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransA_largeK(hc::accelerator_view accl_view, hc::half *A,
-                                  __int64_t aOffset, hc::half *B,
-                                  __int64_t bOffset, hc::half *C,
-                                  __int64_t cOffset, int M, int N, int K,
-                                  int lda, int ldb, int ldc, hc::half alpha,
-                                  hc::half beta) {
-#define GEMM_BLOCK 256
-  hc::extent<2> grdExt(N, M * GEMM_BLOCK);
-  hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int threadIdx = tidx.local[1];
-    int Row = tidx.tile[0];
-    int Col = tidx.tile[1];
-    tile_static hc::half sh[GEMM_BLOCK];
-    sh[threadIdx] = 0;
-
-    for (int tileId = 0;
-         tileId < ((K + GEMM_BLOCK - 1) & ~(GEMM_BLOCK - 1)) / GEMM_BLOCK;
-         tileId++) {
-      if (tileId * GEMM_BLOCK + threadIdx < K && Col < M && Row < N) {
-        sh[threadIdx] +=
-            A[aOffset + Col + (tileId * GEMM_BLOCK + threadIdx) * lda] *
-            B[bOffset + Row + (tileId * GEMM_BLOCK + threadIdx) * ldb];
-      }
-    }
-
-    tidx.barrier.wait();
-
-    for (int stride = GEMM_BLOCK / 2; stride >= 1; stride /= 2) {
-      if (threadIdx < stride) {
-        sh[threadIdx] += sh[threadIdx + stride];
-      }
-
-      tidx.barrier.wait();
-    }
-
-    if (threadIdx == 0 && Col < M && Row < N) {
-      __int64_t C_index = cOffset + Row * ldc + Col;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] *= beta;
-      C[C_index] += sh[0] * alpha;
-    }
-  }) ;
-#undef GEMM_BLOCK
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransB_largeK(hc::accelerator_view accl_view, hc::half *A,
-                                  __int64_t aOffset, hc::half *B,
-                                  __int64_t bOffset, hc::half *C,
-                                  __int64_t cOffset, int M, int N, int K,
-                                  int lda, int ldb, int ldc, hc::half alpha,
-                                  hc::half beta) {
-#define GEMM_BLOCK 256
-  hc::extent<2> grdExt(N, M * GEMM_BLOCK);
-  hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int threadIdx = tidx.local[1];
-    int Row = tidx.tile[0];
-    int Col = tidx.tile[1];
-    tile_static hc::half sh[GEMM_BLOCK];
-    sh[threadIdx] = 0;
-
-    for (int tileId = 0;
-         tileId < ((K + GEMM_BLOCK - 1) & ~(GEMM_BLOCK - 1)) / GEMM_BLOCK;
-         tileId++) {
-      if (tileId * GEMM_BLOCK + threadIdx < K && Col < M && Row < N) {
-        sh[threadIdx] +=
-            A[aOffset + Col * lda + tileId * GEMM_BLOCK + threadIdx] *
-            B[bOffset + Row * ldb + tileId * GEMM_BLOCK + threadIdx];
-      }
-    }
-
-    tidx.barrier.wait();
-
-    for (int stride = GEMM_BLOCK / 2; stride >= 1; stride /= 2) {
-      if (threadIdx < stride) {
-        sh[threadIdx] += sh[threadIdx + stride];
-      }
-
-      tidx.barrier.wait();
-    }
-
-    if (threadIdx == 0 && Col < M && Row < N) {
-      __int64_t C_index = cOffset + Row * ldc + Col;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] *= beta;
-      C[C_index] += sh[0] * alpha;
-    }
-  }) ;
-#undef GEMM_BLOCK
-  return HCBLAS_SUCCEEDS;
+// Runs the built gemm_MICRO_NBK_M_N_K_TS16 variant, named in the
+// HCBLAS_LAYER trace
+static hcblasStatus gemm_variant(bool transA, bool transB, int MTILE,
+                                 hc::accelerator_view accl_view, hc::half *A,
+                                 __int64_t aOffset, hc::half *B,
+                                 __int64_t bOffset, hc::half *C,
+                                 __int64_t cOffset, int M, int N, int K,
+                                 int lda, int ldb, int ldc, hc::half alpha,
+                                 hc::half beta) {
+  hgemm_kernel kernel =
+      gemm_MICRO_NBK_M_N_K_variant<hc::half>(transA, transB, MTILE);
+  if (hcblasTraceLevel() > 0) {
+    hcblasTraceKernel("%s", gemm_variant_kernel_name(kernel));
+  }
+  return kernel(accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda,
+                ldb, ldc, alpha, beta);
 }
 
 hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, hc::half *A,
@@ -3202,9 +801,8 @@ hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, hc::half *A,
         alpha, beta);
   } else if ((M <= 500 && N <= 700) || (M <= 700 && N <= 500) || K < 20 ||
              M < 20 || N < 20) {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_variant(false, false, 2, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   } else if ((K <= 5000) ||
              (((M <= 5000 && N <= 8000) || (M <= 8000 && N <= 5000)) &&
               K <= 8000) ||
@@ -3212,17 +810,15 @@ hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, hc::half *A,
                (M <= 7000 && N <= 4000) || (M <= 4000 && N <= 7000) ||
                (M <= 5000 && N <= 6000) || (M <= 6000 && N <= 5000)) &&
               K <= 10000)) {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_variant(false, false, 4, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   } else if (M <= 50000 && N <= 50000) {
     return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
         accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
         alpha, beta);
   } else {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_variant(false, false, 6, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   }
 }
 
@@ -3263,20 +859,17 @@ hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, hc::half *A,
         accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
         alpha, beta);
   } else if ((M <= 500 && N <= 1000) || (N <= 500 && M <= 1000) || K <= 30) {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_variant(false, true, 2, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   } else if ((M < 9000 && N < 9000 & K < 5000) ||
              (M < 8000 && N < 8000 && K < 6000) ||
              (M < 7000 && N < 7000 && K < 8000) ||
              (M < 6000 && N < 6000 && K < 9000)) {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_variant(false, true, 4, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   } else {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_variant(false, true, 6, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   }
 }
 
@@ -3338,9 +931,8 @@ hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, hc::half *A,
         accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
         alpha, beta);
   } else if (M <= 2000 && N <= 5000 && K <= 20) {
-    return gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_variant(true, false, 2, accl_view, A, aOffset, B, bOffset, C,
+                        cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
   } else if ((K >= 1500 &&
               ((M >= 4000 && N >= 5000) || (M >= 5000 && N >= 3000) ||
                (M >= 7000 && N >= 1000))) ||
@@ -24,6 +24,7 @@ THE SOFTWARE.
 #define LIB_SRC_BLAS_HGEMM_HGEMM_ARRAY_KERNELS_H_
 
 #include "include/hcblaslib.h"
+#include "include/hcblas_micro_kernels.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -347,25 +348,17 @@ THE SOFTWARE.
   offA++;                                       \
   offB++;
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_Mx16_NX16_KX64_TS16XMS4(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
+/* Signature of the gemm_MICRO_NBK_M_N_K_TS16 variants */
+typedef hcblasMicroKernel<hc::half>::type hgemm_kernel;
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_M_N_K_TS16XMS4(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
+/* Built gemm_MICRO_NBK_M_N_K_TS16 variants of the HGEMM variant table */
+template <>
+hgemm_kernel gemm_MICRO_NBK_M_N_K_variant<hc::half>(bool transA, bool transB,
+                                                    int MTILE);
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_Mx16_NX16_KX96_TS16XMS6(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransAB_STEP_NBK_M_N_K_TS16XMS6(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
+/* Trace name of a gemm_MICRO_NBK_M_N_K_TS16 variant, NULL for any other
+ kernel */
+const char *gemm_variant_kernel_name(hgemm_kernel kernel);
 
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX064_NX064_KX16_TS16XMTS4(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
@@ -382,36 +375,11 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
@@ -433,21 +401,6 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
 
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
 hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
@@ -474,21 +427,6 @@ hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, hc::half *A,
                            int lda, int ldb, int ldc, hc::half alpha,
                            hc::half beta);
 
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta);
-
 hcblasStatus gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
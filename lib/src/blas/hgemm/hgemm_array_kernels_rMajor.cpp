@@ -357,85 +357,6 @@ hcblasStatus gemm_NoTransA_rMajor_STEP_TS8XSS8(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_NoTransA_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    hc::half rC[1][1] = {{0.0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[0];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[0];
-    int idy = tidx.local[1];
-    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
-    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
-    int idxS = ids & (STEPSIZE - 1);
-    int idyT = (idt) >> tilemulshift;
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxS + idyTOffset;
-        int kIndex = iOffset + idxS + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idyT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + (gidyOffset + idyT) * ldb + kIndex];
-        }
-
-        if (gidxOffset + idyT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + (gidxOffset + idyT) * lda + kIndex];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int piter = 0; piter < TILESIZE; ++piter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = (gidxOffset + idx) * ldc;
-    int ccolprod = (gidyOffset + idy);
-
-    if (crow / ldc < M && ccolprod < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
 * HGEMM - NoTransA case - Row major Access
 * STEP with Non Bank Conflict Implementation
@@ -1126,84 +1047,6 @@ hcblasStatus gemm_NoTransB_rMajor_MICRO_TS16XMTS2(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_NoTransB_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = hc::fast_math::log2f(STEPSIZE);
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    hc::half rC[1][1] = {{0.0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[0];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[0];
-    int idy = tidx.local[1];
-    int idt = (idy << tilemulshift) + idx;
-    int idyT = idt >> tilemulshift;
-    int idxT = idt & (TILESIZE - 1);
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxT + idyTOffset;
-        int kIndex = iOffset + idyT + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idxT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + gidyOffset + idxT + kIndex * ldb];
-        }
-
-        if (gidxOffset + idxT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + gidxOffset + idxT + kIndex * lda];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(BANKTILESIZE);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = (gidxOffset + idx) * ldc;
-    int ccolprod = (gidyOffset + idy);
-
-    if (crow / ldc < M && ccolprod < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
 * HGEMM - TransAB case - Row major Access
 * MICRO with Non Bank Conflict Implementation
@@ -1298,82 +1141,6 @@ hcblasStatus gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_TransAB_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, hc::half *A, __int64_t aOffset, hc::half *B,
-    __int64_t bOffset, hc::half *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    hc::half rC[1][1] = {{0.0}};
-    hc::half rA[1][STEPTILERATIO];
-    hc::half rB[1][STEPTILERATIO];
-    tile_static hc::half lA[STEPTILEPROD + STEPSIZE];  // 8*8+8
-    tile_static hc::half lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[0];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[0];
-    int idy = tidx.local[1];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] =
-              B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (TILESIZE * sec)];
-        } else {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] =
-              A[aOffset + gidx * TILESIZE + idxT + idyT * lda +
-                i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + (gidx * TILESIZE + idx) * ldc + (gidy * TILESIZE + idy);
-      C[C_index] = (hisnan(C[C_index]) || hisinf(C[C_index])) ? 0 : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
 /*
 * HGEMM - TransAB case - Row major Access
 * STEP with Non Bank Conflict Implementation
@@ -0,0 +1,88 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./igemm_array_kernels.h"
+
+// A is M x K with M contiguous and B is N x K with N contiguous, so
+// both operands gather four K strided values into each packed word.
+template <typename T>
+hcblasStatus igemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, T *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, igemm_epilogue epilogue,
+    bool packedA, bool packedB) {
+  int M_ = (M - 1) / IGEMM_MICROTILESIZE + 1;
+  int N_ = (N - 1) / IGEMM_MICROTILESIZE + 1;
+  int N_R = (N_ + 15) & ~15;
+  int M_R = (M_ + 15) & ~15;
+  hc::extent<2> grdExt(N_R, M_R);
+  hc::tiled_extent<2> t_ext = grdExt.tile(IGEMM_TILESIZE, IGEMM_TILESIZE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
+    int rC[IGEMM_MICROTILESIZE][IGEMM_MICROTILESIZE] = {{0}};
+    int rA[IGEMM_MICROTILESIZE];
+    int rB[IGEMM_MICROTILESIZE];
+    tile_static int lA[IGEMM_TILESIZE][IGEMM_BANKSIZE];
+    tile_static int lB[IGEMM_TILESIZE][IGEMM_BANKSIZE];
+    int gidx = tidx.tile[1];
+    int gidy = tidx.tile[0];
+    int idx = tidx.local[1];
+    int idy = tidx.local[0];
+
+    for (int block_k = 0; block_k < K; block_k += IGEMM_KBLOCK) {
+      int kA = block_k + idy * IGEMM_PACK;
+      int kB = block_k + idy * IGEMM_PACK;
+      for (int sec = 0; sec < IGEMM_MICROTILESIZE; ++sec) {
+        int row = gidx * IGEMM_BLOCKSIZE + idx + sec * IGEMM_TILESIZE;
+        __int64_t aIndex = aOffset + row + kA * static_cast<__int64_t>(lda);
+        lA[idy][idx + sec * IGEMM_TILESIZE] =
+            (row < M) ? igemm_load4(A, aIndex, lda, K - kA, false) : 0;
+        int col = gidy * IGEMM_BLOCKSIZE + idx + sec * IGEMM_TILESIZE;
+        __int64_t bIndex = bOffset + col + kB * static_cast<__int64_t>(ldb);
+        lB[idy][idx + sec * IGEMM_TILESIZE] =
+            (col < N) ? igemm_load4(B, bIndex, ldb, K - kB, false) : 0;
+      }
+
+      tidx.barrier.wait();
+
+      for (int k4 = 0; k4 < IGEMM_TILESIZE; ++k4) {
+        IM2x2;
+      }
+
+      tidx.barrier.wait();
+    }
+
+    IGEMM_STORE2x2;
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+template hcblasStatus igemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2<int>(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, int *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, igemm_epilogue epilogue,
+    bool packedA, bool packedB);
+
+template hcblasStatus igemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2<signed char>(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, signed char *C,
+    __int64_t cOffset, int M, int N, int K, int lda, int ldb, int ldc,
+    igemm_epilogue epilogue, bool packedA, bool packedB);
@@ -0,0 +1,152 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef LIB_SRC_BLAS_IGEMM_IGEMM_ARRAY_KERNELS_H_
+#define LIB_SRC_BLAS_IGEMM_IGEMM_ARRAY_KERNELS_H_
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_math.hpp>
+
+// Each 16x16 work group computes a 32x32 block of C with a 2x2 micro tile,
+// the same layout as the sgemm TS16XMTS2 kernels. K is staged 64 elements at
+// a time as 16 packed words of four consecutive int8 values.
+#define IGEMM_TILESIZE 16
+#define IGEMM_MICROTILESIZE 2
+#define IGEMM_BLOCKSIZE (IGEMM_TILESIZE * IGEMM_MICROTILESIZE)
+#define IGEMM_PACK 4
+#define IGEMM_KBLOCK (IGEMM_TILESIZE * IGEMM_PACK)
+#define IGEMM_BANKSIZE (IGEMM_BLOCKSIZE + 1)
+
+// Parameters of the store phase. For int32 C the accumulator is scaled by
+// alpha and beta; for int8 C it is requantised with a per row or per column
+// scale and zero point and saturated to [-128, 127].
+struct igemm_epilogue {
+  int alpha;
+  int beta;
+  const float *scale;
+  const int *zeroPoint;
+  bool perColumn;
+};
+
+// Dot product of two words each holding four signed 8 bit lanes
+static inline int igemm_dot4(int a, int b) [[hc]] {
+  return ((a << 24) >> 24) * ((b << 24) >> 24) +
+         ((a << 16) >> 24) * ((b << 16) >> 24) +
+         ((a << 8) >> 24) * ((b << 8) >> 24) + (a >> 24) * (b >> 24);
+}
+
+// Packs up to four int8 values spaced stride apart, starting at index, into
+// one word. Lanes at or beyond remain are zero filled. When packed is set the
+// four values are contiguous and 4 byte aligned and are read as one word.
+static inline int igemm_load4(const signed char *P, __int64_t index,
+                              __int64_t stride, int remain,
+                              bool packed) [[hc]] {
+  if (packed && remain >= IGEMM_PACK) {
+    return *reinterpret_cast<const int *>(P + index);
+  }
+  int word = 0;
+  for (int i = 0; i < IGEMM_PACK; ++i) {
+    if (i < remain) {
+      word |= (static_cast<int>(P[index + i * stride]) & 0xff) << (8 * i);
+    }
+  }
+  return word;
+}
+
+static inline void igemm_store(int *C, __int64_t index, int acc, int row,
+                               int col, const igemm_epilogue &ep) [[hc]] {
+  int value = ep.alpha * acc;
+  if (ep.beta != 0) {
+    value += ep.beta * C[index];
+  }
+  C[index] = value;
+}
+
+static inline void igemm_store(signed char *C, __int64_t index, int acc,
+                               int row, int col,
+                               const igemm_epilogue &ep) [[hc]] {
+  int q = ep.perColumn ? col : row;
+  float value = static_cast<float>(acc) * ep.scale[q];
+  if (ep.zeroPoint != NULL) {
+    value += static_cast<float>(ep.zeroPoint[q]);
+  }
+  // Round half away from zero and saturate to the int8 range
+  value = value >= 0 ? value + 0.5f : value - 0.5f;
+  value = value > 127.0f ? 127.0f : (value < -128.0f ? -128.0f : value);
+  C[index] = static_cast<signed char>(value);
+}
+
+// Multiply accumulate one packed K step of the 2x2 micro tile
+#define IM2x2                                 \
+  rA[0] = lA[k4][idx];                        \
+  rA[1] = lA[k4][idx + IGEMM_TILESIZE];       \
+  rB[0] = lB[k4][idy];                        \
+  rB[1] = lB[k4][idy + IGEMM_TILESIZE];       \
+  rC[0][0] += igemm_dot4(rA[0], rB[0]);       \
+  rC[0][1] += igemm_dot4(rA[0], rB[1]);       \
+  rC[1][0] += igemm_dot4(rA[1], rB[0]);       \
+  rC[1][1] += igemm_dot4(rA[1], rB[1]);
+
+// Bounds checked store of the 2x2 micro tile
+#define IGEMM_STORE2x2                                                    \
+  for (int i = 0; i < IGEMM_MICROTILESIZE; ++i) {                         \
+    for (int j = 0; j < IGEMM_MICROTILESIZE; ++j) {                       \
+      int row = gidx * IGEMM_BLOCKSIZE + idx + i * IGEMM_TILESIZE;        \
+      int col = gidy * IGEMM_BLOCKSIZE + idy + j * IGEMM_TILESIZE;        \
+      if (row < M && col < N) {                                           \
+        igemm_store(C, cOffset + row + col * static_cast<__int64_t>(ldc), \
+                    rC[i][j], row, col, epilogue);                        \
+      }                                                                   \
+    }                                                                     \
+  }
+
+template <typename T>
+hcblasStatus igemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, T *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, igemm_epilogue epilogue,
+    bool packedA, bool packedB);
+
+template <typename T>
+hcblasStatus igemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, T *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, igemm_epilogue epilogue,
+    bool packedA, bool packedB);
+
+template <typename T>
+hcblasStatus igemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, T *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, igemm_epilogue epilogue,
+    bool packedA, bool packedB);
+
+template <typename T>
+hcblasStatus igemm_TransAB_MICRO_NBK_M_N_K_TS16XMTS2(
+    hc::accelerator_view accl_view, const signed char *A, __int64_t aOffset,
+    const signed char *B, __int64_t bOffset, T *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, igemm_epilogue epilogue,
+    bool packedA, bool packedB);
+
+#endif  // LIB_SRC_BLAS_IGEMM_IGEMM_ARRAY_KERNELS_H_
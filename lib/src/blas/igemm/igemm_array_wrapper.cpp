@@ -0,0 +1,120 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./igemm_array_kernels.h"
+#include <cstdint>
+
+// An int8 operand can be read a packed word at a time when K is its
+// contiguous dimension and the start of every row or column is 4 byte aligned
+static bool igemm_packed(const signed char *P, __int64_t offset, __int64_t ld,
+                         bool kContiguous) {
+  return kContiguous && (ld % IGEMM_PACK) == 0 &&
+         (reinterpret_cast<uintptr_t>(P + offset) % IGEMM_PACK) == 0;
+}
+
+// Igemm wrapper routine that invokes the kernel for the requested transpose
+// combination. Operands are column major.
+template <typename T>
+static hcblasStatus igemm_HC(hc::accelerator_view accl_view, bool transA,
+                             bool transB, const int M, const int N,
+                             const int K, const signed char *A,
+                             __int64_t aOffset, __int64_t lda,
+                             const signed char *B, __int64_t bOffset,
+                             __int64_t ldb, T *C, __int64_t cOffset,
+                             __int64_t ldc, igemm_epilogue epilogue) {
+  bool packedA = igemm_packed(A, aOffset, lda, transA);
+  bool packedB = igemm_packed(B, bOffset, ldb, !transB);
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+
+  if (!transB) {
+    if (!transA) {
+      status = igemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
+          accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb,
+          ldc, epilogue, packedA, packedB);
+    } else {
+      status = igemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
+          accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb,
+          ldc, epilogue, packedA, packedB);
+    }
+  } else if (!transA) {
+    status = igemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        epilogue, packedA, packedB);
+  } else {
+    status = igemm_TransAB_MICRO_NBK_M_N_K_TS16XMTS2(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        epilogue, packedA, packedB);
+  }
+  return status;
+}
+
+// Igemm Call Type I: Inputs and outputs are HCC device pointers
+hcblasStatus Hcblaslibrary::hcblas_igemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const int &alpha, const signed char *A, const __int64_t lda,
+    const signed char *B, const __int64_t ldb, const int &beta, int *C,
+    const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || M <= 0 || N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  igemm_epilogue epilogue = {alpha, beta, NULL, NULL, false};
+
+  if (order) {
+    return igemm_HC(accl_view, typeA == Trans, typeB == Trans, M, N, K, A,
+                    aOffset, lda, B, bOffset, ldb, C, cOffset, ldc, epilogue);
+  }
+  // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+  return igemm_HC(accl_view, typeB == Trans, typeA == Trans, N, M, K, B,
+                  bOffset, ldb, A, aOffset, lda, C, cOffset, ldc, epilogue);
+}
+
+// Igemm Call Type I with the requantisation epilogue: the int32 accumulator
+// is scaled, shifted by the zero point and saturated to int8 before the store
+hcblasStatus Hcblaslibrary::hcblas_igemm_requant(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const signed char *A, const __int64_t lda, const signed char *B,
+    const __int64_t ldb, signed char *C, const __int64_t ldc,
+    hcblasQuantAxis axis, const float *scale, const int *zeroPoint,
+    const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || scale == NULL || M <= 0 ||
+      N <= 0 || K <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (order) {
+    igemm_epilogue epilogue = {1, 0, scale, zeroPoint, axis == PerColumn};
+    return igemm_HC(accl_view, typeA == Trans, typeB == Trans, M, N, K, A,
+                    aOffset, lda, B, bOffset, ldb, C, cOffset, ldc, epilogue);
+  }
+  // Rows of the row major C are the columns of the transposed problem
+  igemm_epilogue epilogue = {1, 0, scale, zeroPoint, axis == PerRow};
+  return igemm_HC(accl_view, typeB == Trans, typeA == Trans, N, M, K, B,
+                  bOffset, ldb, A, aOffset, lda, C, cOffset, ldc, epilogue);
+}
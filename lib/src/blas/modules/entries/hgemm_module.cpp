@@ -0,0 +1,46 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "../routine_modules.h"
+
+#ifdef HCBLAS_ROUTINE_MODULES
+
+// Entry table of libhcblas-hgemm.so. The qualified calls run the
+// implementation linked into this module, not the library stubs.
+
+static hcblasStatus hgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+    const int K, const hc::half &alpha, hc::half *A, const __int64_t lda,
+    hc::half *B, const __int64_t ldb, const hc::half &beta, hc::half *C,
+    const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  return lib->Hcblaslibrary::hcblas_hgemm(accl_view, order, typeA, typeB, M, N,
+                                          K, alpha, A, lda, B, ldb, beta, C,
+                                          ldc, aOffset, bOffset, cOffset);
+}
+
+extern "C" const hcblasHgemmEntries hcblas_module_hgemm = {hgemm};
+
+#endif  // HCBLAS_ROUTINE_MODULES
@@ -0,0 +1,65 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "../routine_modules.h"
+
+#ifdef HCBLAS_ROUTINE_MODULES
+
+// Entry table of libhcblas-zgemm.so. The qualified calls run the
+// implementation linked into this module, not the library stubs.
+
+static hcblasStatus zgemm(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+    const int K, const hc::short_vector::double_2 &alpha,
+    hc::short_vector::double_2 *A, const __int64_t aOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B, const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return lib->Hcblaslibrary::hcblas_zgemm(accl_view, order, typeA, typeB, M, N,
+                                          K, alpha, A, aOffset, lda, B, bOffset,
+                                          ldb, beta, C, cOffset, ldc);
+}
+
+static hcblasStatus zgemm_batched(
+    Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+    const int K, const hc::short_vector::double_2 &alpha,
+    hc::short_vector::double_2 *A[], const __int64_t aOffset,
+    const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return lib->Hcblaslibrary::hcblas_zgemm(
+      accl_view, order, typeA, typeB, M, N, K, alpha, A, aOffset, A_batchOffset,
+      lda, B, bOffset, B_batchOffset, ldb, beta, C, cOffset, C_batchOffset, ldc,
+      batchSize);
+}
+
+extern "C" const hcblasZgemmEntries hcblas_module_zgemm = {
+    zgemm, zgemm_batched};
+
+#endif  // HCBLAS_ROUTINE_MODULES
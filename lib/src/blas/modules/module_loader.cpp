@@ -0,0 +1,62 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "routine_modules.h"
+#include "include/hcblas_targets.h"
+#include "include/hcblas_trace.h"
+#include <dlfcn.h>
+
+// Set by lib/src/CMakeLists.txt with HCBLAS_ROUTINE_MODULES
+#ifdef HCBLAS_ROUTINE_MODULES
+#define HCBLAS_MODULE_ROUTINES ((1u << ModuleRoutines) - 1)
+#else
+#define HCBLAS_MODULE_ROUTINES 0u
+#endif
+
+static const void *open_routine_module(hcblasModuleRoutine routine) {
+  std::string file = hcblasRoutineModuleFile(hcblasModuleDirectory(), routine);
+  // The module stays loaded; it resolves the rest of the library through
+  // libhcblas, which is loaded already
+  void *module = dlopen(file.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (module == NULL) {
+    return NULL;
+  }
+  std::string table =
+      std::string("hcblas_module_") + hcblasModuleRoutineName(routine);
+  return dlsym(module, table.c_str());
+}
+
+// The load shows up in the kernel column of the HCBLAS_LAYER trace of the
+// call that caused it
+static void report_routine_module(hcblasModuleRoutine routine,
+                                  double milliseconds) {
+  hcblasTraceKernel("load_%s(%.3fms)", hcblasModuleRoutineName(routine),
+                    milliseconds);
+}
+
+hcblasModuleRegistry &hcblasRoutineModules() {
+  static hcblasModuleRegistry registry(
+      HCBLAS_MODULE_ROUTINES, open_routine_module, report_routine_module);
+  return registry;
+}
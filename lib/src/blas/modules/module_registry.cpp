@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas_modules.h"
+#include "include/hcblas_targets.h"
+#include <chrono>
+
+const char *hcblasModuleRoutineName(hcblasModuleRoutine routine) {
+  static const char *const names[ModuleRoutines] = {"sgemm", "dgemm", "hgemm",
+                                                    "cgemm", "zgemm"};
+  return routine < ModuleRoutines ? names[routine] : "";
+}
+
+std::string hcblasRoutineModuleFile(const std::string &directory,
+                                    hcblasModuleRoutine routine) {
+  // Routine modules share the naming of the target modules
+  return hcblasTargetModuleFile(directory, hcblasModuleRoutineName(routine));
+}
+
+hcblasModuleRegistry::hcblasModuleRegistry(unsigned modules, Loader loader,
+                                           Reporter reporter)
+    : modules(modules), loader(loader), reporter(reporter) {
+  for (int r = 0; r < ModuleRoutines; r++) {
+    slots[r].state.store(Unloaded, std::memory_order_relaxed);
+    slots[r].table = NULL;
+    slots[r].milliseconds = -1;
+  }
+}
+
+const void *hcblasModuleRegistry::entries(hcblasModuleRoutine routine) {
+  if (routine >= ModuleRoutines || !isModule(routine)) {
+    return NULL;
+  }
+  Slot &slot = slots[routine];
+  int state = slot.state.load(std::memory_order_acquire);
+  if (state == Loaded) {
+    return slot.table;
+  }
+  if (state == Failed) {
+    return NULL;
+  }
+
+  std::lock_guard<std::mutex> guard(lock);
+  // Another thread may have loaded it while this one waited
+  state = slot.state.load(std::memory_order_relaxed);
+  if (state != Unloaded) {
+    return state == Loaded ? slot.table : NULL;
+  }
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  const void *table = loader(routine);
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (table == NULL) {
+    slot.state.store(Failed, std::memory_order_release);
+    return NULL;
+  }
+  slot.table = table;
+  slot.milliseconds = elapsed.count();
+  slot.state.store(Loaded, std::memory_order_release);
+  if (reporter != NULL) {
+    reporter(routine, slot.milliseconds);
+  }
+  return table;
+}
+
+double hcblasModuleRegistry::loadMilliseconds(
+    hcblasModuleRoutine routine) const {
+  if (routine >= ModuleRoutines) {
+    return -1;
+  }
+  if (!isModule(routine)) {
+    return 0;
+  }
+  const Slot &slot = slots[routine];
+  if (slot.state.load(std::memory_order_acquire) != Loaded) {
+    return -1;
+  }
+  return slot.milliseconds;
+}
@@ -0,0 +1,150 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* Entry points of the routine modules (include/hcblas_modules.h). A module
+* exports its table as hcblas_module_<routine>; each entry runs the
+* routine's own implementation on lib, bypassing the stub the library
+* keeps in its place.
+*/
+
+#ifndef LIB_SRC_BLAS_MODULES_ROUTINE_MODULES_H_
+#define LIB_SRC_BLAS_MODULES_ROUTINE_MODULES_H_
+
+#include "include/hcblaslib.h"
+#include "include/hcblas_modules.h"
+
+/* The routine modules of the library; none unless it was built with
+ HCBLAS_ROUTINE_MODULES */
+hcblasModuleRegistry &hcblasRoutineModules();
+
+template <typename T>
+const T *hcblasRoutineEntries(hcblasModuleRoutine routine) {
+  return static_cast<const T *>(hcblasRoutineModules().entries(routine));
+}
+
+struct hcblasSgemmEntries {
+  hcblasStatus (*gemm)(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                       hcblasOrder order, hcblasTranspose typeA,
+                       hcblasTranspose typeB, const int M, const int N,
+                       const int K, const float &alpha, float *A,
+                       const __int64_t lda, float *B, const __int64_t ldb,
+                       const float &beta, float *C, const __int64_t ldc,
+                       const __int64_t aOffset, const __int64_t bOffset,
+                       const __int64_t cOffset);
+  hcblasStatus (*gemmBatched)(
+      Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const float &alpha, float *A[], const __int64_t lda,
+      const __int64_t A_batchOffset, float *B[], const __int64_t ldb,
+      const __int64_t B_batchOffset, const float &beta, float *C[],
+      const __int64_t ldc, const __int64_t C_batchOffset,
+      const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+      const int batchSize);
+  hcblasStatus (*gemmCapture)(
+      Hcblaslibrary *lib, hcblasPlan *plan, hc::accelerator_view accl_view,
+      hcblasOrder order, hcblasTranspose typeA, hcblasTranspose typeB,
+      const int M, const int N, const int K, const float &alpha, float *A,
+      const __int64_t lda, float *B, const __int64_t ldb, const float &beta,
+      float *C, const __int64_t ldc, const __int64_t aOffset,
+      const __int64_t bOffset, const __int64_t cOffset);
+};
+
+struct hcblasDgemmEntries {
+  hcblasStatus (*gemm)(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                       hcblasOrder order, hcblasTranspose typeA,
+                       hcblasTranspose typeB, const int M, const int N,
+                       const int K, const double &alpha, double *A,
+                       const __int64_t lda, double *B, const __int64_t ldb,
+                       const double &beta, double *C, const __int64_t ldc,
+                       const __int64_t aOffset, const __int64_t bOffset,
+                       const __int64_t cOffset);
+  hcblasStatus (*gemmBatched)(
+      Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const double &alpha, double *A[], const __int64_t lda,
+      const __int64_t A_batchOffset, double *B[], const __int64_t ldb,
+      const __int64_t B_batchOffset, const double &beta, double *C[],
+      const __int64_t ldc, const __int64_t C_batchOffset,
+      const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+      const int batchSize);
+};
+
+struct hcblasHgemmEntries {
+  hcblasStatus (*gemm)(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                       hcblasOrder order, hcblasTranspose typeA,
+                       hcblasTranspose typeB, const int M, const int N,
+                       const int K, const hc::half &alpha, hc::half *A,
+                       const __int64_t lda, hc::half *B, const __int64_t ldb,
+                       const hc::half &beta, hc::half *C, const __int64_t ldc,
+                       const __int64_t aOffset, const __int64_t bOffset,
+                       const __int64_t cOffset);
+};
+
+struct hcblasCgemmEntries {
+  hcblasStatus (*gemm)(
+      Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const hc::short_vector::float_2 &alpha,
+      hc::short_vector::float_2 *A, const __int64_t aOffset,
+      const __int64_t lda, hc::short_vector::float_2 *B,
+      const __int64_t bOffset, const __int64_t ldb,
+      const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C,
+      const __int64_t cOffset, const __int64_t ldc);
+  hcblasStatus (*gemmBatched)(
+      Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const hc::short_vector::float_2 &alpha,
+      hc::short_vector::float_2 *A[], const __int64_t aOffset,
+      const __int64_t A_batchOffset, const __int64_t lda,
+      hc::short_vector::float_2 *B[], const __int64_t bOffset,
+      const __int64_t B_batchOffset, const __int64_t ldb,
+      const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C[],
+      const __int64_t cOffset, const __int64_t C_batchOffset,
+      const __int64_t ldc, const int batchSize);
+};
+
+struct hcblasZgemmEntries {
+  hcblasStatus (*gemm)(
+      Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const hc::short_vector::double_2 &alpha,
+      hc::short_vector::double_2 *A, const __int64_t aOffset,
+      const __int64_t lda, hc::short_vector::double_2 *B,
+      const __int64_t bOffset, const __int64_t ldb,
+      const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+      const __int64_t cOffset, const __int64_t ldc);
+  hcblasStatus (*gemmBatched)(
+      Hcblaslibrary *lib, hc::accelerator_view accl_view, hcblasOrder order,
+      hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+      const int K, const hc::short_vector::double_2 &alpha,
+      hc::short_vector::double_2 *A[], const __int64_t aOffset,
+      const __int64_t A_batchOffset, const __int64_t lda,
+      hc::short_vector::double_2 *B[], const __int64_t bOffset,
+      const __int64_t B_batchOffset, const __int64_t ldb,
+      const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+      const __int64_t cOffset, const __int64_t C_batchOffset,
+      const __int64_t ldc, const int batchSize);
+};
+
+#endif  // LIB_SRC_BLAS_MODULES_ROUTINE_MODULES_H_
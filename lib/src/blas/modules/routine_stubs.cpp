@@ -0,0 +1,215 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "routine_modules.h"
+
+#ifdef HCBLAS_ROUTINE_MODULES
+
+// The GEMM routines are built as modules (lib/src/CMakeLists.txt); these
+// stand in for them in the library, loading the module on first use.
+// A module that cannot be loaded fails the call.
+
+hcblasStatus Hcblaslibrary::hcblas_sgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const float &alpha, float *A, const __int64_t lda, float *B,
+    const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  const hcblasSgemmEntries *module =
+      hcblasRoutineEntries<hcblasSgemmEntries>(ModuleSgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemm(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                      lda, B, ldb, beta, C, ldc, aOffset, bOffset, cOffset);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_sgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const float &alpha, float *A[], const __int64_t lda,
+    const __int64_t A_batchOffset, float *B[], const __int64_t ldb,
+    const __int64_t B_batchOffset, const float &beta, float *C[],
+    const __int64_t ldc, const __int64_t C_batchOffset,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+    const int batchSize) {
+  const hcblasSgemmEntries *module =
+      hcblasRoutineEntries<hcblasSgemmEntries>(ModuleSgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemmBatched(this, accl_view, order, typeA, typeB, M, N, K,
+                             alpha, A, lda, A_batchOffset, B, ldb,
+                             B_batchOffset, beta, C, ldc, C_batchOffset,
+                             aOffset, bOffset, cOffset, batchSize);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_sgemm_capture(
+    hcblasPlan *plan, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+    const int K, const float &alpha, float *A, const __int64_t lda, float *B,
+    const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
+  const hcblasSgemmEntries *module =
+      hcblasRoutineEntries<hcblasSgemmEntries>(ModuleSgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemmCapture(this, plan, accl_view, order, typeA, typeB, M, N,
+                             K, alpha, A, lda, B, ldb, beta, C, ldc, aOffset,
+                             bOffset, cOffset);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_dgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const double &alpha, double *A, const __int64_t lda, double *B,
+    const __int64_t ldb, const double &beta, double *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  const hcblasDgemmEntries *module =
+      hcblasRoutineEntries<hcblasDgemmEntries>(ModuleDgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemm(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                      lda, B, ldb, beta, C, ldc, aOffset, bOffset, cOffset);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_dgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const double &alpha, double *A[], const __int64_t lda,
+    const __int64_t A_batchOffset, double *B[], const __int64_t ldb,
+    const __int64_t B_batchOffset, const double &beta, double *C[],
+    const __int64_t ldc, const __int64_t C_batchOffset,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset,
+    const int batchSize) {
+  const hcblasDgemmEntries *module =
+      hcblasRoutineEntries<hcblasDgemmEntries>(ModuleDgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemmBatched(this, accl_view, order, typeA, typeB, M, N, K,
+                             alpha, A, lda, A_batchOffset, B, ldb,
+                             B_batchOffset, beta, C, ldc, C_batchOffset,
+                             aOffset, bOffset, cOffset, batchSize);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_hgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::half &alpha, hc::half *A, const __int64_t lda, hc::half *B,
+    const __int64_t ldb, const hc::half &beta, hc::half *C,
+    const __int64_t ldc, const __int64_t aOffset, const __int64_t bOffset,
+    const __int64_t cOffset) {
+  const hcblasHgemmEntries *module =
+      hcblasRoutineEntries<hcblasHgemmEntries>(ModuleHgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemm(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                      lda, B, ldb, beta, C, ldc, aOffset, bOffset, cOffset);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_cgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+    const __int64_t aOffset, const __int64_t lda,
+    hc::short_vector::float_2 *B, const __int64_t bOffset,
+    const __int64_t ldb, const hc::short_vector::float_2 &beta,
+    hc::short_vector::float_2 *C, const __int64_t cOffset,
+    const __int64_t ldc) {
+  const hcblasCgemmEntries *module =
+      hcblasRoutineEntries<hcblasCgemmEntries>(ModuleCgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemm(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                      aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_cgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset,
+    const __int64_t lda, hc::short_vector::float_2 *B[],
+    const __int64_t bOffset, const __int64_t B_batchOffset,
+    const __int64_t ldb, const hc::short_vector::float_2 &beta,
+    hc::short_vector::float_2 *C[], const __int64_t cOffset,
+    const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize) {
+  const hcblasCgemmEntries *module =
+      hcblasRoutineEntries<hcblasCgemmEntries>(ModuleCgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemmBatched(this, accl_view, order, typeA, typeB, M, N, K,
+                             alpha, A, aOffset, A_batchOffset, lda, B,
+                             bOffset, B_batchOffset, ldb, beta, C, cOffset,
+                             C_batchOffset, ldc, batchSize);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_zgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B, const __int64_t bOffset,
+    const __int64_t ldb, const hc::short_vector::double_2 &beta,
+    hc::short_vector::double_2 *C, const __int64_t cOffset,
+    const __int64_t ldc) {
+  const hcblasZgemmEntries *module =
+      hcblasRoutineEntries<hcblasZgemmEntries>(ModuleZgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemm(this, accl_view, order, typeA, typeB, M, N, K, alpha, A,
+                      aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+hcblasStatus Hcblaslibrary::hcblas_zgemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int M, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset,
+    const __int64_t lda, hc::short_vector::double_2 *B[],
+    const __int64_t bOffset, const __int64_t B_batchOffset,
+    const __int64_t ldb, const hc::short_vector::double_2 &beta,
+    hc::short_vector::double_2 *C[], const __int64_t cOffset,
+    const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize) {
+  const hcblasZgemmEntries *module =
+      hcblasRoutineEntries<hcblasZgemmEntries>(ModuleZgemm);
+  if (module == NULL) {
+    return HCBLAS_INVALID;
+  }
+  return module->gemmBatched(this, accl_view, order, typeA, typeB, M, N, K,
+                             alpha, A, aOffset, A_batchOffset, lda, B,
+                             bOffset, B_batchOffset, ldb, beta, C, cOffset,
+                             C_batchOffset, ldc, batchSize);
+}
+
+#endif  // HCBLAS_ROUTINE_MODULES
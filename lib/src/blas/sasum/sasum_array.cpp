@@ -27,11 +27,15 @@ THE SOFTWARE.
 
 #define TILE_SIZE 256
 
-void sasum_HC(hc::accelerator_view accl_view, __int64_t n, float *xView,
+void sasum_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+              __int64_t n, float *xView,
               __int64_t incx, __int64_t xOffset, float *Y) {
   *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(float) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, 1);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -142,12 +146,16 @@ void sasum_HC(hc::accelerator_view accl_view, __int64_t n, float *xView,
   hc::am_free(dev_global_buffer);
 }
 
-void sasum_HC(hc::accelerator_view accl_view, __int64_t n, float *xView,
+void sasum_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+              __int64_t n, float *xView,
               __int64_t incx, __int64_t xOffset, float *Y,
               __int64_t X_batchOffset, int batchSize) {
   *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(float) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, batchSize);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -269,7 +277,9 @@ hcblasStatus Hcblaslibrary::hcblas_sasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  sasum_HC(accl_view, N, X, incX, xOffset, Y);
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  sasum_HC(accl_view, props, N, X, incX, xOffset, Y);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -285,7 +295,10 @@ hcblasStatus Hcblaslibrary::hcblas_sasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  sasum_HC(accl_view, N, X, incX, xOffset, Y, X_batchOffset, batchSize);
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  sasum_HC(accl_view, props, N, X, incX, xOffset, Y, X_batchOffset,
+           batchSize);
   return HCBLAS_SUCCEEDS;
 }
 
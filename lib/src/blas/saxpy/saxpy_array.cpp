@@ -175,6 +175,16 @@ void axpy_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
   }
 }
 
+// Replays a captured saxpy step
+static hcblasStatus axpy_plan_launch(hc::accelerator_view accl_view,
+                                     const hcblasPlanStep &step) {
+  axpy_HC(accl_view, step.dim[0], step.scalar[0],
+          static_cast<const float *>(step.operand[0]), step.offset[0],
+          step.dim[1], static_cast<float *>(step.operand[1]), step.offset[1],
+          step.dim[2]);
+  return HCBLAS_SUCCEEDS;
+}
+
 /* SAXPY - Type I : Inputs and outputs are device pointers */
 hcblasStatus Hcblaslibrary::hcblas_saxpy(hc::accelerator_view accl_view,
                                          const int N, const float &alpha,
@@ -182,6 +192,15 @@ hcblasStatus Hcblaslibrary::hcblas_saxpy(hc::accelerator_view accl_view,
                                          float *Y, const int incY,
                                          const __int64_t xOffset,
                                          const __int64_t yOffset) {
+  return hcblas_saxpy_capture(NULL, accl_view, N, alpha, X, incX, Y, incY,
+                              xOffset, yOffset);
+}
+
+/* SAXPY - Type I, recorded in plan when it is not NULL */
+hcblasStatus Hcblaslibrary::hcblas_saxpy_capture(
+    hcblasPlan *plan, hc::accelerator_view accl_view, const int N,
+    const float &alpha, const float *X, const int incX, float *Y,
+    const int incY, const __int64_t xOffset, const __int64_t yOffset) {
   /*Check the conditions*/
   if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
     return HCBLAS_INVALID;
@@ -191,6 +210,16 @@ hcblasStatus Hcblaslibrary::hcblas_saxpy(hc::accelerator_view accl_view,
     return HCBLAS_SUCCEEDS;
   }
 
+  if (plan != NULL) {
+    hcblasPlanStep step = {axpy_plan_launch,
+                           NULL,
+                           {const_cast<float *>(X), Y},
+                           {xOffset, yOffset},
+                           {N, incX, incY},
+                           {alpha}};
+    plan->steps.push_back(step);
+    return HCBLAS_SUCCEEDS;
+  }
   axpy_HC(accl_view, N, alpha, X, xOffset, incX, Y, yOffset, incY);
   return HCBLAS_SUCCEEDS;
 }
@@ -0,0 +1,119 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_math.hpp>
+
+#define BLOCK_SIZE 256
+
+/*
+ * Symmetric band matrix-vector product on BLAS band storage. For a column
+ * major matrix with k super/sub diagonals
+ *   Upper : A(i, j) = AB[k + i - j + j * lda]  for i <= j
+ *   Lower : A(i, j) = AB[i - j + j * lda]      for i >= j
+ * and the other triangle is read through symmetry. Each thread produces one
+ * element of Y from the 2k + 1 wide band of its row.
+ */
+template <typename T>
+static void sbmv_HC(hc::accelerator_view accl_view, bool upper, int n, int k,
+                    T alpha, const T *A, __int64_t aOffset, __int64_t lda,
+                    const T *X, __int64_t xOffset, __int64_t incX, T beta,
+                    T *Y, __int64_t yOffset, __int64_t incY) {
+  __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int i = tidx.global[0];
+    if (i >= n) return;
+
+    int jStart = (i - k > 0) ? i - k : 0;
+    int jEnd = (i + k < n - 1) ? i + k : n - 1;
+    T sum = 0;
+    for (int j = jStart; j <= jEnd; ++j) {
+      // (r, c) is the stored element of the pair A(i, j), A(j, i)
+      int r = upper ? (i < j ? i : j) : (i > j ? i : j);
+      int c = upper ? (i < j ? j : i) : (i > j ? j : i);
+      __int64_t bandRow = upper ? k + r - c : r - c;
+      sum += A[aOffset + c * lda + bandRow] * X[xOffset + j * incX];
+    }
+
+    __int64_t Y_index = yOffset + i * incY;
+    if (beta == 0) {
+      Y[Y_index] = alpha * sum;
+    } else {
+      Y[Y_index] = beta * Y[Y_index] + alpha * sum;
+    }
+  }) ;
+}
+
+template <typename T>
+static hcblasStatus sbmv(hc::accelerator_view accl_view, hcblasOrder order,
+                         hcblasUplo uplo, const int N, const int K,
+                         const T alpha, const T *A, const __int64_t aOffset,
+                         const int lda, const T *X, const __int64_t xOffset,
+                         const int incX, const T beta, T *Y,
+                         const __int64_t yOffset, const int incY) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || K < 0 || lda < K + 1 ||
+      incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // Row major band storage of one triangle is column major band storage of
+  // the other
+  bool upper = (uplo == Upper);
+  if (!order) {
+    upper = !upper;
+  }
+
+  sbmv_HC<T>(accl_view, upper, N, K, alpha, A, aOffset, lda, X, xOffset, incX,
+             beta, Y, yOffset, incY);
+  return HCBLAS_SUCCEEDS;
+}
+
+/* SSBMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_ssbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const int K, const float &alpha, const float *A,
+    const __int64_t aOffset, const int lda, const float *X,
+    const __int64_t xOffset, const int incX, const float &beta, float *Y,
+    const __int64_t yOffset, const int incY) {
+  return sbmv<float>(accl_view, order, uplo, N, K, alpha, A, aOffset, lda, X,
+                     xOffset, incX, beta, Y, yOffset, incY);
+}
+
+/* DSBMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dsbmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const int K, const double &alpha, const double *A,
+    const __int64_t aOffset, const int lda, const double *X,
+    const __int64_t xOffset, const int incX, const double &beta, double *Y,
+    const __int64_t yOffset, const int incY) {
+  return sbmv<double>(accl_view, order, uplo, N, K, alpha, A, aOffset, lda, X,
+                      xOffset, incX, beta, Y, yOffset, incY);
+}
@@ -27,12 +27,16 @@ THE SOFTWARE.
 
 #define TILE_SIZE 256
 
-float sdot_HC(hc::accelerator_view accl_view, __int64_t n, const float *xView,
+float sdot_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+              __int64_t n, const float *xView,
               __int64_t incx, __int64_t xOffset, const float *yView,
               __int64_t incy, __int64_t yOffset, float out) {
   out = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(float) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, 1);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -137,9 +141,11 @@ float sdot_HC(hc::accelerator_view accl_view, __int64_t n, const float *xView,
                  sizeof(float) * tile_count);
 
   // 2nd pass reduction
-  // Check if the residual is capable of occupying 50% of compute units
-  // Assumption : The target architecture has 40 compute units
-  if (tile_count < TILE_SIZE * 20) {
+  // Finish on the host unless the partial sums span several work groups
+  // and would occupy at least half of those the device holds
+  long long partial_groups = (tile_count + TILE_SIZE - 1) / TILE_SIZE;
+  if (partial_groups == 1 ||
+      2 * partial_groups < hcblasResidentGroups(props, kernel)) {
     for (int i = 0; i < tile_count; i++) {
       out = (hc::fast_math::isnan(static_cast<float>(out)) ||
              hc::fast_math::isinf(static_cast<float>(out)))
@@ -148,8 +154,8 @@ float sdot_HC(hc::accelerator_view accl_view, __int64_t n, const float *xView,
       out += host_global_buffer[i];
     }
   } else {
-    out = sdot_HC(accl_view, tile_count, dev_global_buffer, 1, 0, NULL, 0, 0,
-                  out);
+    out = sdot_HC(accl_view, props, tile_count, dev_global_buffer, 1, 0, NULL,
+                  0, 0, out);
   }
 
   // free up resources
@@ -158,14 +164,18 @@ float sdot_HC(hc::accelerator_view accl_view, __int64_t n, const float *xView,
   return out;
 }
 
-float sdot_HC(hc::accelerator_view accl_view, __int64_t n, const float *xView,
+float sdot_HC(hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+              __int64_t n, const float *xView,
               __int64_t incx, __int64_t xOffset, const float *yView,
               __int64_t incy, __int64_t yOffset, float out,
               const __int64_t X_batchOffset, const __int64_t Y_batchOffset,
               const int batchSize) {
   out = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
+  // runtime sizes: work groups stride over x, so no more of them are
+  // launched than the device holds at once
+  hcblasKernelResources kernel = {TILE_SIZE, sizeof(float) * TILE_SIZE, 0};
+  unsigned int tile_count = hcblasGridGroups(
+      props, kernel, (n + TILE_SIZE - 1) / TILE_SIZE, batchSize);
   // simultaneous live threads
   const unsigned int thread_count = tile_count * TILE_SIZE;
   // global buffer (return type)
@@ -290,7 +300,9 @@ hcblasStatus Hcblaslibrary::hcblas_sdot(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  dot = sdot_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, dot);
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  dot = sdot_HC(accl_view, props, N, X, incX, xOffset, Y, incY, yOffset, dot);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -305,7 +317,9 @@ hcblasStatus Hcblaslibrary::hcblas_sdot(
     return HCBLAS_INVALID;
   }
 
-  dot = sdot_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, dot,
+  hcblasDeviceProps props =
+      deviceProperties(accl_view.get_accelerator());
+  dot = sdot_HC(accl_view, props, N, X, incX, xOffset, Y, incY, yOffset, dot,
                 X_batchOffset, Y_batchOffset, batchSize);
   return HCBLAS_SUCCEEDS;
 }
@@ -24,6 +24,8 @@ THE SOFTWARE.
 #define LIB_SRC_BLAS_SGEMM_SGEMM_ARRAY_KERNELS_H_
 
 #include "include/hcblaslib.h"
+#include "include/hcblas_micro_kernels.h"
+#include "include/hcblas_trace.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -39,6 +41,51 @@ THE SOFTWARE.
 #define MICROTILEPROD (TILESIZE * MICROTILESIZE)
 #define BANKMICROTILESIZE (TILESIZE * MICROTILESIZE + 1)
 
+/* Signature shared by every tuned SGEMM kernel. The *_select functions
+ below map a problem shape to one of them, so the choice can be made once
+ and the kernel launched later (plan capture). */
+typedef hcblasStatus (*sgemm_kernel)(hc::accelerator_view accl_view,
+                                     const float *A, __int64_t aOffset,
+                                     const float *B, __int64_t bOffset,
+                                     float *C, __int64_t cOffset, int M, int N,
+                                     int K, int lda, int ldb, int ldc,
+                                     float alpha, float beta);
+
+/* alignment: hcblasGemmAlignment of the operands, which decides whether a
+ vector staged variant may be used */
+sgemm_kernel gemm_select(const hcblasDeviceProps &props, int order,
+                         char TransA, char TransB, int M, int N, int K,
+                         float alpha, unsigned alignment);
+
+/* Variant of kernel for alignment (hcblasGemmAlignment): the one moving
+ operands with 16 byte loads and stores if kernel has one and alignment
+ allows it, else the scalar one. Either variant may be passed in, so a
+ recorded kernel can be checked again against new operands. */
+sgemm_kernel gemm_vector_select(sgemm_kernel kernel, unsigned alignment);
+
+/* Split-K kernel for the storage order and transposes, or NULL when C has
+ enough tiles to occupy the device on its own */
+sgemm_kernel gemm_splitK_select(const hcblasDeviceProps &props, int order,
+                                char TransA, char TransB, int M, int N,
+                                int K);
+
+/* Name of a kernel returned by the select functions, for the HCBLAS_LAYER
+ trace; NULL if the kernel is not a select result. The split-K and batch
+ kernels name themselves. */
+const char *gemm_kernel_name(sgemm_kernel kernel);
+
+/* Per storage order halves of gemm_kernel_name */
+const char *gemm_colMajor_kernel_name(sgemm_kernel kernel);
+const char *gemm_rMajor_kernel_name(sgemm_kernel kernel);
+
+struct sgemm_kernel_entry {
+  sgemm_kernel kernel;
+  const char *name;
+};
+
+#define SGEMM_KERNEL_ENTRY(kernel) \
+  { kernel, #kernel }
+
 #define MS1x1(offsetA, offsetB)                            \
   for (int iter = 0; iter < STEPSIZE / TILESIZE; ++iter) { \
     rA[0][iter] = lA[offA + (TILESIZE * TILESIZE) * iter]; \
@@ -347,25 +394,14 @@ THE SOFTWARE.
   offA++;                                       \
   offB++;
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_Mx16_NX16_KX64_TS16XMS4(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransAB_STEP_NBK_M_N_K_TS16XMS4(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta);
+/* Built gemm_MICRO_NBK_M_N_K_TS16 variants of the SGEMM variant table */
+template <>
+sgemm_kernel gemm_MICRO_NBK_M_N_K_variant<float>(bool transA, bool transB,
+                                                 int MTILE);
 
-hcblasStatus gemm_NoTransAB_STEP_NBK_Mx16_NX16_KX96_TS16XMS6(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransAB_STEP_NBK_M_N_K_TS16XMS6(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta);
+/* Trace name of a gemm_MICRO_NBK_M_N_K_TS16 variant, NULL for any other
+ kernel */
+const char *gemm_variant_kernel_name(sgemm_kernel kernel);
 
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX064_NX064_KX16_TS16XMTS4(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
@@ -377,12 +413,17 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
+/* gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2 staging A
+ and B with float_4 loads and updating C with float_2 accesses. Every
+ operand must be 16 byte aligned with a leading dimension that keeps it so
+ (HCBLAS_GEMM_VECTOR_ALIGNED). */
+hcblasStatus
+gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2_VEC(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
+hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
@@ -392,35 +433,12 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, float *A,
-                            __int64_t aOffset, float *B, __int64_t bOffset,
-                            float *C, __int64_t cOffset, int M, int N, int K,
-                            int lda, int ldb, int ldc, float alpha, float beta);
+sgemm_kernel gemm_NoTransAB_select(int M, int N, int K);
 
 hcblasStatus gemm_NoTransA_MICRO_NBK_M096_N096_K096_TS16XMTS6(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
@@ -432,21 +450,6 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
 hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
@@ -467,25 +470,7 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, float *A,
-                           __int64_t aOffset, float *B, __int64_t bOffset,
-                           float *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
+sgemm_kernel gemm_NoTransA_select(int M, int N, int K);
 
 hcblasStatus gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
@@ -517,15 +502,17 @@ hcblasStatus gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, float *A,
-                           __int64_t aOffset, float *B, __int64_t bOffset,
-                           float *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, float alpha, float beta);
+sgemm_kernel gemm_NoTransB_select(int M, int N, int K);
+
+sgemm_kernel gemm_TransAB_select(int M, int N, int K);
 
-hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, float *A,
-                          __int64_t aOffset, float *B, __int64_t bOffset,
-                          float *C, __int64_t cOffset, int M, int N, int K,
-                          int lda, int ldb, int ldc, float alpha, float beta);
+/* Launcher that runs the tile aligned interior of a ragged M x N x K
+ product on the M128_N128_K16 TS16XMTS<MTILE> kernel for the transposes
+ and the rest on bounds checked kernels (see hcblas_edge.h); NULL if the
+ shape has too small an interior or both operands are transposed. Column
+ major only. */
+sgemm_kernel gemm_edge_select(bool transA, bool transB, int MTILE, int M,
+                              int N, int K);
 
 /*
 * SGEMM Kernels for Batch processing in column major order
@@ -567,32 +554,13 @@ hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, float *A[],
 * SGEMM Kernels - Row major order
 */
 
-hcblasStatus gemm_NoTransAB_rMajor(hc::accelerator_view accl_view, float *A,
-                                   __int64_t aOffset, float *B,
-                                   __int64_t bOffset, float *C,
-                                   __int64_t cOffset, int M, int N, int K,
-                                   int lda, int ldb, int ldc, float alpha,
-                                   float beta);
+sgemm_kernel gemm_NoTransAB_rMajor_select(int M, int N, int K);
 
-hcblasStatus gemm_NoTransA_rMajor(hc::accelerator_view accl_view, float *A,
-                                  __int64_t aOffset, float *B,
-                                  __int64_t bOffset, float *C,
-                                  __int64_t cOffset, int M, int N, int K,
-                                  int lda, int ldb, int ldc, float alpha,
-                                  float beta);
+sgemm_kernel gemm_NoTransA_rMajor_select(int M, int N, int K);
 
-hcblasStatus gemm_NoTransB_rMajor(hc::accelerator_view accl_view, float *A,
-                                  __int64_t aOffset, float *B,
-                                  __int64_t bOffset, float *C,
-                                  __int64_t cOffset, int M, int N, int K,
-                                  int lda, int ldb, int ldc, float alpha,
-                                  float beta);
+sgemm_kernel gemm_NoTransB_rMajor_select(int M, int N, int K);
 
-hcblasStatus gemm_TransAB_rMajor(hc::accelerator_view accl_view, float *A,
-                                 __int64_t aOffset, float *B, __int64_t bOffset,
-                                 float *C, __int64_t cOffset, int M, int N,
-                                 int K, int lda, int ldb, int ldc, float alpha,
-                                 float beta);
+sgemm_kernel gemm_TransAB_rMajor_select(int M, int N, int K);
 
 /*
 * SGEMM Kernels for Batch-processing in Row major order
@@ -633,4 +601,25 @@ hcblasStatus gemm_TransAB_rMajor(hc::accelerator_view accl_view, float *A,
                                  int M, int N, int K, int lda, int ldb, int ldc,
                                  float alpha, float beta, int batchSize);
 
+/*
+* SGEMM Kernels for batches of tiny matrices in column major order. M, N and
+* K are all at most SGEMM_TINY_MAX; one work group handles many batch
+* elements and every operand is read exactly once. No more work groups are
+* launched than props says the device holds; each loops over its share.
+*/
+
+#define SGEMM_TINY_MAX 32
+
+typedef hcblasStatus (*sgemm_tiny_kernel)(
+    hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+    bool transA, bool transB, float *A[],
+    __int64_t aOffset, __int64_t A_batchOffset, float *B[], __int64_t bOffset,
+    __int64_t B_batchOffset, float *C[], __int64_t cOffset,
+    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
+    float alpha, float beta, int batchSize);
+
+/* Kernel instantiated for the smallest size class holding M, N and K, or
+ NULL if any of them is outside [1, SGEMM_TINY_MAX] */
+sgemm_tiny_kernel gemm_tiny_batch_select(int M, int N, int K);
+
 #endif  // LIB_SRC_BLAS_SGEMM_SGEMM_ARRAY_KERNELS_H_
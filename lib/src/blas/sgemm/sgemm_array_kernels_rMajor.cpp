@@ -29,9 +29,9 @@ THE SOFTWARE.
 * TILESIZE = 8 STEPSIZE = 8
 */
 hcblasStatus gemm_NoTransAB_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 8
 #define STEPSIZE 8
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -111,9 +111,9 @@ hcblasStatus gemm_NoTransAB_rMajor_STEP_NBK_TS8XSS8(
 */
 
 hcblasStatus gemm_NoTransAB_rMajor_STEP_NBK_TS16XSS16(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define STEPSIZE 16
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -193,9 +193,9 @@ hcblasStatus gemm_NoTransAB_rMajor_STEP_NBK_TS16XSS16(
 * TILESIZE = 16 MICROTILESIZE = 2
 */
 hcblasStatus gemm_NoTransAB_rMajor_MICRO_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -284,9 +284,9 @@ hcblasStatus gemm_NoTransAB_rMajor_MICRO_TS16XMTS2(
 */
 
 hcblasStatus gemm_NoTransA_rMajor_STEP_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 8
 #define STEPSIZE 8
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -367,88 +367,6 @@ hcblasStatus gemm_NoTransA_rMajor_STEP_TS8XSS8(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_NoTransA_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    float rC[1][1] = {{0.0}};
-    float rA[1][STEPTILERATIO];
-    float rB[1][STEPTILERATIO];
-    tile_static float lA[STEPTILEPROD + STEPSIZE];
-    tile_static float lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[0];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[0];
-    int idy = tidx.local[1];
-    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
-    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
-    int idxS = ids & (STEPSIZE - 1);
-    int idyT = (idt) >> tilemulshift;
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxS + idyTOffset;
-        int kIndex = iOffset + idxS + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idyT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + (gidyOffset + idyT) * ldb + kIndex];
-        }
-
-        if (gidxOffset + idyT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + (gidxOffset + idyT) * lda + kIndex];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int piter = 0; piter < TILESIZE; ++piter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = (gidxOffset + idx) * ldc;
-    int ccolprod = (gidyOffset + idy);
-
-    if (crow / ldc < M && ccolprod < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
 * SGEMM - NoTransA case - Row major Access
 * STEP with Non Bank Conflict Implementation
@@ -456,9 +374,9 @@ hcblasStatus gemm_NoTransA_rMajor_STEP_NBK_TS8XSS8(
 */
 
 hcblasStatus gemm_NoTransA_rMajor_STEP_NBK_TS16XSS16(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define STEPSIZE 16
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -544,9 +462,9 @@ hcblasStatus gemm_NoTransA_rMajor_STEP_NBK_TS16XSS16(
 */
 
 hcblasStatus gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -635,9 +553,9 @@ hcblasStatus gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2(
 */
 
 hcblasStatus gemm_NoTransA_rMajor_MICRO_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -727,9 +645,9 @@ hcblasStatus gemm_NoTransA_rMajor_MICRO_TS16XMTS2(
 */
 
 hcblasStatus gemm_NoTransB_rMajor_STEP_NBK_TS16XSS16(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define STEPSIZE 16
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -814,9 +732,9 @@ hcblasStatus gemm_NoTransB_rMajor_STEP_NBK_TS16XSS16(
 */
 
 hcblasStatus gemm_NoTransB_rMajor_MICRO_NBK_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -903,9 +821,9 @@ hcblasStatus gemm_NoTransB_rMajor_MICRO_NBK_TS16XMTS2(
 */
 
 hcblasStatus gemm_NoTransB_rMajor_STEP_TS16XSS16(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define STEPSIZE 16
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -987,9 +905,9 @@ hcblasStatus gemm_NoTransB_rMajor_STEP_TS16XSS16(
 */
 
 hcblasStatus gemm_NoTransB_rMajor_STEP_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 8
 #define STEPSIZE 8
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -1071,9 +989,9 @@ hcblasStatus gemm_NoTransB_rMajor_STEP_TS8XSS8(
 */
 
 hcblasStatus gemm_NoTransB_rMajor_MICRO_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -1159,87 +1077,6 @@ hcblasStatus gemm_NoTransB_rMajor_MICRO_TS16XMTS2(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_NoTransB_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = hc::fast_math::log2f(STEPSIZE);
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    float rC[1][1] = {{0.0}};
-    float rA[1][STEPTILERATIO];
-    float rB[1][STEPTILERATIO];
-    tile_static float lA[STEPTILEPROD + STEPSIZE];
-    tile_static float lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[0];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[0];
-    int idy = tidx.local[1];
-    int idt = (idy << tilemulshift) + idx;
-    int idyT = idt >> tilemulshift;
-    int idxT = idt & (TILESIZE - 1);
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxT + idyTOffset;
-        int kIndex = iOffset + idyT + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idxT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + gidyOffset + idxT + kIndex * ldb];
-        }
-
-        if (gidxOffset + idxT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + gidxOffset + idxT + kIndex * lda];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(BANKTILESIZE);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = (gidxOffset + idx) * ldc;
-    int ccolprod = (gidyOffset + idy);
-
-    if (crow / ldc < M && ccolprod < N) {
-      __int64_t C_index = cOffset + crow + ccolprod;
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
 * SGEMM - TransAB case - Row major Access
 * MICRO with Non Bank Conflict Implementation
@@ -1247,9 +1084,9 @@ hcblasStatus gemm_NoTransB_rMajor_STEP_NBK_TS8XSS8(
 */
 
 hcblasStatus gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -1336,85 +1173,6 @@ hcblasStatus gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_TransAB_rMajor_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    float rC[1][1] = {{0.0}};
-    float rA[1][STEPTILERATIO];
-    float rB[1][STEPTILERATIO];
-    tile_static float lA[STEPTILEPROD + STEPSIZE];  // 8*8+8
-    tile_static float lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[0];
-    int gidy = tidx.tile[1];
-    int idx = tidx.local[0];
-    int idy = tidx.local[1];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] =
-              B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (TILESIZE * sec)];
-        } else {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] =
-              A[aOffset + gidx * TILESIZE + idxT + idyT * lda +
-                i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + (gidx * TILESIZE + idx) * ldc + (gidy * TILESIZE + idy);
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
 /*
 * SGEMM - TransAB case - Row major Access
 * STEP with Non Bank Conflict Implementation
@@ -1422,9 +1180,9 @@ hcblasStatus gemm_TransAB_rMajor_STEP_NBK_TS8XSS8(
 */
 
 hcblasStatus gemm_TransAB_rMajor_STEP_NBK_TS16XSS16(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define STEPSIZE 16
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -1508,9 +1266,9 @@ hcblasStatus gemm_TransAB_rMajor_STEP_NBK_TS16XSS16(
 */
 
 hcblasStatus gemm_TransAB_rMajor_MICRO_TS16XMTS2(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 16
 #define MICROTILESIZE 2
   int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
@@ -1599,9 +1357,9 @@ hcblasStatus gemm_TransAB_rMajor_MICRO_TS16XMTS2(
 */
 
 hcblasStatus gemm_TransAB_rMajor_STEP_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset, float *B,
-    __int64_t bOffset, float *C, __int64_t cOffset, int M, int N, int K,
-    int lda, int ldb, int ldc, float alpha, float beta) {
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define TILESIZE 8
 #define STEPSIZE 8
   hc::extent<2> grdExt((M + (TILESIZE - 1)) & ~(TILESIZE - 1),
@@ -1680,12 +1438,10 @@ hcblasStatus gemm_TransAB_rMajor_STEP_TS8XSS8(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_TransAB_rMajor_largeK(hc::accelerator_view accl_view,
-                                        float *A, __int64_t aOffset, float *B,
-                                        __int64_t bOffset, float *C,
-                                        __int64_t cOffset, int M, int N, int K,
-                                        int lda, int ldb, int ldc, float alpha,
-                                        float beta) {
+hcblasStatus gemm_TransAB_rMajor_largeK(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define GEMM_BLOCK 256
   hc::extent<2> grdExt(N, M * GEMM_BLOCK);
   hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
@@ -1730,12 +1486,10 @@ hcblasStatus gemm_TransAB_rMajor_largeK(hc::accelerator_view accl_view,
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransB_rMajor_largeK(hc::accelerator_view accl_view,
-                                         float *A, __int64_t aOffset, float *B,
-                                         __int64_t bOffset, float *C,
-                                         __int64_t cOffset, int M, int N, int K,
-                                         int lda, int ldb, int ldc, float alpha,
-                                         float beta) {
+hcblasStatus gemm_NoTransB_rMajor_largeK(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define GEMM_BLOCK 256
   hc::extent<2> grdExt(N, M * GEMM_BLOCK);
   hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
@@ -1780,12 +1534,10 @@ hcblasStatus gemm_NoTransB_rMajor_largeK(hc::accelerator_view accl_view,
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransA_rMajor_largeK(hc::accelerator_view accl_view,
-                                         float *A, __int64_t aOffset, float *B,
-                                         __int64_t bOffset, float *C,
-                                         __int64_t cOffset, int M, int N, int K,
-                                         int lda, int ldb, int ldc, float alpha,
-                                         float beta) {
+hcblasStatus gemm_NoTransA_rMajor_largeK(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
 #define GEMM_BLOCK 256
   hc::extent<2> grdExt(N, M * GEMM_BLOCK);
   hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
@@ -1831,154 +1583,120 @@ hcblasStatus gemm_NoTransA_rMajor_largeK(hc::accelerator_view accl_view,
 }
 
 /*  TOP LEVEL FUNCITONS */
-hcblasStatus gemm_NoTransAB_rMajor(hc::accelerator_view accl_view, float *A,
-                                   __int64_t aOffset, float *B,
-                                   __int64_t bOffset, float *C,
-                                   __int64_t cOffset, int M, int N, int K,
-                                   int lda, int ldb, int ldc, float alpha,
-                                   float beta) {
+sgemm_kernel gemm_NoTransAB_rMajor_select(int M, int N, int K) {
   if ((M < 600 && N < 600 && K < 10) || (M < 1800 && N < 600 && K < 600)) {
-    return gemm_NoTransAB_rMajor_STEP_NBK_TS8XSS8(accl_view, A, aOffset, B,
-                                                  bOffset, C, cOffset, M, N, K,
-                                                  lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransAB_rMajor_STEP_NBK_TS8XSS8;
   } else if ((M < 600 && N < 600 && K < 1800) ||
              (M < 1800 && ((N < 600 && K < 1800) || (N < 1800 && K < 10)))) {
-    return gemm_NoTransAB_rMajor_STEP_NBK_TS16XSS16(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_NoTransAB_rMajor_STEP_NBK_TS16XSS16;
   } else {
-    return gemm_NoTransAB_rMajor_MICRO_TS16XMTS2(accl_view, A, aOffset, B,
-                                                 bOffset, C, cOffset, M, N, K,
-                                                 lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransAB_rMajor_MICRO_TS16XMTS2;
   }
 }
 
-hcblasStatus gemm_NoTransA_rMajor(hc::accelerator_view accl_view, float *A,
-                                  __int64_t aOffset, float *B,
-                                  __int64_t bOffset, float *C,
-                                  __int64_t cOffset, int M, int N, int K,
-                                  int lda, int ldb, int ldc, float alpha,
-                                  float beta) {
+sgemm_kernel gemm_NoTransA_rMajor_select(int M, int N, int K) {
   if (M < 1000 && N < 1000 && K > 10000) {
-    return gemm_NoTransA_rMajor_largeK(accl_view, A, aOffset, B, bOffset, C,
-                                       cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                       beta);
+    return gemm_NoTransA_rMajor_largeK;
   } else if ((M < 6000 && N < 600 && K < 10) ||
              (M < 1800 && N < 80 && K > 1800 && K < 6000)) {
-    return gemm_NoTransA_rMajor_STEP_TS8XSS8(accl_view, A, aOffset, B, bOffset,
-                                             C, cOffset, M, N, K, lda, ldb, ldc,
-                                             alpha, beta);
+    return gemm_NoTransA_rMajor_STEP_TS8XSS8;
   } else if ((M < 600 && N < 600 && K < 6000) ||
              (M > 1800 && M < 6000 && (K < 600 || (K > 1800 && K < 10000)) &&
               N < 10) ||
              (M < 10 && N < 600 && K < 1800) ||
              (M < 600 && N < 1800 && K < 10)) {
-    return gemm_NoTransA_rMajor_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransA_rMajor_STEP_NBK_TS16XSS16;
   } else if ((M > 1800 && M < 6000 && N > 100 && N < 600 &&
               (K < 600 || (K < 6000 && K > 1800))) ||
              (M < 1800 && N < 600 && K < 10) ||
              (M > 1800 && M < 6000 && K > 1800 && K < 6000 && N < 300 &&
               M == K)) {
-    return gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2;
   } else if ((M == K && M < 10000 && N < 200) ||
              (M < 600 && N < 1800 && K < 600) ||
              (M < 1800 && N < 100 && K < 1800) ||
              (M > 600 && M < 6000 && K > 1800 && K < 10000 && N < 300 &&
               M < K)) {
-    return gemm_NoTransA_rMajor_MICRO_TS16XMTS2(accl_view, A, aOffset, B,
-                                                bOffset, C, cOffset, M, N, K,
-                                                lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransA_rMajor_MICRO_TS16XMTS2;
   } else {
-    return gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2;
   }
 }
 
-hcblasStatus gemm_NoTransB_rMajor(hc::accelerator_view accl_view, float *A,
-                                  __int64_t aOffset, float *B,
-                                  __int64_t bOffset, float *C,
-                                  __int64_t cOffset, int M, int N, int K,
-                                  int lda, int ldb, int ldc, float alpha,
-                                  float beta) {
+sgemm_kernel gemm_NoTransB_rMajor_select(int M, int N, int K) {
   if (M < 1000 && N < 1000 && K > 10000) {
-    return gemm_NoTransB_rMajor_largeK(accl_view, A, aOffset, B, bOffset, C,
-                                       cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                       beta);
+    return gemm_NoTransB_rMajor_largeK;
   } else if (M > 1800 && M < 6000 && N > 600 && N < 1800 && K < 600) {
-    return gemm_NoTransB_rMajor_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+    return gemm_NoTransB_rMajor_MICRO_NBK_TS16XMTS2;
   } else if (M > 600 && M < 1800 && N < 600 && K < 10) {
-    return gemm_NoTransB_rMajor_STEP_TS8XSS8(accl_view, A, aOffset, B, bOffset,
-                                             C, cOffset, M, N, K, lda, ldb, ldc,
-                                             alpha, beta);
+    return gemm_NoTransB_rMajor_STEP_TS8XSS8;
   } else if (M > 1800 && M < 6000 && N > 1800 && N < 6000 && K < 10) {
-    return gemm_NoTransB_rMajor_MICRO_TS16XMTS2(accl_view, A, aOffset, B,
-                                                bOffset, C, cOffset, M, N, K,
-                                                lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransB_rMajor_MICRO_TS16XMTS2;
   } else if ((M < 600 && N < 600 && K < 6000) ||
              (M > 1800 && M < 6000 && K < 1800 && N < 10) ||
              (M < 10 && N < 1800 && K > 1800 && K < 6000)) {
-    return gemm_NoTransB_rMajor_STEP_TS16XSS16(accl_view, A, aOffset, B,
-                                               bOffset, C, cOffset, M, N, K,
-                                               lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransB_rMajor_STEP_TS16XSS16;
   } else if ((M < 1800 && K < 600 && N < 10) ||
              (M < 10 && N < 600 && K < 1800) ||
              (M < 600 && N < 1800 && K < 10)) {
-    return gemm_NoTransB_rMajor_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransB_rMajor_STEP_NBK_TS16XSS16;
   } else {
-    return gemm_NoTransB_rMajor_MICRO_TS16XMTS2(accl_view, A, aOffset, B,
-                                                bOffset, C, cOffset, M, N, K,
-                                                lda, ldb, ldc, alpha, beta);
+    return gemm_NoTransB_rMajor_MICRO_TS16XMTS2;
   }
 }
 
-hcblasStatus gemm_TransAB_rMajor(hc::accelerator_view accl_view, float *A,
-                                 __int64_t aOffset, float *B, __int64_t bOffset,
-                                 float *C, __int64_t cOffset, int M, int N,
-                                 int K, int lda, int ldb, int ldc, float alpha,
-                                 float beta) {
+sgemm_kernel gemm_TransAB_rMajor_select(int M, int N, int K) {
   if (M < 1000 && N < 1000 && K > 10000) {
-    return gemm_TransAB_rMajor_largeK(accl_view, A, aOffset, B, bOffset, C,
-                                      cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                      beta);
+    return gemm_TransAB_rMajor_largeK;
   } else if (M > 600 && M < 1800 && N < 200 && K > 600 && K < 1800) {
-    return gemm_TransAB_rMajor_MICRO_TS16XMTS2(accl_view, A, aOffset, B,
-                                               bOffset, C, cOffset, M, N, K,
-                                               lda, ldb, ldc, alpha, beta);
+    return gemm_TransAB_rMajor_MICRO_TS16XMTS2;
   } else if (((M > 600 && M < 1800 && N < 600) || (M < 50 && N < 1800)) &&
              (K < 10)) {
-    return gemm_TransAB_rMajor_STEP_TS8XSS8(accl_view, A, aOffset, B, bOffset,
-                                            C, cOffset, M, N, K, lda, ldb, ldc,
-                                            alpha, beta);
+    return gemm_TransAB_rMajor_STEP_TS8XSS8;
   } else if ((M < 600 && N < 600 && K < 6000) ||
              (M > 1800 && M < 10000 && K > 600 && K < 10000 && N < 10) ||
              (M < 10 && N > 600 && N < 1800 && K < 6000)) {
-    return gemm_TransAB_rMajor_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B,
-                                                  bOffset, C, cOffset, M, N, K,
-                                                  lda, ldb, ldc, alpha, beta);
+    return gemm_TransAB_rMajor_STEP_NBK_TS16XSS16;
   } else if ((((M > 1800 && M < 6000 && M == K) ||
                (M > 1800 && M < 10000 && K > 1800 && K < 10000)) &&
               N < 200) ||
              (M < 10000 && N < 1800 && K < 10) ||
              (M > 1800 && M < 6000 && N < 600 && K < 200)) {
-    return gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2;
   } else if (M > 6000 && M < 10000 && N < 600 && K < 10) {
-    return gemm_TransAB_rMajor_STEP_TS8XSS8(accl_view, A, aOffset, B, bOffset,
-                                            C, cOffset, M, N, K, lda, ldb, ldc,
-                                            alpha, beta);
+    return gemm_TransAB_rMajor_STEP_TS8XSS8;
   } else {
-    return gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+    return gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2;
+  }
+}
+
+// Select results by name, for the HCBLAS_LAYER trace
+static const sgemm_kernel_entry gemm_rMajor_kernels[] = {
+    SGEMM_KERNEL_ENTRY(gemm_NoTransAB_rMajor_MICRO_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransAB_rMajor_STEP_NBK_TS16XSS16),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransAB_rMajor_STEP_NBK_TS8XSS8),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransA_rMajor_MICRO_NBK_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransA_rMajor_MICRO_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransA_rMajor_STEP_NBK_TS16XSS16),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransA_rMajor_STEP_TS8XSS8),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransA_rMajor_largeK),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransB_rMajor_MICRO_NBK_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransB_rMajor_MICRO_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransB_rMajor_STEP_NBK_TS16XSS16),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransB_rMajor_STEP_TS16XSS16),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransB_rMajor_STEP_TS8XSS8),
+    SGEMM_KERNEL_ENTRY(gemm_NoTransB_rMajor_largeK),
+    SGEMM_KERNEL_ENTRY(gemm_TransAB_rMajor_MICRO_NBK_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_TransAB_rMajor_MICRO_TS16XMTS2),
+    SGEMM_KERNEL_ENTRY(gemm_TransAB_rMajor_STEP_NBK_TS16XSS16),
+    SGEMM_KERNEL_ENTRY(gemm_TransAB_rMajor_STEP_TS8XSS8),
+    SGEMM_KERNEL_ENTRY(gemm_TransAB_rMajor_largeK)};
+
+const char *gemm_rMajor_kernel_name(sgemm_kernel kernel) {
+  for (const sgemm_kernel_entry &entry : gemm_rMajor_kernels) {
+    if (entry.kernel == kernel) {
+      return entry.name;
+    }
   }
+  return NULL;
 }
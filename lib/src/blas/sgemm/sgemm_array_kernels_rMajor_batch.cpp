@@ -384,93 +384,6 @@ hcblasStatus gemm_NoTransA_rMajor_batch_STEP_TS8XSS8(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_NoTransA_rMajor_batch_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset,
-    __int64_t A_batchOffset, float *B, __int64_t bOffset,
-    __int64_t B_batchOffset, float *C, __int64_t cOffset,
-    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
-    float alpha, float beta, int batchSize) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<3> grdExt(batchSize, (M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = static_cast<int>(hc::fast_math::log2f(STEPSIZE));
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    int elt = tidx.tile[0];
-    float rC[1][1] = {{0.0}};
-    float rA[1][STEPTILERATIO];
-    float rB[1][STEPTILERATIO];
-    tile_static float lA[STEPTILEPROD + STEPSIZE];
-    tile_static float lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[2];
-    int idx = tidx.local[1];
-    int idy = tidx.local[2];
-    int idt = (idy << tilemulshift) + idx;  // (idy * TILESIZE + idx)
-    int ids = (idy << shiftfactor) + idx;   // (idy * STEPSIZE + idx)
-    int idxS = ids & (STEPSIZE - 1);
-    int idyT = (idt) >> tilemulshift;
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxS + idyTOffset;
-        int kIndex = iOffset + idxS + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idyT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + B_batchOffset * elt +
-                           (gidyOffset + idyT) * ldb + kIndex];
-        }
-
-        if (gidxOffset + idyT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + A_batchOffset * elt +
-                           (gidxOffset + idyT) * lda + kIndex];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int piter = 0; piter < TILESIZE; ++piter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = (gidxOffset + idx) * ldc;
-    int ccolprod = (gidyOffset + idy);
-
-    if (crow / ldc < M && ccolprod < N) {
-      __int64_t C_index = cOffset + C_batchOffset * elt + crow + ccolprod;
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
 * SGEMM - NoTransA case - Row major Access
 * STEP with Non Bank Conflict Implementation
@@ -1222,92 +1135,6 @@ hcblasStatus gemm_NoTransB_rMajor_batch_MICRO_TS16XMTS2(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_NoTransB_rMajor_batch_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset,
-    __int64_t A_batchOffset, float *B, __int64_t bOffset,
-    __int64_t B_batchOffset, float *C, __int64_t cOffset,
-    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
-    float alpha, float beta, int batchSize) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<3> grdExt(batchSize, (M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
-    int tilemulshift = static_cast<int>(hc::fast_math::log2f(TILESIZE));
-    int shiftfactor = hc::fast_math::log2f(STEPSIZE);
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftfactor;
-    int elt = tidx.tile[0];
-    float rC[1][1] = {{0.0}};
-    float rA[1][STEPTILERATIO];
-    float rB[1][STEPTILERATIO];
-    tile_static float lA[STEPTILEPROD + STEPSIZE];
-    tile_static float lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[2];
-    int idx = tidx.local[1];
-    int idy = tidx.local[2];
-    int idt = (idy << tilemulshift) + idx;
-    int idyT = idt >> tilemulshift;
-    int idxT = idt & (TILESIZE - 1);
-    int gidyOffset = gidy << tilemulshift;
-    int gidxOffset = gidx << tilemulshift;
-    int idyTOffset = idyT * BANKTILESIZE;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-      int iOffset = i << shiftfactor;
-
-      for (int sec = 0; sec < STEPTILERATIO; ++sec) {
-        int secOffset = sec << tilemulshift;
-        int secStartPt = (sec << tilemulshift) * BANKTILESIZE;
-        int localIdx = secStartPt + idxT + idyTOffset;
-        int kIndex = iOffset + idyT + secOffset;
-        // Initialize the local memory with zero
-        lB[localIdx] = 0;
-        lA[localIdx] = 0;
-
-        if (gidyOffset + idxT < N && kIndex < K) {
-          lB[localIdx] = B[bOffset + B_batchOffset * elt + gidyOffset + idxT +
-                           kIndex * ldb];
-        }
-
-        if (gidxOffset + idxT < M && kIndex < K) {
-          lA[localIdx] = A[aOffset + A_batchOffset * elt + gidxOffset + idxT +
-                           kIndex * lda];
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(BANKTILESIZE);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-    int crow = (gidxOffset + idx) * ldc;
-    int ccolprod = (gidyOffset + idy);
-
-    if (crow / ldc < M && ccolprod < N) {
-      __int64_t C_index = cOffset + C_batchOffset * elt + crow + ccolprod;
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
-
 /*
 * SGEMM - TransAB case - Row major Access
 * MICRO with Non Bank Conflict Implementation
@@ -1409,89 +1236,6 @@ hcblasStatus gemm_TransAB_rMajor_batch_MICRO_NBK_TS16XMTS2(
 * TILESIZE = 8 STEPSIZE = 8
 */
 
-hcblasStatus gemm_TransAB_rMajor_batch_STEP_NBK_TS8XSS8(
-    hc::accelerator_view accl_view, float *A, __int64_t aOffset,
-    __int64_t A_batchOffset, float *B, __int64_t bOffset,
-    __int64_t B_batchOffset, float *C, __int64_t cOffset,
-    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
-    float alpha, float beta, int batchSize) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<3> grdExt(batchSize, (M + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (N + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    int elt = tidx.tile[0];
-    float rC[1][1] = {{0.0}};
-    float rA[1][STEPTILERATIO];
-    float rB[1][STEPTILERATIO];
-    tile_static float lA[STEPTILEPROD + STEPSIZE];  // 8*8+8
-    tile_static float lB[STEPTILEPROD + STEPSIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[2];
-    int idx = tidx.local[1];
-    int idy = tidx.local[2];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] =
-              B[bOffset + B_batchOffset * elt + (gidy * TILESIZE + idyT) * ldb +
-                idxT + i * STEPSIZE + (TILESIZE * sec)];
-        } else {
-          lB[idyT * BANKTILESIZE + idxT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] =
-              A[aOffset + A_batchOffset * elt + gidx * TILESIZE + idxT +
-                idyT * lda + i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * BANKTILESIZE + idyT + (BANKNUMTILEELMTS * sec)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * BANKTILESIZE;
-      int offB = idy * BANKTILESIZE;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1_NOBANK(1);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index = cOffset + C_batchOffset * elt +
-                          (gidx * TILESIZE + idx) * ldc +
-                          (gidy * TILESIZE + idy);
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
-  return HCBLAS_SUCCEEDS;
-}
 /*
 * SGEMM - TransAB case - Row major Access
 * STEP with Non Bank Conflict Implementation
@@ -2096,15 +1840,18 @@ hcblasStatus gemm_NoTransAB_rMajor(hc::accelerator_view accl_view, float *A,
                                    int ldc, float alpha, float beta,
                                    int batchSize) {
   if ((M < 600 && N < 600 && K < 10) || (M < 1800 && N < 600 && K < 600)) {
+    hcblasTraceKernel("gemm_NoTransAB_rMajor_batch_STEP_NBK_TS8XSS8");
     return gemm_NoTransAB_rMajor_batch_STEP_NBK_TS8XSS8(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if ((M < 600 && N < 600 && K < 1800) ||
              (M < 1800 && ((N < 600 && K < 1800) || (N < 1800 && K < 10)))) {
+    hcblasTraceKernel("gemm_NoTransAB_rMajor_batch_STEP_NBK_TS16XSS16");
     return gemm_NoTransAB_rMajor_batch_STEP_NBK_TS16XSS16(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else {
+    hcblasTraceKernel("gemm_NoTransAB_rMajor_batch_MICRO_TS16XMTS2");
     return gemm_NoTransAB_rMajor_batch_MICRO_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2120,11 +1867,13 @@ hcblasStatus gemm_NoTransA_rMajor(hc::accelerator_view accl_view, float *A,
                                   int ldc, float alpha, float beta,
                                   int batchSize) {
   if (M > 10000 && N < 500) {
+    hcblasTraceKernel("gemm_NoTransA_rMajor_batch_largeM");
     return gemm_NoTransA_rMajor_batch_largeM(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if ((M < 6000 && N < 600 && K < 10) ||
              (M < 1800 && N < 80 && K > 1800 && K < 6000)) {
+    hcblasTraceKernel("gemm_NoTransA_rMajor_batch_STEP_TS8XSS8");
     return gemm_NoTransA_rMajor_batch_STEP_TS8XSS8(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2133,6 +1882,7 @@ hcblasStatus gemm_NoTransA_rMajor(hc::accelerator_view accl_view, float *A,
               N < 10) ||
              (M < 10 && N < 600 && K < 1800) ||
              (M < 600 && N < 1800 && K < 10)) {
+    hcblasTraceKernel("gemm_NoTransA_rMajor_batch_STEP_NBK_TS16XSS16");
     return gemm_NoTransA_rMajor_batch_STEP_NBK_TS16XSS16(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2141,6 +1891,7 @@ hcblasStatus gemm_NoTransA_rMajor(hc::accelerator_view accl_view, float *A,
              (M < 1800 && N < 600 && K < 10) ||
              (M > 1800 && M < 6000 && K > 1800 && K < 6000 && N < 300 &&
               M == K)) {
+    hcblasTraceKernel("gemm_NoTransA_rMajor_batch_MICRO_NBK_TS16XMTS2");
     return gemm_NoTransA_rMajor_batch_MICRO_NBK_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2149,10 +1900,12 @@ hcblasStatus gemm_NoTransA_rMajor(hc::accelerator_view accl_view, float *A,
              (M < 1800 && N < 100 && K < 1800) ||
              (M > 600 && M < 6000 && K > 1800 && K < 10000 && N < 300 &&
               M < K)) {
+    hcblasTraceKernel("gemm_NoTransA_rMajor_batch_MICRO_TS16XMTS2");
     return gemm_NoTransA_rMajor_batch_MICRO_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else {
+    hcblasTraceKernel("gemm_NoTransA_rMajor_batch_MICRO_NBK_TS16XMTS2");
     return gemm_NoTransA_rMajor_batch_MICRO_NBK_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2168,34 +1921,41 @@ hcblasStatus gemm_NoTransB_rMajor(hc::accelerator_view accl_view, float *A,
                                   int ldc, float alpha, float beta,
                                   int batchSize) {
   if (M > 10000 && N < 500) {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_largeM");
     return gemm_NoTransB_rMajor_batch_largeM(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if (M > 1800 && M < 6000 && N > 600 && N < 1800 && K < 600) {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_MICRO_NBK_TS16XMTS2");
     return gemm_NoTransB_rMajor_batch_MICRO_NBK_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if (M > 600 && M < 1800 && N < 600 && K < 10) {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_STEP_TS8XSS8");
     return gemm_NoTransB_rMajor_batch_STEP_TS8XSS8(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if (M > 1800 && M < 6000 && N > 1800 && N < 6000 && K < 10) {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_MICRO_TS16XMTS2");
     return gemm_NoTransB_rMajor_batch_MICRO_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if ((M < 600 && N < 600 && K < 6000) ||
              (M > 1800 && M < 6000 && K < 1800 && N < 10) ||
              (M < 10 && N < 1800 && K > 1800 && K < 6000)) {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_STEP_TS16XSS16");
     return gemm_NoTransB_rMajor_batch_STEP_TS16XSS16(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if ((M < 1800 && K < 600 && N < 10) ||
              (M < 10 && N < 600 && K < 1800) ||
              (M < 600 && N < 1800 && K < 10)) {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_STEP_NBK_TS16XSS16");
     return gemm_NoTransB_rMajor_batch_STEP_NBK_TS16XSS16(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else {
+    hcblasTraceKernel("gemm_NoTransB_rMajor_batch_MICRO_TS16XMTS2");
     return gemm_NoTransB_rMajor_batch_MICRO_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2210,21 +1970,25 @@ hcblasStatus gemm_TransAB_rMajor(hc::accelerator_view accl_view, float *A,
                                  int M, int N, int K, int lda, int ldb, int ldc,
                                  float alpha, float beta, int batchSize) {
   if (M > 10000 && N < 500) {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_largeM");
     return gemm_TransAB_rMajor_batch_largeM(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if (M > 600 && M < 1800 && N < 200 && K > 600 && K < 1800) {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_MICRO_TS16XMTS2");
     return gemm_TransAB_rMajor_batch_MICRO_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if (((M > 600 && M < 1800 && N < 600) || (M < 50 && N < 1800)) &&
              (K < 10)) {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_STEP_TS8XSS8");
     return gemm_TransAB_rMajor_batch_STEP_TS8XSS8(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if ((M < 600 && N < 600 && K < 6000) ||
              (M > 1800 && M < 10000 && K > 600 && K < 10000 && N < 10) ||
              (M < 10 && N > 600 && N < 1800 && K < 6000)) {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_STEP_NBK_TS16XSS16");
     return gemm_TransAB_rMajor_batch_STEP_NBK_TS16XSS16(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -2233,14 +1997,17 @@ hcblasStatus gemm_TransAB_rMajor(hc::accelerator_view accl_view, float *A,
               N < 200) ||
              (M < 10000 && N < 1800 && K < 10) ||
              (M > 1800 && M < 6000 && N < 600 && K < 200)) {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_MICRO_NBK_TS16XMTS2");
     return gemm_TransAB_rMajor_batch_MICRO_NBK_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else if (M > 6000 && M < 10000 && N < 600 && K < 10) {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_STEP_TS8XSS8");
     return gemm_TransAB_rMajor_batch_STEP_TS8XSS8(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
   } else {
+    hcblasTraceKernel("gemm_TransAB_rMajor_batch_MICRO_NBK_TS16XMTS2");
     return gemm_TransAB_rMajor_batch_MICRO_NBK_TS16XMTS2(
         accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
         cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
@@ -22,57 +22,6 @@ THE SOFTWARE.
 
 #include "./sgemm_array_kernels.h"
 
-// Sgemm Wrapper routine that invokes the appropriate kernel routines depending
-// on the input dimension M N and K
-hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
-                     char TransA, char TransB, const int M, const int N,
-                     const int K, const float alpha, float *A_mat,
-                     __int64_t aOffset, __int64_t lda, float *B_mat,
-                     __int64_t bOffset, __int64_t ldb, const float beta,
-                     float *C_mat, __int64_t cOffset, __int64_t ldc) {
-  hcblasStatus status = HCBLAS_SUCCEEDS;
-  // Start the operations
-
-  if (order) {
-    if (TransB == 'n') {
-      if (TransA == 'n') {
-        status =
-            gemm_NoTransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                           cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-      } else {
-        status = gemm_NoTransB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                               cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-      }
-    } else if (TransA == 'n') {
-      status = gemm_NoTransA(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                             cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    } else {
-      status = gemm_TransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                            cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    }
-  } else {
-    if (TransB == 'n') {
-      if (TransA == 'n') {
-        status = gemm_NoTransAB_rMajor(accl_view, A_mat, aOffset, B_mat,
-                                       bOffset, C_mat, cOffset, M, N, K, lda,
-                                       ldb, ldc, alpha, beta);
-      } else {
-        status = gemm_NoTransB_rMajor(accl_view, A_mat, aOffset, B_mat, bOffset,
-                                      C_mat, cOffset, M, N, K, lda, ldb, ldc,
-                                      alpha, beta);
-      }
-    } else if (TransA == 'n') {
-      status =
-          gemm_NoTransA_rMajor(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                               cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    } else {
-      status =
-          gemm_TransAB_rMajor(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                              cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    }
-  }
-  return status;
-}
 hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
                      char TransA, char TransB, const int M, const int N,
                      const int K, const float alpha, float *A_mat[],
@@ -154,11 +103,11 @@ hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
 }
 // Type 1 -  alpha = 0 Kernel
 
-hcblasStatus gemm_alpha0_col(hc::accelerator_view accl_view, float *A,
-                             __int64_t aOffset, float *B, __int64_t bOffset,
-                             float *C, __int64_t cOffset, int M, int N, int K,
-                             int lda, int ldb, int ldc, float alpha,
-                             float beta) {
+hcblasStatus gemm_alpha0_col(hc::accelerator_view accl_view, const float *A,
+                             __int64_t aOffset, const float *B,
+                             __int64_t bOffset, float *C, __int64_t cOffset,
+                             int M, int N, int K, int lda, int ldb, int ldc,
+                             float alpha, float beta) {
 #define GEMM_BLOCK 256
   hc::extent<2> grdExt(N, M * GEMM_BLOCK);
   hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
@@ -224,11 +173,11 @@ hcblasStatus gemm_alpha0_col_batch(hc::accelerator_view accl_view, float *A,
 
 // Type 1 -  alpha = 0 Kernel
 
-hcblasStatus gemm_alpha0_row(hc::accelerator_view accl_view, float *A,
-                             __int64_t aOffset, float *B, __int64_t bOffset,
-                             float *C, __int64_t cOffset, int M, int N, int K,
-                             int lda, int ldb, int ldc, float alpha,
-                             float beta) {
+hcblasStatus gemm_alpha0_row(hc::accelerator_view accl_view, const float *A,
+                             __int64_t aOffset, const float *B,
+                             __int64_t bOffset, float *C, __int64_t cOffset,
+                             int M, int N, int K, int lda, int ldb, int ldc,
+                             float alpha, float beta) {
 #define GEMM_BLOCK 256
   hc::extent<2> grdExt(N, M * GEMM_BLOCK);
   hc::tiled_extent<2> t_ext = grdExt.tile(1, GEMM_BLOCK);
@@ -292,6 +241,78 @@ hcblasStatus gemm_alpha0_row_batch(hc::accelerator_view accl_view, float *A,
   return HCBLAS_SUCCEEDS;
 }
 
+// Sgemm kernel selection: picks the tuned kernel for the input dimension
+// M N and K
+sgemm_kernel gemm_select(const hcblasDeviceProps &props, int order,
+                         char TransA, char TransB, int M, int N, int K,
+                         float alpha, unsigned alignment) {
+  // For alpha = 0
+  if (alpha == 0) {
+    return order ? gemm_alpha0_col : gemm_alpha0_row;
+  }
+
+  // Few output tiles and a long K: split K across work groups
+  sgemm_kernel splitK = gemm_splitK_select(props, order, TransA, TransB, M,
+                                           N, K);
+  if (splitK) {
+    return splitK;
+  }
+
+  if (order) {
+    if (TransB == 'n') {
+      if (TransA == 'n') {
+        return gemm_vector_select(gemm_NoTransAB_select(M, N, K), alignment);
+      } else {
+        return gemm_NoTransB_select(M, N, K);
+      }
+    } else if (TransA == 'n') {
+      return gemm_NoTransA_select(M, N, K);
+    } else {
+      return gemm_TransAB_select(M, N, K);
+    }
+  } else {
+    if (TransB == 'n') {
+      if (TransA == 'n') {
+        return gemm_NoTransAB_rMajor_select(M, N, K);
+      } else {
+        return gemm_NoTransB_rMajor_select(M, N, K);
+      }
+    } else if (TransA == 'n') {
+      return gemm_NoTransA_rMajor_select(M, N, K);
+    } else {
+      return gemm_TransAB_rMajor_select(M, N, K);
+    }
+  }
+}
+
+const char *gemm_kernel_name(sgemm_kernel kernel) {
+  if (kernel == gemm_alpha0_col) {
+    return "gemm_alpha0_col";
+  } else if (kernel == gemm_alpha0_row) {
+    return "gemm_alpha0_row";
+  }
+  const char *name = gemm_colMajor_kernel_name(kernel);
+  return name ? name : gemm_rMajor_kernel_name(kernel);
+}
+
+// Replays a captured sgemm step. hcblasPlanRebind may have moved the
+// operands, so the vector variant is only kept if they still allow it.
+static hcblasStatus gemm_plan_launch(hc::accelerator_view accl_view,
+                                     const hcblasPlanStep &step) {
+  sgemm_kernel kernel = gemm_vector_select(
+      reinterpret_cast<sgemm_kernel>(step.kernel),
+      hcblasGemmAlignment(step.operand[0], step.offset[0], step.dim[3],
+                          step.operand[1], step.offset[1], step.dim[4],
+                          step.operand[2], step.offset[2], step.dim[5],
+                          sizeof(float)));
+  return kernel(accl_view, static_cast<const float *>(step.operand[0]),
+                step.offset[0], static_cast<const float *>(step.operand[1]),
+                step.offset[1], static_cast<float *>(step.operand[2]),
+                step.offset[2], step.dim[0], step.dim[1], step.dim[2],
+                step.dim[3], step.dim[4], step.dim[5], step.scalar[0],
+                step.scalar[1]);
+}
+
 // Sgemm Call Type I: Inputs and outputs are HCC device pointers
 hcblasStatus Hcblaslibrary::hcblas_sgemm(
     hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
@@ -299,29 +320,54 @@ hcblasStatus Hcblaslibrary::hcblas_sgemm(
     const float &alpha, float *A, const __int64_t lda, float *B,
     const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
     const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
-  int i, j;
-  float temp;
-  hcblasStatus status = HCBLAS_SUCCEEDS;
+  return hcblas_sgemm_capture(NULL, accl_view, order, typeA, typeB, M, N, K,
+                              alpha, A, lda, B, ldb, beta, C, ldc, aOffset,
+                              bOffset, cOffset);
+}
 
+// Sgemm Call Type I, recorded in plan when it is not NULL
+hcblasStatus Hcblaslibrary::hcblas_sgemm_capture(
+    hcblasPlan *plan, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int M, const int N,
+    const int K, const float &alpha, float *A, const __int64_t lda, float *B,
+    const __int64_t ldb, const float &beta, float *C, const __int64_t ldc,
+    const __int64_t aOffset, const __int64_t bOffset, const __int64_t cOffset) {
   // Quick return if possible
   if (A == NULL || B == NULL || C == NULL || !M || !N || !K) {
     return HCBLAS_INVALID;
   }
 
-  // For alpha = 0
-  if (alpha == 0) {
-    if (order) {
-      status = gemm_alpha0_col(accl_view, A, aOffset, B, bOffset, C, cOffset, M,
-                               N, K, lda, ldb, ldc, alpha, beta);
-    } else {
-      status = gemm_alpha0_row(accl_view, A, aOffset, B, bOffset, C, cOffset, M,
-                               N, K, lda, ldb, ldc, alpha, beta);
-    }
-    return status;
+  // Repeated shapes reuse the kernel the selectors picked the first time
+  hc::accelerator accl = accl_view.get_accelerator();
+  unsigned alignment = hcblasGemmAlignment(A, aOffset, lda, B, bOffset, ldb,
+                                           C, cOffset, ldc, sizeof(float));
+  hcblasDecisionKey key =
+      hcblasGemmKey(FloatType, accl.get_seqnum(), order, typeA, typeB,
+                    alpha == 0, M, N, K, lda, ldb, ldc, alignment);
+  hcblasPlanKernel decision;
+  sgemm_kernel kernel;
+  if (gemmDecisions.find(key, &decision)) {
+    kernel = reinterpret_cast<sgemm_kernel>(decision);
+  } else {
+    kernel = gemm_select(deviceProperties(accl), order, typeA, typeB, M, N, K,
+                         alpha, alignment);
+    gemmDecisions.insert(key, reinterpret_cast<hcblasPlanKernel>(kernel));
   }
-  status = gemm_HC(accl_view, order, typeA, typeB, M, N, K, alpha, A, aOffset,
-                   lda, B, bOffset, ldb, beta, C, cOffset, ldc);
-  return status;
+  if (hcblasTraceLevel() > 0 && gemm_kernel_name(kernel)) {
+    hcblasTraceKernel("%s", gemm_kernel_name(kernel));
+  }
+  if (plan != NULL) {
+    hcblasPlanStep step = {gemm_plan_launch,
+                           reinterpret_cast<hcblasPlanKernel>(kernel),
+                           {A, B, C},
+                           {aOffset, bOffset, cOffset},
+                           {M, N, K, lda, ldb, ldc},
+                           {alpha, beta}};
+    plan->steps.push_back(step);
+    return HCBLAS_SUCCEEDS;
+  }
+  return kernel(accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda,
+                ldb, ldc, alpha, beta);
 }
 
 /* SGEMM- Overloaded function with arguments related to batch processing */
@@ -357,6 +403,26 @@ hcblasStatus Hcblaslibrary::hcblas_sgemm(
       return status;
     }*/
 
+  // Tiny matrices: many batch elements per work group
+  if (batchSize > 0) {
+    sgemm_tiny_kernel tiny = order ? gemm_tiny_batch_select(M, N, K)
+                                   : gemm_tiny_batch_select(N, M, K);
+    hcblasDeviceProps props = deviceProperties(accl_view.get_accelerator());
+    if (tiny && order) {
+      return tiny(accl_view, props, typeA == Trans, typeB == Trans, A, aOffset,
+                  A_batchOffset, B, bOffset, B_batchOffset, C, cOffset,
+                  C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta,
+                  batchSize);
+    }
+    if (tiny) {
+      // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+      return tiny(accl_view, props, typeB == Trans, typeA == Trans, B, bOffset,
+                  B_batchOffset, A, aOffset, A_batchOffset, C, cOffset,
+                  C_batchOffset, N, M, K, ldb, lda, ldc, alpha, beta,
+                  batchSize);
+    }
+  }
+
   status = gemm_HC(accl_view, order, typeA, typeB, M, N, K, alpha, A, aOffset,
                    lda, B, bOffset, ldb, beta, C, cOffset, ldc, A_batchOffset,
                    B_batchOffset, C_batchOffset, batchSize);
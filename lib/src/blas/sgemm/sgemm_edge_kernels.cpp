@@ -0,0 +1,124 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "./sgemm_array_kernels.h"
+#include "include/hcblas_edge.h"
+
+// Ragged shapes for the M128_N128_K16 Mini_Batch kernels. Those kernels
+// read and write whole 64x64 (TS16XMTS2) or 128x128 (TS16XMTS4) tiles of C
+// in 16 deep K steps with no bounds checks, so on their own they only take
+// exact multiples. Here the tile aligned interior goes to them and the
+// remainder blocks of hcblasEdgeBlocks to whatever kernel the selector
+// picks for their shape, all on the same in order view.
+
+#define EDGE_KUNIT 16
+
+static sgemm_kernel edge_interior_kernel(bool transA, bool transB,
+                                         int MTILE) {
+  if (!transA && !transB) {
+    if (MTILE == 2) {
+      return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2;
+    }
+    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2;
+  } else if (!transA) {
+    if (MTILE == 2) {
+      return gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2;
+    }
+    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2;
+  }
+  if (MTILE == 2) {
+    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2;
+  }
+  return gemm_NoTransB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2;
+}
+
+// Column major; op(A)(i, k) and op(B)(k, j) are strided by the leading
+// dimension in k and j unless transposed
+template <bool transA, bool transB, int MTILE>
+static hcblasStatus gemm_edge_M128_N128_K16_MB2(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
+  hcblasEdgeSplit split =
+      hcblasEdgePartition(M, N, K, 32 * MTILE, EDGE_KUNIT);
+  hcblasEdgeBlock blocks[HCBLAS_EDGE_MAX_BLOCKS];
+  int count = hcblasEdgeBlocks(M, N, K, split, blocks);
+  hcblasTraceKernel("gemm_edge_M128_N128_K16_TS16XMTS%d_MB2<%d,%d>(%dx%dx%d)",
+                    MTILE, transA, transB, split.M0, split.N0, split.K0);
+  for (int b = 0; b < count; b++) {
+    const hcblasEdgeBlock &block = blocks[b];
+    sgemm_kernel kernel;
+    if (b == 0) {
+      // The interior starts where the operands do, so aligns as they do
+      kernel = gemm_vector_select(
+          edge_interior_kernel(transA, transB, MTILE),
+          hcblasGemmAlignment(A, aOffset, lda, B, bOffset, ldb, C, cOffset,
+                              ldc, sizeof(float)));
+    } else if (!transA && !transB) {
+      kernel = gemm_NoTransAB_select(block.rows, block.cols, block.depth);
+    } else if (!transA) {
+      kernel = gemm_NoTransA_select(block.rows, block.cols, block.depth);
+    } else {
+      kernel = gemm_NoTransB_select(block.rows, block.cols, block.depth);
+    }
+    __int64_t aBlock =
+        transA ? block.k + static_cast<__int64_t>(block.row) * lda
+               : block.row + static_cast<__int64_t>(block.k) * lda;
+    __int64_t bBlock =
+        transB ? block.col + static_cast<__int64_t>(block.k) * ldb
+               : block.k + static_cast<__int64_t>(block.col) * ldb;
+    __int64_t cBlock = block.row + static_cast<__int64_t>(block.col) * ldc;
+    hcblasStatus status =
+        kernel(accl_view, A, aOffset + aBlock, B, bOffset + bBlock, C,
+               cOffset + cBlock, block.rows, block.cols, block.depth, lda, ldb,
+               ldc, alpha, block.accumulate ? 1.0f : beta);
+    if (status != HCBLAS_SUCCEEDS) {
+      return status;
+    }
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+sgemm_kernel gemm_edge_select(bool transA, bool transB, int MTILE, int M,
+                              int N, int K) {
+  if (transA && transB) {
+    return NULL;
+  }
+  hcblasEdgeSplit split = hcblasEdgePartition(M, N, K, 32 * MTILE, EDGE_KUNIT);
+  if (split.M0 == 0) {
+    return NULL;
+  }
+  if (MTILE == 2) {
+    if (!transA) {
+      return transB ? gemm_edge_M128_N128_K16_MB2<false, true, 2>
+                    : gemm_edge_M128_N128_K16_MB2<false, false, 2>;
+    }
+    return gemm_edge_M128_N128_K16_MB2<true, false, 2>;
+  }
+  if (!transA) {
+    return transB ? gemm_edge_M128_N128_K16_MB2<false, true, 4>
+                  : gemm_edge_M128_N128_K16_MB2<false, false, 4>;
+  }
+  return gemm_edge_M128_N128_K16_MB2<true, false, 4>;
+}
@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas_edge.h"
+
+hcblasEdgeSplit hcblasEdgePartition(int M, int N, int K, int tile,
+                                    int kUnit) {
+  hcblasEdgeSplit none = {0, 0, 0};
+  if (M <= 0 || N <= 0 || K <= 0 || tile <= 0 || kUnit <= 0) {
+    return none;
+  }
+
+  hcblasEdgeSplit split = {M / tile * tile, N / tile * tile,
+                           K / kUnit * kUnit};
+  if (split.M0 < HCBLAS_EDGE_MIN_TILES * tile ||
+      split.N0 < HCBLAS_EDGE_MIN_TILES * tile || split.K0 == 0) {
+    return none;
+  }
+  double interior = static_cast<double>(split.M0) * split.N0 * split.K0;
+  double total = static_cast<double>(M) * N * K;
+  if (interior * 100 < total * HCBLAS_EDGE_MIN_INTERIOR) {
+    return none;
+  }
+  return split;
+}
+
+int hcblasEdgeBlocks(int M, int N, int K, hcblasEdgeSplit split,
+                     hcblasEdgeBlock blocks[HCBLAS_EDGE_MAX_BLOCKS]) {
+  int count = 0;
+  hcblasEdgeBlock interior = {0, 0, 0, split.M0, split.N0, split.K0, false};
+  blocks[count++] = interior;
+  // The K tail adds onto the interior, so it must run after it
+  if (split.K0 < K) {
+    hcblasEdgeBlock tail = {0,        0,           split.K0, split.M0,
+                            split.N0, K - split.K0, true};
+    blocks[count++] = tail;
+  }
+  if (split.M0 < M) {
+    hcblasEdgeBlock rows = {split.M0, 0, 0, M - split.M0, N, K, false};
+    blocks[count++] = rows;
+  }
+  if (split.N0 < N) {
+    hcblasEdgeBlock cols = {0, split.N0, 0, split.M0, N - split.N0, K, false};
+    blocks[count++] = cols;
+  }
+  return count;
+}
@@ -0,0 +1,283 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./sgemm_array_kernels.h"
+#include "include/hcblas_splitk.h"
+#include <hc_am.hpp>
+#include <atomic>
+
+// Split-K SGEMM for shapes whose C has too few 32x32 tiles to occupy the
+// device, e.g. M = N = 64 with a very long K. Pass one gives every (tile,
+// K chunk) pair its own work group and writes the partial product to a
+// workspace; pass two sums the partials of each element in chunk order and
+// applies alpha and beta, so results are reproducible run to run.
+
+#define SPLITK_TILESIZE 16
+#define SPLITK_MICROTILESIZE 2
+#define SPLITK_BLOCKSIZE (SPLITK_TILESIZE * SPLITK_MICROTILESIZE)
+#define SPLITK_BANKSIZE (SPLITK_BLOCKSIZE + 1)
+#define SPLITK_MIN_CHUNK 256
+#define SPLITK_POOL_SIZE 4
+#define SPLITK_POOL_DEVICES 64
+
+// Workspace buffers are kept after use and handed to later calls on the
+// same accelerator, so a run of split-K calls allocates once. A buffer is
+// parked with a marker queued after the last pass that used it; it can be
+// taken again at once on the same view, whose queue runs in order, and on
+// any other view of the accelerator once the marker is ready. Nothing
+// waits on the host unless every slot of a device holds a busy buffer.
+struct splitk_buffer {
+  hc::accelerator_view view;
+  hc::completion_future done;
+  float *ptr;
+  size_t count;
+};
+
+// Slots are claimed by swapping them to NULL, so a thread only reads a
+// buffer it owns and the pool needs no lock
+static std::atomic<splitk_buffer *>
+    splitk_pool[SPLITK_POOL_DEVICES][SPLITK_POOL_SIZE];
+
+static std::atomic<splitk_buffer *> *splitk_slots(
+    const hc::accelerator &accl) {
+  return splitk_pool[accl.get_seqnum() % SPLITK_POOL_DEVICES];
+}
+
+static void splitk_free(splitk_buffer *buffer) {
+  hc::am_free(buffer->ptr);
+  delete buffer;
+}
+
+// Puts buffer in an empty slot; false if there is none
+static bool splitk_park(std::atomic<splitk_buffer *> *slots,
+                        splitk_buffer *buffer) {
+  for (int i = 0; i < SPLITK_POOL_SIZE; i++) {
+    splitk_buffer *empty = NULL;
+    if (slots[i].compare_exchange_strong(empty, buffer,
+                                         std::memory_order_acq_rel)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Parks buffer, making room by freeing parked buffers that are idle. Only
+// when all of them are still in use does it wait for buffer itself.
+static void splitk_retire(std::atomic<splitk_buffer *> *slots,
+                          splitk_buffer *buffer) {
+  if (splitk_park(slots, buffer)) return;
+  for (int i = 0; i < SPLITK_POOL_SIZE; i++) {
+    splitk_buffer *parked = slots[i].exchange(NULL, std::memory_order_acq_rel);
+    if (parked == NULL) continue;
+    if (parked->done.is_ready()) {
+      splitk_free(parked);
+      if (splitk_park(slots, buffer)) return;
+    } else if (!splitk_park(slots, parked)) {
+      parked->done.wait();
+      splitk_free(parked);
+    }
+  }
+  buffer->done.wait();
+  splitk_free(buffer);
+}
+
+static float *splitk_acquire(const hc::accelerator_view &view,
+                             size_t count) {
+  hc::accelerator accl = view.get_accelerator();
+  std::atomic<splitk_buffer *> *slots = splitk_slots(accl);
+  for (int i = 0; i < SPLITK_POOL_SIZE; i++) {
+    if (slots[i].load(std::memory_order_relaxed) == NULL) continue;
+    splitk_buffer *buffer = slots[i].exchange(NULL, std::memory_order_acq_rel);
+    if (buffer == NULL) continue;
+    bool idle = buffer->view == view || buffer->done.is_ready();
+    if (idle && buffer->count >= count &&
+        buffer->view.get_accelerator() == accl) {
+      float *ptr = buffer->ptr;
+      delete buffer;
+      return ptr;
+    }
+    splitk_retire(slots, buffer);
+  }
+  return (float *)hc::am_alloc(sizeof(float) * count, accl, 0);
+}
+
+static void splitk_release(hc::accelerator_view &view, float *ptr,
+                           size_t count) {
+  splitk_buffer *buffer =
+      new splitk_buffer{view, view.create_marker(), ptr, count};
+  splitk_retire(splitk_slots(view.get_accelerator()), buffer);
+}
+
+// K is split until the pass one work groups can fill every compute unit
+static hcblasSplitK splitk_partition(const hcblasDeviceProps &props, int M,
+                                     int N, int K) {
+  hcblasKernelResources kernel = {
+      SPLITK_TILESIZE * SPLITK_TILESIZE,
+      2 * sizeof(float) * SPLITK_TILESIZE * SPLITK_BANKSIZE, 0};
+  long long target = hcblasResidentGroups(props, kernel);
+  return hcblasSplitKPartition(M, N, K, SPLITK_BLOCKSIZE, SPLITK_BLOCKSIZE,
+                               SPLITK_TILESIZE, SPLITK_MIN_CHUNK,
+                               static_cast<int>(target));
+}
+
+// op(A)(i, k) is contiguous in i exactly when the storage order and the
+// transpose flag agree; likewise op(B)(k, j) is contiguous in k
+template <bool rowMajor, bool transA, bool transB>
+static hcblasStatus gemm_splitK_MICRO_TS16XMTS2(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
+  hc::accelerator accl = accl_view.get_accelerator();
+  hcblasSplitK partition =
+      splitk_partition(hcblasDeviceProperties(accl), M, N, K);
+  int splits = partition.splits;
+  int kChunk = partition.kChunk;
+  hcblasTraceKernel("gemm_splitK_MICRO_TS16XMTS2<%d,%d,%d>(splits=%d)",
+                    rowMajor, transA, transB, splits);
+  size_t count = static_cast<size_t>(splits) * M * N;
+  float *work = splitk_acquire(accl_view, count);
+  if (work == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  int tilesM = (M + SPLITK_BLOCKSIZE - 1) / SPLITK_BLOCKSIZE;
+  int tilesN = (N + SPLITK_BLOCKSIZE - 1) / SPLITK_BLOCKSIZE;
+  hc::extent<3> grdExt(splits, tilesN * SPLITK_TILESIZE,
+                       tilesM * SPLITK_TILESIZE);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, SPLITK_TILESIZE,
+                                          SPLITK_TILESIZE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    tile_static float lA[SPLITK_TILESIZE * SPLITK_BANKSIZE];
+    tile_static float lB[SPLITK_TILESIZE * SPLITK_BANKSIZE];
+    int split = tidx.tile[0];
+    int idx = tidx.local[2];
+    int idy = tidx.local[1];
+    int idt = idy * SPLITK_TILESIZE + idx;
+    int row0 = tidx.tile[2] * SPLITK_BLOCKSIZE;
+    int col0 = tidx.tile[1] * SPLITK_BLOCKSIZE;
+    int kBegin = split * kChunk;
+    int kEnd = (kBegin + kChunk < K) ? kBegin + kChunk : K;
+    float rC[SPLITK_MICROTILESIZE][SPLITK_MICROTILESIZE] = {{0}};
+
+    for (int kb = kBegin; kb < kEnd; kb += SPLITK_TILESIZE) {
+      for (int l = 0; l < SPLITK_MICROTILESIZE; l++) {
+        int e = idt + l * SPLITK_TILESIZE * SPLITK_TILESIZE;
+        int m = e % SPLITK_BLOCKSIZE;
+        int k = e / SPLITK_BLOCKSIZE;
+        int gm = row0 + m;
+        int gk = kb + k;
+        float a = 0;
+        if (gm < M && gk < kEnd) {
+          a = (rowMajor != transA)
+                  ? A[aOffset + static_cast<__int64_t>(gm) * lda + gk]
+                  : A[aOffset + static_cast<__int64_t>(gk) * lda + gm];
+        }
+        lA[k * SPLITK_BANKSIZE + m] = a;
+
+        k = e % SPLITK_TILESIZE;
+        int n = e / SPLITK_TILESIZE;
+        int gn = col0 + n;
+        gk = kb + k;
+        float b = 0;
+        if (gn < N && gk < kEnd) {
+          b = (rowMajor != transB)
+                  ? B[bOffset + static_cast<__int64_t>(gk) * ldb + gn]
+                  : B[bOffset + static_cast<__int64_t>(gn) * ldb + gk];
+        }
+        lB[k * SPLITK_BANKSIZE + n] = b;
+      }
+      tidx.barrier.wait();
+
+      for (int k = 0; k < SPLITK_TILESIZE; k++) {
+        for (int i = 0; i < SPLITK_MICROTILESIZE; i++) {
+          float a = lA[k * SPLITK_BANKSIZE + idx + i * SPLITK_TILESIZE];
+          for (int j = 0; j < SPLITK_MICROTILESIZE; j++) {
+            rC[i][j] += a * lB[k * SPLITK_BANKSIZE + idy + j * SPLITK_TILESIZE];
+          }
+        }
+      }
+      tidx.barrier.wait();
+    }
+
+    // Partials are stored column major, one M x N slab per chunk
+    float *slab = work + static_cast<__int64_t>(split) * M * N;
+    for (int j = 0; j < SPLITK_MICROTILESIZE; j++) {
+      int gn = col0 + idy + j * SPLITK_TILESIZE;
+      for (int i = 0; i < SPLITK_MICROTILESIZE; i++) {
+        int gm = row0 + idx + i * SPLITK_TILESIZE;
+        if (gm < M && gn < N) {
+          slab[static_cast<__int64_t>(gn) * M + gm] = rC[i][j];
+        }
+      }
+    }
+  });
+
+  __int64_t elements = static_cast<__int64_t>(M) * N;
+  hc::extent<1> sumExt((elements + 255) & ~255);
+  hc::parallel_for_each(accl_view, sumExt.tile(256),
+                        [=](hc::tiled_index<1> tidx)[[hc]] {
+    __int64_t e = tidx.global[0];
+    if (e < elements) {
+      int gm = static_cast<int>(e % M);
+      int gn = static_cast<int>(e / M);
+      float sum = 0;
+      for (int s = 0; s < splits; s++) {
+        sum += work[s * elements + e];
+      }
+      __int64_t C_index =
+          cOffset + (rowMajor ? static_cast<__int64_t>(gm) * ldc + gn
+                              : static_cast<__int64_t>(gn) * ldc + gm);
+      // C is not read when beta is zero, so it may hold NaN on entry
+      C[C_index] = (beta == 0) ? alpha * sum
+                               : alpha * sum + beta * C[C_index];
+    }
+  });
+
+  // The pool hands the workspace out again once both passes are done
+  splitk_release(accl_view, work, count);
+  return HCBLAS_SUCCEEDS;
+}
+
+sgemm_kernel gemm_splitK_select(const hcblasDeviceProps &props, int order,
+                                char TransA, char TransB, int M, int N,
+                                int K) {
+  if (splitk_partition(props, M, N, K).splits <= 1) {
+    return NULL;
+  }
+  bool transA = TransA != 'n';
+  bool transB = TransB != 'n';
+  if (order) {
+    if (!transA) {
+      return transB ? gemm_splitK_MICRO_TS16XMTS2<false, false, true>
+                    : gemm_splitK_MICRO_TS16XMTS2<false, false, false>;
+    }
+    return transB ? gemm_splitK_MICRO_TS16XMTS2<false, true, true>
+                  : gemm_splitK_MICRO_TS16XMTS2<false, true, false>;
+  }
+  if (!transA) {
+    return transB ? gemm_splitK_MICRO_TS16XMTS2<true, false, true>
+                  : gemm_splitK_MICRO_TS16XMTS2<true, false, false>;
+  }
+  return transB ? gemm_splitK_MICRO_TS16XMTS2<true, true, true>
+                : gemm_splitK_MICRO_TS16XMTS2<true, true, false>;
+}
@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_splitk.h"
+#include <algorithm>
+
+hcblasSplitK hcblasSplitKPartition(int M, int N, int K, int tileM, int tileN,
+                                   int kUnit, int minChunk,
+                                   int targetGroups) {
+  hcblasSplitK none = {1, K};
+  if (M <= 0 || N <= 0 || K <= 0 || tileM <= 0 || tileN <= 0 || kUnit <= 0) {
+    return none;
+  }
+
+  long long tiles = static_cast<long long>((M + tileM - 1) / tileM) *
+                    ((N + tileN - 1) / tileN);
+  if (tiles >= targetGroups) {
+    return none;
+  }
+
+  // Enough chunks to fill the device, but none shorter than minChunk and
+  // no more partial products than the workspace bound allows
+  long long splits = (targetGroups + tiles - 1) / tiles;
+  splits = std::min(splits, static_cast<long long>(K / std::max(minChunk, 1)));
+  splits = std::min(splits, static_cast<long long>(HCBLAS_SPLITK_MAX_SPLITS));
+  splits = std::min(splits, HCBLAS_SPLITK_MAX_WORKSPACE /
+                                (static_cast<long long>(M) * N));
+  if (splits <= 1) {
+    return none;
+  }
+
+  // Round the chunk up to whole kUnit steps, then drop chunks left empty
+  long long chunk = (K + splits - 1) / splits;
+  chunk = (chunk + kUnit - 1) / kUnit * kUnit;
+  splits = (K + chunk - 1) / chunk;
+  if (splits <= 1) {
+    return none;
+  }
+
+  hcblasSplitK partition = {static_cast<int>(splits),
+                            static_cast<int>(chunk)};
+  return partition;
+}
@@ -0,0 +1,141 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./sgemm_array_kernels.h"
+
+// Batched SGEMM for matrices no larger than SGEMM_TINY_MAX in any dimension.
+// The tuned batch kernels give every batch element at least one 8x8 or 16x16
+// work group, which leaves most work items idle on 3x3 to 16x16 products.
+// Here the sizes are compile time bounds: each batch element is owned by TN
+// work items, one per column of C, and a work group packs as many elements
+// as fit. op(A) of an element is staged once in shared memory; the column
+// of op(B) and the column of C a work item works on stay in registers.
+
+// Elements per work group: at most 256 work items and 16KB of staged A
+#define SGEMM_TINY_ELEMENTS(TM, TN, TK)                       \
+  ((256 / (TN)) < (4096 / ((TM) * (TK))) ? (256 / (TN))       \
+                                         : (4096 / ((TM) * (TK))))
+
+template <int TM, int TN, int TK>
+static hcblasStatus gemm_tiny_batch(
+    hc::accelerator_view accl_view, const hcblasDeviceProps &props,
+    bool transA, bool transB, float *A[], __int64_t aOffset,
+    __int64_t A_batchOffset, float *B[], __int64_t bOffset,
+    __int64_t B_batchOffset, float *C[], __int64_t cOffset,
+    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
+    float alpha, float beta, int batchSize) {
+  const int elements = SGEMM_TINY_ELEMENTS(TM, TN, TK);
+  const int groupSize = elements * TN;
+  hcblasTraceKernel("gemm_tiny_batch<%d,%d,%d>", TM, TN, TK);
+  // Units of elements batch elements; each work group takes every groups-th
+  int units = (batchSize + elements - 1) / elements;
+  hcblasKernelResources kernel = {groupSize,
+                                  sizeof(float) * elements * TM * TK, 0};
+  int groups = hcblasGridGroups(props, kernel, units, 1);
+  hc::extent<1> grdExt(groups * groupSize);
+  hc::tiled_extent<1> t_ext = grdExt.tile(groupSize);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<1> tidx)[[hc]] {
+    tile_static float lA[elements * TM * TK];
+    int e = tidx.local[0] / TN;
+    int j = tidx.local[0] % TN;
+    float *sA = lA + e * TM * TK;
+
+    for (int unit = tidx.tile[0]; unit < units; unit += groups) {
+      int elt = unit * elements + e;
+
+      // The TN work items of an element stage op(A) column by column
+      if (elt < batchSize) {
+        const float *A_mat = A[elt] + aOffset + A_batchOffset;
+        for (int t = j; t < M * K; t += TN) {
+          int i = t % M;
+          int k = t / M;
+          sA[k * TM + i] = transA ? A_mat[i * lda + k] : A_mat[k * lda + i];
+        }
+      }
+      tidx.barrier.wait();
+
+      if (elt < batchSize && j < N) {
+        const float *B_mat = B[elt] + bOffset + B_batchOffset;
+        float *C_mat = C[elt] + cOffset + C_batchOffset;
+        float rB[TK];
+        float rC[TM];
+        for (int k = 0; k < TK; k++) {
+          rB[k] = 0;
+          if (k < K) {
+            rB[k] = transB ? B_mat[k * ldb + j] : B_mat[j * ldb + k];
+          }
+        }
+        for (int i = 0; i < TM; i++) {
+          rC[i] = 0;
+        }
+        for (int k = 0; k < TK; k++) {
+          if (k < K) {
+            for (int i = 0; i < TM; i++) {
+              rC[i] += sA[k * TM + i] * rB[k];
+            }
+          }
+        }
+        for (int i = 0; i < TM; i++) {
+          if (i < M) {
+            float c = C_mat[j * ldc + i];
+            c = (hc::fast_math::isnan(c) || hc::fast_math::isinf(c)) ? 0 : c;
+            C_mat[j * ldc + i] = alpha * rC[i] + beta * c;
+          }
+        }
+      }
+      // op(A) of the next unit overwrites the staged one
+      tidx.barrier.wait();
+    }
+  });
+  return HCBLAS_SUCCEEDS;
+}
+
+#undef SGEMM_TINY_ELEMENTS
+
+// Size classes: every dimension is rounded up to 4, 8, 16 or 32
+template <int TM, int TN>
+static sgemm_tiny_kernel gemm_tiny_batch_select_K(int K) {
+  if (K <= 4) return gemm_tiny_batch<TM, TN, 4>;
+  if (K <= 8) return gemm_tiny_batch<TM, TN, 8>;
+  if (K <= 16) return gemm_tiny_batch<TM, TN, 16>;
+  return gemm_tiny_batch<TM, TN, 32>;
+}
+
+template <int TM>
+static sgemm_tiny_kernel gemm_tiny_batch_select_N(int N, int K) {
+  if (N <= 4) return gemm_tiny_batch_select_K<TM, 4>(K);
+  if (N <= 8) return gemm_tiny_batch_select_K<TM, 8>(K);
+  if (N <= 16) return gemm_tiny_batch_select_K<TM, 16>(K);
+  return gemm_tiny_batch_select_K<TM, 32>(K);
+}
+
+sgemm_tiny_kernel gemm_tiny_batch_select(int M, int N, int K) {
+  if (M <= 0 || N <= 0 || K <= 0 || M > SGEMM_TINY_MAX ||
+      N > SGEMM_TINY_MAX || K > SGEMM_TINY_MAX) {
+    return NULL;
+  }
+  if (M <= 4) return gemm_tiny_batch_select_N<4>(N, K);
+  if (M <= 8) return gemm_tiny_batch_select_N<8>(N, K);
+  if (M <= 16) return gemm_tiny_batch_select_N<16>(N, K);
+  return gemm_tiny_batch_select_N<32>(N, K);
+}
@@ -0,0 +1,78 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "./sgemm_array_kernels.h"
+
+/* Variants of gemm_MICRO_NBK_M_N_K_TS16 by trace name. A lean build defines
+ HCBLAS_LEAN_KERNELS and HCBLAS_KERNEL_<name> for each kernel its selection
+ table names; the others are not compiled and have no kernel here. */
+static const hcblasMicroVariant<float> gemm_variants[] = {
+    HCBLAS_MICRO_VARIANT(float, false, false, 2,
+                         gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2),
+#if !defined(HCBLAS_LEAN_KERNELS) || \
+    defined(HCBLAS_KERNEL_gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4)
+    HCBLAS_MICRO_VARIANT(float, false, false, 4,
+                         gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4),
+#else
+    HCBLAS_MICRO_VARIANT_OMITTED(false, false, 4,
+                                 gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4),
+#endif
+#if !defined(HCBLAS_LEAN_KERNELS) || \
+    defined(HCBLAS_KERNEL_gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6)
+    HCBLAS_MICRO_VARIANT(float, false, false, 6,
+                         gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6),
+#else
+    HCBLAS_MICRO_VARIANT_OMITTED(false, false, 6,
+                                 gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6),
+#endif
+    HCBLAS_MICRO_VARIANT(float, false, true, 2,
+                         gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2),
+#if !defined(HCBLAS_LEAN_KERNELS) || \
+    defined(HCBLAS_KERNEL_gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4)
+    HCBLAS_MICRO_VARIANT(float, false, true, 4,
+                         gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4),
+#else
+    HCBLAS_MICRO_VARIANT_OMITTED(false, true, 4,
+                                 gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4),
+#endif
+#if !defined(HCBLAS_LEAN_KERNELS) || \
+    defined(HCBLAS_KERNEL_gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6)
+    HCBLAS_MICRO_VARIANT(float, false, true, 6,
+                         gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6),
+#else
+    HCBLAS_MICRO_VARIANT_OMITTED(false, true, 6,
+                                 gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6),
+#endif
+    HCBLAS_MICRO_VARIANT(float, true, false, 2,
+                         gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2),
+};
+
+template <>
+sgemm_kernel gemm_MICRO_NBK_M_N_K_variant<float>(bool transA, bool transB,
+                                                 int MTILE) {
+  return hcblasMicroVariantFind(gemm_variants, transA, transB, MTILE);
+}
+
+const char *gemm_variant_kernel_name(sgemm_kernel kernel) {
+  return hcblasMicroVariantName(gemm_variants, kernel);
+}
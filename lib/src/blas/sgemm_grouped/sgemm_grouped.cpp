@@ -0,0 +1,227 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include "include/hcblas_grouped.h"
+#include "include/hcblas_trace.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <vector>
+
+// Each 16x16 work group computes one 32x32 block of C with a 2x2 micro tile
+// and stages K 16 elements at a time, as the TS16XMTS2 sgemm kernels do
+#define GROUPED_TILESIZE 16
+#define GROUPED_MICROTILESIZE 2
+#define GROUPED_BLOCKSIZE (GROUPED_TILESIZE * GROUPED_MICROTILESIZE)
+#define GROUPED_BANKSIZE (GROUPED_BLOCKSIZE + 1)
+
+// One problem of the group as the kernel sees it, in schedule order.
+// Operands are column major.
+struct sgemm_grouped_desc {
+  const float *A;
+  const float *B;
+  float *C;
+  int M;
+  int N;
+  int K;
+  int lda;
+  int ldb;
+  int ldc;
+  int tilesM;
+  __int64_t firstTile;
+};
+
+// Index of the problem owning tile: the last descriptor starting at or
+// before it
+static inline int grouped_find(const sgemm_grouped_desc *desc, int count,
+                               __int64_t tile) [[hc]] {
+  int lo = 0;
+  int hi = count - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) >> 1;
+    if (desc[mid].firstTile <= tile) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return lo;
+}
+
+static void gemm_grouped_MICRO_TS16XMTS2(hc::accelerator_view accl_view,
+                                         const hcblasDeviceProps &props,
+                                         bool transA, bool transB,
+                                         const sgemm_grouped_desc *desc,
+                                         int count, __int64_t tileCount,
+                                         float alpha, float beta) {
+  hcblasTraceKernel("gemm_grouped_MICRO_TS16XMTS2");
+  // No more work groups than the device holds; each takes every groups-th
+  // tile of the schedule
+  hcblasKernelResources kernel = {
+      GROUPED_TILESIZE * GROUPED_TILESIZE,
+      2 * sizeof(float) * GROUPED_TILESIZE * GROUPED_BANKSIZE, 0};
+  __int64_t groups = hcblasGridGroups(props, kernel, tileCount, 1);
+  hc::extent<2> grdExt(GROUPED_TILESIZE, groups * GROUPED_TILESIZE);
+  hc::tiled_extent<2> t_ext = grdExt.tile(GROUPED_TILESIZE, GROUPED_TILESIZE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
+    tile_static float lA[GROUPED_TILESIZE * GROUPED_BANKSIZE];
+    tile_static float lB[GROUPED_TILESIZE * GROUPED_BANKSIZE];
+    for (__int64_t tile = tidx.tile[1]; tile < tileCount; tile += groups) {
+      const sgemm_grouped_desc &d = desc[grouped_find(desc, count, tile)];
+      int idx = tidx.local[1];
+      int idy = tidx.local[0];
+      int idt = idy * GROUPED_TILESIZE + idx;
+      __int64_t local = tile - d.firstTile;
+      int row0 = static_cast<int>(local % d.tilesM) * GROUPED_BLOCKSIZE;
+      int col0 = static_cast<int>(local / d.tilesM) * GROUPED_BLOCKSIZE;
+      float rC[GROUPED_MICROTILESIZE][GROUPED_MICROTILESIZE] = {{0}};
+
+      for (int kb = 0; kb < d.K; kb += GROUPED_TILESIZE) {
+        // 256 work items stage a 16x32 slice of op(A) and of op(B), two
+        // elements each; out of range elements are zero filled
+        for (int l = 0; l < GROUPED_MICROTILESIZE; l++) {
+          int e = idt + l * GROUPED_TILESIZE * GROUPED_TILESIZE;
+          int m = e % GROUPED_BLOCKSIZE;
+          int k = e / GROUPED_BLOCKSIZE;
+          int gm = row0 + m;
+          int gk = kb + k;
+          float a = 0;
+          if (gm < d.M && gk < d.K) {
+            a = transA ? d.A[static_cast<__int64_t>(gm) * d.lda + gk]
+                       : d.A[static_cast<__int64_t>(gk) * d.lda + gm];
+          }
+          lA[k * GROUPED_BANKSIZE + m] = a;
+
+          k = e % GROUPED_TILESIZE;
+          int n = e / GROUPED_TILESIZE;
+          int gn = col0 + n;
+          gk = kb + k;
+          float b = 0;
+          if (gn < d.N && gk < d.K) {
+            b = transB ? d.B[static_cast<__int64_t>(gk) * d.ldb + gn]
+                       : d.B[static_cast<__int64_t>(gn) * d.ldb + gk];
+          }
+          lB[k * GROUPED_BANKSIZE + n] = b;
+        }
+        tidx.barrier.wait();
+
+        for (int k = 0; k < GROUPED_TILESIZE; k++) {
+          for (int i = 0; i < GROUPED_MICROTILESIZE; i++) {
+            float a = lA[k * GROUPED_BANKSIZE + idx + i * GROUPED_TILESIZE];
+            for (int j = 0; j < GROUPED_MICROTILESIZE; j++) {
+              rC[i][j] +=
+                  a * lB[k * GROUPED_BANKSIZE + idy + j * GROUPED_TILESIZE];
+            }
+          }
+        }
+        tidx.barrier.wait();
+      }
+
+      for (int j = 0; j < GROUPED_MICROTILESIZE; j++) {
+        int gn = col0 + idy + j * GROUPED_TILESIZE;
+        for (int i = 0; i < GROUPED_MICROTILESIZE; i++) {
+          int gm = row0 + idx + i * GROUPED_TILESIZE;
+          if (gm < d.M && gn < d.N) {
+            __int64_t C_index = static_cast<__int64_t>(gn) * d.ldc + gm;
+            d.C[C_index] = (beta == 0)
+                               ? alpha * rC[i][j]
+                               : alpha * rC[i][j] + beta * d.C[C_index];
+          }
+        }
+      }
+    }
+  });
+}
+
+// Sgemm Grouped: every problem has its own shape, leading dimensions and
+// operands; transposes and scalars are shared. Shapes, leading dimensions
+// and the pointer arrays are read on the host.
+hcblasStatus Hcblaslibrary::hcblas_sgemm_grouped(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose typeA,
+    hcblasTranspose typeB, const int *M, const int *N, const int *K,
+    const float &alpha, const float *const A[], const int *lda,
+    const float *const B[], const int *ldb, const float &beta,
+    float *const C[], const int *ldc, const int groupCount) {
+  // Quick return if possible
+  if (groupCount == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+  if (groupCount < 0 || M == NULL || N == NULL || K == NULL || A == NULL ||
+      B == NULL || C == NULL || lda == NULL || ldb == NULL || ldc == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  // Row major C = op(A) * op(B) is column major C' = op(B)' * op(A)'
+  bool transA = order ? typeA == Trans : typeB == Trans;
+  bool transB = order ? typeB == Trans : typeA == Trans;
+  const int *rows = order ? M : N;
+  const int *cols = order ? N : M;
+
+  hcblasGroupedSchedule schedule(GROUPED_BLOCKSIZE, GROUPED_BLOCKSIZE);
+  if (!schedule.build(rows, cols, K, groupCount)) {
+    return HCBLAS_INVALID;
+  }
+  if (schedule.tileCount() == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  const std::vector<hcblasGroupedRange> &ranges = schedule.ranges();
+  std::vector<sgemm_grouped_desc> host(ranges.size());
+  for (size_t i = 0; i < ranges.size(); i++) {
+    int p = ranges[i].problem;
+    sgemm_grouped_desc &d = host[i];
+    d.A = order ? A[p] : B[p];
+    d.B = order ? B[p] : A[p];
+    d.C = C[p];
+    d.M = rows[p];
+    d.N = cols[p];
+    d.K = K[p];
+    d.lda = order ? lda[p] : ldb[p];
+    d.ldb = order ? ldb[p] : lda[p];
+    d.ldc = ldc[p];
+    d.tilesM = ranges[i].tilesM;
+    d.firstTile = ranges[i].firstTile;
+    if (d.C == NULL || (d.K > 0 && (d.A == NULL || d.B == NULL))) {
+      return HCBLAS_INVALID;
+    }
+  }
+
+  hc::accelerator accl = accl_view.get_accelerator();
+  size_t bytes = sizeof(sgemm_grouped_desc) * host.size();
+  sgemm_grouped_desc *desc =
+      (sgemm_grouped_desc *)hc::am_alloc(bytes, accl, 0);
+  if (desc == NULL) {
+    return HCBLAS_INVALID;
+  }
+  accl_view.copy(host.data(), desc, bytes);
+
+  gemm_grouped_MICRO_TS16XMTS2(accl_view,
+                               deviceProperties(accl_view.get_accelerator()),
+                               transA, transB, desc,
+                               static_cast<int>(host.size()),
+                               schedule.tileCount(), alpha, beta);
+
+  accl_view.wait();
+  hc::am_free(desc);
+  return HCBLAS_SUCCEEDS;
+}
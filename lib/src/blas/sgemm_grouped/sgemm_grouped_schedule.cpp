@@ -0,0 +1,98 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_grouped.h"
+#include <algorithm>
+#include <cstddef>
+
+// Most expensive first; equal costs keep the caller's order
+static bool grouped_range_before(const hcblasGroupedRange &a,
+                                 const hcblasGroupedRange &b) {
+  if (a.cost != b.cost) {
+    return a.cost > b.cost;
+  }
+  return a.problem < b.problem;
+}
+
+hcblasGroupedSchedule::hcblasGroupedSchedule(int tileM, int tileN)
+    : tileM(tileM), tileN(tileN), total(0) {}
+
+bool hcblasGroupedSchedule::build(const int *M, const int *N, const int *K,
+                                  int groupCount) {
+  order.clear();
+  total = 0;
+  if (tileM <= 0 || tileN <= 0 || groupCount < 0 ||
+      (groupCount > 0 && (M == NULL || N == NULL || K == NULL))) {
+    return false;
+  }
+
+  for (int i = 0; i < groupCount; i++) {
+    if (M[i] < 0 || N[i] < 0 || K[i] < 0) {
+      order.clear();
+      return false;
+    }
+    if (M[i] == 0 || N[i] == 0) {
+      continue;
+    }
+    hcblasGroupedRange range;
+    range.problem = i;
+    range.tilesM = (M[i] + tileM - 1) / tileM;
+    range.tilesN = (N[i] + tileN - 1) / tileN;
+    range.firstTile = 0;
+    // Every block walks the whole K; K == 0 still has to scale C by beta
+    range.cost = static_cast<long long>(range.tilesM) * range.tilesN *
+                 std::max(K[i], 1);
+    order.push_back(range);
+  }
+
+  std::sort(order.begin(), order.end(), grouped_range_before);
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i].firstTile = total;
+    total += static_cast<long long>(order[i].tilesM) * order[i].tilesN;
+  }
+  return true;
+}
+
+bool hcblasGroupedSchedule::locate(long long tile, int *problem, int *tileRow,
+                                   int *tileCol) const {
+  if (tile < 0 || tile >= total) {
+    return false;
+  }
+  // Last range starting at or before tile
+  size_t lo = 0;
+  size_t hi = order.size() - 1;
+  while (lo < hi) {
+    size_t mid = (lo + hi + 1) / 2;
+    if (order[mid].firstTile <= tile) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  const hcblasGroupedRange &range = order[lo];
+  long long local = tile - range.firstTile;
+  *problem = range.problem;
+  *tileRow = static_cast<int>(local % range.tilesM);
+  *tileCol = static_cast<int>(local / range.tilesM);
+  return true;
+}
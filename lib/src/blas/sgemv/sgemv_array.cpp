@@ -822,6 +822,35 @@ static void gemv_alpha0_rowbatch(hc::accelerator_view accl_view, float *A,
   }) ;
 }
 
+typedef void (*sgemv_kernel)(hc::accelerator_view accl_view, float *A,
+                             __int64_t aOffset, float *X, __int64_t xOffset,
+                             float *Y, __int64_t yOffset, float alpha,
+                             float beta, int lenX, int lenY);
+
+static sgemv_kernel gemv_select(hcblasOrder order, hcblasTranspose type,
+                                float alpha) {
+  if (alpha == 0) {
+    return order ? gemv_alpha0_col : gemv_alpha0_row;
+  }
+  if (order) {
+    if (type == 't') return gemv_TransA;
+    return gemv_NoTransA;
+  }
+  if (type == 't') return gemv_TransA_rMajor;
+  return gemv_NoTransA_rMajor;
+}
+
+// Replays a captured sgemv step
+static hcblasStatus gemv_plan_launch(hc::accelerator_view accl_view,
+                                     const hcblasPlanStep &step) {
+  sgemv_kernel kernel = reinterpret_cast<sgemv_kernel>(step.kernel);
+  kernel(accl_view, static_cast<float *>(step.operand[0]), step.offset[0],
+         static_cast<float *>(step.operand[1]), step.offset[1],
+         static_cast<float *>(step.operand[2]), step.offset[2], step.scalar[0],
+         step.scalar[1], step.dim[0], step.dim[1]);
+  return HCBLAS_SUCCEEDS;
+}
+
 /* SGEMV - Type I : inputs and outputs are device pointers */
 hcblasStatus Hcblaslibrary::hcblas_sgemv(
     hc::accelerator_view accl_view, hcblasOrder order, hcblasTranspose type,
@@ -829,6 +858,18 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
     const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
     const int incX, const float &beta, float *Y, const __int64_t yOffset,
     const int incY) {
+  return hcblas_sgemv_capture(NULL, accl_view, order, type, M, N, alpha, A,
+                              aOffset, lda, X, xOffset, incX, beta, Y, yOffset,
+                              incY);
+}
+
+/* SGEMV - Type I, recorded in plan when it is not NULL */
+hcblasStatus Hcblaslibrary::hcblas_sgemv_capture(
+    hcblasPlan *plan, hc::accelerator_view accl_view, hcblasOrder order,
+    hcblasTranspose type, const int M, const int N, const float &alpha,
+    float *A, const __int64_t aOffset, const int lda, float *X,
+    const __int64_t xOffset, const int incX, const float &beta, float *Y,
+    const __int64_t yOffset, const int incY) {
   /*Check the conditions*/
   if (X == NULL || Y == NULL || A == NULL || M <= 0 || N <= 0 || incX <= 0 ||
       incY <= 0) {
@@ -845,33 +886,19 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
     lenY = 1 + (N - 1) * abs(incY);
   }
 
-  if (alpha == 0) {
-    if (order)
-      gemv_alpha0_col(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha,
-                      beta, lenX, lenY);
-    else
-      gemv_alpha0_row(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha,
-                      beta, lenX, lenY);
+  sgemv_kernel kernel = gemv_select(order, type, alpha);
+  if (plan != NULL) {
+    hcblasPlanStep step = {gemv_plan_launch,
+                           reinterpret_cast<hcblasPlanKernel>(kernel),
+                           {A, X, Y},
+                           {aOffset, xOffset, yOffset},
+                           {lenX, lenY},
+                           {alpha, beta}};
+    plan->steps.push_back(step);
     return HCBLAS_SUCCEEDS;
   }
-
-  if (order) {
-    if (type == 't') {
-      gemv_TransA(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha, beta,
-                  lenX, lenY);
-    } else if (type == 'n') {
-      gemv_NoTransA(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha, beta,
-                    lenX, lenY);
-    }
-  } else {
-    if (type == 't') {
-      gemv_TransA_rMajor(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha,
-                         beta, lenX, lenY);
-    } else if (type == 'n') {
-      gemv_NoTransA_rMajor(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha,
-                           beta, lenX, lenY);
-    }
-  }
+  kernel(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha, beta, lenX,
+         lenY);
 
   return HCBLAS_SUCCEEDS;
 }
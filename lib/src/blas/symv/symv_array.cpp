@@ -0,0 +1,183 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <hc_math.hpp>
+
+#define SYMV_BLOCK 32
+#define BLOCK_SIZE 256
+
+/*
+ * SYMV is computed in two passes over a column major matrix.
+ *
+ * Pass 1 walks the stored triangle in SYMV_BLOCK x SYMV_BLOCK blocks. Each
+ * block (I, J) is read from global memory exactly once and staged in LDS.
+ * An off diagonal block feeds two outputs: A(I,J) * x(J) is a partial sum for
+ * the rows of block I and A(I,J)' * x(I) is a partial sum for the rows of
+ * block J. The diagonal block mirrors its stored triangle inside LDS.
+ *
+ * Every partial is written to its own slot of a (numBlocks x n) workspace,
+ * so pass 2 reduces the slots in a fixed order and the result does not
+ * depend on the scheduling of the blocks.
+ */
+template <typename T>
+static void symv_partials(hc::accelerator_view accl_view, bool upper, int n,
+                          const T *A, __int64_t aOffset, __int64_t lda,
+                          const T *X, __int64_t xOffset, __int64_t incX,
+                          T *work, int numBlocks) {
+  hc::extent<2> compute_domain(numBlocks, numBlocks * SYMV_BLOCK);
+  hc::parallel_for_each(accl_view, compute_domain.tile(1, SYMV_BLOCK), [=
+  ](hc::tiled_index<2> tidx)[[hc]] {
+    int I = tidx.tile[0];
+    int J = tidx.tile[1];
+    int tx = tidx.local[1];
+
+    // Blocks outside the referenced triangle carry no data
+    if (upper ? (I > J) : (I < J)) return;
+
+    tile_static T lA[SYMV_BLOCK][SYMV_BLOCK + 1];
+    tile_static T lxI[SYMV_BLOCK];
+    tile_static T lxJ[SYMV_BLOCK];
+    int row0 = I * SYMV_BLOCK;
+    int col0 = J * SYMV_BLOCK;
+    int row = row0 + tx;
+
+    for (int c = 0; c < SYMV_BLOCK; ++c) {
+      int col = col0 + c;
+      lA[tx][c] = (row < n && col < n) ? A[aOffset + col * lda + row] : 0;
+    }
+    lxI[tx] = (row < n) ? X[xOffset + row * incX] : 0;
+    lxJ[tx] = (col0 + tx < n) ? X[xOffset + (col0 + tx) * incX] : 0;
+
+    tidx.barrier.wait();
+
+    T rowSum = 0;
+    if (I == J) {
+      for (int c = 0; c < SYMV_BLOCK; ++c) {
+        bool stored = upper ? (tx <= c) : (tx >= c);
+        rowSum += (stored ? lA[tx][c] : lA[c][tx]) * lxJ[c];
+      }
+      if (row < n) {
+        work[(__int64_t)I * n + row] = rowSum;
+      }
+    } else {
+      T colSum = 0;
+      for (int c = 0; c < SYMV_BLOCK; ++c) {
+        rowSum += lA[tx][c] * lxJ[c];
+        colSum += lA[c][tx] * lxI[c];
+      }
+      if (row < n) {
+        work[(__int64_t)J * n + row] = rowSum;
+      }
+      if (col0 + tx < n) {
+        work[(__int64_t)I * n + col0 + tx] = colSum;
+      }
+    }
+  }) ;
+}
+
+template <typename T>
+static void symv_reduce(hc::accelerator_view accl_view, int n, const T *work,
+                        int numBlocks, T alpha, T beta, T *Y,
+                        __int64_t yOffset, __int64_t incY) {
+  __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int i = tidx.global[0];
+    if (i < n) {
+      T sum = 0;
+      for (int s = 0; s < numBlocks; ++s) {
+        sum += work[(__int64_t)s * n + i];
+      }
+      __int64_t Y_index = yOffset + i * incY;
+      if (beta == 0) {
+        Y[Y_index] = alpha * sum;
+      } else {
+        Y[Y_index] = beta * Y[Y_index] + alpha * sum;
+      }
+    }
+  }) ;
+}
+
+template <typename T>
+static hcblasStatus symv_HC(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, const int N, const T alpha,
+                            const T *A, const __int64_t aOffset, const int lda,
+                            const T *X, const __int64_t xOffset,
+                            const int incX, const T beta, T *Y,
+                            const __int64_t yOffset, const int incY) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  if (alpha == 0 && beta == 1) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // A row major symmetric matrix is the column major matrix with the other
+  // triangle stored
+  bool upper = (uplo == Upper);
+  if (!order) {
+    upper = !upper;
+  }
+
+  int numBlocks = (N + SYMV_BLOCK - 1) / SYMV_BLOCK;
+  hc::accelerator accl = accl_view.get_accelerator();
+  T *work = (T *)hc::am_alloc(sizeof(T) * numBlocks * N, accl, 0);
+  if (work == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  symv_partials<T>(accl_view, upper, N, A, aOffset, lda, X, xOffset, incX,
+                   work, numBlocks);
+  symv_reduce<T>(accl_view, N, work, numBlocks, alpha, beta, Y, yOffset, incY);
+
+  accl_view.wait();
+  hc::am_free(work);
+  return HCBLAS_SUCCEEDS;
+}
+
+/* SSYMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_ssymv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const float &alpha, const float *A, const __int64_t aOffset,
+    const int lda, const float *X, const __int64_t xOffset, const int incX,
+    const float &beta, float *Y, const __int64_t yOffset, const int incY) {
+  return symv_HC<float>(accl_view, order, uplo, N, alpha, A, aOffset, lda, X,
+                        xOffset, incX, beta, Y, yOffset, incY);
+}
+
+/* DSYMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dsymv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const double &alpha, const double *A, const __int64_t aOffset,
+    const int lda, const double *X, const __int64_t xOffset, const int incX,
+    const double &beta, double *Y, const __int64_t yOffset, const int incY) {
+  return symv_HC<double>(accl_view, order, uplo, N, alpha, A, aOffset, lda, X,
+                         xOffset, incX, beta, Y, yOffset, incY);
+}
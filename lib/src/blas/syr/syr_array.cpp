@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_math.hpp>
+
+/*
+ * Symmetric rank-1 and rank-2 updates. Both use the 16x16 tiling of GER
+ * restricted to the referenced triangle of a column major matrix; a row
+ * major matrix is handled as the column major matrix with the other
+ * triangle stored.
+ */
+template <typename T>
+static void syr2_HC(hc::accelerator_view accl_view, bool upper, __int64_t n,
+                    T alpha, const T *x, __int64_t xOffset, __int64_t incx,
+                    const T *y, __int64_t yOffset, __int64_t incy, T *a,
+                    __int64_t aOffset, __int64_t lda) {
+  __int64_t N = (n + 15) & ~15;
+  hc::extent<2> compute_domain(N, N);
+  hc::parallel_for_each(accl_view, compute_domain.tile(16, 16), [=
+  ](hc::tiled_index<2> tidx)[[hc]] {
+    int i = tidx.global[0];
+    int j = tidx.global[1];
+
+    if (i < n && j < n && (upper ? (i <= j) : (i >= j))) {
+      __int64_t a_index = aOffset + j * lda + i;
+      T xi = x[xOffset + i * incx];
+      T xj = x[xOffset + j * incx];
+      if (y == NULL) {
+        a[a_index] += alpha * xi * xj;
+      } else {
+        a[a_index] +=
+            alpha * (xi * y[yOffset + j * incy] + y[yOffset + i * incy] * xj);
+      }
+    }
+  }) ;
+}
+
+template <typename T>
+static hcblasStatus syr2(hc::accelerator_view accl_view, hcblasOrder order,
+                         hcblasUplo uplo, const int N, const T alpha,
+                         const T *X, const __int64_t xOffset, const int incX,
+                         const T *Y, const __int64_t yOffset, const int incY,
+                         T *A, const __int64_t aOffset, const int lda) {
+  if (alpha == 0) {
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool upper = (uplo == Upper);
+  if (!order) {
+    upper = !upper;
+  }
+
+  syr2_HC<T>(accl_view, upper, N, alpha, X, xOffset, incX, Y, yOffset, incY, A,
+             aOffset, lda);
+  return HCBLAS_SUCCEEDS;
+}
+
+/* SSYR - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_ssyr(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const float &alpha, const float *X, const __int64_t xOffset,
+    const int incX, float *A, const __int64_t aOffset, const int lda) {
+  /*Check the conditions*/
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2<float>(accl_view, order, uplo, N, alpha, X, xOffset, incX, NULL,
+                     0, 0, A, aOffset, lda);
+}
+
+/* DSYR - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dsyr(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const double &alpha, const double *X, const __int64_t xOffset,
+    const int incX, double *A, const __int64_t aOffset, const int lda) {
+  /*Check the conditions*/
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2<double>(accl_view, order, uplo, N, alpha, X, xOffset, incX, NULL,
+                      0, 0, A, aOffset, lda);
+}
+
+/* SSYR2 - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_ssyr2(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const float &alpha, const float *X, const __int64_t xOffset,
+    const int incX, const float *Y, const __int64_t yOffset, const int incY,
+    float *A, const __int64_t aOffset, const int lda) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2<float>(accl_view, order, uplo, N, alpha, X, xOffset, incX, Y,
+                     yOffset, incY, A, aOffset, lda);
+}
+
+/* DSYR2 - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dsyr2(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    const int N, const double &alpha, const double *X, const __int64_t xOffset,
+    const int incX, const double *Y, const __int64_t yOffset, const int incY,
+    double *A, const __int64_t aOffset, const int lda) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || A == NULL || N <= 0 || lda < N || incX <= 0 ||
+      incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  return syr2<double>(accl_view, order, uplo, N, alpha, X, xOffset, incX, Y,
+                      yOffset, incY, A, aOffset, lda);
+}
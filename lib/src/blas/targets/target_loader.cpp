@@ -0,0 +1,87 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblaslib.h"
+#include "include/hcblas_targets.h"
+#include <dlfcn.h>
+#include <cstdlib>
+#include <mutex>
+
+// Set by lib/src/CMakeLists.txt from HCBLAS_AMDGPU_TARGETS
+#ifndef HCBLAS_BUILTIN_TARGETS
+#define HCBLAS_BUILTIN_TARGETS "gfx803,gfx900"
+#endif
+#ifndef HCBLAS_MODULE_TARGETS
+#define HCBLAS_MODULE_TARGETS ""
+#endif
+
+std::string hcblasModuleDirectory() {
+  const char *path = getenv("HCBLAS_MODULE_PATH");
+  if (path != NULL && *path != '\0') {
+    return path;
+  }
+  Dl_info info;
+  if (dladdr(reinterpret_cast<void *>(&hcblasLoadTargetKernels), &info) &&
+      info.dli_fname != NULL) {
+    std::string library(info.dli_fname);
+    size_t slash = library.rfind('/');
+    if (slash != std::string::npos) {
+      return library.substr(0, slash) + "/hcblas";
+    }
+  }
+  return "hcblas";
+}
+
+bool hcblasLoadTargetKernels(const hc::accelerator &accl) {
+  static const hcblasTargetRegistry registry(HCBLAS_BUILTIN_TARGETS,
+                                             HCBLAS_MODULE_TARGETS);
+  std::wstring path = accl.get_device_path();
+  if (path == L"cpu") {
+    return true;
+  }
+  std::string device(path.begin(), path.end());
+  hcblasTargetSelection selection =
+      registry.select(device, hcblasModuleDirectory());
+  // A target that was not built is left to the runtime, which reports
+  // the missing code objects at launch
+  if (selection.source != hcblasTargetModule) {
+    return true;
+  }
+
+  // Each module is loaded once and stays loaded: the runtime reads the code
+  // objects of every loaded module before the first launch on a device
+  static std::mutex lock;
+  static std::vector<std::string> loaded;
+  std::lock_guard<std::mutex> guard(lock);
+  for (size_t i = 0; i < loaded.size(); i++) {
+    if (loaded[i] == selection.target) {
+      return true;
+    }
+  }
+  if (dlopen(selection.module.c_str(), RTLD_NOW | RTLD_LOCAL) == NULL) {
+    return false;
+  }
+  loaded.push_back(selection.target);
+  return true;
+}
@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas_targets.h"
+#include <algorithm>
+#include <cctype>
+
+std::string hcblasTargetName(const std::string &device) {
+  std::string name(device);
+  std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+  size_t start = name.find("gfx");
+  if (start == std::string::npos) {
+    return "";
+  }
+  size_t end = start + 3;
+  while (end < name.size() && isalnum(name[end])) {
+    end++;
+  }
+  // "gfx" alone names no target
+  if (end == start + 3) {
+    return "";
+  }
+  return name.substr(start, end - start);
+}
+
+std::vector<std::string> hcblasParseTargets(const std::string &list) {
+  std::vector<std::string> targets;
+  size_t begin = 0;
+  while (begin <= list.size()) {
+    size_t end = list.find_first_of(",;", begin);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    std::string target = hcblasTargetName(list.substr(begin, end - begin));
+    if (!target.empty() &&
+        std::find(targets.begin(), targets.end(), target) == targets.end()) {
+      targets.push_back(target);
+    }
+    begin = end + 1;
+  }
+  return targets;
+}
+
+std::string hcblasTargetModuleFile(const std::string &directory,
+                                   const std::string &target) {
+  std::string file = "libhcblas-" + target + ".so";
+  if (directory.empty()) {
+    return file;
+  }
+  if (directory[directory.size() - 1] == '/') {
+    return directory + file;
+  }
+  return directory + "/" + file;
+}
+
+hcblasTargetRegistry::hcblasTargetRegistry(const std::string &builtin,
+                                           const std::string &modules)
+    : builtin(hcblasParseTargets(builtin)),
+      modules(hcblasParseTargets(modules)) {}
+
+hcblasTargetSelection hcblasTargetRegistry::select(
+    const std::string &device, const std::string &moduleDir) const {
+  hcblasTargetSelection selection;
+  selection.target = hcblasTargetName(device);
+  selection.source = hcblasTargetMissing;
+  if (selection.target.empty()) {
+    return selection;
+  }
+  if (std::find(builtin.begin(), builtin.end(), selection.target) !=
+      builtin.end()) {
+    selection.source = hcblasTargetBuiltin;
+  } else if (std::find(modules.begin(), modules.end(), selection.target) !=
+             modules.end()) {
+    selection.source = hcblasTargetModule;
+    selection.module = hcblasTargetModuleFile(moduleDir, selection.target);
+  }
+  return selection;
+}
@@ -0,0 +1,429 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef hcblasTraceRing<hcblasTraceRecord, HCBLAS_TRACE_RING> TraceRing;
+
+// How often the writer drains the rings when nobody asks it to
+const std::chrono::milliseconds kDrainPeriod(20);
+
+enum DrainMode {
+  DrainReady,  // stop at the first record whose device time is pending
+  DrainWait,   // wait for every pending device time
+  DrainExit    // write everything, untimed if the device is not done
+};
+
+struct TraceState {
+  TraceState()
+      : out(stderr),
+        ownsOut(false),
+        format(TraceCsv),
+        headerDone(false),
+        running(false),
+        stopping(false),
+        reportedDrops(0),
+        origin(std::chrono::steady_clock::now()) {}
+
+  // Guards everything below. Producers only take it to register a ring.
+  std::mutex lock;
+  // Rings outlive their threads so records queued just before a thread
+  // exits are still written.
+  std::vector<TraceRing *> rings;
+  // Drained records, in drain order, whose line is not written yet
+  std::deque<hcblasTraceRecord> pending;
+  FILE *out;
+  bool ownsOut;
+  hcblasTraceFormat format;
+  bool headerDone;
+  std::thread writer;
+  std::condition_variable wake;
+  bool running;
+  bool stopping;
+  unsigned long long reportedDrops;
+  std::chrono::steady_clock::time_point origin;
+};
+
+// Never destroyed: threads may still trace while static objects go away
+TraceState &traceState() {
+  static TraceState *state = new TraceState();
+  return *state;
+}
+
+std::atomic<int> traceLevel(-1);
+std::once_flag traceEnvOnce;
+
+thread_local TraceRing *threadRing = NULL;
+thread_local int threadIndex = -1;
+thread_local hcblasTraceRecord threadRecord;
+thread_local hcblasTraceRecord *threadCall = NULL;
+// View of the call being traced, kept for its end marker. A vector so the
+// storage is reused from call to call.
+thread_local std::vector<hc::accelerator_view> threadView;
+
+// Appends to a fixed buffer, silently truncating
+class LineWriter {
+ public:
+  LineWriter(char *out, size_t size) : out(out), size(size), len(0) {
+    if (size > 0) {
+      out[0] = '\0';
+    }
+  }
+
+  void put(const char *format, ...) {
+    if (len + 1 >= size) {
+      return;
+    }
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(out + len, size - len, format, args);
+    va_end(args);
+    if (n > 0) {
+      len += std::min(static_cast<size_t>(n), size - len - 1);
+    }
+  }
+
+  // JSON string body: quotes and backslashes escaped
+  void putEscaped(const char *text, size_t count) {
+    for (size_t i = 0; i < count && text[i]; i++) {
+      if (text[i] == '"' || text[i] == '\\') {
+        put("\\%c", text[i]);
+      } else {
+        put("%c", text[i]);
+      }
+    }
+  }
+
+  size_t length() const { return len; }
+
+ private:
+  char *out;
+  size_t size;
+  size_t len;
+};
+
+bool isNumber(const char *text, size_t count) {
+  char value[64];
+  if (count == 0 || count >= sizeof(value)) {
+    return false;
+  }
+  memcpy(value, text, count);
+  value[count] = '\0';
+  char *end = NULL;
+  strtod(value, &end);
+  return *end == '\0';
+}
+
+void writeArgsJson(LineWriter &line, const char *args) {
+  line.put("{");
+  const char *field = args;
+  bool first = true;
+  while (*field) {
+    const char *stop = strchr(field, ',');
+    size_t count = stop ? stop - field : strlen(field);
+    const char *equals =
+        static_cast<const char *>(memchr(field, '=', count));
+    if (equals != NULL) {
+      size_t keyCount = equals - field;
+      const char *value = equals + 1;
+      size_t valueCount = count - keyCount - 1;
+      line.put(first ? "\"" : ",\"");
+      line.putEscaped(field, keyCount);
+      line.put("\":");
+      if (isNumber(value, valueCount)) {
+        line.put("%.*s", static_cast<int>(valueCount), value);
+      } else {
+        line.put("\"");
+        line.putEscaped(value, valueCount);
+        line.put("\"");
+      }
+      first = false;
+    }
+    field += count;
+    if (*field == ',') {
+      field++;
+    }
+  }
+  line.put("}");
+}
+
+double ticksToUs(uint64_t ticks) {
+  return ticks * 1e6 / static_cast<double>(hc::get_tick_frequency());
+}
+
+// Caller holds state.lock
+void writeRecord(TraceState &state, const hcblasTraceRecord &record,
+                 double deviceUs) {
+  if (!state.headerDone) {
+    if (state.format == TraceCsv) {
+      fputs("time_us,thread,call,kernel,device_us,args\n", state.out);
+    }
+    state.headerDone = true;
+  }
+  char line[2 * HCBLAS_TRACE_ARGS];
+  size_t len = hcblasTraceFormatRecord(record, deviceUs, state.format, line,
+                                       sizeof(line));
+  fwrite(line, 1, len, state.out);
+  fputc('\n', state.out);
+}
+
+// Caller holds state.lock
+void drain(TraceState &state, DrainMode mode) {
+  hcblasTraceRecord record;
+  unsigned long long drops = 0;
+  for (TraceRing *ring : state.rings) {
+    while (ring->pop(&record)) {
+      state.pending.push_back(record);
+    }
+    drops += ring->droppedCount();
+  }
+  while (!state.pending.empty()) {
+    const hcblasTraceRecord &next = state.pending.front();
+    double deviceUs = -1;
+    if (next.timed) {
+      if (mode == DrainReady && !next.end.is_ready()) {
+        break;
+      }
+      if (mode == DrainWait) {
+        next.end.wait();
+      }
+      if (next.end.is_ready()) {
+        deviceUs =
+            ticksToUs(next.end.get_end_tick() - next.start.get_end_tick());
+      }
+    }
+    writeRecord(state, next, deviceUs);
+    state.pending.pop_front();
+  }
+  if (drops > state.reportedDrops) {
+    if (state.format == TraceCsv) {
+      fprintf(state.out, "# dropped %llu records\n",
+              drops - state.reportedDrops);
+    } else {
+      fprintf(state.out, "{\"dropped\":%llu}\n", drops - state.reportedDrops);
+    }
+    state.reportedDrops = drops;
+  }
+  fflush(state.out);
+}
+
+void writerLoop() {
+  TraceState &state = traceState();
+  std::unique_lock<std::mutex> guard(state.lock);
+  while (!state.stopping) {
+    state.wake.wait_for(guard, kDrainPeriod);
+    drain(state, DrainReady);
+  }
+}
+
+void shutdown() {
+  TraceState &state = traceState();
+  {
+    std::lock_guard<std::mutex> guard(state.lock);
+    state.stopping = true;
+  }
+  state.wake.notify_all();
+  state.writer.join();
+  std::lock_guard<std::mutex> guard(state.lock);
+  drain(state, DrainExit);
+  if (state.ownsOut) {
+    fclose(state.out);
+    state.out = stderr;
+    state.ownsOut = false;
+  }
+}
+
+// Caller holds state.lock. Falls back to stderr if path cannot be opened.
+void setOutput(TraceState &state, const char *path,
+               hcblasTraceFormat format) {
+  if (state.ownsOut) {
+    fclose(state.out);
+  }
+  state.out = stderr;
+  state.ownsOut = false;
+  if (path != NULL && *path) {
+    FILE *file = fopen(path, "w");
+    if (file != NULL) {
+      state.out = file;
+      state.ownsOut = true;
+    } else {
+      fprintf(stderr, "hcblas: cannot open trace file %s\n", path);
+    }
+  }
+  state.format = format;
+  state.headerDone = false;
+}
+
+void readEnvironment() {
+  const char *layer = getenv("HCBLAS_LAYER");
+  int level = layer ? atoi(layer) : 0;
+  level = level < 0 ? 0 : (level > 2 ? 2 : level);
+  if (level > 0) {
+    const char *format = getenv("HCBLAS_LAYER_FORMAT");
+    TraceState &state = traceState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    setOutput(state, getenv("HCBLAS_LAYER_FILE"),
+              format && strcmp(format, "json") == 0 ? TraceJson : TraceCsv);
+  }
+  int unset = -1;
+  traceLevel.compare_exchange_strong(unset, level);
+}
+
+// Ring of the calling thread, registered and the writer started on first use
+TraceRing *threadTraceRing() {
+  if (threadRing == NULL) {
+    TraceRing *ring = new TraceRing();
+    TraceState &state = traceState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    threadIndex = static_cast<int>(state.rings.size());
+    state.rings.push_back(ring);
+    if (!state.running) {
+      state.running = true;
+      state.writer = std::thread(writerLoop);
+      atexit(shutdown);
+    }
+    threadRing = ring;
+  }
+  return threadRing;
+}
+
+}  // namespace
+
+int hcblasTraceLevel() {
+  int level = traceLevel.load(std::memory_order_acquire);
+  if (level >= 0) {
+    return level;
+  }
+  std::call_once(traceEnvOnce, readEnvironment);
+  return traceLevel.load(std::memory_order_acquire);
+}
+
+void hcblasTraceConfigure(int level, const char *path,
+                          hcblasTraceFormat format) {
+  // Keep a later first use from applying the environment over this
+  std::call_once(traceEnvOnce, [] {});
+  TraceState &state = traceState();
+  std::lock_guard<std::mutex> guard(state.lock);
+  drain(state, DrainWait);
+  setOutput(state, path, format);
+  traceLevel.store(level < 0 ? 0 : level, std::memory_order_release);
+}
+
+void hcblasTraceFlush() {
+  TraceState &state = traceState();
+  std::lock_guard<std::mutex> guard(state.lock);
+  drain(state, DrainWait);
+}
+
+void hcblasTraceKernel(const char *format, ...) {
+  if (threadCall == NULL) {
+    return;
+  }
+  // A call that launches several kernels lists them all
+  char *kernel = threadCall->kernel;
+  size_t len = strlen(kernel);
+  if (len > 0 && len + 1 < HCBLAS_TRACE_NAME) {
+    kernel[len++] = '+';
+    kernel[len] = '\0';
+  }
+  va_list args;
+  va_start(args, format);
+  vsnprintf(kernel + len, HCBLAS_TRACE_NAME - len, format, args);
+  va_end(args);
+}
+
+size_t hcblasTraceFormatRecord(const hcblasTraceRecord &record,
+                               double deviceUs, hcblasTraceFormat format,
+                               char *out, size_t size) {
+  LineWriter line(out, size);
+  if (format == TraceCsv) {
+    line.put("%.1f,%d,%s,\"%s\",", record.hostUs, record.thread, record.call,
+             record.kernel);
+    if (deviceUs >= 0) {
+      line.put("%.1f", deviceUs);
+    }
+    line.put(",\"%s\"", record.args);
+  } else {
+    line.put("{\"time_us\":%.1f,\"thread\":%d,\"call\":\"", record.hostUs,
+             record.thread);
+    line.putEscaped(record.call, HCBLAS_TRACE_NAME);
+    line.put("\",\"kernel\":\"");
+    line.putEscaped(record.kernel, HCBLAS_TRACE_NAME);
+    if (deviceUs >= 0) {
+      line.put("\",\"device_us\":%.1f,\"args\":", deviceUs);
+    } else {
+      line.put("\",\"device_us\":null,\"args\":");
+    }
+    writeArgsJson(line, record.args);
+    line.put("}");
+  }
+  return line.length();
+}
+
+void hcblasTraceCall::begin(const hc::accelerator_view &view,
+                            const char *call, const char *format,
+                            va_list args) {
+  // A C API call made from inside another one is part of the outer record
+  if (threadCall != NULL) {
+    return;
+  }
+  threadTraceRing();
+  hcblasTraceRecord &record = threadRecord;
+  snprintf(record.call, HCBLAS_TRACE_NAME, "%s", call);
+  record.kernel[0] = '\0';
+  vsnprintf(record.args, HCBLAS_TRACE_ARGS, format, args);
+  record.thread = threadIndex;
+  record.hostUs = std::chrono::duration<double, std::micro>(
+                      std::chrono::steady_clock::now() - traceState().origin)
+                      .count();
+  record.timed = hcblasTraceLevel() > 1;
+  if (record.timed) {
+    threadView.assign(1, view);
+    record.start = threadView[0].create_marker();
+  }
+  threadCall = &record;
+  active = true;
+}
+
+void hcblasTraceCall::end() {
+  hcblasTraceRecord &record = *threadCall;
+  if (record.timed) {
+    record.end = threadView[0].create_marker();
+    threadView.clear();
+  }
+  threadRing->push(record);
+  threadCall = NULL;
+}
@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <hc_math.hpp>
+
+#define BLOCK_SIZE 256
+
+/* Gather a strided vector into a contiguous workspace */
+template <typename T>
+static void trmv_gather(hc::accelerator_view accl_view, int n, const T *X,
+                        __int64_t xOffset, __int64_t incX, T *work) {
+  __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int i = tidx.global[0];
+    if (i < n) {
+      work[i] = X[xOffset + i * incX];
+    }
+  }) ;
+}
+
+/*
+ * One thread per output row; chunks of the input vector are staged in LDS
+ * and only the part of each chunk inside the triangle is accumulated.
+ * For op(A) = A the loads are coalesced down a column; for op(A) = A' each
+ * thread walks its own column.
+ */
+template <typename T>
+static void trmv_HC(hc::accelerator_view accl_view, bool upper, bool trans,
+                    bool unit, int n, const T *A, __int64_t aOffset,
+                    __int64_t lda, const T *work, T *X, __int64_t xOffset,
+                    __int64_t incX) {
+  __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  // Row i of op(A) is non zero for j <= i when op(A) is lower triangular
+  bool lowerOp = (upper == trans);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int bx = tidx.tile[0];
+    int tx = tidx.local[0];
+    int i = bx * BLOCK_SIZE + tx;
+    tile_static T Xds[BLOCK_SIZE];
+    T sum = 0;
+    // Chunks entirely outside the triangle of every row in this tile are
+    // skipped
+    int firstChunk = lowerOp ? 0 : bx;
+    int lastChunk = lowerOp ? bx : (n - 1) / BLOCK_SIZE;
+
+    for (int m = firstChunk; m <= lastChunk; ++m) {
+      int j0 = m * BLOCK_SIZE;
+      Xds[tx] = (j0 + tx < n) ? work[j0 + tx] : 0;
+
+      tidx.barrier.wait();
+
+      if (i < n) {
+        for (int k = 0; k < BLOCK_SIZE; ++k) {
+          int j = j0 + k;
+          if (j >= n) break;
+          if (lowerOp ? (j > i) : (j < i)) continue;
+          if (j == i && unit) {
+            sum += Xds[k];
+          } else {
+            T a = trans ? A[aOffset + i * lda + j] : A[aOffset + j * lda + i];
+            sum += a * Xds[k];
+          }
+        }
+      }
+
+      tidx.barrier.wait();
+    }
+
+    if (i < n) {
+      X[xOffset + i * incX] = sum;
+    }
+  }) ;
+}
+
+template <typename T>
+static hcblasStatus trmv(hc::accelerator_view accl_view, hcblasOrder order,
+                         hcblasUplo uplo, hcblasTranspose type,
+                         hcblasDiag diag, const int N, const T *A,
+                         const __int64_t aOffset, const int lda, T *X,
+                         const __int64_t xOffset, const int incX) {
+  /*Check the conditions*/
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // A row major matrix is the transpose of the same buffer read column major
+  bool upper = (uplo == Upper);
+  bool trans = (type != NoTrans);
+  if (!order) {
+    upper = !upper;
+    trans = !trans;
+  }
+
+  hc::accelerator accl = accl_view.get_accelerator();
+  T *work = (T *)hc::am_alloc(sizeof(T) * N, accl, 0);
+  if (work == NULL) {
+    return HCBLAS_INVALID;
+  }
+
+  trmv_gather<T>(accl_view, N, X, xOffset, incX, work);
+  trmv_HC<T>(accl_view, upper, trans, diag == Unit, N, A, aOffset, lda, work,
+             X, xOffset, incX);
+
+  accl_view.wait();
+  hc::am_free(work);
+  return HCBLAS_SUCCEEDS;
+}
+
+/* STRMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_strmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const float *A,
+    const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+    const int incX) {
+  return trmv<float>(accl_view, order, uplo, type, diag, N, A, aOffset, lda, X,
+                     xOffset, incX);
+}
+
+/* DTRMV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dtrmv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const double *A,
+    const __int64_t aOffset, const int lda, double *X, const __int64_t xOffset,
+    const int incX) {
+  return trmv<double>(accl_view, order, uplo, type, diag, N, A, aOffset, lda,
+                      X, xOffset, incX);
+}
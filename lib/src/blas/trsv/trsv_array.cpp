@@ -0,0 +1,209 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <hc_math.hpp>
+
+#define TRSV_BLOCK 64
+#define BLOCK_SIZE 256
+
+/*
+ * TRSV is solved in blocks of TRSV_BLOCK rows, in the order implied by the
+ * shape of op(A) (top down when op(A) is lower triangular, bottom up
+ * otherwise). Each step
+ *   1. solves the diagonal block in a single work group with the block held
+ *      in LDS, and
+ *   2. subtracts the contribution of the solved block from every row that
+ *      is still unsolved.
+ * For unit stride vectors step 2 is a GEMM with one column, so it runs on
+ * the tuned level-3 kernels; strided vectors use a panel kernel instead.
+ */
+template <typename T>
+static void trsv_diag_block(hc::accelerator_view accl_view, bool lowerOp,
+                            bool trans, bool unit, int r0, int nb,
+                            const T *A, __int64_t aOffset, __int64_t lda, T *X,
+                            __int64_t xOffset, __int64_t incX) {
+  hc::extent<1> compute_domain(TRSV_BLOCK);
+  hc::parallel_for_each(accl_view, compute_domain.tile(TRSV_BLOCK), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int tx = tidx.local[0];
+    tile_static T lA[TRSV_BLOCK][TRSV_BLOCK + 1];
+    tile_static T lx[TRSV_BLOCK];
+
+    // lA[i][j] holds op(A)(r0 + i, r0 + j)
+    for (int j = 0; j < nb; ++j) {
+      if (tx < nb) {
+        lA[tx][j] = trans ? A[aOffset + (r0 + tx) * lda + r0 + j]
+                          : A[aOffset + (r0 + j) * lda + r0 + tx];
+      }
+    }
+    lx[tx] = (tx < nb) ? X[xOffset + (r0 + tx) * incX] : 0;
+
+    tidx.barrier.wait();
+
+    for (int s = 0; s < nb; ++s) {
+      int k = lowerOp ? s : nb - 1 - s;
+      if (tx == k && !unit) {
+        lx[k] /= lA[k][k];
+      }
+
+      tidx.barrier.wait();
+
+      if (lowerOp ? (tx > k && tx < nb) : (tx < k)) {
+        lx[tx] -= lA[tx][k] * lx[k];
+      }
+
+      tidx.barrier.wait();
+    }
+
+    if (tx < nb) {
+      X[xOffset + (r0 + tx) * incX] = lx[tx];
+    }
+  }) ;
+}
+
+/* x(R) -= op(A)(R, B) * x(B) for the rows R = [rStart, rStart + nr) */
+template <typename T>
+static void trsv_panel_update(hc::accelerator_view accl_view, bool trans,
+                              int r0, int nb, int rStart, int nr, const T *A,
+                              __int64_t aOffset, __int64_t lda, T *X,
+                              __int64_t xOffset, __int64_t incX) {
+  __int64_t size = (nr + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  hc::extent<1> compute_domain(size);
+  hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
+  ](hc::tiled_index<1> tidx)[[hc]] {
+    int tx = tidx.local[0];
+    int i = rStart + tidx.global[0];
+    tile_static T lx[TRSV_BLOCK];
+    if (tx < nb) {
+      lx[tx] = X[xOffset + (r0 + tx) * incX];
+    }
+
+    tidx.barrier.wait();
+
+    if (tidx.global[0] < nr) {
+      T sum = 0;
+      for (int k = 0; k < nb; ++k) {
+        T a = trans ? A[aOffset + i * lda + r0 + k]
+                    : A[aOffset + (r0 + k) * lda + i];
+        sum += a * lx[k];
+      }
+      X[xOffset + i * incX] -= sum;
+    }
+  }) ;
+}
+
+static hcblasStatus trsv_gemm(Hcblaslibrary *lib,
+                              hc::accelerator_view accl_view,
+                              hcblasTranspose typeA, int M, int K,
+                              const float *A, __int64_t lda, __int64_t aOffset,
+                              float *X, __int64_t bOffset, __int64_t cOffset) {
+  return lib->hcblas_sgemm(accl_view, ColMajor, typeA, NoTrans, M, 1, K,
+                           -1.0f, const_cast<float *>(A), lda, X, K, 1.0f, X,
+                           M, aOffset, bOffset, cOffset);
+}
+
+static hcblasStatus trsv_gemm(Hcblaslibrary *lib,
+                              hc::accelerator_view accl_view,
+                              hcblasTranspose typeA, int M, int K,
+                              const double *A, __int64_t lda,
+                              __int64_t aOffset, double *X, __int64_t bOffset,
+                              __int64_t cOffset) {
+  return lib->hcblas_dgemm(accl_view, ColMajor, typeA, NoTrans, M, 1, K, -1.0,
+                           const_cast<double *>(A), lda, X, K, 1.0, X, M,
+                           aOffset, bOffset, cOffset);
+}
+
+template <typename T>
+static hcblasStatus trsv(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                         hcblasOrder order, hcblasUplo uplo,
+                         hcblasTranspose type, hcblasDiag diag, const int N,
+                         const T *A, const __int64_t aOffset, const int lda,
+                         T *X, const __int64_t xOffset, const int incX) {
+  /*Check the conditions*/
+  if (X == NULL || A == NULL || N <= 0 || lda < N || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // A row major matrix is the transpose of the same buffer read column major
+  bool upper = (uplo == Upper);
+  bool trans = (type != NoTrans);
+  if (!order) {
+    upper = !upper;
+    trans = !trans;
+  }
+  bool lowerOp = (upper == trans);
+  bool unit = (diag == Unit);
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+
+  int numBlocks = (N + TRSV_BLOCK - 1) / TRSV_BLOCK;
+  for (int s = 0; s < numBlocks && status == HCBLAS_SUCCEEDS; ++s) {
+    int b = lowerOp ? s : numBlocks - 1 - s;
+    int r0 = b * TRSV_BLOCK;
+    int nb = (N - r0 < TRSV_BLOCK) ? N - r0 : TRSV_BLOCK;
+    trsv_diag_block<T>(accl_view, lowerOp, trans, unit, r0, nb, A, aOffset,
+                       lda, X, xOffset, incX);
+
+    // Rows that still depend on this block
+    int rStart = lowerOp ? r0 + nb : 0;
+    int nr = lowerOp ? N - r0 - nb : r0;
+    if (nr == 0) {
+      continue;
+    }
+
+    if (incX == 1) {
+      // op(A)(R, B) is A(R, B) or the transpose of A(B, R)
+      __int64_t subOffset = trans ? aOffset + rStart * (__int64_t)lda + r0
+                                  : aOffset + r0 * (__int64_t)lda + rStart;
+      status = trsv_gemm(lib, accl_view, trans ? Trans : NoTrans, nr, nb, A,
+                         lda, subOffset, X, xOffset + r0, xOffset + rStart);
+    } else {
+      trsv_panel_update<T>(accl_view, trans, r0, nb, rStart, nr, A, aOffset,
+                           lda, X, xOffset, incX);
+    }
+  }
+
+  return status;
+}
+
+/* STRSV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_strsv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const float *A,
+    const __int64_t aOffset, const int lda, float *X, const __int64_t xOffset,
+    const int incX) {
+  return trsv<float>(this, accl_view, order, uplo, type, diag, N, A, aOffset,
+                     lda, X, xOffset, incX);
+}
+
+/* DTRSV - Inputs and outputs are device pointers */
+hcblasStatus Hcblaslibrary::hcblas_dtrsv(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose type, hcblasDiag diag, const int N, const double *A,
+    const __int64_t aOffset, const int lda, double *X, const __int64_t xOffset,
+    const int incX) {
+  return trsv<double>(this, accl_view, order, uplo, type, diag, N, A, aOffset,
+                      lda, X, xOffset, incX);
+}
@@ -22,14 +22,37 @@ THE SOFTWARE.
 
 #include "include/hcblas.h"
 #include "include/hcblaslib.h"
+#include "include/hcblas_cpu.h"
+#include "include/hcblas_out_of_core.h"
+#include "include/hcblas_trace.h"
+#include "blas/modules/routine_modules.h"
+#include <algorithm>
 #include <iostream>
+#include <new>
+
+// Argument formatting for the HCBLAS_LAYER call trace
+static char traceOrder(hcblasHandle_t handle) {
+  return handle->Order == RowMajor ? 'R' : 'C';
+}
+
+static char traceOp(hcblasOperation_t op) {
+  return op == HCBLAS_OP_N ? 'N' : (op == HCBLAS_OP_T ? 'T' : 'C');
+}
+
+// While the calling thread captures with handle, hcblasSgemm, hcblasSgemv
+// and hcblasSaxpy are recorded and every other routine that touches device
+// memory refuses to run, so nothing executes ahead of the recorded calls.
+static bool capturing(hcblasHandle_t handle) {
+  return handle->capturePlan() != NULL;
+}
 
 // hcblas Helper functions
 
 // 1. hcblasCreate()
 
 // This function initializes the HCBLAS library and creates a handle to an
-// opaque structure holding the HCBLAS library context.
+// opaque structure holding the HCBLAS library context. The backend is
+// chosen by hcblasDefaultBackend().
 
 // Return Values
 // --------------------------------------------------------------------
@@ -40,7 +63,7 @@ hcblasStatus_t hcblasCreate(hcblasHandle_t *handle, hc::accelerator_view *av) {
   if (handle == NULL) {
     handle = new hcblasHandle_t();
   }
-  *handle = new Hcblaslibrary(av);
+  *handle = hcblasNewLibrary(av, hcblasDefaultBackend(av->get_accelerator()));
 
   if (*handle == NULL) {
     return HCBLAS_STATUS_ALLOC_FAILED;
@@ -63,6 +86,8 @@ int hisinf(hc::half raw) __HC_FP16_DECL_SUFFIX__ {
 // This function releases hardware resources used by the HCBLAS library.
 // This function is usually the last call with a particular handle to the HCBLAS
 // library.
+// Captures still open with the handle, on any thread, are dropped and their
+// plans released.
 
 // Return Values
 // ---------------------------------------------------------------------
@@ -86,6 +111,10 @@ hcblasStatus_t hcblasDestroy(hcblasHandle_t *handle) {
 // stream is not set, all kernels use the defaultNULL stream. In particular,
 // this routine can be used to change the stream between kernel launches and
 // then to reset the hcBLAS library stream back to NULL.
+// The stream set here is the handle default; threads that bound their own
+// stream with hcblasSetThreadAcclView() keep using it. The call may race with
+// hcBLAS calls on other threads: each call launches on the stream it
+// resolved when it started.
 
 // Return Values
 // -------------------------------------------------------------------------
@@ -97,8 +126,7 @@ hcblasStatus_t hcblasSetAcclView(hcblasHandle_t handle,
   if (handle == nullptr || handle->initialized == false) {
     return HCBLAS_STATUS_NOT_INITIALIZED;
   }
-  handle->currentAcclView = accl_view;
-  handle->currentStream = stream;
+  handle->setDefaultAcclView(accl_view, stream);
   return HCBLAS_STATUS_SUCCESS;
 }
 
@@ -107,6 +135,10 @@ hcblasStatus_t hcblasSetAcclView(hcblasHandle_t handle,
 // This function gets the hcBLAS library stream, which is being used to execute
 // all calls to the hcBLAS library functions. If the hcBLAS library stream is
 // not set, all kernels use the defaultNULL stream.
+// The stream returned is the one the calling thread launches on, its own
+// binding if it has one. The returned view is owned by the handle and stays
+// valid until the handle is destroyed, whatever the calling thread binds or
+// clears in the meantime on this or other handles.
 
 // Return Values
 // --------------------------------------------------------------------------
@@ -119,8 +151,13 @@ hcblasStatus_t hcblasGetAcclView(hcblasHandle_t handle,
   if (handle == nullptr) {
     return HCBLAS_STATUS_NOT_INITIALIZED;
   }
-  accl_view = &handle->currentAcclView;
-  stream = &(handle->currentStream);
+  // Either the calling thread's node of the handle's binding table or the
+  // handle's published default; neither moves while the handle lives
+  const hcblasStreamBinding &binding = handle->binding();
+  accl_view = const_cast<hc::accelerator_view *>(&binding.acclView);
+  if (stream != nullptr) {
+    *stream = binding.stream;
+  }
   return HCBLAS_STATUS_SUCCESS;
 }
 
@@ -152,6 +189,7 @@ hcblasStatus_t hcblasSetVector(hcblasHandle_t handle, int n, int elemSize,
 
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
   if (incx <= 0 || incy <= 0 || elemSize <= 0) {
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -165,7 +203,7 @@ hcblasStatus_t hcblasSetVector(hcblasHandle_t handle, int n, int elemSize,
     return HCBLAS_STATUS_MAPPING_ERROR;
   }
 
-  handle->currentAcclView.copy(x, y, elemSize * n);
+  handle->acclView().copy(x, y, elemSize * n);
   return HCBLAS_STATUS_SUCCESS;
 }
 
@@ -197,6 +235,7 @@ hcblasStatus_t hcblasGetVector(hcblasHandle_t handle, int n, int elemSize,
 
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
   if (incx <= 0 || incy <= 0 || elemSize <= 0) {
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -210,7 +249,7 @@ hcblasStatus_t hcblasGetVector(hcblasHandle_t handle, int n, int elemSize,
     return HCBLAS_STATUS_MAPPING_ERROR;
   }
 
-  handle->currentAcclView.copy(x, y, elemSize * n);
+  handle->acclView().copy(x, y, elemSize * n);
   return HCBLAS_STATUS_SUCCESS;
 }
 
@@ -244,6 +283,7 @@ hcblasStatus_t hcblasSetMatrix(hcblasHandle_t handle, int rows, int cols,
 
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
   if (rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || elemSize <= 0) {
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -257,7 +297,7 @@ hcblasStatus_t hcblasSetMatrix(hcblasHandle_t handle, int rows, int cols,
     return HCBLAS_STATUS_MAPPING_ERROR;
   }
 
-  handle->currentAcclView.copy(A, B, elemSize * rows * cols);
+  handle->acclView().copy(A, B, elemSize * rows * cols);
 
   return HCBLAS_STATUS_SUCCESS;
 }
@@ -293,6 +333,7 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
 
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
   if (rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || elemSize <= 0) {
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -306,8 +347,448 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
     return HCBLAS_STATUS_MAPPING_ERROR;
   }
 
-  handle->currentAcclView.copy(A, B, elemSize * rows * cols);
+  handle->acclView().copy(A, B, elemSize * rows * cols);
+
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 7. hcblasSetThreadAcclView()
+
+// This function binds a stream to the handle for the calling thread only.
+// Subsequent hcBLAS calls made by this thread with this handle execute on
+// accl_view, whatever the handle default set by hcblasSetAcclView() is, and
+// calls made by other threads are unaffected. This lets many threads share a
+// single handle while each keeps its own stream. Binding again replaces the
+// previous binding of the thread.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the stream was bound successfully
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasSetThreadAcclView(hcblasHandle_t handle,
+                                       hc::accelerator_view &accl_view,
+                                       void *stream) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  handle->bindThreadAcclView(accl_view, stream);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 8. hcblasClearThreadAcclView()
+
+// This function removes the stream bound by hcblasSetThreadAcclView() for the
+// calling thread, which goes back to the handle default stream.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the binding was removed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasClearThreadAcclView(hcblasHandle_t handle) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  handle->unbindThreadAcclView();
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 9. hcblasBeginCapture()
+
+// This function starts recording the hcBLAS calls the calling thread makes
+// with handle. While capturing, hcblas<t>gemm(), hcblas<t>gemv() and
+// hcblas<t>axpy() for <t> = S validate their arguments, pick their kernel
+// and append the launch to the plan instead of executing it. The other
+// routines that take handle and access device memory (including the
+// hcblasSet/Get<Vector|Matrix>() copies) cannot be recorded: they return
+// HCBLAS_STATUS_INVALID_VALUE without running, so nothing executes out of
+// order with the recorded calls. Other threads using the same handle are
+// not affected. Handles on the CPU backend run every call immediately and
+// cannot capture.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            capture started
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      the thread is already capturing on handle,
+//                                  or handle runs on the CPU backend
+// HCBLAS_STATUS_ALLOC_FAILED       the plan could not be allocated
+
+hcblasStatus_t hcblasBeginCapture(hcblasHandle_t handle) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (handle->backend != HccBackend || handle->capturePlan() != NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  hcblasPlan *plan = new (std::nothrow) hcblasPlan();
+  if (plan == NULL) {
+    return HCBLAS_STATUS_ALLOC_FAILED;
+  }
+  handle->beginCapture(plan);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 10. hcblasEndCapture()
+
+// This function stops the capture started by hcblasBeginCapture() on the
+// calling thread and returns the recorded calls in *plan.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the plan was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      plan is NULL or the thread is not
+//                                  capturing on handle
+
+hcblasStatus_t hcblasEndCapture(hcblasHandle_t handle, hcblasPlan_t *plan) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (plan == NULL || handle->capturePlan() == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *plan = handle->capturePlan();
+  handle->endCapture();
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 11. hcblasLaunchPlan()
+
+// This function launches the calls recorded in plan, in capture order, on the
+// stream the calling thread uses with handle. Arguments were checked and
+// kernels chosen at capture time, so a launch only enqueues the kernels.
+// Scalars are the values passed at capture time; device pointers are those
+// of the capture unless changed with hcblasPlanRebind().
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the plan was launched
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      plan is NULL
+// HCBLAS_STATUS_EXECUTION_FAILED   a recorded call failed to launch
+
+hcblasStatus_t hcblasLaunchPlan(hcblasHandle_t handle, hcblasPlan_t plan) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (plan == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  if (plan->launch(handle->acclView()) != HCBLAS_SUCCEEDS) {
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+  }
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 12. hcblasPlanRebind()
+
+// This function replaces the device pointer from with to in every call
+// recorded in plan, so the same plan can run on other buffers. The new
+// buffers must be large enough for the recorded shapes and offsets.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the pointer was replaced
+// HCBLAS_STATUS_INVALID_VALUE      plan or to is NULL, or from is not used
+//                                  by plan
+
+hcblasStatus_t hcblasPlanRebind(hcblasPlan_t plan, const void *from,
+                                void *to) {
+  if (plan == NULL || to == NULL || plan->rebind(from, to) == 0) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 13. hcblasDestroyPlan()
+
+// This function releases a plan returned by hcblasEndCapture().
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the plan was released
+// HCBLAS_STATUS_INVALID_VALUE      plan is NULL
+
+hcblasStatus_t hcblasDestroyPlan(hcblasPlan_t plan) {
+  if (plan == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  delete plan;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 14. hcblasCreateWithBackend()
+
+// This function creates a handle like hcblasCreate() whose routines run on
+// backend.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            initialization succeeded
+// HCBLAS_STATUS_INVALID_VALUE      backend is not a hcblasBackend_t value
+// HCBLAS_STATUS_ALLOC_FAILED       the resources could not be allocated
+
+hcblasStatus_t hcblasCreateWithBackend(hcblasHandle_t *handle,
+                                       hc::accelerator_view *av,
+                                       hcblasBackend_t backend) {
+  if (handle == NULL) {
+    handle = new hcblasHandle_t();
+  }
+  hcblasBackend kind;
+  switch (backend) {
+    case HCBLAS_BACKEND_DEFAULT:
+      kind = hcblasDefaultBackend(av->get_accelerator());
+      break;
+    case HCBLAS_BACKEND_HCC:
+      kind = HccBackend;
+      break;
+    case HCBLAS_BACKEND_CPU:
+      kind = CpuBackend;
+      break;
+    default:
+      return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *handle = hcblasNewLibrary(av, kind);
+
+  if (*handle == NULL) {
+    return HCBLAS_STATUS_ALLOC_FAILED;
+  }
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 15. hcblasGetBackend()
+
+// This function returns in *backend where the routines of handle run.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the backend was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      backend is NULL
+
+hcblasStatus_t hcblasGetBackend(hcblasHandle_t handle,
+                                hcblasBackend_t *backend) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (backend == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *backend = (handle->backend == CpuBackend) ? HCBLAS_BACKEND_CPU
+                                             : HCBLAS_BACKEND_HCC;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 16. hcblasXtCreate()
+
+// This function creates a handle for the multi-device hcblasXt routines on
+// every accelerator returned by hc::accelerator::get_all() that is neither
+// the CPU nor emulated, or on the CPU if there is no other.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            initialization succeeded
+// HCBLAS_STATUS_INVALID_VALUE      handle is NULL
+// HCBLAS_STATUS_ALLOC_FAILED       the resources could not be allocated
+
+hcblasStatus_t hcblasXtCreate(hcblasXtHandle_t *handle) {
+  if (handle == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *handle = new (std::nothrow) hcblasXtContext();
+  if (*handle == NULL) {
+    return HCBLAS_STATUS_ALLOC_FAILED;
+  }
+  if ((*handle)->initialized == false) {
+    delete *handle;
+    *handle = NULL;
+    return HCBLAS_STATUS_ALLOC_FAILED;
+  }
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 17. hcblasXtDestroy()
+
+// This function releases the devices of an hcblasXt handle.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the shut down succeeded
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+
+hcblasStatus_t hcblasXtDestroy(hcblasXtHandle_t *handle) {
+  if (handle == nullptr || *handle == nullptr ||
+      (*handle)->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  delete *handle;
+  *handle = nullptr;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 18. hcblasXtDeviceSelect()
+
+// This function makes the hcblasXt routines of handle run on the nbDevices
+// accelerators whose indices in hc::accelerator::get_all() are listed in
+// deviceId.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the devices were selected
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      nbDevices<1, deviceId is NULL or an index
+//                                  is out of range or repeated
+// HCBLAS_STATUS_ALLOC_FAILED       the resources could not be allocated
+
+hcblasStatus_t hcblasXtDeviceSelect(hcblasXtHandle_t handle, int nbDevices,
+                                    const int deviceId[]) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (nbDevices < 1 || deviceId == NULL) return HCBLAS_STATUS_INVALID_VALUE;
+
+  std::vector<int> ids(deviceId, deviceId + nbDevices);
+  int count = static_cast<int>(hc::accelerator::get_all().size());
+  for (int i = 0; i < nbDevices; i++) {
+    if (ids[i] < 0 || ids[i] >= count ||
+        std::count(ids.begin(), ids.end(), ids[i]) > 1)
+      return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  if (!handle->select(ids)) return HCBLAS_STATUS_ALLOC_FAILED;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 19. hcblasXtSetBlockDim()
+
+// This function sets the side of the square blocks of C that the hcblasXt
+// routines share out among the devices; the default is 2048.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the block size was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      blockDim<1
+
+hcblasStatus_t hcblasXtSetBlockDim(hcblasXtHandle_t handle, int blockDim) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (blockDim < 1) return HCBLAS_STATUS_INVALID_VALUE;
+  handle->blockDim = blockDim;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 20. hcblasXtGetBlockDim()
+
+// This function returns in *blockDim the side of the blocks of C that the
+// hcblasXt routines share out among the devices.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the block size was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      blockDim is NULL
+
+hcblasStatus_t hcblasXtGetBlockDim(hcblasXtHandle_t handle, int *blockDim) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (blockDim == NULL) return HCBLAS_STATUS_INVALID_VALUE;
+  *blockDim = handle->blockDim;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// hcblasRoutine_t has one bit per hcblasModuleRoutine
+static_assert(HCBLAS_ROUTINE_SGEMM == 1u << ModuleSgemm &&
+                  HCBLAS_ROUTINE_DGEMM == 1u << ModuleDgemm &&
+                  HCBLAS_ROUTINE_HGEMM == 1u << ModuleHgemm &&
+                  HCBLAS_ROUTINE_CGEMM == 1u << ModuleCgemm &&
+                  HCBLAS_ROUTINE_ZGEMM == 1u << ModuleZgemm &&
+                  HCBLAS_ROUTINE_ALL == (1u << ModuleRoutines) - 1,
+              "hcblasRoutine_t does not match hcblasModuleRoutine");
+
+// 21. hcblasWarmup()
+
+// This function loads the modules of the routines in routines, a
+// combination of hcblasRoutine_t values, so that their first call does not
+// pay for it. Routines built into the library, and handles on the CPU
+// backend, need no loading and the call then does nothing.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the modules are loaded
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      routines is not a combination of
+//                                  hcblasRoutine_t values
+// HCBLAS_STATUS_INTERNAL_ERROR     a module could not be loaded
+
+hcblasStatus_t hcblasWarmup(hcblasHandle_t handle, unsigned int routines) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasWarmup",
+                        "routines=%u", routines);
+
+  if (routines & ~HCBLAS_ROUTINE_ALL) return HCBLAS_STATUS_INVALID_VALUE;
+  // The CPU backend replaces every routine and uses no module
+  if (handle->backend == CpuBackend) return HCBLAS_STATUS_SUCCESS;
+
+  hcblasModuleRegistry &modules = hcblasRoutineModules();
+  for (int r = 0; r < ModuleRoutines; r++) {
+    hcblasModuleRoutine routine = static_cast<hcblasModuleRoutine>(r);
+    if ((routines >> r) & 1u && modules.isModule(routine) &&
+        modules.entries(routine) == NULL) {
+      return HCBLAS_STATUS_INTERNAL_ERROR;
+    }
+  }
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 22. hcblasGetModuleLoadTime()
+
+// This function returns in *milliseconds how long loading the module of
+// routine took: 0 if the routine is built into the library and a negative
+// value if its module has not been loaded (yet, or it failed to load).
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the time was returned
+// HCBLAS_STATUS_INVALID_VALUE      routine is not a single hcblasRoutine_t
+//                                  value, or milliseconds is NULL
+
+hcblasStatus_t hcblasGetModuleLoadTime(hcblasRoutine_t routine,
+                                       double *milliseconds) {
+  if (milliseconds == NULL) return HCBLAS_STATUS_INVALID_VALUE;
+  for (int r = 0; r < ModuleRoutines; r++) {
+    if (routine == 1u << r) {
+      *milliseconds = hcblasRoutineModules().loadMilliseconds(
+          static_cast<hcblasModuleRoutine>(r));
+      return HCBLAS_STATUS_SUCCESS;
+    }
+  }
+  return HCBLAS_STATUS_INVALID_VALUE;
+}
+
+// 23. hcblasGetGemmCacheStats()
+
+// This function returns how many GEMM calls on handle found their kernel in
+// the handle's decision cache (*hits) and how many had to select it
+// (*misses). A call hits when an earlier one had the same precision, order,
+// transposes, sizes, leading dimensions and operand alignment. Only SGEMM
+// consults the cache so far.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the counts were returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      hits or misses is NULL
 
+hcblasStatus_t hcblasGetGemmCacheStats(hcblasHandle_t handle,
+                                       unsigned long long *hits,
+                                       unsigned long long *misses) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (hits == NULL || misses == NULL) return HCBLAS_STATUS_INVALID_VALUE;
+  *hits = handle->gemmDecisions.hits();
+  *misses = handle->gemmDecisions.misses();
   return HCBLAS_STATUS_SUCCESS;
 }
 
@@ -357,9 +838,13 @@ hcblasStatus_t hcblasSasum(hcblasHandle_t handle, const int n, float *x,
                            const int incx, float *result) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSasum",
+                        "order=%c,n=%d,incx=%d", traceOrder(handle), n, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_sasum(handle->currentAcclView, n, x, incx, xOffset,
+  status = handle->hcblas_sasum(handle->acclView(), n, x, incx, xOffset,
                                 result);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -372,10 +857,15 @@ hcblasStatus_t hcblasSasumBatched(hcblasHandle_t handle, const int n, float *x,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSasumBatched",
+                        "order=%c,n=%d,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, incx, batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_sasum(handle->currentAcclView, n, x, incx, xOffset,
+  status = handle->hcblas_sasum(handle->acclView(), n, x, incx, xOffset,
                                 result, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -387,9 +877,13 @@ hcblasStatus_t hcblasDasum(hcblasHandle_t handle, const int n, double *x,
                            const int incx, double *result) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDasum",
+                        "order=%c,n=%d,incx=%d", traceOrder(handle), n, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_dasum(handle->currentAcclView, n, x, incx, xOffset,
+  status = handle->hcblas_dasum(handle->acclView(), n, x, incx, xOffset,
                                 result);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -402,10 +896,15 @@ hcblasStatus_t hcblasDasumBatched(hcblasHandle_t handle, const int n, double *x,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDasumBatched",
+                        "order=%c,n=%d,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, incx, batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_dasum(handle->currentAcclView, n, x, incx, xOffset,
+  status = handle->hcblas_dasum(handle->acclView(), n, x, incx, xOffset,
                                 result, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -445,11 +944,21 @@ hcblasStatus_t hcblasSaxpy(hcblasHandle_t handle, int n, const float *alpha,
                            const float *x, int incx, float *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSaxpy",
+                        "order=%c,n=%d,alpha=%g,incx=%d,incy=%d",
+                        traceOrder(handle), n, *alpha, incx, incy);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_saxpy(handle->currentAcclView, n, *alpha, x, incx, y,
-                                incy, xOffset, yOffset);
+  hcblasPlan *plan = handle->capturePlan();
+  if (plan != NULL) {
+    status = handle->hcblas_saxpy_capture(plan, handle->acclView(), n, *alpha,
+                                          x, incx, y, incy, xOffset, yOffset);
+  } else {
+    status = handle->hcblas_saxpy(handle->acclView(), n, *alpha, x, incx, y,
+                                  incy, xOffset, yOffset);
+  }
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -460,10 +969,15 @@ hcblasStatus_t hcblasDaxpy(hcblasHandle_t handle, int n, const double *alpha,
                            const double *x, int incx, double *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDaxpy",
+                        "order=%c,n=%d,alpha=%g,incx=%d,incy=%d",
+                        traceOrder(handle), n, *alpha, incx, incy);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_daxpy(handle->currentAcclView, n, *alpha, x, incx, y,
+  status = handle->hcblas_daxpy(handle->acclView(), n, *alpha, x, incx, y,
                                 incy, xOffset, yOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -476,12 +990,17 @@ hcblasStatus_t hcblasSaxpyBatched(hcblasHandle_t handle, int n,
                                   float *y, int incy, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSaxpyBatched",
+                        "order=%c,n=%d,alpha=%g,incx=%d,incy=%d,batchCount=%d",
+                        traceOrder(handle), n, *alpha, incx, incy, batchCount);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   __int64_t X_batchOffset = n;
   __int64_t Y_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_saxpy(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_saxpy(handle->acclView(), n, *alpha, x, incx,
                                 X_batchOffset, y, incy, Y_batchOffset, xOffset,
                                 yOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -519,10 +1038,15 @@ hcblasStatus_t hcblasScopy(hcblasHandle_t handle, int n, const float *x,
                            int incx, float *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasScopy",
+                        "order=%c,n=%d,incx=%d,incy=%d", traceOrder(handle), n,
+                        incx, incy);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_scopy(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_scopy(handle->acclView(), n, x, incx, xOffset, y,
                                 incy, yOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -535,12 +1059,17 @@ hcblasStatus_t hcblasScopyBatched(hcblasHandle_t handle, int n, const float *x,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasScopyBatched",
+                        "order=%c,n=%d,incx=%d,incy=%d,batchCount=%d",
+                        traceOrder(handle), n, incx, incy, batchCount);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   __int64_t X_batchOffset = n;
   __int64_t Y_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_scopy(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_scopy(handle->acclView(), n, x, incx, xOffset, y,
                                 incy, yOffset, X_batchOffset, Y_batchOffset,
                                 batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -553,10 +1082,15 @@ hcblasStatus_t hcblasDcopy(hcblasHandle_t handle, int n, const double *x,
                            int incx, double *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDcopy",
+                        "order=%c,n=%d,incx=%d,incy=%d", traceOrder(handle), n,
+                        incx, incy);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_dcopy(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_dcopy(handle->acclView(), n, x, incx, xOffset, y,
                                 incy, yOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -569,12 +1103,17 @@ hcblasStatus_t hcblasDcopyBatched(hcblasHandle_t handle, int n, const double *x,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDcopyBatched",
+                        "order=%c,n=%d,incx=%d,incy=%d,batchCount=%d",
+                        traceOrder(handle), n, incx, incy, batchCount);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   __int64_t X_batchOffset = n;
   __int64_t Y_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_dcopy(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_dcopy(handle->acclView(), n, x, incx, xOffset, y,
                                 incy, yOffset, X_batchOffset, Y_batchOffset,
                                 batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -614,10 +1153,15 @@ hcblasStatus_t hcblasSdot(hcblasHandle_t handle, int n, const float *x,
                           int incx, const float *y, int incy, float *result) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSdot",
+                        "order=%c,n=%d,incx=%d,incy=%d", traceOrder(handle), n,
+                        incx, incy);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_sdot(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_sdot(handle->acclView(), n, x, incx, xOffset, y,
                                incy, yOffset, *result);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -630,12 +1174,17 @@ hcblasStatus_t hcblasSdotBatched(hcblasHandle_t handle, int n, const float *x,
                                  float *result, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSdotBatched",
+                        "order=%c,n=%d,incx=%d,incy=%d,batchCount=%d",
+                        traceOrder(handle), n, incx, incy, batchCount);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   __int64_t X_batchOffset = n;
   __int64_t Y_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_sdot(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_sdot(handle->acclView(), n, x, incx, xOffset, y,
                                incy, yOffset, *result, X_batchOffset,
                                Y_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -648,10 +1197,15 @@ hcblasStatus_t hcblasDdot(hcblasHandle_t handle, int n, const double *x,
                           int incx, const double *y, int incy, double *result) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDdot",
+                        "order=%c,n=%d,incx=%d,incy=%d", traceOrder(handle), n,
+                        incx, incy);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_ddot(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_ddot(handle->acclView(), n, x, incx, xOffset, y,
                                incy, yOffset, *result);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -664,12 +1218,17 @@ hcblasStatus_t hcblasDdotBatched(hcblasHandle_t handle, int n, const double *x,
                                  double *result, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDdotBatched",
+                        "order=%c,n=%d,incx=%d,incy=%d,batchCount=%d",
+                        traceOrder(handle), n, incx, incy, batchCount);
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   __int64_t X_batchOffset = n;
   __int64_t Y_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_ddot(handle->currentAcclView, n, x, incx, xOffset, y,
+  status = handle->hcblas_ddot(handle->acclView(), n, x, incx, xOffset, y,
                                incy, yOffset, *result, X_batchOffset,
                                Y_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -707,9 +1266,14 @@ hcblasStatus_t hcblasSscal(hcblasHandle_t handle, int n, const float *alpha,
                            float *x, int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSscal",
+                        "order=%c,n=%d,alpha=%g,incx=%d", traceOrder(handle), n,
+                        *alpha, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_sscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_sscal(handle->acclView(), n, *alpha, x, incx,
                                 xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -722,10 +1286,15 @@ hcblasStatus_t hcblasSscalBatched(hcblasHandle_t handle, int n,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSscalBatched",
+                        "order=%c,n=%d,alpha=%g,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, *alpha, incx, batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_sscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_sscal(handle->acclView(), n, *alpha, x, incx,
                                 xOffset, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -737,9 +1306,14 @@ hcblasStatus_t hcblasDscal(hcblasHandle_t handle, int n, const double *alpha,
                            double *x, int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDscal",
+                        "order=%c,n=%d,alpha=%g,incx=%d", traceOrder(handle), n,
+                        *alpha, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_dscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_dscal(handle->acclView(), n, *alpha, x, incx,
                                 xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -752,10 +1326,15 @@ hcblasStatus_t hcblasDscalBatched(hcblasHandle_t handle, int n,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDscalBatched",
+                        "order=%c,n=%d,alpha=%g,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, *alpha, incx, batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_dscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_dscal(handle->acclView(), n, *alpha, x, incx,
                                 xOffset, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -767,10 +1346,15 @@ hcblasStatus_t hcblasCscal(hcblasHandle_t handle, int n, const hcComplex *alpha,
                            hcComplex *x, int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasCscal",
+                        "order=%c,n=%d,alpha=%g%+gi,incx=%d",
+                        traceOrder(handle), n, alpha->x, alpha->y, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_cscal(
-      handle->currentAcclView, n,
+      handle->acclView(), n,
       *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
       reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
@@ -784,11 +1368,17 @@ hcblasStatus_t hcblasCscalBatched(hcblasHandle_t handle, int n,
                                   int incx, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasCscalBatched",
+                        "order=%c,n=%d,alpha=%g%+gi,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, alpha->x, alpha->y, incx,
+                        batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
   status = handle->hcblas_cscal(
-      handle->currentAcclView, n,
+      handle->acclView(), n,
       *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
       reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset,
       X_batchOffset, batchCount);
@@ -803,10 +1393,15 @@ hcblasStatus_t hcblasZscal(hcblasHandle_t handle, int n,
                            int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasZscal",
+                        "order=%c,n=%d,alpha=%g%+gi,incx=%d",
+                        traceOrder(handle), n, alpha->x, alpha->y, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_zscal(
-      handle->currentAcclView, n,
+      handle->acclView(), n,
       *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
       reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
@@ -821,11 +1416,17 @@ hcblasStatus_t hcblasZscalBatched(hcblasHandle_t handle, int n,
                                   int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasZscalBatched",
+                        "order=%c,n=%d,alpha=%g%+gi,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, alpha->x, alpha->y, incx,
+                        batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
   status = handle->hcblas_zscal(
-      handle->currentAcclView, n,
+      handle->acclView(), n,
       *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
       reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset,
       X_batchOffset, batchCount);
@@ -839,10 +1440,15 @@ hcblasStatus_t hcblasCsscal(hcblasHandle_t handle, int n, const float *alpha,
                             hcComplex *x, int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasCsscal",
+                        "order=%c,n=%d,alpha=%g,incx=%d", traceOrder(handle), n,
+                        *alpha, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_csscal(
-      handle->currentAcclView, n, *alpha,
+      handle->acclView(), n, *alpha,
       reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -855,11 +1461,16 @@ hcblasStatus_t hcblasCsscalBatched(hcblasHandle_t handle, int n,
                                    int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasCsscalBatched",
+                        "order=%c,n=%d,alpha=%g,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, *alpha, incx, batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
   status =
-      handle->hcblas_csscal(handle->currentAcclView, n, *alpha,
+      handle->hcblas_csscal(handle->acclView(), n, *alpha,
                             reinterpret_cast<hc::short_vector::float2 *>(x),
                             incx, xOffset, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -872,10 +1483,15 @@ hcblasStatus_t hcblasZdscal(hcblasHandle_t handle, int n, const double *alpha,
                             hcDoubleComplex *x, int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasZdscal",
+                        "order=%c,n=%d,alpha=%g,incx=%d", traceOrder(handle), n,
+                        *alpha, incx);
   __int64_t xOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_zdscal(
-      handle->currentAcclView, n, *alpha,
+      handle->acclView(), n, *alpha,
       reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -888,11 +1504,16 @@ hcblasStatus_t hcblasZdscalBatched(hcblasHandle_t handle, int n,
                                    int incx, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasZdscalBatched",
+                        "order=%c,n=%d,alpha=%g,incx=%d,batchCount=%d",
+                        traceOrder(handle), n, *alpha, incx, batchCount);
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
   status =
-      handle->hcblas_zdscal(handle->currentAcclView, n, *alpha,
+      handle->hcblas_zdscal(handle->acclView(), n, *alpha,
                             reinterpret_cast<hc::short_vector::double2 *>(x),
                             incx, xOffset, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -971,6 +1592,11 @@ hcblasStatus_t hcblasSgemv(hcblasHandle_t handle, hcblasOperation_t trans,
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
 
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemv",
+                        "order=%c,trans=%c,m=%d,n=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d", traceOrder(handle), traceOp(trans),
+                        m, n, *alpha, lda, incx, *beta, incy);
+
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
 
@@ -980,9 +1606,16 @@ hcblasStatus_t hcblasSgemv(hcblasHandle_t handle, hcblasOperation_t trans,
   hcblasStatus status;
   hcblasTranspose transA;
   transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
-  status = handle->hcblas_sgemv(handle->currentAcclView, handle->Order, transA,
-                                m, n, *alpha, A, aOffset, lda, x, xOffset, incx,
-                                *beta, y, yOffset, incy);
+  hcblasPlan *plan = handle->capturePlan();
+  if (plan != NULL) {
+    status = handle->hcblas_sgemv_capture(
+        plan, handle->acclView(), handle->Order, transA, m, n, *alpha, A,
+        aOffset, lda, x, xOffset, incx, *beta, y, yOffset, incy);
+  } else {
+    status = handle->hcblas_sgemv(handle->acclView(), handle->Order, transA,
+                                  m, n, *alpha, A, aOffset, lda, x, xOffset,
+                                  incx, *beta, y, yOffset, incy);
+  }
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -996,6 +1629,13 @@ hcblasStatus_t hcblasSgemvBatched(hcblasHandle_t handle,
                                   float *y, int incy, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemvBatched",
+                        "order=%c,trans=%c,m=%d,n=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d,batchCount=%d", traceOrder(handle),
+                        traceOp(trans), m, n, *alpha, lda, incx, *beta, incy,
+                        batchCount);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1017,7 +1657,7 @@ hcblasStatus_t hcblasSgemvBatched(hcblasHandle_t handle,
   __int64_t X_batchOffset = row;
   __int64_t Y_batchOffset = col;
   __int64_t A_batchOffset = row * col;
-  status = handle->hcblas_sgemv(handle->currentAcclView, handle->Order, transA,
+  status = handle->hcblas_sgemv(handle->acclView(), handle->Order, transA,
                                 m, n, *alpha, A, aOffset, A_batchOffset, lda, x,
                                 xOffset, X_batchOffset, incx, *beta, y, yOffset,
                                 Y_batchOffset, incy, batchCount);
@@ -1034,6 +1674,12 @@ hcblasStatus_t hcblasDgemv(hcblasHandle_t handle, hcblasOperation_t trans,
                            double *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgemv",
+                        "order=%c,trans=%c,m=%d,n=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d", traceOrder(handle), traceOp(trans),
+                        m, n, *alpha, lda, incx, *beta, incy);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1044,7 +1690,7 @@ hcblasStatus_t hcblasDgemv(hcblasHandle_t handle, hcblasOperation_t trans,
   hcblasStatus status;
   hcblasTranspose transA;
   transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
-  status = handle->hcblas_dgemv(handle->currentAcclView, handle->Order, transA,
+  status = handle->hcblas_dgemv(handle->acclView(), handle->Order, transA,
                                 m, n, *alpha, A, aOffset, lda, x, xOffset, incx,
                                 *beta, y, yOffset, incy);
   if (status == HCBLAS_SUCCEEDS)
@@ -1060,6 +1706,13 @@ hcblasStatus_t hcblasDgemvBatched(hcblasHandle_t handle,
                                   double *y, int incy, int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgemvBatched",
+                        "order=%c,trans=%c,m=%d,n=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d,batchCount=%d", traceOrder(handle),
+                        traceOp(trans), m, n, *alpha, lda, incx, *beta, incy,
+                        batchCount);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1081,7 +1734,7 @@ hcblasStatus_t hcblasDgemvBatched(hcblasHandle_t handle,
   __int64_t X_batchOffset = row;
   __int64_t Y_batchOffset = col;
   __int64_t A_batchOffset = row * col;
-  status = handle->hcblas_dgemv(handle->currentAcclView, handle->Order, transA,
+  status = handle->hcblas_dgemv(handle->acclView(), handle->Order, transA,
                                 m, n, *alpha, A, aOffset, A_batchOffset, lda, x,
                                 xOffset, X_batchOffset, incx, *beta, y, yOffset,
                                 Y_batchOffset, incy, batchCount);
@@ -1132,6 +1785,11 @@ hcblasStatus_t hcblasSger(hcblasHandle_t handle, int m, int n,
                           const float *y, int incy, float *A, int lda) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSger",
+                        "order=%c,m=%d,n=%d,alpha=%g,incx=%d,incy=%d,lda=%d",
+                        traceOrder(handle), m, n, *alpha, incx, incy, lda);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1141,7 +1799,7 @@ hcblasStatus_t hcblasSger(hcblasHandle_t handle, int m, int n,
   __int64_t aOffset = 0;
   hcblasStatus status;
   status =
-      handle->hcblas_sger(handle->currentAcclView, handle->Order, m, n, *alpha,
+      handle->hcblas_sger(handle->acclView(), handle->Order, m, n, *alpha,
                           x, xOffset, incx, y, yOffset, incy, A, aOffset, lda);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1155,6 +1813,12 @@ hcblasStatus_t hcblasSgerBatched(hcblasHandle_t handle, int m, int n,
                                  int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgerBatched",
+                        "order=%c,m=%d,n=%d,alpha=%g,incx=%d,incy=%d,lda=%d,"
+                        "batchCount=%d", traceOrder(handle), m, n, *alpha, incx,
+                        incy, lda, batchCount);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1166,7 +1830,7 @@ hcblasStatus_t hcblasSgerBatched(hcblasHandle_t handle, int m, int n,
   __int64_t Y_batchOffset = n;
   __int64_t A_batchOffset = m * n;
   hcblasStatus status;
-  status = handle->hcblas_sger(handle->currentAcclView, handle->Order, m, n,
+  status = handle->hcblas_sger(handle->acclView(), handle->Order, m, n,
                                *alpha, x, xOffset, X_batchOffset, incx, y,
                                yOffset, Y_batchOffset, incy, A, aOffset,
                                A_batchOffset, lda, batchCount);
@@ -1182,6 +1846,11 @@ hcblasStatus_t hcblasDger(hcblasHandle_t handle, int m, int n,
                           const double *y, int incy, double *A, int lda) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDger",
+                        "order=%c,m=%d,n=%d,alpha=%g,incx=%d,incy=%d,lda=%d",
+                        traceOrder(handle), m, n, *alpha, incx, incy, lda);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1191,7 +1860,7 @@ hcblasStatus_t hcblasDger(hcblasHandle_t handle, int m, int n,
   __int64_t aOffset = 0;
   hcblasStatus status;
   status =
-      handle->hcblas_dger(handle->currentAcclView, handle->Order, m, n, *alpha,
+      handle->hcblas_dger(handle->acclView(), handle->Order, m, n, *alpha,
                           x, xOffset, incx, y, yOffset, incy, A, aOffset, lda);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1205,6 +1874,12 @@ hcblasStatus_t hcblasDgerBatched(hcblasHandle_t handle, int m, int n,
                                  int batchCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgerBatched",
+                        "order=%c,m=%d,n=%d,alpha=%g,incx=%d,incy=%d,lda=%d,"
+                        "batchCount=%d", traceOrder(handle), m, n, *alpha, incx,
+                        incy, lda, batchCount);
 
   if (m < 0 || n < 0 || incx == 0 || incy == 0)
     return HCBLAS_STATUS_INVALID_VALUE;
@@ -1216,7 +1891,7 @@ hcblasStatus_t hcblasDgerBatched(hcblasHandle_t handle, int m, int n,
   __int64_t Y_batchOffset = n;
   __int64_t A_batchOffset = m * n;
   hcblasStatus status;
-  status = handle->hcblas_dger(handle->currentAcclView, handle->Order, m, n,
+  status = handle->hcblas_dger(handle->acclView(), handle->Order, m, n,
                                *alpha, x, xOffset, X_batchOffset, incx, y,
                                yOffset, Y_batchOffset, incy, A, aOffset,
                                A_batchOffset, lda, batchCount);
@@ -1226,328 +1901,1691 @@ hcblasStatus_t hcblasDgerBatched(hcblasHandle_t handle, int m, int n,
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-// HCBLAS Level-3 Function Reference
-
-// The Level-3 Basic Linear Algebra Subprograms (BLAS3) functions perform
-// matrix-matrix operations. Unless otherwise specified <type> and <t>
-// have the following meanings:
-
-// <type>       <t>          Meaning
-// ---------------------------------------------------
-// float     ‘s’ or ‘S’      real single-precision
-// double    ‘d’ or ‘D’      real double-precision
-// hcComplex ‘c’ or ‘C’      complex single-precision
-
-// 1. hcblas<t>gemm()
+// 3. hcblas<t>symv() and hcblasChemv()
 
-// This function performs the matrix-matrix multiplication
-// C = α op ( A ) op ( B ) + β C
-// where α and β are scalars, and A , B and C are matrices stored in
-// column-major format with dimensions op ( A ) m × k , op ( B ) k × n
-// and C m × n , respectively. Also, for matrix A
-// op ( A ) = A   if  transa == HCBLAS_OP_N
-//            A^T if  transa == HCBLAS_OP_T
-//            A^H if  transa == HCBLAS_OP_C
-// and op ( B ) is defined similarly for matrix B .
+// This function performs the symmetric (Hermitian for hcblasChemv)
+// matrix-vector multiplication
+// y = α A x + β y
+// where A is a n × n symmetric (Hermitian) matrix stored in lower or upper
+// mode, x and y are vectors, and α and β are scalars. Only the triangle
+// selected by uplo is read; the imaginary part of the diagonal of a Hermitian
+// matrix is assumed to be zero.
 
 // Param.       Memory           In/out         Meaning
 // -------------------------------------------------------------------------------------
 // handle       host             input          handle to the HCBLAS library
 //                                              context.
-// transa       host             input          operation op(A) that is non- or
-//                                              (conj.) transpose.
-// transb       host             input          operation op(B) that is non- or
-//                                              (conj.) transpose.
-// m            host             input          number of rows of matrix op(A)
-//                                              and C.
-// n            host             input          number of rows of matrix op(B)
-//                                              and C.
-// k            host             input          number of columns of op(A) and
-//                                              rows of op(B).
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
 // alpha        host or device   input          <type> scalar used for
 //                                              multiplication.
-// A            device           input          <type> array of dimensions lda x
-//                                              k with lda>=max(1,m)
-//                                              if transa == HCBLAS_OP_N and lda
-//                                              x m with lda>=max(1,k)
-//                                              otherwise.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
 // lda          host             input          leading dimension of
 //                                              two-dimensional array used to
-//                                              store the matrix A.
-// B            device           input          <type> array of dimension ldb x
-//                                              n with ldb>=max(1,k)
-//                                              if transa == HCBLAS_OP_N and ldb
-//                                              x k with ldb>=max(1,n)
-//                                              otherwise.
-// ldb          host             input          leading dimension of
-//                                              two-dimensional array used to
-//                                              store matrix B.
+//                                              store matrix A.
+// x            device           input          <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
 // beta         host or device   input          <type> scalar used for
-//                                              multiplication. If beta==0, C
-//                                              does not have to be a
+//                                              multiplication, if beta==0
+//                                              then y does not have to be a
 //                                              valid input.
-// C            device           in/out         <type> array of dimensions ldc x
-//                                              n with ldc>=max(1,m).
-// ldc          host             input          leading dimension of a
-//                                              two-dimensional array used to
-//                                              store the matrix C.
-// batchCount   host             input          number of pointers contained in
-//                                              input and output arrays.
+// y            device           in/out         <type> vector with n elements.
+// incy         host             input          stride between consecutive
+//                                              elements of y.
 
 // Return Values
 // --------------------------------------------------------------------
 // HCBLAS_STATUS_SUCCESS           the operation completed successfully
 // HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
-// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx,incy<=0
 // HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
 
-hcblasStatus_t hcblasSgemm(hcblasHandle_t handle, hcblasOperation_t transa,
-                           hcblasOperation_t transb, int m, int n, int k,
-                           const float *alpha, float *A, int lda, float *B,
-                           int ldb, const float *beta, float *C, int ldc) {
+hcblasStatus_t hcblasSsymv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const float *alpha, const float *A, int lda,
+                           const float *x, int incx, const float *beta,
+                           float *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSsymv",
+                        "order=%c,uplo=%d,n=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d", traceOrder(handle),
+                        static_cast<int>(uplo), n, *alpha, lda, incx, *beta,
+                        incy);
+
+  if (n < 0 || incx <= 0 || incy <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
 
   __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
   hcblasStatus status;
-  hcblasTranspose transA, transB;
-  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
-  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
-  status = handle->hcblas_sgemm(handle->currentAcclView, handle->Order, transA,
-                                transB, m, n, k, *alpha, A, lda, B, ldb, *beta,
-                                C, ldc, aOffset, bOffset, cOffset);
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_ssymv(handle->acclView(), handle->Order,
+                                uploA, n, *alpha, A, aOffset, lda, x, xOffset,
+                                incx, *beta, y, yOffset, incy);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-hcblasStatus_t hcblasCgemm(hcblasHandle_t handle, hcblasOperation_t transa,
-                           hcblasOperation_t transb, int m, int n, int k,
-                           const hcComplex *alpha, hcComplex *A, int lda,
-                           hcComplex *B, int ldb, const hcComplex *beta,
-                           hcComplex *C, int ldc) {
+hcblasStatus_t hcblasDsymv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const double *alpha, const double *A, int lda,
+                           const double *x, int incx, const double *beta,
+                           double *y, int incy) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDsymv",
+                        "order=%c,uplo=%d,n=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d", traceOrder(handle),
+                        static_cast<int>(uplo), n, *alpha, lda, incx, *beta,
+                        incy);
 
-  __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
+  if (n < 0 || incx <= 0 || incy <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
 
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
   hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_dsymv(handle->acclView(), handle->Order,
+                                uploA, n, *alpha, A, aOffset, lda, x, xOffset,
+                                incx, *beta, y, yOffset, incy);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
 
-  hcblasTranspose transA, transB;
-  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
-  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+hcblasStatus_t hcblasChemv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const hcComplex *alpha, const hcComplex *A, int lda,
+                           const hcComplex *x, int incx, const hcComplex *beta,
+                           hcComplex *y, int incy) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  status = handle->hcblas_cgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
-      reinterpret_cast<hc::short_vector::float2 *>(A), aOffset, lda,
-      reinterpret_cast<hc::short_vector::float2 *>(B), bOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(beta)),
-      reinterpret_cast<hc::short_vector::float2 *>(C), cOffset, ldc);
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasChemv",
+                        "order=%c,uplo=%d,n=%d,alpha=%g%+gi,lda=%d,incx=%d,"
+                        "beta=%g%+gi,incy=%d", traceOrder(handle),
+                        static_cast<int>(uplo), n, alpha->x, alpha->y, lda,
+                        incx, beta->x, beta->y, incy);
+
+  if (n < 0 || incx <= 0 || incy <= 0) return HCBLAS_STATUS_INVALID_VALUE;
 
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_chemv(
+      handle->acclView(), handle->Order, uploA, n,
+      *(reinterpret_cast<const hc::short_vector::float_2 *>(alpha)),
+      reinterpret_cast<const hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<const hc::short_vector::float_2 *>(x), xOffset, incx,
+      *(reinterpret_cast<const hc::short_vector::float_2 *>(beta)),
+      reinterpret_cast<hc::short_vector::float_2 *>(y), yOffset, incy);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-hcblasStatus_t hcblasDgemm(hcblasHandle_t handle, hcblasOperation_t transa,
-                           hcblasOperation_t transb, int m, int n, int k,
-                           const double *alpha, double *A, int lda, double *B,
-                           int ldb, const double *beta, double *C, int ldc) {
+// 4. hcblas<t>trmv()
+
+// This function performs the triangular matrix-vector multiplication
+// x = op ( A ) x
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, and x is a vector. Also, for matrix A
+// op ( A ) = A             if trans == HCBLAS_OP_N
+//            A^T           if trans == HCBLAS_OP_T
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose.
+// diag         host             input          indicates if the elements on
+//                                              the main diagonal of matrix A
+//                                              are unity and should not be
+//                                              accessed.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           in/out         <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrmv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const float *A, int lda, float *x, int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasStrmv",
+                        "order=%c,uplo=%d,trans=%c,diag=%d,n=%d,lda=%d,incx=%d",
+                        traceOrder(handle), static_cast<int>(uplo),
+                        traceOp(trans), static_cast<int>(diag), n, lda, incx);
+
+  if (n < 0 || incx <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
 
   __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
+  __int64_t xOffset = 0;
   hcblasStatus status;
-  hcblasTranspose transA, transB;
-  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
-  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
-  status = handle->hcblas_dgemm(handle->currentAcclView, handle->Order, transA,
-                                transB, m, n, k, *alpha, A, lda, B, ldb, *beta,
-                                C, ldc, aOffset, bOffset, cOffset);
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+  status = handle->hcblas_strmv(handle->acclView(), handle->Order,
+                                uploA, transA, diagA, n, A, aOffset, lda, x,
+                                xOffset, incx);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-hcblasStatus_t hcblasZgemm(hcblasHandle_t handle, hcblasOperation_t transa,
-                           hcblasOperation_t transb, int m, int n, int k,
-                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
-                           int lda, hcDoubleComplex *B, int ldb,
-                           const hcDoubleComplex *beta, hcDoubleComplex *C,
-                           int ldc) {
+hcblasStatus_t hcblasDtrmv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const double *A, int lda, double *x,
+                           int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDtrmv",
+                        "order=%c,uplo=%d,trans=%c,diag=%d,n=%d,lda=%d,incx=%d",
+                        traceOrder(handle), static_cast<int>(uplo),
+                        traceOp(trans), static_cast<int>(diag), n, lda, incx);
 
-  __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
+  if (n < 0 || incx <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
 
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
   hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+  status = handle->hcblas_dtrmv(handle->acclView(), handle->Order,
+                                uploA, transA, diagA, n, A, aOffset, lda, x,
+                                xOffset, incx);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
 
-  hcblasTranspose transA, transB;
-  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
-  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+// 5. hcblas<t>trsv()
 
-  status = handle->hcblas_zgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
-      reinterpret_cast<hc::short_vector::double2 *>(A), aOffset, lda,
-      reinterpret_cast<hc::short_vector::double2 *>(B), bOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(beta)),
-      reinterpret_cast<hc::short_vector::double2 *>(C), cOffset, ldc);
+// This function solves the triangular linear system with a single
+// right-hand-side
+// op ( A ) x = b
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, and x and b are vectors. The solution x
+// overwrites the right-hand-sides b on exit. No test for singularity or
+// near-singularity is included in this function. Also, for matrix A
+// op ( A ) = A             if trans == HCBLAS_OP_N
+//            A^T           if trans == HCBLAS_OP_T
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose.
+// diag         host             input          indicates if the elements on
+//                                              the main diagonal of matrix A
+//                                              are unity and should not be
+//                                              accessed.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           in/out         <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrsv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const float *A, int lda, float *x, int incx) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasStrsv",
+                        "order=%c,uplo=%d,trans=%c,diag=%d,n=%d,lda=%d,incx=%d",
+                        traceOrder(handle), static_cast<int>(uplo),
+                        traceOp(trans), static_cast<int>(diag), n, lda, incx);
 
+  if (n < 0 || incx <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+  status = handle->hcblas_strsv(handle->acclView(), handle->Order,
+                                uploA, transA, diagA, n, A, aOffset, lda, x,
+                                xOffset, incx);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-hcblasStatus_t hcblasHgemm(hcblasHandle_t handle, hcblasOperation_t transa,
-                           hcblasOperation_t transb, int m, int n, int k,
-                           const hc::half *alpha, hc::half *A, int lda,
-                           hc::half *B, int ldb, const hc::half *beta,
-                           hc::half *C, int ldc) {
+hcblasStatus_t hcblasDtrsv(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, hcblasDiagType_t diag,
+                           int n, const double *A, int lda, double *x,
+                           int incx) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDtrsv",
+                        "order=%c,uplo=%d,trans=%c,diag=%d,n=%d,lda=%d,incx=%d",
+                        traceOrder(handle), static_cast<int>(uplo),
+                        traceOp(trans), static_cast<int>(diag), n, lda, incx);
+
+  if (n < 0 || incx <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
 
   __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
+  __int64_t xOffset = 0;
   hcblasStatus status;
-  hcblasTranspose transA, transB;
-  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
-  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
-  status = handle->hcblas_hgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::half *>(alpha)),
-      reinterpret_cast<hc::half *>(A), lda, reinterpret_cast<hc::half *>(B),
-      ldb, *(reinterpret_cast<const hc::half *>(beta)),
-      reinterpret_cast<hc::half *>(C), ldc, aOffset, bOffset, cOffset);
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+  status = handle->hcblas_dtrsv(handle->acclView(), handle->Order,
+                                uploA, transA, diagA, n, A, aOffset, lda, x,
+                                xOffset, incx);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
-// 2. hcblas<t>gemmBatched()
 
-// This function performs the matrix-matrix multiplications of an array of
-// matrices.
-// C [ i ] = α op ( A [ i ] ) op ( B [ i ] ) + β C [ i ] ,  for i  ∈ [ 0 ,
-// batchCount − 1 ]
-// where α and β are scalars, and A , B and C are arrays of pointers to matrices
-// stored in column-major format with dimensions
-// op ( A [ i ] ) m × k , op ( B [ i ] ) k × n and C [ i ] m × n ,
-// respectively. Also, for matrix A
-// op ( A ) = A   if  transa == HCBLAS_OP_N
-//            A^T if  transa == HCBLAS_OP_T
-//            A^H if  transa == HCBLAS_OP_C
-// and op ( B [ i ] ) is defined similarly for matrix B [ i ] .
+// 6. hcblas<t>syr() and hcblas<t>syr2()
 
-// This function is intended to be used for matrices of small sizes where the
-// launch overhead is a significant factor.
+// This function performs the symmetric rank-1 and rank-2 updates
+// A = α x x T + A          if syr() is called
+//     α ( x y T + y x T ) + A   if syr2() is called
+// where A is a n × n symmetric matrix stored in column-major format, x and y
+// are vectors, and α is a scalar. Only the triangle selected by uplo is
+// updated.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// x            device           input          <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// y            device           input          <type> vector with n elements
+//                                              (syr2 only).
+// incy         host             input          stride between consecutive
+//                                              elements of y (syr2 only).
+// A            device           in/out         <type> array of dimension lda x
+//                                              n with lda >= max(1,n).
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyr(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                          const float *alpha, const float *x, int incx,
+                          float *A, int lda) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSsyr",
+                        "order=%c,uplo=%d,n=%d,alpha=%g,incx=%d,lda=%d",
+                        traceOrder(handle), static_cast<int>(uplo), n, *alpha,
+                        incx, lda);
+
+  if (n < 0 || incx <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t xOffset = 0;
+  __int64_t aOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_ssyr(handle->acclView(), handle->Order,
+                               uploA, n, *alpha, x, xOffset, incx, A, aOffset,
+                               lda);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsyr(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                          const double *alpha, const double *x, int incx,
+                          double *A, int lda) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDsyr",
+                        "order=%c,uplo=%d,n=%d,alpha=%g,incx=%d,lda=%d",
+                        traceOrder(handle), static_cast<int>(uplo), n, *alpha,
+                        incx, lda);
+
+  if (n < 0 || incx <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t xOffset = 0;
+  __int64_t aOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_dsyr(handle->acclView(), handle->Order,
+                               uploA, n, *alpha, x, xOffset, incx, A, aOffset,
+                               lda);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasSsyr2(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const float *alpha, const float *x, int incx,
+                           const float *y, int incy, float *A, int lda) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSsyr2",
+                        "order=%c,uplo=%d,n=%d,alpha=%g,incx=%d,incy=%d,lda=%d",
+                        traceOrder(handle), static_cast<int>(uplo), n, *alpha,
+                        incx, incy, lda);
+
+  if (n < 0 || incx <= 0 || incy <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  __int64_t aOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_ssyr2(handle->acclView(), handle->Order,
+                                uploA, n, *alpha, x, xOffset, incx, y, yOffset,
+                                incy, A, aOffset, lda);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsyr2(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           const double *alpha, const double *x, int incx,
+                           const double *y, int incy, double *A, int lda) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDsyr2",
+                        "order=%c,uplo=%d,n=%d,alpha=%g,incx=%d,incy=%d,lda=%d",
+                        traceOrder(handle), static_cast<int>(uplo), n, *alpha,
+                        incx, incy, lda);
+
+  if (n < 0 || incx <= 0 || incy <= 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  __int64_t aOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_dsyr2(handle->acclView(), handle->Order,
+                                uploA, n, *alpha, x, xOffset, incx, y, yOffset,
+                                incy, A, aOffset, lda);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 7. hcblas<t>gbmv()
+
+// This function performs the banded matrix-vector multiplication
+// y = α op ( A ) x + β y
+// where A is a m × n banded matrix with kl subdiagonals and ku
+// superdiagonals, x and y are vectors, and α and β are scalars. Also, for
+// matrix A
+// op ( A ) = A             if trans == HCBLAS_OP_N
+//            A^T           if trans == HCBLAS_OP_T
+// The banded matrix A is stored column by column, with the main diagonal
+// stored in row ku+1 (starting in first position), the first superdiagonal
+// stored in row ku (starting in second position), the first subdiagonal
+// stored in row ku+2 (starting in first position), etc. So that in general,
+// the element A(i,j) is stored in the memory location A(ku+1+i-j,j) for
+// j = 1 , … , n and i ∈ [ max ( 1 , j − ku ) , min ( m , j + kl ) ].
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix A.
+// n            host             input          number of columns of matrix A.
+// kl           host             input          number of subdiagonals of
+//                                              matrix A.
+// ku           host             input          number of superdiagonals of
+//                                              matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= kl+ku+1.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           input          <type> vector with n elements if
+//                                              trans==HCBLAS_OP_N and m
+//                                              elements otherwise.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication, if beta==0
+//                                              then y does not have to be a
+//                                              valid input.
+// y            device           in/out         <type> vector with m elements if
+//                                              trans==HCBLAS_OP_N and n
+//                                              elements otherwise.
+// incy         host             input          stride between consecutive
+//                                              elements of y.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,kl,ku<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgbmv(hcblasHandle_t handle, hcblasOperation_t trans,
+                           int m, int n, int kl, int ku, const float *alpha,
+                           const float *A, int lda, const float *x, int incx,
+                           const float *beta, float *y, int incy) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgbmv",
+                        "order=%c,trans=%c,m=%d,n=%d,kl=%d,ku=%d,alpha=%g,"
+                        "lda=%d,incx=%d,beta=%g,incy=%d", traceOrder(handle),
+                        traceOp(trans), m, n, kl, ku, *alpha, lda, incx, *beta,
+                        incy);
+
+  if (m < 0 || n < 0 || kl < 0 || ku < 0 || incx <= 0 || incy <= 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  hcblasStatus status;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_sgbmv(handle->acclView(), handle->Order,
+                                transA, m, n, kl, ku, *alpha, A, aOffset, lda,
+                                x, xOffset, incx, *beta, y, yOffset, incy);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDgbmv(hcblasHandle_t handle, hcblasOperation_t trans,
+                           int m, int n, int kl, int ku, const double *alpha,
+                           const double *A, int lda, const double *x, int incx,
+                           const double *beta, double *y, int incy) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgbmv",
+                        "order=%c,trans=%c,m=%d,n=%d,kl=%d,ku=%d,alpha=%g,"
+                        "lda=%d,incx=%d,beta=%g,incy=%d", traceOrder(handle),
+                        traceOp(trans), m, n, kl, ku, *alpha, lda, incx, *beta,
+                        incy);
+
+  if (m < 0 || n < 0 || kl < 0 || ku < 0 || incx <= 0 || incy <= 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  hcblasStatus status;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_dgbmv(handle->acclView(), handle->Order,
+                                transA, m, n, kl, ku, *alpha, A, aOffset, lda,
+                                x, xOffset, incx, *beta, y, yOffset, incy);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 8. hcblas<t>sbmv()
+
+// This function performs the symmetric banded matrix-vector multiplication
+// y = α A x + β y
+// where A is a n × n symmetric banded matrix with k subdiagonals and
+// superdiagonals, x and y are vectors, and α and β are scalars.
+// If uplo == HCBLAS_FILL_MODE_LOWER then the symmetric banded matrix A is
+// stored column by column, with the main diagonal of the matrix stored in
+// row 1, the first subdiagonal in row 2 (starting at first position), etc.
+// So that in general, the element A(i,j) is stored in the memory location
+// A(1+i-j,j) for j = 1 , … , n and i ∈ [ j , min ( m , j + k ) ].
+// If uplo == HCBLAS_FILL_MODE_UPPER then the main diagonal is stored in row
+// k+1, the first superdiagonal in row k (starting at second position), etc.
+// So that in general, the element A(i,j) is stored in the memory location
+// A(1+k+i-j,j) for j = 1 , … , n and i ∈ [ max ( 1 , j − k ) , j ].
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored.
+// n            host             input          number of rows and columns of
+//                                              matrix A.
+// k            host             input          number of sub- and
+//                                              super-diagonals of matrix A.
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              n with lda >= k+1.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// x            device           input          <type> vector with n elements.
+// incx         host             input          stride between consecutive
+//                                              elements of x.
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication, if beta==0
+//                                              then y does not have to be a
+//                                              valid input.
+// y            device           in/out         <type> vector with n elements.
+// incy         host             input          stride between consecutive
+//                                              elements of y.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or incx,incy<=0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsbmv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           int k, const float *alpha, const float *A, int lda,
+                           const float *x, int incx, const float *beta,
+                           float *y, int incy) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSsbmv",
+                        "order=%c,uplo=%d,n=%d,k=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d", traceOrder(handle),
+                        static_cast<int>(uplo), n, k, *alpha, lda, incx, *beta,
+                        incy);
+
+  if (n < 0 || k < 0 || incx <= 0 || incy <= 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_ssbmv(handle->acclView(), handle->Order,
+                                uploA, n, k, *alpha, A, aOffset, lda, x,
+                                xOffset, incx, *beta, y, yOffset, incy);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsbmv(hcblasHandle_t handle, hcblasFillMode_t uplo, int n,
+                           int k, const double *alpha, const double *A, int lda,
+                           const double *x, int incx, const double *beta,
+                           double *y, int incy) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDsbmv",
+                        "order=%c,uplo=%d,n=%d,k=%d,alpha=%g,lda=%d,incx=%d,"
+                        "beta=%g,incy=%d", traceOrder(handle),
+                        static_cast<int>(uplo), n, k, *alpha, lda, incx, *beta,
+                        incy);
+
+  if (n < 0 || k < 0 || incx <= 0 || incy <= 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (n == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  hcblasStatus status;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_UPPER) ? Upper : Lower;
+  status = handle->hcblas_dsbmv(handle->acclView(), handle->Order,
+                                uploA, n, k, *alpha, A, aOffset, lda, x,
+                                xOffset, incx, *beta, y, yOffset, incy);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// HCBLAS Level-3 Function Reference
+
+// The Level-3 Basic Linear Algebra Subprograms (BLAS3) functions perform
+// matrix-matrix operations. Unless otherwise specified <type> and <t>
+// have the following meanings:
+
+// <type>       <t>          Meaning
+// ---------------------------------------------------
+// float     ‘s’ or ‘S’      real single-precision
+// double    ‘d’ or ‘D’      real double-precision
+// hcComplex ‘c’ or ‘C’      complex single-precision
+
+// 1. hcblas<t>gemm()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// where α and β are scalars, and A , B and C are matrices stored in
+// column-major format with dimensions op ( A ) m × k , op ( B ) k × n
+// and C m × n , respectively. Also, for matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// and op ( B ) is defined similarly for matrix B .
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              (conj.) transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of rows of matrix op(B)
+//                                              and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimensions lda x
+//                                              k with lda>=max(1,m)
+//                                              if transa == HCBLAS_OP_N and lda
+//                                              x m with lda>=max(1,k)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,k)
+//                                              if transa == HCBLAS_OP_N and ldb
+//                                              x k with ldb>=max(1,n)
+//                                              otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a
+//                                              valid input.
+// C            device           in/out         <type> array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C.
+// batchCount   host             input          number of pointers contained in
+//                                              input and output arrays.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb, const float *beta, float *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemm",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k, *alpha, lda,
+                        ldb, *beta, ldc);
+
+  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  hcblasPlan *plan = handle->capturePlan();
+  if (plan != NULL) {
+    status = handle->hcblas_sgemm_capture(
+        plan, handle->acclView(), handle->Order, transA, transB, m, n, k,
+        *alpha, A, lda, B, ldb, *beta, C, ldc, aOffset, bOffset, cOffset);
+  } else {
+    status = handle->hcblas_sgemm(handle->acclView(), handle->Order, transA,
+                                  transB, m, n, k, *alpha, A, lda, B, ldb,
+                                  *beta, C, ldc, aOffset, bOffset, cOffset);
+  }
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb, const hcComplex *beta,
+                           hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasCgemm",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,"
+                        "alpha=%g%+gi,lda=%d,ldb=%d,beta=%g%+gi,ldc=%d",
+                        traceOrder(handle), traceOp(transa), traceOp(transb), m,
+                        n, k, alpha->x, alpha->y, lda, ldb, beta->x, beta->y,
+                        ldc);
+
+  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_cgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k,
+      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
+      reinterpret_cast<hc::short_vector::float2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float2 *>(B), bOffset, ldb,
+      *(reinterpret_cast<const hc::short_vector::float2 *>(beta)),
+      reinterpret_cast<hc::short_vector::float2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb, const double *beta, double *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgemm",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k, *alpha, lda,
+                        ldb, *beta, ldc);
+
+  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_dgemm(handle->acclView(), handle->Order, transA,
+                                transB, m, n, k, *alpha, A, lda, B, ldb, *beta,
+                                C, ldc, aOffset, bOffset, cOffset);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb,
+                           const hcDoubleComplex *beta, hcDoubleComplex *C,
+                           int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasZgemm",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,"
+                        "alpha=%g%+gi,lda=%d,ldb=%d,beta=%g%+gi,ldc=%d",
+                        traceOrder(handle), traceOp(transa), traceOp(transb), m,
+                        n, k, alpha->x, alpha->y, lda, ldb, beta->x, beta->y,
+                        ldc);
+
+  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_zgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k,
+      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
+      reinterpret_cast<hc::short_vector::double2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double2 *>(B), bOffset, ldb,
+      *(reinterpret_cast<const hc::short_vector::double2 *>(beta)),
+      reinterpret_cast<hc::short_vector::double2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasHgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const hc::half *alpha, hc::half *A, int lda,
+                           hc::half *B, int ldb, const hc::half *beta,
+                           hc::half *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasHgemm",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k,
+                        static_cast<float>(*alpha), lda, ldb,
+                        static_cast<float>(*beta), ldc);
+
+  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_hgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k,
+      *(reinterpret_cast<const hc::half *>(alpha)),
+      reinterpret_cast<hc::half *>(A), lda, reinterpret_cast<hc::half *>(B),
+      ldb, *(reinterpret_cast<const hc::half *>(beta)),
+      reinterpret_cast<hc::half *>(C), ldc, aOffset, bOffset, cOffset);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+// 2. hcblas<t>gemmBatched()
+
+// This function performs the matrix-matrix multiplications of an array of
+// matrices.
+// C [ i ] = α op ( A [ i ] ) op ( B [ i ] ) + β C [ i ] ,  for i  ∈ [ 0 ,
+// batchCount − 1 ]
+// where α and β are scalars, and A , B and C are arrays of pointers to matrices
+// stored in column-major format with dimensions
+// op ( A [ i ] ) m × k , op ( B [ i ] ) k × n and C [ i ] m × n ,
+// respectively. Also, for matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// and op ( B [ i ] ) is defined similarly for matrix B [ i ] .
+
+// This function is intended to be used for matrices of small sizes where the
+// launch overhead is a significant factor.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              (conj.) transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of rows of matrix op(B)
+//                                              and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host or device   input          <type> scalar used for
+//                                              multiplication.
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k with lda>=max(1,m)
+//                                              if transa == HCBLAS_OP_N and lda
+//                                              x m with lda>=max(1,k)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A[i].
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,k)
+//                                              if transa == HCBLAS_OP_N and ldb
+//                                              x k with ldb>=max(1,n)
+//                                              otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B[i].
+// beta         host or device   input          <type> scalar used for
+//                                              multiplication. If beta==0 C
+//                                              does not have to be a valid
+//                                              input.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C[i].
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmBatched(hcblasHandle_t handle,
+                                  hcblasOperation_t transa,
+                                  hcblasOperation_t transb, int m, int n, int k,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, const float *beta,
+                                  float *Carray[], int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemmBatched",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d,batchCount=%d",
+                        traceOrder(handle), traceOp(transa), traceOp(transb), m,
+                        n, k, *alpha, lda, ldb, *beta, ldc, batchCount);
+
+  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_sgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k, *alpha,
+      Aarray, lda, A_batchOffset, Barray, ldb, B_batchOffset, *beta, Carray,
+      ldc, C_batchOffset, aOffset, bOffset, cOffset, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCgemmBatched(hcblasHandle_t handle,
+                                  hcblasOperation_t transa,
+                                  hcblasOperation_t transb, int m, int n, int k,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  const hcComplex *beta, hcComplex *Carray[],
+                                  int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasCgemmBatched",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,"
+                        "alpha=%g%+gi,lda=%d,ldb=%d,beta=%g%+gi,ldc=%d,"
+                        "batchCount=%d", traceOrder(handle), traceOp(transa),
+                        traceOp(transb), m, n, k, alpha->x, alpha->y, lda, ldb,
+                        beta->x, beta->y, ldc, batchCount);
+
+  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = m * n;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_cgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k,
+      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
+      reinterpret_cast<hc::short_vector::float2 **>(Aarray), aOffset,
+      A_batchOffset, lda, reinterpret_cast<hc::short_vector::float2 **>(Barray),
+      bOffset, B_batchOffset, ldb,
+      *(reinterpret_cast<const hc::short_vector::float2 *>(beta)),
+      reinterpret_cast<hc::short_vector::float2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// Batche Double Implementations
+hcblasStatus_t hcblasDgemmBatched(hcblasHandle_t handle,
+                                  hcblasOperation_t transa,
+                                  hcblasOperation_t transb, int m, int n, int k,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  const double *beta, double *Carray[], int ldc,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgemmBatched",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d,batchCount=%d",
+                        traceOrder(handle), traceOp(transa), traceOp(transb), m,
+                        n, k, *alpha, lda, ldb, *beta, ldc, batchCount);
+
+  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_dgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k, *alpha,
+      Aarray, lda, A_batchOffset, Barray, ldb, B_batchOffset, *beta, Carray,
+      ldc, C_batchOffset, aOffset, bOffset, cOffset, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZgemmBatched(
+    hcblasHandle_t handle, hcblasOperation_t transa, hcblasOperation_t transb,
+    int m, int n, int k, const hcDoubleComplex *alpha,
+    hcDoubleComplex *Aarray[], int lda, hcDoubleComplex *Barray[], int ldb,
+    const hcDoubleComplex *beta, hcDoubleComplex *Carray[], int ldc,
+    int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasZgemmBatched",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,"
+                        "alpha=%g%+gi,lda=%d,ldb=%d,beta=%g%+gi,ldc=%d,"
+                        "batchCount=%d", traceOrder(handle), traceOp(transa),
+                        traceOp(transb), m, n, k, alpha->x, alpha->y, lda, ldb,
+                        beta->x, beta->y, ldc, batchCount);
+
+  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = m * n;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_zgemm(
+      handle->acclView(), handle->Order, transA, transB, m, n, k,
+      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
+      reinterpret_cast<hc::short_vector::double2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double2 **>(Barray), bOffset,
+      B_batchOffset, ldb,
+      *(reinterpret_cast<const hc::short_vector::double2 *>(beta)),
+      reinterpret_cast<hc::short_vector::double2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 3. hcblasGemmEx()
+
+// This function is an extension of hcblas<t>gemm that allows the user to
+// individually specify the data types for each of the A, B and C matrices
+// and the type in which the products are accumulated.
+// C = α op ( A ) op ( B ) + β C
+// A and B are converted to computeType as they are loaded, so no separate
+// conversion pass is required. alpha and beta point to values of
+// computeType. The supported combinations are
+
+// Atype          Btype          Ctype          computeType
+// ------------------------------------------------------------------
+// HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_16F
+// HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_32F
+// HCBLAS_R_16F   HCBLAS_R_16F   HCBLAS_R_32F   HCBLAS_R_32F
+// HCBLAS_R_32F   HCBLAS_R_32F   HCBLAS_R_32F   HCBLAS_R_32F
+// HCBLAS_R_64F   HCBLAS_R_64F   HCBLAS_R_64F   HCBLAS_R_64F
+// HCBLAS_C_32F   HCBLAS_C_32F   HCBLAS_C_32F   HCBLAS_C_32F
+// HCBLAS_C_64F   HCBLAS_C_64F   HCBLAS_C_64F   HCBLAS_C_64F
+// HCBLAS_R_8I    HCBLAS_R_8I    HCBLAS_R_32I   HCBLAS_R_32I
+// HCBLAS_R_16BF  HCBLAS_R_16BF  HCBLAS_R_16BF  HCBLAS_R_32F
+// HCBLAS_R_16BF  HCBLAS_R_16BF  HCBLAS_R_32F   HCBLAS_R_32F
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          computeType scalar used for
+//                                              multiplication.
+// A            device           input          Atype array of dimensions lda x
+//                                              k with lda>=max(1,m) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              m with lda>=max(1,k) otherwise.
+// Atype        host             input          storage type of matrix A.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A.
+// B            device           input          Btype array of dimension ldb x
+//                                              n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// Btype        host             input          storage type of matrix B.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          computeType scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            device           in/out         Ctype array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// Ctype        host             input          storage type of matrix C.
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C.
+// computeType  host             input          type used for accumulation and
+//                                              for alpha and beta.
+// algo         host             input          algorithm selection, must be
+//                                              HCBLAS_GEMM_DEFAULT.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0 or the type
+//                                 combination is not supported
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+static bool hcblasToDatatype(hcblasDataType_t type, hcblasDatatype *out) {
+  switch (type) {
+    case HCBLAS_R_16F: *out = HalfType; return true;
+    case HCBLAS_R_32F: *out = FloatType; return true;
+    case HCBLAS_R_64F: *out = DoubleType; return true;
+    case HCBLAS_C_32F: *out = ComplexType; return true;
+    case HCBLAS_C_64F: *out = DoubleComplexType; return true;
+    case HCBLAS_R_8I: *out = Int8Type; return true;
+    case HCBLAS_R_32I: *out = Int32Type; return true;
+    case HCBLAS_R_16BF: *out = Bfloat16Type; return true;
+  }
+  return false;
+}
+
+hcblasStatus_t hcblasGemmEx(hcblasHandle_t handle, hcblasOperation_t transa,
+                            hcblasOperation_t transb, int m, int n, int k,
+                            const void *alpha, const void *A,
+                            hcblasDataType_t Atype, int lda, const void *B,
+                            hcblasDataType_t Btype, int ldb, const void *beta,
+                            void *C, hcblasDataType_t Ctype, int ldc,
+                            hcblasDataType_t computeType,
+                            hcblasGemmAlgo_t algo) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasGemmEx",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,Atype=%d,"
+                        "lda=%d,Btype=%d,ldb=%d,Ctype=%d,ldc=%d,"
+                        "computeType=%d,algo=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k,
+                        static_cast<int>(Atype), lda, static_cast<int>(Btype),
+                        ldb, static_cast<int>(Ctype), ldc,
+                        static_cast<int>(computeType), static_cast<int>(algo));
+
+  if (m < 0 || n < 0 || k < 0 || alpha == nullptr || beta == nullptr ||
+      algo != HCBLAS_GEMM_DEFAULT)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasDatatype aType, bType, cType, sType;
+  if (!hcblasToDatatype(Atype, &aType) || !hcblasToDatatype(Btype, &bType) ||
+      !hcblasToDatatype(Ctype, &cType) ||
+      !hcblasToDatatype(computeType, &sType))
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (!handle->hcblas_gemmex_supported(aType, bType, cType, sType))
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0 || k == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_gemmex(handle->acclView(), handle->Order,
+                                 transA, transB, m, n, k, alpha, A, aType,
+                                 aOffset, lda, B, bType, bOffset, ldb, beta, C,
+                                 cType, cOffset, ldc, sType);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 4. hcblasIgemm()
+
+// This function performs the matrix-matrix multiplication on 8 bit signed
+// integer operands with 32 bit integer accumulation
+// C = α op ( A ) op ( B ) + β C
+// hcblasIgemmRequant() computes the same product but requantises the int32
+// accumulator to 8 bit in the store phase
+// C = sat8 ( round ( scale[q] op ( A ) op ( B ) ) + zeroPoint[q] )
+// where q is the row or column of C selected by axis, round rounds half away
+// from zero and sat8 saturates to [-128, 127].
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          int scalar used for
+//                                              multiplication.
+// A            device           input          int8 array of dimensions lda x
+//                                              k with lda>=max(1,m) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              m with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store the matrix A.
+// B            device           input          int8 array of dimension ldb x
+//                                              n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          int scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            device           in/out         int32 (hcblasIgemm) or int8
+//                                              (hcblasIgemmRequant) array of
+//                                              dimensions ldc x n with
+//                                              ldc>=max(1,m).
+// ldc          host             input          leading dimension of a
+//                                              two-dimensional array used to
+//                                              store the matrix C.
+// axis         host             input          whether scale and zeroPoint are
+//                                              indexed by row or column of C.
+// scale        device           input          float array of m (per row) or n
+//                                              (per column) elements.
+// zeroPoint    device           input          int array of m or n elements,
+//                                              may be NULL for symmetric
+//                                              quantisation.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0 or scale is NULL
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasIgemm(hcblasHandle_t handle, hcblasOperation_t transa,
+                           hcblasOperation_t transb, int m, int n, int k,
+                           const int *alpha, const signed char *A, int lda,
+                           const signed char *B, int ldb, const int *beta,
+                           int *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasIgemm",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%d,"
+                        "lda=%d,ldb=%d,beta=%d,ldc=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k, *alpha, lda,
+                        ldb, *beta, ldc);
+
+  if (m < 0 || n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0 || k == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_igemm(handle->acclView(), handle->Order, transA,
+                                transB, m, n, k, *alpha, A, lda, B, ldb, *beta,
+                                C, ldc, aOffset, bOffset, cOffset);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasIgemmRequant(hcblasHandle_t handle,
+                                  hcblasOperation_t transa,
+                                  hcblasOperation_t transb, int m, int n,
+                                  int k, const signed char *A, int lda,
+                                  const signed char *B, int ldb,
+                                  signed char *C, int ldc,
+                                  hcblasQuantAxis_t axis, const float *scale,
+                                  const int *zeroPoint) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasIgemmRequant",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,lda=%d,"
+                        "ldb=%d,ldc=%d,axis=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k, lda, ldb,
+                        ldc, static_cast<int>(axis));
+
+  if (m < 0 || n < 0 || k < 0 || scale == nullptr)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0 || k == 0) return HCBLAS_STATUS_SUCCESS;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  hcblasQuantAxis quantAxis =
+      (axis == HCBLAS_QUANT_PER_ROW) ? PerRow : PerColumn;
+
+  status = handle->hcblas_igemm_requant(
+      handle->acclView(), handle->Order, transA, transB, m, n, k, A, lda,
+      B, ldb, C, ldc, quantAxis, scale, zeroPoint, aOffset, bOffset, cOffset);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 5. hcblasSgemmEpilogue()
+
+// This function performs the single precision matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// and applies the epilogue described by hcblasEpilogue_t to every element
+// of C before it is stored, replacing separate scale, bias and activation
+// passes over C.
 
 // Param.       Memory           In/out         Meaning
 // -------------------------------------------------------------------------------------
 // handle       host             input          handle to the HCBLAS library
 //                                              context.
 // transa       host             input          operation op(A) that is non- or
-//                                              (conj.) transpose.
+//                                              transpose.
 // transb       host             input          operation op(B) that is non- or
-//                                              (conj.) transpose.
+//                                              transpose.
 // m            host             input          number of rows of matrix op(A)
 //                                              and C.
-// n            host             input          number of rows of matrix op(B)
-//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
 // k            host             input          number of columns of op(A) and
 //                                              rows of op(B).
-// alpha        host or device   input          <type> scalar used for
+// alpha        host             input          <type> scalar used for
 //                                              multiplication.
-// Aarray       device           input          array of pointers to <type>
-//                                              array, with each array of dim.
-//                                              lda x k with lda>=max(1,m)
-//                                              if transa == HCBLAS_OP_N and lda
-//                                              x m with lda>=max(1,k)
-//                                              otherwise.
+// A            device           input          <type> array of dimensions lda
+//                                              x k with lda>=max(1,m) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              m with lda>=max(1,k) otherwise.
 // lda          host             input          leading dimension of
 //                                              two-dimensional array used to
-//                                              store the matrix A[i].
-// Barray       device           input          array of pointers to <type>
-//                                              array, with each array of dim.
-//                                              ldb x n with ldb>=max(1,k)
-//                                              if transa == HCBLAS_OP_N and ldb
-//                                              x k with ldb>=max(1,n)
-//                                              otherwise.
+//                                              store the matrix A.
+// B            device           input          <type> array of dimension ldb
+//                                              x n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
 // ldb          host             input          leading dimension of
 //                                              two-dimensional array used to
-//                                              store matrix B[i].
-// beta         host or device   input          <type> scalar used for
-//                                              multiplication. If beta==0 C
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0, C
 //                                              does not have to be a valid
 //                                              input.
-// Carray       device           in/out         array of pointers to <type>
-//                                              array, with each array of dim.
-//                                              ldc x n with ldc>=max(1,m).
+// C            device           in/out         <type> array of dimensions ldc
+//                                              x n with ldc>=max(1,m).
 // ldc          host             input          leading dimension of a
 //                                              two-dimensional array used to
-//                                              store the matrix C[i].
-// batchCount   host             input          number of pointers contained in
-//                                              Aarray, Barray and Carray.
+//                                              store the matrix C.
+// epilogue     host             input          scale, bias, activation and
+//                                              auxiliary output to apply.
 
 // Return Values
 // --------------------------------------------------------------------
 // HCBLAS_STATUS_SUCCESS           the operation completed successfully
 // HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
-// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k,batchCount<0
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,k<0, epilogue is NULL,
+//                                 ldaux is too small or clampMin>clampMax
 // HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
 
-hcblasStatus_t hcblasSgemmBatched(hcblasHandle_t handle,
-                                  hcblasOperation_t transa,
-                                  hcblasOperation_t transb, int m, int n, int k,
-                                  const float *alpha, float *Aarray[], int lda,
-                                  float *Barray[], int ldb, const float *beta,
-                                  float *Carray[], int ldc, int batchCount) {
+hcblasStatus_t hcblasSgemmEpilogue(hcblasHandle_t handle,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int m, int n,
+                                   int k, const float *alpha, const float *A,
+                                   int lda, const float *B, int ldb,
+                                   const float *beta, float *C, int ldc,
+                                   const hcblasEpilogue_t *epilogue) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemmEpilogue",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d", traceOrder(handle),
+                        traceOp(transa), traceOp(transb), m, n, k, *alpha, lda,
+                        ldb, *beta, ldc);
+
+  if (m < 0 || n < 0 || k < 0 || epilogue == nullptr)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if ((epilogue->activation == HCBLAS_ACTIVATION_CLAMP &&
+       epilogue->clampMin > epilogue->clampMax) ||
+      (epilogue->aux != nullptr &&
+       epilogue->ldaux < (handle->Order ? m : n)))
     return HCBLAS_STATUS_INVALID_VALUE;
 
+  if (m == 0 || n == 0 || k == 0) return HCBLAS_STATUS_SUCCESS;
+
   __int64_t aOffset = 0;
   __int64_t bOffset = 0;
   __int64_t cOffset = 0;
-  __int64_t A_batchOffset = 0;
-  __int64_t B_batchOffset = 0;
-  __int64_t C_batchOffset = 0;
 
   hcblasStatus status;
   hcblasTranspose transA, transB;
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
 
-  status = handle->hcblas_sgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k, *alpha,
-      Aarray, lda, A_batchOffset, Barray, ldb, B_batchOffset, *beta, Carray,
-      ldc, C_batchOffset, aOffset, bOffset, cOffset, batchCount);
+  hcblasEpilogue ep;
+  ep.bias = epilogue->bias;
+  ep.biasAxis = (epilogue->biasAxis == HCBLAS_QUANT_PER_ROW) ? PerRow
+                                                             : PerColumn;
+  ep.scale = epilogue->scale;
+  ep.scaleAxis = (epilogue->scaleAxis == HCBLAS_QUANT_PER_ROW) ? PerRow
+                                                               : PerColumn;
+  switch (epilogue->activation) {
+    case HCBLAS_ACTIVATION_RELU: ep.activation = ActivationRelu; break;
+    case HCBLAS_ACTIVATION_GELU: ep.activation = ActivationGelu; break;
+    case HCBLAS_ACTIVATION_SIGMOID: ep.activation = ActivationSigmoid; break;
+    case HCBLAS_ACTIVATION_CLAMP: ep.activation = ActivationClamp; break;
+    default: ep.activation = ActivationNone; break;
+  }
+  ep.clampMin = epilogue->clampMin;
+  ep.clampMax = epilogue->clampMax;
+  ep.aux = epilogue->aux;
+  ep.auxOffset = 0;
+  ep.ldaux = epilogue->ldaux;
+
+  status = handle->hcblas_gemmex(handle->acclView(), handle->Order,
+                                 transA, transB, m, n, k, alpha, A, FloatType,
+                                 aOffset, lda, B, FloatType, bOffset, ldb, beta,
+                                 C, FloatType, cOffset, ldc, FloatType, &ep);
 
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1555,40 +3593,107 @@ hcblasStatus_t hcblasSgemmBatched(hcblasHandle_t handle,
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-hcblasStatus_t hcblasCgemmBatched(hcblasHandle_t handle,
+// 6. hcblasSgemmGrouped()
+
+// This function performs the single precision matrix-matrix multiplication
+// C[i] = α op ( A[i] ) op ( B[i] ) + β C[i],  for i ∈ [0, groupCount - 1]
+// where every problem of the group has its own m, n, k and leading
+// dimensions. Unlike hcblasSgemmBatched() the shapes need not agree: all
+// problems are cut into blocks of C that are numbered in one index space,
+// most expensive problem first, and computed by a single kernel launch.
+// Problems with m[i] or n[i] equal to zero are skipped.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A[i]) that is
+//                                              non- or transpose.
+// transb       host             input          operation op(B[i]) that is
+//                                              non- or transpose.
+// m            host             input          array of groupCount numbers of
+//                                              rows of op(A[i]) and C[i].
+// n            host             input          array of groupCount numbers of
+//                                              columns of op(B[i]) and C[i].
+// k            host             input          array of groupCount numbers of
+//                                              columns of op(A[i]) and rows of
+//                                              op(B[i]).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// Aarray       host             input          array of device pointers to
+//                                              <type> arrays, as for
+//                                              hcblasSgemmBatched() with
+//                                              m[i], k[i] and lda[i].
+// lda          host             input          array of leading dimensions of
+//                                              the matrices A[i].
+// Barray       host             input          array of device pointers to
+//                                              <type> arrays, as for
+//                                              hcblasSgemmBatched() with
+//                                              k[i], n[i] and ldb[i].
+// ldb          host             input          array of leading dimensions of
+//                                              the matrices B[i].
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0 C
+//                                              does not have to be a valid
+//                                              input.
+// Carray       host             in/out         array of device pointers to
+//                                              <type> arrays of dimensions
+//                                              ldc[i] x n[i] with
+//                                              ldc[i]>=max(1,m[i]).
+// ldc          host             input          array of leading dimensions of
+//                                              the matrices C[i].
+// groupCount   host             input          number of problems in the
+//                                              group.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     groupCount<0, an array is NULL or some
+//                                 m[i],n[i],k[i]<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmGrouped(hcblasHandle_t handle,
                                   hcblasOperation_t transa,
-                                  hcblasOperation_t transb, int m, int n, int k,
-                                  const hcComplex *alpha, hcComplex *Aarray[],
-                                  int lda, hcComplex *Barray[], int ldb,
-                                  const hcComplex *beta, hcComplex *Carray[],
-                                  int ldc, int batchCount) {
+                                  hcblasOperation_t transb, const int m[],
+                                  const int n[], const int k[],
+                                  const float *alpha,
+                                  const float *const Aarray[],
+                                  const int lda[],
+                                  const float *const Barray[],
+                                  const int ldb[], const float *beta,
+                                  float *const Carray[], const int ldc[],
+                                  int groupCount) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemmGrouped",
+                        "order=%c,transa=%c,transb=%c,alpha=%g,beta=%g,"
+                        "groupCount=%d", traceOrder(handle), traceOp(transa),
+                        traceOp(transb), *alpha, *beta, groupCount);
+
+  if (groupCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (groupCount == 0) return HCBLAS_STATUS_SUCCESS;
+
+  if (m == nullptr || n == nullptr || k == nullptr || Aarray == nullptr ||
+      Barray == nullptr || Carray == nullptr || lda == nullptr ||
+      ldb == nullptr || ldc == nullptr)
     return HCBLAS_STATUS_INVALID_VALUE;
 
-  __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
-  __int64_t A_batchOffset = 0;
-  __int64_t B_batchOffset = 0;
-  __int64_t C_batchOffset = m * n;
+  for (int i = 0; i < groupCount; i++) {
+    if (m[i] < 0 || n[i] < 0 || k[i] < 0) return HCBLAS_STATUS_INVALID_VALUE;
+  }
 
   hcblasStatus status;
   hcblasTranspose transA, transB;
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
 
-  status = handle->hcblas_cgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
-      reinterpret_cast<hc::short_vector::float2 **>(Aarray), aOffset,
-      A_batchOffset, lda, reinterpret_cast<hc::short_vector::float2 **>(Barray),
-      bOffset, B_batchOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(beta)),
-      reinterpret_cast<hc::short_vector::float2 **>(Carray), cOffset,
-      C_batchOffset, ldc, batchCount);
+  status = handle->hcblas_sgemm_grouped(
+      handle->acclView(), handle->Order, transA, transB, m, n, k, *alpha,
+      Aarray, lda, Barray, ldb, *beta, Carray, ldc, groupCount);
 
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1596,78 +3701,256 @@ hcblasStatus_t hcblasCgemmBatched(hcblasHandle_t handle,
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-// Batche Double Implementations
-hcblasStatus_t hcblasDgemmBatched(hcblasHandle_t handle,
-                                  hcblasOperation_t transa,
-                                  hcblasOperation_t transb, int m, int n, int k,
-                                  const double *alpha, double *Aarray[],
-                                  int lda, double *Barray[], int ldb,
-                                  const double *beta, double *Carray[], int ldc,
-                                  int batchCount) {
+// 7. hcblas<t>gemmOutOfCore()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// as hcblas<t>gemm() does, for A, B and C in host memory that need not fit
+// on the device. C is cut into tiles sized so that two buffers of panels of
+// op(A) and op(B) plus one tile of C fit in deviceBytes; each tile streams
+// its panels through the two buffers, copying one while the other is
+// multiplied. cpuFraction of the tiles are computed on the host at the same
+// time, by the CPU backend. On a CPU handle every tile runs on the host.
+// The call returns when C is complete.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// lda          host             input          leading dimension of A.
+// B            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// ldb          host             input          leading dimension of B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            host             in/out         <type> array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of C.
+// deviceBytes  host             input          device memory the call may
+//                                              use; 0 selects a quarter of
+//                                              the device's memory.
+// cpuFraction  host             input          fraction of the tiles of C
+//                                              computed on the host, in
+//                                              [0, 1].
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0 or k<1, cpuFraction is
+//                                 outside [0, 1] or deviceBytes cannot hold
+//                                 tiles of 64 x 64
+// HCBLAS_STATUS_EXECUTION_FAILED  the buffers could not be allocated or a
+//                                 tile failed to run
+
+// Arguments the out-of-core schedule would refuse, so that they report
+// INVALID_VALUE rather than a failed execution
+static bool outOfCoreInvalid(int m, int n, int k, size_t elementSize,
+                             size_t deviceBytes, float cpuFraction) {
+  const size_t minTile = HCBLAS_OUT_OF_CORE_MIN_TILE;
+  return m < 0 || n < 0 || k < 1 || !(cpuFraction >= 0 && cpuFraction <= 1) ||
+         (deviceBytes != 0 &&
+          deviceBytes / elementSize < 5 * minTile * minTile);
+}
+
+hcblasStatus_t hcblasSgemmOutOfCore(hcblasHandle_t handle,
+                                    hcblasOperation_t transa,
+                                    hcblasOperation_t transb, int m, int n,
+                                    int k, const float *alpha, const float *A,
+                                    int lda, const float *B, int ldb,
+                                    const float *beta, float *C, int ldc,
+                                    size_t deviceBytes, float cpuFraction) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
 
-  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasSgemmOutOfCore",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d,deviceBytes=%zu,"
+                        "cpuFraction=%g", traceOrder(handle), traceOp(transa),
+                        traceOp(transb), m, n, k, *alpha, lda, ldb, *beta, ldc,
+                        deviceBytes, cpuFraction);
+
+  if (outOfCoreInvalid(m, n, k, sizeof(float), deviceBytes, cpuFraction))
     return HCBLAS_STATUS_INVALID_VALUE;
 
-  __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
-  __int64_t A_batchOffset = 0;
-  __int64_t B_batchOffset = 0;
-  __int64_t C_batchOffset = 0;
+  if (m == 0 || n == 0) return HCBLAS_STATUS_SUCCESS;
 
   hcblasStatus status;
   hcblasTranspose transA, transB;
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_sgemm_out_of_core(
+      handle->acclView(), handle->Order, transA, transB, m, n, k, *alpha, A,
+      lda, B, ldb, *beta, C, ldc, deviceBytes, cpuFraction);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
 
-  status = handle->hcblas_dgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k, *alpha,
-      Aarray, lda, A_batchOffset, Barray, ldb, B_batchOffset, *beta, Carray,
-      ldc, C_batchOffset, aOffset, bOffset, cOffset, batchCount);
+hcblasStatus_t hcblasDgemmOutOfCore(hcblasHandle_t handle,
+                                    hcblasOperation_t transa,
+                                    hcblasOperation_t transb, int m, int n,
+                                    int k, const double *alpha,
+                                    const double *A, int lda, const double *B,
+                                    int ldb, const double *beta, double *C,
+                                    int ldc, size_t deviceBytes,
+                                    float cpuFraction) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  if (capturing(handle)) return HCBLAS_STATUS_INVALID_VALUE;
+
+  hcblasTraceCall trace(handle->binding().acclView, "hcblasDgemmOutOfCore",
+                        "order=%c,transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,"
+                        "lda=%d,ldb=%d,beta=%g,ldc=%d,deviceBytes=%zu,"
+                        "cpuFraction=%g", traceOrder(handle), traceOp(transa),
+                        traceOp(transb), m, n, k, *alpha, lda, ldb, *beta, ldc,
+                        deviceBytes, cpuFraction);
+
+  if (outOfCoreInvalid(m, n, k, sizeof(double), deviceBytes, cpuFraction))
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0) return HCBLAS_STATUS_SUCCESS;
 
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_dgemm_out_of_core(
+      handle->acclView(), handle->Order, transA, transB, m, n, k, *alpha, A,
+      lda, B, ldb, *beta, C, ldc, deviceBytes, cpuFraction);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
 
-hcblasStatus_t hcblasZgemmBatched(
-    hcblasHandle_t handle, hcblasOperation_t transa, hcblasOperation_t transb,
-    int m, int n, int k, const hcDoubleComplex *alpha,
-    hcDoubleComplex *Aarray[], int lda, hcDoubleComplex *Barray[], int ldb,
-    const hcDoubleComplex *beta, hcDoubleComplex *Carray[], int ldc,
-    int batchCount) {
+// 8. hcblasXt<t>gemm()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// as hcblas<t>gemm() does, on every device of handle at once, for A, B and
+// C in host memory. C is cut into square blocks that are shared out among
+// the devices in proportion to their compute units, keeping the blocks of a
+// block row together where the balance allows. Each device streams the rows
+// of op(A) and the columns of op(B) its blocks need as
+// hcblas<t>gemmOutOfCore() does, overlapping the copies with the
+// multiplication, and writes its blocks back into C. Matrices are column
+// major. The call returns when C is complete.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the hcblasXt
+//                                              context.
+// transa       host             input          operation op(A) that is non- or
+//                                              transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              transpose.
+// m            host             input          number of rows of matrix op(A)
+//                                              and C.
+// n            host             input          number of columns of matrix
+//                                              op(B) and C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// lda          host             input          leading dimension of A.
+// B            host             input          <type> array as for
+//                                              hcblas<t>gemm().
+// ldb          host             input          leading dimension of B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication. If beta==0, C
+//                                              does not have to be a valid
+//                                              input.
+// C            host             in/out         <type> array of dimensions ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the handle was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0 or k<1
+// HCBLAS_STATUS_EXECUTION_FAILED  the buffers could not be allocated or a
+//                                 device failed to run its blocks
+
+hcblasStatus_t hcblasXtSgemm(hcblasXtHandle_t handle, hcblasOperation_t transa,
+                             hcblasOperation_t transb, int m, int n, int k,
+                             const float *alpha, const float *A, int lda,
+                             const float *B, int ldb, const float *beta,
+                             float *C, int ldc) {
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
 
-  if (m < 0 || n < 0 || k < 0 || batchCount < 0)
-    return HCBLAS_STATUS_INVALID_VALUE;
+  hcblasTraceCall trace(handle->devices[0]->currentAcclView, "hcblasXtSgemm",
+                        "transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,lda=%d,"
+                        "ldb=%d,beta=%g,ldc=%d,devices=%d,blockDim=%d",
+                        traceOp(transa), traceOp(transb), m, n, k, *alpha,
+                        lda, ldb, *beta, ldc,
+                        static_cast<int>(handle->devices.size()),
+                        handle->blockDim);
 
-  __int64_t aOffset = 0;
-  __int64_t bOffset = 0;
-  __int64_t cOffset = 0;
-  __int64_t A_batchOffset = 0;
-  __int64_t B_batchOffset = 0;
-  __int64_t C_batchOffset = m * n;
+  if (m < 0 || n < 0 || k < 1) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0) return HCBLAS_STATUS_SUCCESS;
 
   hcblasStatus status;
   hcblasTranspose transA, transB;
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_sgemm(ColMajor, transA, transB, m, n, k, *alpha, A,
+                                lda, B, ldb, *beta, C, ldc);
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
 
-  status = handle->hcblas_zgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
-      reinterpret_cast<hc::short_vector::double2 **>(Aarray), aOffset,
-      A_batchOffset, lda,
-      reinterpret_cast<hc::short_vector::double2 **>(Barray), bOffset,
-      B_batchOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(beta)),
-      reinterpret_cast<hc::short_vector::double2 **>(Carray), cOffset,
-      C_batchOffset, ldc, batchCount);
+hcblasStatus_t hcblasXtDgemm(hcblasXtHandle_t handle, hcblasOperation_t transa,
+                             hcblasOperation_t transb, int m, int n, int k,
+                             const double *alpha, const double *A, int lda,
+                             const double *B, int ldb, const double *beta,
+                             double *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  hcblasTraceCall trace(handle->devices[0]->currentAcclView, "hcblasXtDgemm",
+                        "transa=%c,transb=%c,m=%d,n=%d,k=%d,alpha=%g,lda=%d,"
+                        "ldb=%d,beta=%g,ldc=%d,devices=%d,blockDim=%d",
+                        traceOp(transa), traceOp(transb), m, n, k, *alpha,
+                        lda, ldb, *beta, ldc,
+                        static_cast<int>(handle->devices.size()),
+                        handle->blockDim);
+
+  if (m < 0 || n < 0 || k < 1) return HCBLAS_STATUS_INVALID_VALUE;
+
+  if (m == 0 || n == 0) return HCBLAS_STATUS_SUCCESS;
 
+  hcblasStatus status;
+  hcblasTranspose transA, transB;
+  transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
+  transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
+  status = handle->hcblas_dgemm(ColMajor, transA, transB, m, n, k, *alpha, A,
+                                lda, B, ldb, *beta, C, ldc);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -21,6 +21,52 @@ THE SOFTWARE.
 */
 #include "include/hipblas.h"
 #include "include/hcblas.h"
+#include <atomic>
+#include <mutex>
+
+// The handle-less helpers (hipblasSetVector and friends) run on a default
+// context per device. It is created on first use and then shared by every
+// thread, so repeated copies no longer pay for a handle create/destroy and
+// the accelerator enumeration that comes with it. The contexts are kept for
+// the lifetime of the process on purpose: tearing them down from a static
+// destructor would race with the HIP runtime's own shutdown.
+#define HIPBLAS_MAX_DEFAULT_DEVICES 64
+
+static std::atomic<hipblasHandle_t>
+    defaultHandles[HIPBLAS_MAX_DEFAULT_DEVICES];
+static std::mutex defaultHandlesMutex;
+
+// Returns the default context of the current device in *handle. *owned is
+// set when the device is outside the cache and the caller has to destroy
+// the handle itself.
+static hipblasStatus_t hipblasGetDefaultHandle(hipblasHandle_t *handle,
+                                               bool *owned) {
+  int deviceId;
+  *owned = false;
+  if (hipGetDevice(&deviceId) != hipSuccess || deviceId < 0) {
+    return HIPBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (deviceId >= HIPBLAS_MAX_DEFAULT_DEVICES) {
+    *owned = true;
+    return hipblasCreate(handle);
+  }
+
+  *handle = defaultHandles[deviceId].load(std::memory_order_acquire);
+  if (*handle != NULL) {
+    return HIPBLAS_STATUS_SUCCESS;
+  }
+
+  std::lock_guard<std::mutex> lock(defaultHandlesMutex);
+  *handle = defaultHandles[deviceId].load(std::memory_order_relaxed);
+  if (*handle != NULL) {
+    return HIPBLAS_STATUS_SUCCESS;
+  }
+  hipblasStatus_t status = hipblasCreate(handle);
+  if (status == HIPBLAS_STATUS_SUCCESS) {
+    defaultHandles[deviceId].store(*handle, std::memory_order_release);
+  }
+  return status;
+}
 
 #ifdef __cplusplus
 extern "C" {
@@ -132,52 +178,60 @@ hipblasStatus_t hipblasDestroy(hipblasHandle_t handle) {
 hipblasStatus_t hipblasSetVector(int n, int elemSize, const void *x, int incx,
                                  void *y, int incy) {
   hipblasHandle_t handle = NULL;
-  hipblasStatus_t status = HIPBLAS_STATUS_INTERNAL_ERROR;
-  status = hipblasCreate(&handle);
+  bool owned = false;
+  hipblasStatus_t status = hipblasGetDefaultHandle(&handle, &owned);
   if (status == HIPBLAS_STATUS_SUCCESS) {
     status = hipHCBLASStatusToHIPStatus(
         hcblasSetVector(handle, n, elemSize, x, incx, y, incy));
   }
-  hipblasDestroy(handle);
+  if (owned) {
+    hipblasDestroy(handle);
+  }
   return status;
 }
 
 hipblasStatus_t hipblasGetVector(int n, int elemSize, const void *x, int incx,
                                  void *y, int incy) {
   hipblasHandle_t handle = NULL;
-  hipblasStatus_t status = HIPBLAS_STATUS_INTERNAL_ERROR;
-  status = hipblasCreate(&handle);
+  bool owned = false;
+  hipblasStatus_t status = hipblasGetDefaultHandle(&handle, &owned);
   if (status == HIPBLAS_STATUS_SUCCESS) {
-    status = hipHCBLASStatusToHIPStatus(hcblasGetVector(
-        handle, n, elemSize, x, incx, y, incy));  // HGSOS no need for handle
+    status = hipHCBLASStatusToHIPStatus(
+        hcblasGetVector(handle, n, elemSize, x, incx, y, incy));
+  }
+  if (owned) {
+    hipblasDestroy(handle);
   }
-  hipblasDestroy(handle);
   return status;
 }
 
 hipblasStatus_t hipblasSetMatrix(int rows, int cols, int elemSize,
                                  const void *A, int lda, void *B, int ldb) {
   hipblasHandle_t handle = NULL;
-  hipblasStatus_t status = HIPBLAS_STATUS_INTERNAL_ERROR;
-  status = hipblasCreate(&handle);
+  bool owned = false;
+  hipblasStatus_t status = hipblasGetDefaultHandle(&handle, &owned);
   if (status == HIPBLAS_STATUS_SUCCESS) {
     status = hipHCBLASStatusToHIPStatus(
         hcblasSetMatrix(handle, rows, cols, elemSize, A, lda, B, ldb));
   }
-  hipblasDestroy(handle);
+  if (owned) {
+    hipblasDestroy(handle);
+  }
   return status;
 }
 
 hipblasStatus_t hipblasGetMatrix(int rows, int cols, int elemSize,
                                  const void *A, int lda, void *B, int ldb) {
   hipblasHandle_t handle = NULL;
-  hipblasStatus_t status = HIPBLAS_STATUS_INTERNAL_ERROR;
-  status = hipblasCreate(&handle);
+  bool owned = false;
+  hipblasStatus_t status = hipblasGetDefaultHandle(&handle, &owned);
   if (status == HIPBLAS_STATUS_SUCCESS) {
     status = hipHCBLASStatusToHIPStatus(
         hcblasGetMatrix(handle, rows, cols, elemSize, A, lda, B, ldb));
   }
-  hipblasDestroy(handle);
+  if (owned) {
+    hipblasDestroy(handle);
+  }
   return status;
 }
 
@@ -0,0 +1,405 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "hcblas_bench.h"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+typedef std::map<std::string, std::string> benchArgs;
+
+static const char *const kRoutines[] = {"gemm", "gemv", "ger",  "axpy",
+                                        "scal", "dot",  "asum", "copy"};
+
+// Splits a CSV line, honouring double quoted fields
+static std::vector<std::string> split_csv(const std::string &line) {
+  std::vector<std::string> fields(1);
+  bool quoted = false;
+  for (size_t i = 0; i < line.size(); i++) {
+    char c = line[i];
+    if (c == '"') {
+      quoted = !quoted;
+    } else if (c == ',' && !quoted) {
+      fields.push_back(std::string());
+    } else {
+      fields.back() += c;
+    }
+  }
+  return fields;
+}
+
+// key=value,key=value as written by the trace layer
+static void split_args(const std::string &text, benchArgs *args) {
+  std::vector<std::string> pairs = split_csv(text);
+  for (size_t i = 0; i < pairs.size(); i++) {
+    size_t equals = pairs[i].find('=');
+    if (equals != std::string::npos) {
+      (*args)[pairs[i].substr(0, equals)] = pairs[i].substr(equals + 1);
+    }
+  }
+}
+
+// Reads a JSON string or bare value starting at pos; pos ends past it
+static std::string json_value(const std::string &line, size_t *pos) {
+  std::string value;
+  size_t i = *pos;
+  if (i < line.size() && line[i] == '"') {
+    for (i++; i < line.size() && line[i] != '"'; i++) {
+      if (line[i] == '\\' && i + 1 < line.size()) {
+        i++;
+      }
+      value += line[i];
+    }
+    i++;
+  } else {
+    for (; i < line.size() && line[i] != ',' && line[i] != '}'; i++) {
+      value += line[i];
+    }
+  }
+  *pos = i;
+  return value;
+}
+
+// The call name and the flat "args" object of a JSON trace line
+static bool parse_json(const std::string &line, std::string *name,
+                       benchArgs *args) {
+  size_t call = line.find("\"call\":");
+  size_t object = line.find("\"args\":{");
+  if (call == std::string::npos || object == std::string::npos) {
+    return false;
+  }
+  size_t pos = call + 7;
+  *name = json_value(line, &pos);
+  pos = object + 8;
+  while (pos < line.size() && line[pos] == '"') {
+    std::string key = json_value(line, &pos);
+    if (pos >= line.size() || line[pos] != ':') {
+      return false;
+    }
+    pos++;
+    (*args)[key] = json_value(line, &pos);
+    if (pos < line.size() && line[pos] == ',') {
+      pos++;
+    }
+  }
+  return true;
+}
+
+// Legacy dimension file: whitespace separated SGEMM parameters
+static bool parse_dimensions(const std::string &line, benchArgs *args) {
+  static const char *const keys[] = {"m",      "n",   "k",   "transa",
+                                     "transb", "lda", "ldb", "ldc",
+                                     "alpha",  "beta"};
+  std::istringstream in(line);
+  std::string value;
+  int i = 0;
+  for (; i < 10 && in >> value; i++) {
+    (*args)[keys[i]] = value;
+  }
+  if (i < 3) {
+    return false;
+  }
+  for (int t = 3; t < 5 && t < i; t++) {
+    (*args)[keys[t]] = (*args)[keys[t]] == "1" ? "T" : "N";
+  }
+  return true;
+}
+
+static int int_arg(const benchArgs &args, const char *key, int fallback) {
+  benchArgs::const_iterator it = args.find(key);
+  return it == args.end() ? fallback : atoi(it->second.c_str());
+}
+
+static char char_arg(const benchArgs &args, const char *key, char fallback) {
+  benchArgs::const_iterator it = args.find(key);
+  return it == args.end() || it->second.empty() ? fallback : it->second[0];
+}
+
+// Real or complex scalar; complex values are written as 1.5-2i
+static void scalar_arg(const benchArgs &args, const char *key,
+                       double fallback, double value[2]) {
+  value[0] = fallback;
+  value[1] = 0;
+  benchArgs::const_iterator it = args.find(key);
+  if (it != args.end()) {
+    char *end = NULL;
+    value[0] = strtod(it->second.c_str(), &end);
+    if (*end == '+' || *end == '-') {
+      value[1] = strtod(end, NULL);
+    }
+  }
+}
+
+static bool make_call(const std::string &name, const benchArgs &args,
+                      benchCall *call, std::string *error) {
+  if (name.compare(0, 6, "hcblas") != 0 || name.size() < 8) {
+    *error = "not an hcblas call: " + name;
+    return false;
+  }
+  call->name = name;
+  call->precision = name[6];
+  call->routine = name.substr(7);
+  call->batched = false;
+  size_t batched = call->routine.find("Batched");
+  if (batched != std::string::npos) {
+    call->routine.erase(batched);
+    call->batched = true;
+  }
+  bool known = strchr("SDCZ", call->precision) != NULL;
+  bool routine = false;
+  for (size_t i = 0; i < sizeof(kRoutines) / sizeof(kRoutines[0]); i++) {
+    routine = routine || call->routine == kRoutines[i];
+  }
+  // Only the real precisions of the level 1 and 2 routines are replayed
+  if (call->routine != "gemm" && call->precision != 'S' &&
+      call->precision != 'D') {
+    known = false;
+  }
+  if (!known || !routine || (call->batched && call->routine != "gemm")) {
+    *error = "unsupported call: " + name;
+    return false;
+  }
+
+  call->order = char_arg(args, "order", 'C');
+  call->transA = char_arg(args, call->routine == "gemv" ? "trans" : "transa",
+                          'N');
+  call->transB = char_arg(args, "transb", 'N');
+  call->m = int_arg(args, "m", 0);
+  call->n = int_arg(args, "n", 0);
+  call->k = int_arg(args, "k", 0);
+  if (call->m < 0 || call->n < 0 || call->k < 0) {
+    *error = "negative dimension";
+    return false;
+  }
+  if (call->routine == "gemm" && (!call->m || !call->n || !call->k)) {
+    *error = "gemm needs m, n and k";
+    return false;
+  }
+
+  // Default leading dimensions: tightly packed
+  bool colMajor = call->order != 'R';
+  int rowsA = call->transA == 'N' ? call->m : call->k;
+  int colsA = call->transA == 'N' ? call->k : call->m;
+  int rowsB = call->transB == 'N' ? call->k : call->n;
+  int colsB = call->transB == 'N' ? call->n : call->k;
+  if (call->routine != "gemm") {
+    rowsA = call->m;
+    colsA = call->n;
+  }
+  call->lda = int_arg(args, "lda", colMajor ? rowsA : colsA);
+  call->ldb = int_arg(args, "ldb", colMajor ? rowsB : colsB);
+  call->ldc = int_arg(args, "ldc", colMajor ? call->m : call->n);
+  call->incx = int_arg(args, "incx", 1);
+  call->incy = int_arg(args, "incy", 1);
+  call->batchCount = call->batched ? int_arg(args, "batchCount", 1) : 1;
+  if (call->incx == 0 || call->incy == 0 || call->batchCount < 1) {
+    *error = "invalid increment or batch count";
+    return false;
+  }
+  scalar_arg(args, "alpha", 1, call->alpha);
+  scalar_arg(args, "beta", 0, call->beta);
+  call->count = 1;
+  return true;
+}
+
+benchParseResult benchParseLine(const std::string &line, benchCall *call,
+                                std::string *error) {
+  size_t start = line.find_first_not_of(" \t\r");
+  if (start == std::string::npos || line[start] == '#') {
+    return BenchSkipped;
+  }
+  std::string name;
+  benchArgs args;
+  if (line[start] == '{') {
+    if (line.find("\"dropped\"") != std::string::npos) {
+      return BenchSkipped;
+    }
+    if (!parse_json(line.substr(start), &name, &args)) {
+      *error = "malformed JSON trace line";
+      return BenchError;
+    }
+  } else if (isdigit(static_cast<unsigned char>(line[start])) &&
+             line.find(',') == std::string::npos) {
+    if (!parse_dimensions(line, &args)) {
+      *error = "dimension line needs at least M N K";
+      return BenchError;
+    }
+    name = "hcblasSgemm";
+  } else {
+    std::vector<std::string> fields = split_csv(line.substr(start));
+    if (fields[0] == "time_us") {
+      return BenchSkipped;
+    }
+    if (fields.size() != 6) {
+      *error = "CSV trace line needs 6 fields";
+      return BenchError;
+    }
+    name = fields[2];
+    split_args(fields[5], &args);
+  }
+  return make_call(name, args, call, error) ? BenchParsed : BenchError;
+}
+
+std::vector<benchCall> benchParseLog(std::istream &in,
+                                     std::vector<std::string> *errors) {
+  std::vector<benchCall> calls;
+  std::map<std::string, size_t> seen;
+  std::string line;
+  for (int number = 1; std::getline(in, line); number++) {
+    benchCall call;
+    std::string error;
+    benchParseResult result = benchParseLine(line, &call, &error);
+    if (result == BenchError) {
+      std::ostringstream message;
+      message << "line " << number << ": " << error;
+      errors->push_back(message.str());
+    } else if (result == BenchParsed) {
+      std::string key = call.name + "," + benchDescribe(call);
+      std::map<std::string, size_t>::iterator it = seen.find(key);
+      if (it != seen.end()) {
+        calls[it->second].count++;
+      } else {
+        seen[key] = calls.size();
+        calls.push_back(call);
+      }
+    }
+  }
+  return calls;
+}
+
+std::string benchDescribe(const benchCall &call) {
+  std::ostringstream out;
+  out << "order=" << call.order;
+  if (call.routine == "gemm" || call.routine == "gemv") {
+    out << ",transa=" << call.transA;
+  }
+  if (call.routine == "gemm") {
+    out << ",transb=" << call.transB;
+  }
+  if (call.routine == "gemm" || call.routine == "gemv" ||
+      call.routine == "ger") {
+    out << ",m=" << call.m;
+  }
+  out << ",n=" << call.n;
+  if (call.routine == "gemm") {
+    out << ",k=" << call.k << ",lda=" << call.lda << ",ldb=" << call.ldb
+        << ",ldc=" << call.ldc;
+  } else if (call.routine == "gemv" || call.routine == "ger") {
+    out << ",lda=" << call.lda << ",incx=" << call.incx
+        << ",incy=" << call.incy;
+  } else {
+    out << ",incx=" << call.incx << ",incy=" << call.incy;
+  }
+  bool complex = call.precision == 'C' || call.precision == 'Z';
+  if (call.routine != "dot" && call.routine != "asum" &&
+      call.routine != "copy") {
+    out << ",alpha=" << call.alpha[0];
+    if (complex) {
+      out << (call.alpha[1] < 0 ? "" : "+") << call.alpha[1] << "i";
+    }
+  }
+  if (call.routine == "gemm" || call.routine == "gemv") {
+    out << ",beta=" << call.beta[0];
+    if (complex) {
+      out << (call.beta[1] < 0 ? "" : "+") << call.beta[1] << "i";
+    }
+  }
+  if (call.batched) {
+    out << ",batchCount=" << call.batchCount;
+  }
+  return out.str();
+}
+
+// Elements spanned by a strided vector of length n
+static size_t vector_span(int n, int inc) {
+  return n ? 1 + static_cast<size_t>(n - 1) * (inc < 0 ? -inc : inc) : 0;
+}
+
+// Elements of a rows x cols matrix with leading dimension ld
+static size_t matrix_span(char order, int rows, int cols, int ld) {
+  return static_cast<size_t>(ld) * (order == 'R' ? rows : cols);
+}
+
+void benchOperandSizes(const benchCall &call, size_t sizes[3]) {
+  if (call.routine == "gemm") {
+    bool nA = call.transA == 'N', nB = call.transB == 'N';
+    sizes[0] = matrix_span(call.order, nA ? call.m : call.k,
+                           nA ? call.k : call.m, call.lda);
+    sizes[1] = matrix_span(call.order, nB ? call.k : call.n,
+                           nB ? call.n : call.k, call.ldb);
+    sizes[2] = matrix_span(call.order, call.m, call.n, call.ldc);
+  } else if (call.routine == "gemv") {
+    bool n = call.transA == 'N';
+    sizes[0] = matrix_span(call.order, call.m, call.n, call.lda);
+    sizes[1] = vector_span(n ? call.n : call.m, call.incx);
+    sizes[2] = vector_span(n ? call.m : call.n, call.incy);
+  } else if (call.routine == "ger") {
+    sizes[0] = matrix_span(call.order, call.m, call.n, call.lda);
+    sizes[1] = vector_span(call.m, call.incx);
+    sizes[2] = vector_span(call.n, call.incy);
+  } else {
+    sizes[0] = vector_span(call.n, call.incx);
+    sizes[1] = vector_span(call.n, call.incy);
+    sizes[2] = 0;
+  }
+}
+
+double benchFlops(const benchCall &call) {
+  double m = call.m, n = call.n, k = call.k, flops = 0;
+  if (call.routine == "gemm") {
+    flops = 2 * m * n * k;
+  } else if (call.routine == "gemv" || call.routine == "ger") {
+    flops = 2 * m * n;
+  } else if (call.routine == "axpy" || call.routine == "dot") {
+    flops = 2 * n;
+  } else if (call.routine == "scal" || call.routine == "asum") {
+    flops = n;
+  }
+  // A complex multiply-add is four real multiplies and four adds
+  bool complex = call.precision == 'C' || call.precision == 'Z';
+  return flops * (complex ? 4 : 1) * call.batchCount;
+}
+
+double benchBytes(const benchCall &call) {
+  double m = call.m, n = call.n, k = call.k, elements = 0;
+  bool readC = call.beta[0] != 0 || call.beta[1] != 0;
+  if (call.routine == "gemm") {
+    elements = m * k + k * n + m * n * (readC ? 2 : 1);
+  } else if (call.routine == "gemv") {
+    double x = call.transA == 'N' ? n : m, y = call.transA == 'N' ? m : n;
+    elements = m * n + x + y * (readC ? 2 : 1);
+  } else if (call.routine == "ger") {
+    elements = 2 * m * n + m + n;
+  } else if (call.routine == "axpy") {
+    elements = 3 * n;
+  } else if (call.routine == "asum") {
+    elements = n;
+  } else {
+    elements = 2 * n;
+  }
+  size_t element = call.precision == 'S' ? 4
+                   : call.precision == 'Z' ? 16 : 8;
+  return elements * element * call.batchCount;
+}
@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "hcblas_bench.h"
+
+benchStats benchSummarize(StatisticalTimer &timer,
+                          StatisticalTimer::sTimerID id, int samples,
+                          double flops, double bytes) {
+  benchStats stats = {0, 0, 0, 0, 0, 0, 0};
+  stats.pruned = timer.pruneOutliers(id, 3.0);
+  stats.samples = samples - stats.pruned;
+  double seconds = timer.getAverageTime(id);
+  if (seconds <= 0) {
+    return stats;
+  }
+  // Mean and stddev are in timer ticks, average and minimum in seconds
+  double ticksPerUs = timer.getMean(id) / (seconds * 1e6);
+  stats.meanUs = seconds * 1e6;
+  stats.minUs = timer.getMinimumTime(id) * 1e6;
+  stats.stdDevUs = timer.getStdDev(id) / ticksPerUs;
+  stats.gflops = flops / seconds * 1e-9;
+  stats.gbps = bytes / seconds * 1e-9;
+  return stats;
+}
+
+benchStats benchAggregate(const std::vector<benchCall> &calls,
+                          const std::vector<benchStats> &stats) {
+  benchStats total = {0, 0, 0, 0, 0, 0, 0};
+  double flops = 0, bytes = 0, seconds = 0;
+  for (size_t i = 0; i < calls.size() && i < stats.size(); i++) {
+    double count = calls[i].count;
+    total.samples += stats[i].samples;
+    total.pruned += stats[i].pruned;
+    total.meanUs += count * stats[i].meanUs;
+    total.minUs += count * stats[i].minUs;
+    flops += count * benchFlops(calls[i]);
+    bytes += count * benchBytes(calls[i]);
+  }
+  seconds = total.meanUs * 1e-6;
+  if (seconds > 0) {
+    total.gflops = flops / seconds * 1e-9;
+    total.gbps = bytes / seconds * 1e-9;
+  }
+  return total;
+}
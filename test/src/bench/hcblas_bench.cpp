@@ -0,0 +1,364 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "hcblas_bench.h"
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+unsigned int global_seed = 100;
+
+static void usage(const char *program) {
+  cerr << "usage: " << program
+       << " <log> [--iterations N] [--warmup N] [--device I]" << endl
+       << "  <log> is an HCBLAS_LAYER trace (CSV or JSON lines) or a"
+       << " dimension file" << endl;
+}
+
+static hcblasOperation_t to_op(char trans) {
+  return trans == 'N' ? HCBLAS_OP_N
+                      : (trans == 'T' ? HCBLAS_OP_T : HCBLAS_OP_C);
+}
+
+// Scalars and synthetic data, values in [-1, 1]
+static double random_value() {
+  return 2.0 * rand_r(&global_seed) / RAND_MAX - 1;
+}
+
+static void set_value(float *value, const double source[2]) {
+  *value = source[0];
+}
+static void set_value(double *value, const double source[2]) {
+  *value = source[0];
+}
+static void set_value(hcComplex *value, const double source[2]) {
+  value->x = source[0];
+  value->y = source[1];
+}
+static void set_value(hcDoubleComplex *value, const double source[2]) {
+  value->x = source[0];
+  value->y = source[1];
+}
+
+// Precision specific entry points. Level 3 exists in all four precisions.
+static hcblasStatus_t gemm(hcblasHandle_t handle, const benchCall &c,
+                           const float *alpha, float *A, float *B,
+                           const float *beta, float *C) {
+  return hcblasSgemm(handle, to_op(c.transA), to_op(c.transB), c.m, c.n, c.k,
+                     alpha, A, c.lda, B, c.ldb, beta, C, c.ldc);
+}
+static hcblasStatus_t gemm(hcblasHandle_t handle, const benchCall &c,
+                           const double *alpha, double *A, double *B,
+                           const double *beta, double *C) {
+  return hcblasDgemm(handle, to_op(c.transA), to_op(c.transB), c.m, c.n, c.k,
+                     alpha, A, c.lda, B, c.ldb, beta, C, c.ldc);
+}
+static hcblasStatus_t gemm(hcblasHandle_t handle, const benchCall &c,
+                           const hcComplex *alpha, hcComplex *A, hcComplex *B,
+                           const hcComplex *beta, hcComplex *C) {
+  return hcblasCgemm(handle, to_op(c.transA), to_op(c.transB), c.m, c.n, c.k,
+                     alpha, A, c.lda, B, c.ldb, beta, C, c.ldc);
+}
+static hcblasStatus_t gemm(hcblasHandle_t handle, const benchCall &c,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           hcDoubleComplex *B, const hcDoubleComplex *beta,
+                           hcDoubleComplex *C) {
+  return hcblasZgemm(handle, to_op(c.transA), to_op(c.transB), c.m, c.n, c.k,
+                     alpha, A, c.lda, B, c.ldb, beta, C, c.ldc);
+}
+
+static hcblasStatus_t gemm_batched(hcblasHandle_t handle, const benchCall &c,
+                                   const float *alpha, float *A[], float *B[],
+                                   const float *beta, float *C[]) {
+  return hcblasSgemmBatched(handle, to_op(c.transA), to_op(c.transB), c.m,
+                            c.n, c.k, alpha, A, c.lda, B, c.ldb, beta, C,
+                            c.ldc, c.batchCount);
+}
+static hcblasStatus_t gemm_batched(hcblasHandle_t handle, const benchCall &c,
+                                   const double *alpha, double *A[],
+                                   double *B[], const double *beta,
+                                   double *C[]) {
+  return hcblasDgemmBatched(handle, to_op(c.transA), to_op(c.transB), c.m,
+                            c.n, c.k, alpha, A, c.lda, B, c.ldb, beta, C,
+                            c.ldc, c.batchCount);
+}
+static hcblasStatus_t gemm_batched(hcblasHandle_t handle, const benchCall &c,
+                                   const hcComplex *alpha, hcComplex *A[],
+                                   hcComplex *B[], const hcComplex *beta,
+                                   hcComplex *C[]) {
+  return hcblasCgemmBatched(handle, to_op(c.transA), to_op(c.transB), c.m,
+                            c.n, c.k, alpha, A, c.lda, B, c.ldb, beta, C,
+                            c.ldc, c.batchCount);
+}
+static hcblasStatus_t gemm_batched(hcblasHandle_t handle, const benchCall &c,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *A[], hcDoubleComplex *B[],
+                                   const hcDoubleComplex *beta,
+                                   hcDoubleComplex *C[]) {
+  return hcblasZgemmBatched(handle, to_op(c.transA), to_op(c.transB), c.m,
+                            c.n, c.k, alpha, A, c.lda, B, c.ldb, beta, C,
+                            c.ldc, c.batchCount);
+}
+
+// Level 1 and 2, real precisions only; the parser rejects the others
+template <typename T>
+static hcblasStatus_t vector_call(hcblasHandle_t handle, const benchCall &c,
+                                  const T *alpha, T *ops[3], const T *beta) {
+  return HCBLAS_STATUS_INVALID_VALUE;
+}
+
+static hcblasStatus_t vector_call(hcblasHandle_t handle, const benchCall &c,
+                                  const float *alpha, float *ops[3],
+                                  const float *beta) {
+  float result;
+  if (c.routine == "gemv") {
+    return hcblasSgemv(handle, to_op(c.transA), c.m, c.n, alpha, ops[0],
+                       c.lda, ops[1], c.incx, beta, ops[2], c.incy);
+  } else if (c.routine == "ger") {
+    return hcblasSger(handle, c.m, c.n, alpha, ops[1], c.incx, ops[2], c.incy,
+                      ops[0], c.lda);
+  } else if (c.routine == "axpy") {
+    return hcblasSaxpy(handle, c.n, alpha, ops[0], c.incx, ops[1], c.incy);
+  } else if (c.routine == "scal") {
+    return hcblasSscal(handle, c.n, alpha, ops[0], c.incx);
+  } else if (c.routine == "dot") {
+    return hcblasSdot(handle, c.n, ops[0], c.incx, ops[1], c.incy, &result);
+  } else if (c.routine == "asum") {
+    return hcblasSasum(handle, c.n, ops[0], c.incx, &result);
+  }
+  return hcblasScopy(handle, c.n, ops[0], c.incx, ops[1], c.incy);
+}
+
+static hcblasStatus_t vector_call(hcblasHandle_t handle, const benchCall &c,
+                                  const double *alpha, double *ops[3],
+                                  const double *beta) {
+  double result;
+  if (c.routine == "gemv") {
+    return hcblasDgemv(handle, to_op(c.transA), c.m, c.n, alpha, ops[0],
+                       c.lda, ops[1], c.incx, beta, ops[2], c.incy);
+  } else if (c.routine == "ger") {
+    return hcblasDger(handle, c.m, c.n, alpha, ops[1], c.incx, ops[2], c.incy,
+                      ops[0], c.lda);
+  } else if (c.routine == "axpy") {
+    return hcblasDaxpy(handle, c.n, alpha, ops[0], c.incx, ops[1], c.incy);
+  } else if (c.routine == "scal") {
+    return hcblasDscal(handle, c.n, alpha, ops[0], c.incx);
+  } else if (c.routine == "dot") {
+    return hcblasDdot(handle, c.n, ops[0], c.incx, ops[1], c.incy, &result);
+  } else if (c.routine == "asum") {
+    return hcblasDasum(handle, c.n, ops[0], c.incx, &result);
+  }
+  return hcblasDcopy(handle, c.n, ops[0], c.incx, ops[1], c.incy);
+}
+
+/* Replays call iterations times after warmup untimed runs, on operands
+ filled with synthetic data. Each sample spans the call and the wait for
+ the device to finish it. */
+template <typename T>
+static benchStats replay(hcblasHandle_t handle, hc::accelerator &accl,
+                         const benchCall &call, int id, int iterations,
+                         int warmup, hcblasStatus_t *status) {
+  hc::accelerator_view accl_view = accl.get_default_view();
+  size_t sizes[3];
+  benchOperandSizes(call, sizes);
+  T *ops[3] = {NULL, NULL, NULL};
+  T **arrays[3] = {NULL, NULL, NULL};
+  for (int i = 0; i < 3; i++) {
+    size_t count = sizes[i] * call.batchCount;
+    if (count == 0) {
+      continue;
+    }
+    std::vector<T> host(count);
+    double value[2];
+    for (size_t e = 0; e < count; e++) {
+      value[0] = random_value();
+      value[1] = random_value();
+      set_value(&host[e], value);
+    }
+    ops[i] = hc::am_alloc(sizeof(T) * count, accl, 0);
+    accl_view.copy(host.data(), ops[i], sizeof(T) * count);
+    if (call.batched) {
+      std::vector<T *> pointers(call.batchCount);
+      for (int b = 0; b < call.batchCount; b++) {
+        pointers[b] = ops[i] + b * sizes[i];
+      }
+      arrays[i] = hc::am_alloc(sizeof(T *) * call.batchCount, accl, 0);
+      accl_view.copy(pointers.data(), arrays[i],
+                     sizeof(T *) * call.batchCount);
+    }
+  }
+
+  T alpha, beta;
+  set_value(&alpha, call.alpha);
+  set_value(&beta, call.beta);
+  handle->Order = call.order == 'R' ? RowMajor : ColMajor;
+  StatisticalTimer &timer = StatisticalTimer::getInstance();
+  StatisticalTimer::sTimerID timer_id =
+      timer.getUniqueID(call.name + "," + benchDescribe(call), id);
+  *status = HCBLAS_STATUS_SUCCESS;
+  for (int it = 0; it < warmup + iterations; it++) {
+    if (it >= warmup) {
+      timer.Start(timer_id);
+    }
+    if (call.routine != "gemm") {
+      *status = vector_call(handle, call, &alpha, ops, &beta);
+    } else if (call.batched) {
+      *status = gemm_batched(handle, call, &alpha, arrays[0], arrays[1],
+                             &beta, arrays[2]);
+    } else {
+      *status = gemm(handle, call, &alpha, ops[0], ops[1], &beta, ops[2]);
+    }
+    accl_view.wait();
+    if (it >= warmup) {
+      timer.Stop(timer_id);
+    }
+    if (*status != HCBLAS_STATUS_SUCCESS) {
+      break;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    if (ops[i]) hc::am_free(ops[i]);
+    if (arrays[i]) hc::am_free(arrays[i]);
+  }
+  benchStats stats = {0, 0, 0, 0, 0, 0, 0};
+  if (*status == HCBLAS_STATUS_SUCCESS) {
+    stats = benchSummarize(timer, timer_id, iterations, benchFlops(call),
+                           benchBytes(call));
+  }
+  return stats;
+}
+
+static void print_row(const std::string &name, const std::string &args,
+                      int count, const benchStats &stats) {
+  cout << name << ",\"" << args << "\"," << count << "," << stats.samples
+       << "," << stats.meanUs << "," << stats.minUs << "," << stats.stdDevUs
+       << "," << stats.gflops << "," << stats.gbps << endl;
+}
+
+int main(int argc, char *argv[]) {
+  const char *path = NULL;
+  int iterations = 10;
+  int warmup = 2;
+  int device = -1;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--warmup") && i + 1 < argc) {
+      warmup = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--device") && i + 1 < argc) {
+      device = atoi(argv[++i]);
+    } else if (argv[i][0] != '-' && path == NULL) {
+      path = argv[i];
+    } else {
+      usage(argv[0]);
+      return -1;
+    }
+  }
+  if (path == NULL || iterations < 1 || warmup < 0) {
+    usage(argv[0]);
+    return -1;
+  }
+
+  std::ifstream log(path);
+  if (!log) {
+    cerr << "cannot open " << path << endl;
+    return -1;
+  }
+  std::vector<std::string> errors;
+  std::vector<benchCall> calls = benchParseLog(log, &errors);
+  for (size_t i = 0; i < errors.size(); i++) {
+    cerr << path << ": " << errors[i] << endl;
+  }
+
+  hc::accelerator accl;
+  if (device >= 0) {
+    std::vector<hc::accelerator> all = hc::accelerator::get_all();
+    if (device >= static_cast<int>(all.size())) {
+      cerr << "no device " << device << endl;
+      return -1;
+    }
+    accl = all[device];
+  }
+  hc::accelerator_view accl_view = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  if (hcblasCreate(&handle, &accl_view) != HCBLAS_STATUS_SUCCESS) {
+    cerr << "cannot create an hcblas handle" << endl;
+    return -1;
+  }
+
+  StatisticalTimer &timer = StatisticalTimer::getInstance();
+  timer.Reserve(calls.size(), iterations);
+  timer.setNormalize(true);
+
+  cout << "call,args,count,samples,mean_us,min_us,stddev_us,gflops,gbps"
+       << endl;
+  std::vector<benchStats> stats(calls.size());
+  int failures = 0;
+  for (size_t i = 0; i < calls.size(); i++) {
+    hcblasStatus_t status = HCBLAS_STATUS_SUCCESS;
+    switch (calls[i].precision) {
+      case 'S':
+        stats[i] = replay<float>(handle, accl, calls[i], i, iterations, warmup,
+                                 &status);
+        break;
+      case 'D':
+        stats[i] = replay<double>(handle, accl, calls[i], i, iterations,
+                                  warmup, &status);
+        break;
+      case 'C':
+        stats[i] = replay<hcComplex>(handle, accl, calls[i], i, iterations,
+                                     warmup, &status);
+        break;
+      default:
+        stats[i] = replay<hcDoubleComplex>(handle, accl, calls[i], i,
+                                           iterations, warmup, &status);
+        break;
+    }
+    if (status != HCBLAS_STATUS_SUCCESS) {
+      cerr << calls[i].name << " " << benchDescribe(calls[i])
+           << " failed with status " << status << endl;
+      failures++;
+    }
+    print_row(calls[i].name, benchDescribe(calls[i]), calls[i].count,
+              stats[i]);
+  }
+  int total = 0;
+  for (size_t i = 0; i < calls.size(); i++) {
+    total += calls[i].count;
+  }
+  print_row("total", "", total, benchAggregate(calls, stats));
+
+  hcblasDestroy(&handle);
+  return failures || !errors.empty() ? 1 : 0;
+}
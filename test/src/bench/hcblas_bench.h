@@ -0,0 +1,106 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* hcblas-bench: replays a call log as a benchmark. The log is either an
+* HCBLAS_LAYER trace (CSV or JSON lines) or a dimension file in the format
+* of benchmark/BLAS_benchmark_Convolution_Networks (M N K transA transB lda
+* ldb ldc alpha beta aOffset bOffset cOffset, read as column major SGEMM).
+*
+* Parsing, the cost models and the statistics below do not touch the device
+* so they can be tested on any host.
+*/
+
+#ifndef TEST_SRC_BENCH_HCBLAS_BENCH_H_
+#define TEST_SRC_BENCH_HCBLAS_BENCH_H_
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+#include "statisticalTimer.h"
+
+// One call to replay
+struct benchCall {
+  std::string name;     // C API function, e.g. hcblasSgemm
+  std::string routine;  // gemm, gemv, ger, axpy, scal, dot, asum or copy
+  char precision;       // S, D, C or Z
+  bool batched;
+  char order;           // C or R
+  char transA;          // N, T or C; the transpose of gemv
+  char transB;
+  int m, n, k;
+  int lda, ldb, ldc;
+  int incx, incy;
+  int batchCount;
+  double alpha[2];      // real, imaginary
+  double beta[2];
+  int count;            // occurrences in the log
+};
+
+enum benchParseResult { BenchParsed, BenchSkipped, BenchError };
+
+/* Parses one line of a log. Blank lines, comments and headers are skipped;
+ on error, error says why. */
+benchParseResult benchParseLine(const std::string &line, benchCall *call,
+                                std::string *error);
+
+/* Parses a whole log, merging identical calls into one entry with a count.
+ Entries keep the order of first appearance. Errors are reported with
+ their line number and do not stop the parse. */
+std::vector<benchCall> benchParseLog(std::istream &in,
+                                     std::vector<std::string> *errors);
+
+// Arguments of call as key=value pairs, in a fixed order
+std::string benchDescribe(const benchCall &call);
+
+// Element counts of the operands of one batch element: A, B, C for the
+// level 3 routines, A, x, y for gemv and ger, x, y for level 1.
+void benchOperandSizes(const benchCall &call, size_t sizes[3]);
+
+// Floating point operations and bytes moved by one call
+double benchFlops(const benchCall &call);
+double benchBytes(const benchCall &call);
+
+struct benchStats {
+  int samples;
+  int pruned;
+  double meanUs;
+  double minUs;
+  double stdDevUs;
+  double gflops;
+  double gbps;
+};
+
+/* Statistics of the samples timer holds for id, after pruning samples
+ more than three standard deviations from the mean. samples is how many
+ were added; the timer must be normalized. */
+benchStats benchSummarize(StatisticalTimer &timer,
+                          StatisticalTimer::sTimerID id, int samples,
+                          double flops, double bytes);
+
+/* Totals over a log: each entry weighted by its count, as if the log had
+ been replayed call by call. The standard deviation is left at 0. */
+benchStats benchAggregate(const std::vector<benchCall> &calls,
+                          const std::vector<benchStats> &stats);
+
+#endif  // TEST_SRC_BENCH_HCBLAS_BENCH_H_
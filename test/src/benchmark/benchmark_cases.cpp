@@ -0,0 +1,784 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "benchmark_cases.h"
+#include <sstream>
+#include "include/hcblas_bfloat16.h"
+
+typedef hc::short_vector::float_2 cfloat;
+typedef hc::short_vector::double_2 cdouble;
+
+// Scalars of every case: alpha = 1 and beta = 0.5 keep repeated calls on
+// the same operands bounded.
+template <typename T>
+static T scalar(double value) {
+  return static_cast<T>(value);
+}
+template <>
+cfloat scalar<cfloat>(double value) {
+  return cfloat(value, 0);
+}
+template <>
+cdouble scalar<cdouble>(double value) {
+  return cdouble(value, 0);
+}
+
+template <typename T>
+static T *operand(benchmarkContext &c, int i) {
+  return static_cast<T *>(c.operand[i]);
+}
+
+template <typename T>
+static T **pointers(benchmarkContext &c, int i) {
+  return static_cast<T **>(c.pointers[i]);
+}
+
+/* Level 1: operand 0 is x and 1 is y. Batched forms walk batch vectors of
+ n laid end to end. */
+static hcblasStatus run_saxpy(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  float *x = operand<float>(c, 0), *y = operand<float>(c, 1);
+  if (bc.batch == 1) {
+    return c.library->hcblas_saxpy(c.view, bc.n, scalar<float>(1), x, 1, y,
+                                   1, 0, 0);
+  }
+  return c.library->hcblas_saxpy(c.view, bc.n, scalar<float>(1), x, 1, bc.n,
+                                 y, 1, bc.n, 0, 0, bc.batch);
+}
+
+static hcblasStatus run_daxpy(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  double *x = operand<double>(c, 0), *y = operand<double>(c, 1);
+  if (bc.batch == 1) {
+    return c.library->hcblas_daxpy(c.view, bc.n, scalar<double>(1), x, 1, y,
+                                   1, 0, 0);
+  }
+  return c.library->hcblas_daxpy(c.view, bc.n, scalar<double>(1), x, 1,
+                                 bc.n, y, 1, bc.n, 0, 0, bc.batch);
+}
+
+static hcblasStatus run_sscal(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  float *x = operand<float>(c, 0);
+  if (bc.batch == 1) {
+    return c.library->hcblas_sscal(c.view, bc.n, scalar<float>(1), x, 1, 0);
+  }
+  return c.library->hcblas_sscal(c.view, bc.n, scalar<float>(1), x, 1, 0,
+                                 bc.n, bc.batch);
+}
+
+static hcblasStatus run_dscal(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  double *x = operand<double>(c, 0);
+  if (bc.batch == 1) {
+    return c.library->hcblas_dscal(c.view, bc.n, scalar<double>(1), x, 1,
+                                   0);
+  }
+  return c.library->hcblas_dscal(c.view, bc.n, scalar<double>(1), x, 1, 0,
+                                 bc.n, bc.batch);
+}
+
+static hcblasStatus run_cscal(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  cfloat *x = operand<cfloat>(c, 0);
+  if (bc.batch == 1) {
+    return c.library->hcblas_cscal(c.view, bc.n, scalar<cfloat>(1), x, 1,
+                                   0);
+  }
+  return c.library->hcblas_cscal(c.view, bc.n, scalar<cfloat>(1), x, 1, 0,
+                                 bc.n, bc.batch);
+}
+
+static hcblasStatus run_zscal(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  cdouble *x = operand<cdouble>(c, 0);
+  if (bc.batch == 1) {
+    return c.library->hcblas_zscal(c.view, bc.n, scalar<cdouble>(1), x, 1,
+                                   0);
+  }
+  return c.library->hcblas_zscal(c.view, bc.n, scalar<cdouble>(1), x, 1, 0,
+                                 bc.n, bc.batch);
+}
+
+static hcblasStatus run_csscal(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  cfloat *x = operand<cfloat>(c, 0);
+  if (bc.batch == 1) {
+    return c.library->hcblas_csscal(c.view, bc.n, scalar<float>(1), x, 1,
+                                    0);
+  }
+  return c.library->hcblas_csscal(c.view, bc.n, scalar<float>(1), x, 1, 0,
+                                  bc.n, bc.batch);
+}
+
+static hcblasStatus run_zdscal(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  cdouble *x = operand<cdouble>(c, 0);
+  if (bc.batch == 1) {
+    return c.library->hcblas_zdscal(c.view, bc.n, scalar<double>(1), x, 1,
+                                    0);
+  }
+  return c.library->hcblas_zdscal(c.view, bc.n, scalar<double>(1), x, 1, 0,
+                                  bc.n, bc.batch);
+}
+
+static hcblasStatus run_scopy(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  float *x = operand<float>(c, 0), *y = operand<float>(c, 1);
+  if (bc.batch == 1) {
+    return c.library->hcblas_scopy(c.view, bc.n, x, 1, 0, y, 1, 0);
+  }
+  return c.library->hcblas_scopy(c.view, bc.n, x, 1, 0, y, 1, 0, bc.n, bc.n,
+                                 bc.batch);
+}
+
+static hcblasStatus run_dcopy(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  double *x = operand<double>(c, 0), *y = operand<double>(c, 1);
+  if (bc.batch == 1) {
+    return c.library->hcblas_dcopy(c.view, bc.n, x, 1, 0, y, 1, 0);
+  }
+  return c.library->hcblas_dcopy(c.view, bc.n, x, 1, 0, y, 1, 0, bc.n, bc.n,
+                                 bc.batch);
+}
+
+static hcblasStatus run_sdot(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  float *x = operand<float>(c, 0), *y = operand<float>(c, 1);
+  float dot;
+  if (bc.batch == 1) {
+    return c.library->hcblas_sdot(c.view, bc.n, x, 1, 0, y, 1, 0, dot);
+  }
+  return c.library->hcblas_sdot(c.view, bc.n, x, 1, 0, y, 1, 0, dot, bc.n,
+                                bc.n, bc.batch);
+}
+
+static hcblasStatus run_ddot(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  double *x = operand<double>(c, 0), *y = operand<double>(c, 1);
+  double dot;
+  if (bc.batch == 1) {
+    return c.library->hcblas_ddot(c.view, bc.n, x, 1, 0, y, 1, 0, dot);
+  }
+  return c.library->hcblas_ddot(c.view, bc.n, x, 1, 0, y, 1, 0, dot, bc.n,
+                                bc.n, bc.batch);
+}
+
+static hcblasStatus run_sasum(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  float *x = operand<float>(c, 0);
+  float asum;
+  if (bc.batch == 1) {
+    return c.library->hcblas_sasum(c.view, bc.n, x, 1, 0, &asum);
+  }
+  return c.library->hcblas_sasum(c.view, bc.n, x, 1, 0, &asum, bc.n,
+                                 bc.batch);
+}
+
+static hcblasStatus run_dasum(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  double *x = operand<double>(c, 0);
+  double asum;
+  if (bc.batch == 1) {
+    return c.library->hcblas_dasum(c.view, bc.n, x, 1, 0, &asum);
+  }
+  return c.library->hcblas_dasum(c.view, bc.n, x, 1, 0, &asum, bc.n,
+                                 bc.batch);
+}
+
+/* Level 2: operand 0 is A, 1 is x and 2 is y; A is n x n with lda n
+ unless banded. */
+static hcblasStatus run_sger(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  float *A = operand<float>(c, 0);
+  float *x = operand<float>(c, 1), *y = operand<float>(c, 2);
+  if (bc.batch == 1) {
+    return c.library->hcblas_sger(c.view, c.order, n, n, scalar<float>(1), x,
+                                  0, 1, y, 0, 1, A, 0, n);
+  }
+  return c.library->hcblas_sger(c.view, c.order, n, n, scalar<float>(1), x,
+                                0, n, 1, y, 0, n, 1, A, 0, bc.count[0], n,
+                                bc.batch);
+}
+
+static hcblasStatus run_dger(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  double *A = operand<double>(c, 0);
+  double *x = operand<double>(c, 1), *y = operand<double>(c, 2);
+  if (bc.batch == 1) {
+    return c.library->hcblas_dger(c.view, c.order, n, n, scalar<double>(1),
+                                  x, 0, 1, y, 0, 1, A, 0, n);
+  }
+  return c.library->hcblas_dger(c.view, c.order, n, n, scalar<double>(1), x,
+                                0, n, 1, y, 0, n, 1, A, 0, bc.count[0], n,
+                                bc.batch);
+}
+
+static hcblasStatus run_sgemv(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  float *A = operand<float>(c, 0);
+  float *x = operand<float>(c, 1), *y = operand<float>(c, 2);
+  if (bc.batch == 1) {
+    return c.library->hcblas_sgemv(c.view, c.order, NoTrans, n, n,
+                                   scalar<float>(1), A, 0, n, x, 0, 1,
+                                   scalar<float>(0.5), y, 0, 1);
+  }
+  return c.library->hcblas_sgemv(c.view, c.order, NoTrans, n, n,
+                                 scalar<float>(1), A, 0, bc.count[0], n, x, 0,
+                                 n, 1, scalar<float>(0.5), y, 0, n, 1,
+                                 bc.batch);
+}
+
+static hcblasStatus run_dgemv(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  double *A = operand<double>(c, 0);
+  double *x = operand<double>(c, 1), *y = operand<double>(c, 2);
+  if (bc.batch == 1) {
+    return c.library->hcblas_dgemv(c.view, c.order, NoTrans, n, n,
+                                   scalar<double>(1), A, 0, n, x, 0, 1,
+                                   scalar<double>(0.5), y, 0, 1);
+  }
+  return c.library->hcblas_dgemv(c.view, c.order, NoTrans, n, n,
+                                 scalar<double>(1), A, 0, bc.count[0], n, x,
+                                 0, n, 1, scalar<double>(0.5), y, 0, n, 1,
+                                 bc.batch);
+}
+
+static hcblasStatus run_ssymv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_ssymv(
+      c.view, c.order, Lower, n, scalar<float>(1), operand<float>(c, 0), 0,
+      n, operand<float>(c, 1), 0, 1, scalar<float>(0.5),
+      operand<float>(c, 2), 0, 1);
+}
+
+static hcblasStatus run_dsymv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_dsymv(
+      c.view, c.order, Lower, n, scalar<double>(1), operand<double>(c, 0), 0,
+      n, operand<double>(c, 1), 0, 1, scalar<double>(0.5),
+      operand<double>(c, 2), 0, 1);
+}
+
+static hcblasStatus run_chemv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_chemv(
+      c.view, c.order, Lower, n, scalar<cfloat>(1), operand<cfloat>(c, 0), 0,
+      n, operand<cfloat>(c, 1), 0, 1, scalar<cfloat>(0.5),
+      operand<cfloat>(c, 2), 0, 1);
+}
+
+// The unit diagonal keeps trsv bounded on operands of magnitude 1 / n
+static hcblasStatus run_strmv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_strmv(c.view, c.order, Lower, NoTrans, Unit, n,
+                                 operand<float>(c, 0), 0, n,
+                                 operand<float>(c, 1), 0, 1);
+}
+
+static hcblasStatus run_dtrmv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_dtrmv(c.view, c.order, Lower, NoTrans, Unit, n,
+                                 operand<double>(c, 0), 0, n,
+                                 operand<double>(c, 1), 0, 1);
+}
+
+static hcblasStatus run_strsv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_strsv(c.view, c.order, Lower, NoTrans, Unit, n,
+                                 operand<float>(c, 0), 0, n,
+                                 operand<float>(c, 1), 0, 1);
+}
+
+static hcblasStatus run_dtrsv(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_dtrsv(c.view, c.order, Lower, NoTrans, Unit, n,
+                                 operand<double>(c, 0), 0, n,
+                                 operand<double>(c, 1), 0, 1);
+}
+
+static hcblasStatus run_ssyr(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_ssyr(c.view, c.order, Lower, n, scalar<float>(1),
+                                operand<float>(c, 1), 0, 1,
+                                operand<float>(c, 0), 0, n);
+}
+
+static hcblasStatus run_dsyr(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_dsyr(c.view, c.order, Lower, n,
+                                scalar<double>(1), operand<double>(c, 1), 0,
+                                1, operand<double>(c, 0), 0, n);
+}
+
+static hcblasStatus run_ssyr2(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_ssyr2(
+      c.view, c.order, Lower, n, scalar<float>(1), operand<float>(c, 1), 0, 1,
+      operand<float>(c, 2), 0, 1, operand<float>(c, 0), 0, n);
+}
+
+static hcblasStatus run_dsyr2(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_dsyr2(c.view, c.order, Lower, n,
+                                 scalar<double>(1), operand<double>(c, 1), 0,
+                                 1, operand<double>(c, 2), 0, 1,
+                                 operand<double>(c, 0), 0, n);
+}
+
+static hcblasStatus run_sgbmv(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  return c.library->hcblas_sgbmv(
+      c.view, c.order, NoTrans, bc.n, bc.n, bc.band, bc.band,
+      scalar<float>(1), operand<float>(c, 0), 0, 2 * bc.band + 1,
+      operand<float>(c, 1), 0, 1, scalar<float>(0.5), operand<float>(c, 2),
+      0, 1);
+}
+
+static hcblasStatus run_dgbmv(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  return c.library->hcblas_dgbmv(
+      c.view, c.order, NoTrans, bc.n, bc.n, bc.band, bc.band,
+      scalar<double>(1), operand<double>(c, 0), 0, 2 * bc.band + 1,
+      operand<double>(c, 1), 0, 1, scalar<double>(0.5),
+      operand<double>(c, 2), 0, 1);
+}
+
+static hcblasStatus run_ssbmv(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  return c.library->hcblas_ssbmv(
+      c.view, c.order, Lower, bc.n, bc.band, scalar<float>(1),
+      operand<float>(c, 0), 0, bc.band + 1, operand<float>(c, 1), 0, 1,
+      scalar<float>(0.5), operand<float>(c, 2), 0, 1);
+}
+
+static hcblasStatus run_dsbmv(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  return c.library->hcblas_dsbmv(
+      c.view, c.order, Lower, bc.n, bc.band, scalar<double>(1),
+      operand<double>(c, 0), 0, bc.band + 1, operand<double>(c, 1), 0, 1,
+      scalar<double>(0.5), operand<double>(c, 2), 0, 1);
+}
+
+/* Level 3: operands 0, 1 and 2 are A, B and C, all n x n with leading
+ dimension n, untransposed. */
+static hcblasStatus run_sgemm(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  if (bc.batch == 1) {
+    return c.library->hcblas_sgemm(
+        c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<float>(1),
+        operand<float>(c, 0), n, operand<float>(c, 1), n, scalar<float>(0.5),
+        operand<float>(c, 2), n, 0, 0, 0);
+  }
+  return c.library->hcblas_sgemm(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<float>(1),
+      pointers<float>(c, 0), n, 0, pointers<float>(c, 1), n, 0,
+      scalar<float>(0.5), pointers<float>(c, 2), n, 0, 0, 0, 0, bc.batch);
+}
+
+static hcblasStatus run_dgemm(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  if (bc.batch == 1) {
+    return c.library->hcblas_dgemm(
+        c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<double>(1),
+        operand<double>(c, 0), n, operand<double>(c, 1), n,
+        scalar<double>(0.5), operand<double>(c, 2), n, 0, 0, 0);
+  }
+  return c.library->hcblas_dgemm(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<double>(1),
+      pointers<double>(c, 0), n, 0, pointers<double>(c, 1), n, 0,
+      scalar<double>(0.5), pointers<double>(c, 2), n, 0, 0, 0, 0, bc.batch);
+}
+
+static hcblasStatus run_hgemm(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_hgemm(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<hc::half>(1),
+      operand<hc::half>(c, 0), n, operand<hc::half>(c, 1), n,
+      scalar<hc::half>(0.5), operand<hc::half>(c, 2), n, 0, 0, 0);
+}
+
+static hcblasStatus run_cgemm(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  if (bc.batch == 1) {
+    return c.library->hcblas_cgemm(
+        c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<cfloat>(1),
+        operand<cfloat>(c, 0), 0, n, operand<cfloat>(c, 1), 0, n,
+        scalar<cfloat>(0.5), operand<cfloat>(c, 2), 0, n);
+  }
+  return c.library->hcblas_cgemm(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<cfloat>(1),
+      pointers<cfloat>(c, 0), 0, 0, n, pointers<cfloat>(c, 1), 0, 0, n,
+      scalar<cfloat>(0.5), pointers<cfloat>(c, 2), 0, 0, n, bc.batch);
+}
+
+static hcblasStatus run_zgemm(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  if (bc.batch == 1) {
+    return c.library->hcblas_zgemm(
+        c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<cdouble>(1),
+        operand<cdouble>(c, 0), 0, n, operand<cdouble>(c, 1), 0, n,
+        scalar<cdouble>(0.5), operand<cdouble>(c, 2), 0, n);
+  }
+  return c.library->hcblas_zgemm(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, scalar<cdouble>(1),
+      pointers<cdouble>(c, 0), 0, 0, n, pointers<cdouble>(c, 1), 0, 0, n,
+      scalar<cdouble>(0.5), pointers<cdouble>(c, 2), 0, 0, n, bc.batch);
+}
+
+// batch problems of order n; every dimension array holds n
+static hcblasStatus run_sgemm_grouped(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  std::vector<int> dims(bc.batch, bc.n);
+  return c.library->hcblas_sgemm_grouped(
+      c.view, c.order, NoTrans, NoTrans, &dims[0], &dims[0], &dims[0],
+      scalar<float>(1),
+      reinterpret_cast<const float *const *>(&c.group[0][0]), &dims[0],
+      reinterpret_cast<const float *const *>(&c.group[1][0]), &dims[0],
+      scalar<float>(0.5), reinterpret_cast<float *const *>(&c.group[2][0]),
+      &dims[0], bc.batch);
+}
+
+/* GEMMEX accumulates in FP32 in every case here. Operand 3, when
+ present, is the bias of a fused bias + ReLU epilogue. */
+static hcblasStatus run_gemmex(benchmarkContext &c) {
+  const benchmarkCase &bc = *c.bcase;
+  int n = bc.n;
+  float alpha = 1, beta = 0.5;
+  hcblasEpilogue epilogue = {static_cast<const float *>(c.operand[3]),
+                             PerRow, NULL, PerRow, ActivationRelu, 0, 0,
+                             NULL, 0, 0};
+  return c.library->hcblas_gemmex(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, &alpha, c.operand[0],
+      bc.type[0], 0, n, c.operand[1], bc.type[1], 0, n, &beta, c.operand[2],
+      bc.type[2], 0, n, FloatType, bc.count[3] ? &epilogue : NULL);
+}
+
+static hcblasStatus run_igemm(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_igemm(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, 1,
+      operand<signed char>(c, 0), n, operand<signed char>(c, 1), n, 0,
+      operand<int>(c, 2), n, 0, 0, 0);
+}
+
+// Operand 3 holds the per row scales
+static hcblasStatus run_igemm_requant(benchmarkContext &c) {
+  int n = c.bcase->n;
+  return c.library->hcblas_igemm_requant(
+      c.view, c.order, NoTrans, NoTrans, n, n, n, operand<signed char>(c, 0),
+      n, operand<signed char>(c, 1), n, operand<signed char>(c, 2), n,
+      PerRow, operand<float>(c, 3), NULL, 0, 0, 0);
+}
+
+size_t benchmarkTypeSize(hcblasDatatype type) {
+  switch (type) {
+    case HalfType:
+    case Bfloat16Type:
+      return 2;
+    case FloatType:
+    case Int32Type:
+      return 4;
+    case DoubleType:
+    case ComplexType:
+      return 8;
+    case DoubleComplexType:
+      return 16;
+    case Int8Type:
+      return 1;
+  }
+  return 0;
+}
+
+static hcblasDatatype type_of(char precision) {
+  switch (precision) {
+    case 'D':
+      return DoubleType;
+    case 'C':
+      return ComplexType;
+    case 'Z':
+      return DoubleComplexType;
+    case 'H':
+      return HalfType;
+    case 'B':
+      return Bfloat16Type;
+    case 'I':
+      return Int8Type;
+  }
+  return FloatType;
+}
+
+/* A case whose operands all have the type of precision. passes[i] is how
+ often the routine moves operand i: 1 if it is only read or only written,
+ 2 if it is read and written back. */
+static benchmarkCase make_case(const char *routine, char precision,
+                               bool hasOrder, int n, int batch,
+                               benchmarkLaunch launch, const size_t count[],
+                               const int passes[], double flops) {
+  benchmarkCase bc;
+  bc.routine = routine;
+  bc.precision = precision;
+  bc.hasOrder = hasOrder;
+  bc.n = n;
+  bc.band = 0;
+  bc.batch = batch;
+  bc.pointerArrays = false;
+  bc.bytes = 0;
+  for (int i = 0; i < BENCHMARK_OPERANDS; i++) {
+    bc.type[i] = type_of(precision);
+    bc.count[i] = count[i];
+    bc.bytes += static_cast<double>(passes[i]) * count[i] * batch *
+                benchmarkTypeSize(bc.type[i]);
+  }
+  // Complex multiply adds cost four real ones
+  bool complex = precision == 'C' || precision == 'Z';
+  bc.flops = flops * batch * (complex ? 4 : 1);
+  std::ostringstream args;
+  args << "n=" << n;
+  if (batch > 1) {
+    args << ",batch=" << batch;
+  }
+  bc.args = args.str();
+  bc.launch = launch;
+  return bc;
+}
+
+static void add_level1(std::vector<benchmarkCase> *cases, int n, int batch) {
+  double m = n;
+  size_t len = n;
+  size_t xy[BENCHMARK_OPERANDS] = {len, len, 0, 0};
+  size_t x[BENCHMARK_OPERANDS] = {len, 0, 0, 0};
+  int axpy[BENCHMARK_OPERANDS] = {1, 2, 0, 0};
+  int reads[BENCHMARK_OPERANDS] = {1, 1, 0, 0};
+  int scal[BENCHMARK_OPERANDS] = {2, 0, 0, 0};
+  struct {
+    const char *routine;
+    char precision;
+    benchmarkLaunch launch;
+    const size_t *count;
+    const int *passes;
+    double flops;
+  } table[] = {
+      {"saxpy", 'S', run_saxpy, xy, axpy, 2 * m},
+      {"daxpy", 'D', run_daxpy, xy, axpy, 2 * m},
+      {"sscal", 'S', run_sscal, x, scal, m},
+      {"dscal", 'D', run_dscal, x, scal, m},
+      {"cscal", 'C', run_cscal, x, scal, m},
+      {"zscal", 'Z', run_zscal, x, scal, m},
+      // A real scale of a complex vector is two real multiplies per value
+      {"csscal", 'C', run_csscal, x, scal, 0.5 * m},
+      {"zdscal", 'Z', run_zdscal, x, scal, 0.5 * m},
+      {"scopy", 'S', run_scopy, xy, reads, 0},
+      {"dcopy", 'D', run_dcopy, xy, reads, 0},
+      {"sdot", 'S', run_sdot, xy, reads, 2 * m},
+      {"ddot", 'D', run_ddot, xy, reads, 2 * m},
+      {"sasum", 'S', run_sasum, x, reads, m},
+      {"dasum", 'D', run_dasum, x, reads, m},
+  };
+  for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+    std::string routine = table[i].routine;
+    cases->push_back(make_case(
+        (batch > 1 ? routine + "_batched" : routine).c_str(),
+        table[i].precision, false, n, batch, table[i].launch, table[i].count,
+        table[i].passes, table[i].flops));
+  }
+}
+
+static void add_level2(std::vector<benchmarkCase> *cases, int n, int batch) {
+  double m = n;
+  size_t len = n;
+  size_t nn = len * n;
+  size_t Axy[BENCHMARK_OPERANDS] = {nn, len, len, 0};
+  size_t Ax[BENCHMARK_OPERANDS] = {nn, len, 0, 0};
+  int ger[BENCHMARK_OPERANDS] = {2, 1, 1, 0};
+  int gemv[BENCHMARK_OPERANDS] = {1, 1, 2, 0};
+  int trmv[BENCHMARK_OPERANDS] = {1, 2, 0, 0};
+  int syr[BENCHMARK_OPERANDS] = {2, 1, 0, 0};
+  struct {
+    const char *routine;
+    char precision;
+    benchmarkLaunch launch;
+    const size_t *count;
+    const int *passes;
+    double flops;
+    bool batched;
+    bool triangle;  // touches one triangle of A
+  } table[] = {
+      {"sger", 'S', run_sger, Axy, ger, 2 * m * m, true, false},
+      {"dger", 'D', run_dger, Axy, ger, 2 * m * m, true, false},
+      {"sgemv", 'S', run_sgemv, Axy, gemv, 2 * m * m, true, false},
+      {"dgemv", 'D', run_dgemv, Axy, gemv, 2 * m * m, true, false},
+      {"ssymv", 'S', run_ssymv, Axy, gemv, 2 * m * m, false, true},
+      {"dsymv", 'D', run_dsymv, Axy, gemv, 2 * m * m, false, true},
+      {"chemv", 'C', run_chemv, Axy, gemv, 2 * m * m, false, true},
+      {"strmv", 'S', run_strmv, Ax, trmv, m * m, false, true},
+      {"dtrmv", 'D', run_dtrmv, Ax, trmv, m * m, false, true},
+      {"strsv", 'S', run_strsv, Ax, trmv, m * m, false, true},
+      {"dtrsv", 'D', run_dtrsv, Ax, trmv, m * m, false, true},
+      {"ssyr", 'S', run_ssyr, Ax, syr, m * m, false, true},
+      {"dsyr", 'D', run_dsyr, Ax, syr, m * m, false, true},
+      {"ssyr2", 'S', run_ssyr2, Axy, ger, 2 * m * m, false, true},
+      {"dsyr2", 'D', run_dsyr2, Axy, ger, 2 * m * m, false, true},
+  };
+  for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+    if (batch > 1 && !table[i].batched) {
+      continue;
+    }
+    std::string routine = table[i].routine;
+    benchmarkCase bc = make_case(
+        (batch > 1 ? routine + "_batched" : routine).c_str(),
+        table[i].precision, true, n, batch, table[i].launch, table[i].count,
+        table[i].passes, table[i].flops);
+    if (table[i].triangle) {
+      bc.bytes -= 0.5 * table[i].passes[0] * nn *
+                  benchmarkTypeSize(bc.type[0]);
+    }
+    cases->push_back(bc);
+  }
+  if (batch > 1) {
+    return;
+  }
+
+  // Band routines on 2 * band + 1 (gbmv) and band + 1 (sbmv) diagonals
+  int band = n < 64 ? n / 2 : 32;
+  const char *banded[4] = {"sgbmv", "dgbmv", "ssbmv", "dsbmv"};
+  benchmarkLaunch launches[4] = {run_sgbmv, run_dgbmv, run_ssbmv, run_dsbmv};
+  for (int i = 0; i < 4; i++) {
+    int diagonals = i < 2 ? 2 * band + 1 : band + 1;
+    size_t count[BENCHMARK_OPERANDS] = {diagonals * len, len, len, 0};
+    double flops = 2 * m * (i < 2 ? diagonals : 2 * band + 1);
+    benchmarkCase bc = make_case(banded[i], i % 2 ? 'D' : 'S', true, n, 1,
+                                 launches[i], count, gemv, flops);
+    bc.band = band;
+    std::ostringstream args;
+    args << bc.args << (i < 2 ? ",kl=" : ",k=") << band;
+    if (i < 2) {
+      args << ",ku=" << band;
+    }
+    bc.args = args.str();
+    cases->push_back(bc);
+  }
+}
+
+static void add_level3(std::vector<benchmarkCase> *cases, int n, int batch) {
+  double m = n;
+  size_t len = n;
+  size_t nn = len * n;
+  size_t ABC[BENCHMARK_OPERANDS] = {nn, nn, nn, 0};
+  int gemm[BENCHMARK_OPERANDS] = {1, 1, 2, 0};
+  double flops = 2 * m * m * m;
+  const char *routines[5] = {"sgemm", "dgemm", "cgemm", "zgemm", "hgemm"};
+  const char precisions[5] = {'S', 'D', 'C', 'Z', 'H'};
+  benchmarkLaunch launches[5] = {run_sgemm, run_dgemm, run_cgemm, run_zgemm,
+                                 run_hgemm};
+  // hgemm has no batched form
+  for (int i = 0; i < (batch > 1 ? 4 : 5); i++) {
+    std::string routine = routines[i];
+    benchmarkCase bc = make_case(
+        (batch > 1 ? routine + "_batched" : routine).c_str(), precisions[i],
+        true, n, batch, launches[i], ABC, gemm, flops);
+    bc.pointerArrays = batch > 1;
+    cases->push_back(bc);
+  }
+  if (batch > 1) {
+    benchmarkCase bc = make_case("sgemm_grouped", 'S', true, n, batch,
+                                 run_sgemm_grouped, ABC, gemm, flops);
+    bc.pointerArrays = true;
+    cases->push_back(bc);
+    return;
+  }
+
+  /* GEMMEX in its mixed precision forms: half or bfloat16 in, half,
+  bfloat16 or float out, and float with the fused epilogue */
+  struct {
+    char precision;
+    hcblasDatatype in, out;
+    bool epilogue;
+  } gemmex[] = {{'H', HalfType, FloatType, false},
+                {'H', HalfType, HalfType, false},
+                {'B', Bfloat16Type, FloatType, false},
+                {'B', Bfloat16Type, Bfloat16Type, false},
+                {'S', FloatType, FloatType, true}};
+  const char *names[] = {"half", "float", "double", "complex",
+                         "double_complex", "int8", "int32", "bfloat16"};
+  for (size_t i = 0; i < sizeof(gemmex) / sizeof(gemmex[0]); i++) {
+    size_t count[BENCHMARK_OPERANDS] = {nn, nn, nn,
+                                        gemmex[i].epilogue ? len : 0};
+    int passes[BENCHMARK_OPERANDS] = {1, 1, 2, 1};
+    benchmarkCase bc = make_case("gemmex", gemmex[i].precision, true, n, 1,
+                                 run_gemmex, count, passes, flops);
+    bc.type[0] = bc.type[1] = gemmex[i].in;
+    bc.type[2] = gemmex[i].out;
+    bc.type[3] = FloatType;
+    bc.bytes = 0;
+    for (int j = 0; j < BENCHMARK_OPERANDS; j++) {
+      bc.bytes += static_cast<double>(passes[j]) * count[j] *
+                  benchmarkTypeSize(bc.type[j]);
+    }
+    bc.args += std::string(",a=") + names[gemmex[i].in] + ",c=" +
+               names[gemmex[i].out] + ",compute=float";
+    if (gemmex[i].epilogue) {
+      bc.args += ",epilogue=bias_relu";
+    }
+    cases->push_back(bc);
+  }
+
+  // IGEMM reads int8 and writes int32, or int8 after requantisation with
+  // per row scales
+  for (int requant = 0; requant < 2; requant++) {
+    // beta is 0 so C is only written
+    size_t count[BENCHMARK_OPERANDS] = {nn, nn, nn, requant ? len : 0};
+    int passes[BENCHMARK_OPERANDS] = {1, 1, 1, 1};
+    benchmarkCase bc = make_case(requant ? "igemm_requant" : "igemm", 'I',
+                                 true, n, 1,
+                                 requant ? run_igemm_requant : run_igemm,
+                                 count, passes, flops);
+    bc.type[2] = requant ? Int8Type : Int32Type;
+    bc.type[3] = FloatType;
+    bc.bytes = 0;
+    for (int j = 0; j < BENCHMARK_OPERANDS; j++) {
+      bc.bytes += static_cast<double>(passes[j]) * count[j] *
+                  benchmarkTypeSize(bc.type[j]);
+    }
+    cases->push_back(bc);
+  }
+}
+
+std::vector<benchmarkCase> benchmarkCases(int n1, int n2, int n3) {
+  std::vector<benchmarkCase> cases;
+  add_level1(&cases, n1, 1);
+  add_level1(&cases, n1 / 8, 64);
+  add_level2(&cases, n2, 1);
+  add_level2(&cases, n2 / 8, 64);
+  add_level3(&cases, n3, 1);
+  add_level3(&cases, n3 / 16, 64);
+  return cases;
+}
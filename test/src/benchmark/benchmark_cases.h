@@ -0,0 +1,83 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* The cases hcblas-benchmark times. A case names one Hcblaslibrary routine
+* in one precision, the operands it needs and what one call costs; the
+* layout is chosen when it runs. Problems are square so the same leading
+* dimensions serve both layouts.
+*/
+
+#ifndef TEST_SRC_BENCHMARK_BENCHMARK_CASES_H_
+#define TEST_SRC_BENCHMARK_BENCHMARK_CASES_H_
+
+#include <string>
+#include <vector>
+#include "hcblas_benchmark.h"
+#include "include/hcblaslib.h"
+
+#define BENCHMARK_OPERANDS 4
+
+struct benchmarkCase;
+
+/* Device operands of a case and the view to launch on. operand[i] holds
+ batch consecutive elements of count[i] values each; pointers[i] is a
+ device array of the start of each, for routines batched through arrays
+ of pointers, and group[i] the same array on the host. */
+struct benchmarkContext {
+  Hcblaslibrary *library;
+  hc::accelerator_view view;
+  hcblasOrder order;
+  const benchmarkCase *bcase;
+  void *operand[BENCHMARK_OPERANDS];
+  void *pointers[BENCHMARK_OPERANDS];
+  std::vector<void *> group[BENCHMARK_OPERANDS];
+};
+
+typedef hcblasStatus (*benchmarkLaunch)(benchmarkContext &context);
+
+struct benchmarkCase {
+  std::string routine;  // without the hcblas_ prefix
+  char precision;       // S, D, C, Z, H, B (bfloat16) or I (int8)
+  bool hasOrder;        // runs in both layouts
+  int n;                // vector length or matrix order
+  int band;             // kl = ku of gbmv, k of sbmv
+  int batch;            // 1 unless batched
+  bool pointerArrays;
+  hcblasDatatype type[BENCHMARK_OPERANDS];
+  size_t count[BENCHMARK_OPERANDS];  // per batch element, 0 if unused
+  double flops;         // per call
+  double bytes;         // per call
+  std::string args;
+  benchmarkLaunch launch;
+};
+
+// Bytes of one value of type
+size_t benchmarkTypeSize(hcblasDatatype type);
+
+/* Every case: level 1 routines on vectors of n1, level 2 on matrices of
+ order n2 and level 3 of order n3. Batched forms run 64 problems an
+ eighth (level 1 and 2) or a sixteenth (level 3) of the size. */
+std::vector<benchmarkCase> benchmarkCases(int n1, int n2, int n3);
+
+#endif  // TEST_SRC_BENCHMARK_BENCHMARK_CASES_H_
@@ -0,0 +1,207 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "hcblas_benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+static double median_of(std::vector<double> values) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t half = values.size() / 2;
+  return values.size() % 2 ? values[half]
+                           : 0.5 * (values[half - 1] + values[half]);
+}
+
+benchmarkSummary benchmarkSummarize(const std::vector<double> &samplesUs,
+                                    double outlierMads) {
+  benchmarkSummary summary = {0, 0, 0, 0, 0, 0};
+  if (samplesUs.empty()) {
+    return summary;
+  }
+  double median = median_of(samplesUs);
+  std::vector<double> deviations(samplesUs.size());
+  for (size_t i = 0; i < samplesUs.size(); i++) {
+    deviations[i] = std::fabs(samplesUs[i] - median);
+  }
+  // A MAD of 0 (more than half the samples equal) leaves nothing to scale
+  // the cut by; keep every sample then.
+  double limit = outlierMads * 1.4826 * median_of(deviations);
+  std::vector<double> kept;
+  for (size_t i = 0; i < samplesUs.size(); i++) {
+    if (limit <= 0 || deviations[i] <= limit) {
+      kept.push_back(samplesUs[i]);
+    }
+  }
+  std::sort(kept.begin(), kept.end());
+  summary.samples = kept.size();
+  summary.pruned = samplesUs.size() - kept.size();
+  summary.medianUs = median_of(kept);
+  size_t rank = static_cast<size_t>(std::ceil(0.95 * kept.size()));
+  summary.p95Us = kept[rank > 0 ? rank - 1 : 0];
+  double sum = 0;
+  for (size_t i = 0; i < kept.size(); i++) {
+    sum += kept[i];
+  }
+  summary.meanUs = sum / kept.size();
+  summary.minUs = kept[0];
+  return summary;
+}
+
+benchmarkRoofline benchmarkRooflineFor(const hcblasDeviceProps &props,
+                                       double fp64Ratio, int busBits) {
+  benchmarkRoofline roofline;
+  // Lanes retiring an FMA per clock: a SIMD is 16 lanes wide
+  double lanes = static_cast<double>(props.computeUnits) * props.simdsPerCU *
+                 16;
+  roofline.fp32Gflops = 2 * lanes * props.coreClockMHz * 1e-3;
+  roofline.fp64Gflops = roofline.fp32Gflops * fp64Ratio;
+  roofline.fp16Gflops = 2 * roofline.fp32Gflops;
+  roofline.int8Gops = roofline.fp32Gflops;
+  roofline.gbps = 2.0 * props.memoryClockMHz * (busBits / 8) * 1e-3;
+  return roofline;
+}
+
+double benchmarkPeakGflops(const benchmarkRoofline &roofline,
+                           char precision) {
+  switch (precision) {
+    case 'S':
+    case 'C':
+    case 'B':
+      return roofline.fp32Gflops;
+    case 'D':
+    case 'Z':
+      return roofline.fp64Gflops;
+    case 'H':
+      return roofline.fp16Gflops;
+    case 'I':
+      return roofline.int8Gops;
+  }
+  return 0;
+}
+
+benchmarkRating benchmarkRate(const benchmarkResult &result,
+                              const benchmarkRoofline &roofline) {
+  benchmarkRating rating = {0, 0, -1, -1, false};
+  double us = result.summary.medianUs;
+  if (!result.succeeded || us <= 0) {
+    return rating;
+  }
+  rating.gflops = result.flops / us * 1e-3;
+  rating.gbps = result.bytes / us * 1e-3;
+  double peak = benchmarkPeakGflops(roofline, result.precision);
+  if (roofline.gbps > 0) {
+    rating.bandwidthFraction = rating.gbps / roofline.gbps;
+  }
+  if (peak <= 0 || result.flops <= 0) {
+    return rating;
+  }
+  double attainable = peak;
+  if (roofline.gbps > 0 && result.bytes > 0) {
+    double memoryRoof = result.flops / result.bytes * roofline.gbps;
+    if (memoryRoof < peak) {
+      attainable = memoryRoof;
+      rating.memoryBound = true;
+    }
+  }
+  rating.fraction = rating.gflops / attainable;
+  return rating;
+}
+
+std::string benchmarkJsonString(const std::string &text) {
+  std::string quoted = "\"";
+  for (size_t i = 0; i < text.size(); i++) {
+    char c = text[i];
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escape[8];
+      snprintf(escape, sizeof(escape), "\\u%04x", c);
+      quoted += escape;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + "\"";
+}
+
+// Rates that could not be computed are written as null
+static void write_number(std::ostream &out, double value) {
+  if (value < 0 || std::isnan(value) || std::isinf(value)) {
+    out << "null";
+  } else {
+    out << value;
+  }
+}
+
+void benchmarkWriteJson(std::ostream &out, const std::string &device,
+                        const hcblasDeviceProps &props,
+                        const benchmarkRoofline &roofline,
+                        const benchmarkConfig &config,
+                        const std::vector<benchmarkResult> &results) {
+  out << "{\n  \"device\": {\"name\": " << benchmarkJsonString(device)
+      << ", \"compute_units\": " << props.computeUnits
+      << ", \"core_clock_mhz\": " << props.coreClockMHz
+      << ", \"memory_clock_mhz\": " << props.memoryClockMHz << "},\n";
+  out << "  \"roofline\": {\"fp32_gflops\": " << roofline.fp32Gflops
+      << ", \"fp64_gflops\": " << roofline.fp64Gflops
+      << ", \"fp16_gflops\": " << roofline.fp16Gflops
+      << ", \"int8_gops\": " << roofline.int8Gops
+      << ", \"gbps\": " << roofline.gbps << "},\n";
+  out << "  \"config\": {\"warmup\": " << config.warmup
+      << ", \"iterations\": " << config.iterations
+      << ", \"outlier_mads\": " << config.outlierMads << "},\n";
+  out << "  \"results\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const benchmarkResult &r = results[i];
+    benchmarkRating rating = benchmarkRate(r, roofline);
+    out << (i ? ",\n" : "\n") << "    {\"routine\": "
+        << benchmarkJsonString(r.routine) << ", \"precision\": \""
+        << r.precision << "\", \"layout\": " << benchmarkJsonString(r.layout)
+        << ", \"args\": " << benchmarkJsonString(r.args)
+        << ", \"status\": \"" << (r.succeeded ? "ok" : "failed") << "\"";
+    if (r.succeeded) {
+      out << ", \"samples\": " << r.summary.samples
+          << ", \"pruned\": " << r.summary.pruned
+          << ", \"median_us\": " << r.summary.medianUs
+          << ", \"p95_us\": " << r.summary.p95Us
+          << ", \"mean_us\": " << r.summary.meanUs
+          << ", \"min_us\": " << r.summary.minUs
+          << ", \"gflops\": " << rating.gflops
+          << ", \"gbps\": " << rating.gbps << ", \"roofline_fraction\": ";
+      write_number(out, rating.fraction);
+      out << ", \"bandwidth_fraction\": ";
+      write_number(out, rating.bandwidthFraction);
+      if (rating.fraction >= 0) {
+        out << ", \"bound\": \""
+            << (rating.memoryBound ? "memory" : "compute") << "\"";
+      }
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+}
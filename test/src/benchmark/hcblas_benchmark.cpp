@@ -0,0 +1,359 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "benchmark_cases.h"
+#include "hcblas_benchmark.h"
+#include "include/hcblas_bfloat16.h"
+#include "include/hcblas_cpu.h"
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+unsigned int global_seed = 100;
+
+static void usage(const char *program) {
+  cerr << "usage: " << program << " [options]" << endl
+       << "  --filter TEXT      only routines whose name contains TEXT" << endl
+       << "  --iterations N     timed runs per case (default 20)" << endl
+       << "  --warmup N         untimed runs before them (default 3)" << endl
+       << "  --outlier-mads X   rejection threshold, 0 keeps all (default 3)"
+       << endl
+       << "  --json PATH        also write the results as JSON" << endl
+       << "  --device I         accelerator index" << endl
+       << "  --backend NAME     hcc or cpu (default hcc)" << endl
+       << "  --size-l1 N        level 1 vector length (default 4194304)"
+       << endl
+       << "  --size-l2 N        level 2 matrix order (default 4096)" << endl
+       << "  --size-l3 N        level 3 matrix order (default 1024)" << endl
+       << "  --fp64-ratio X     FP64 rate over FP32 (default 0.0625)" << endl
+       << "  --bus-bits N       memory bus width (default 4096)" << endl
+       << "  --peak-gflops X    FP32 peak, overrides the device clocks" << endl
+       << "  --peak-gbps X      bandwidth peak, overrides the device clocks"
+       << endl;
+}
+
+static double random_value() {
+  return 2.0 * rand_r(&global_seed) / RAND_MAX - 1;
+}
+
+// Floating point values in [-1, 1] / scale, integers in [-128, 127]
+static void fill(unsigned char *host, hcblasDatatype type, size_t count,
+                 double scale) {
+  for (size_t i = 0; i < count; i++) {
+    double value = random_value() / scale;
+    switch (type) {
+      case HalfType:
+        reinterpret_cast<hc::half *>(host)[i] = static_cast<hc::half>(value);
+        break;
+      case Bfloat16Type:
+        reinterpret_cast<hcBfloat16 *>(host)[i] =
+            hcblasFloatToBfloat16(static_cast<float>(value));
+        break;
+      case FloatType:
+        reinterpret_cast<float *>(host)[i] = value;
+        break;
+      case ComplexType:
+        reinterpret_cast<float *>(host)[2 * i] = value;
+        reinterpret_cast<float *>(host)[2 * i + 1] = random_value() / scale;
+        break;
+      case DoubleType:
+        reinterpret_cast<double *>(host)[i] = value;
+        break;
+      case DoubleComplexType:
+        reinterpret_cast<double *>(host)[2 * i] = value;
+        reinterpret_cast<double *>(host)[2 * i + 1] = random_value() / scale;
+        break;
+      case Int8Type:
+        reinterpret_cast<signed char *>(host)[i] =
+            rand_r(&global_seed) % 256 - 128;
+        break;
+      case Int32Type:
+        reinterpret_cast<int *>(host)[i] = rand_r(&global_seed) % 256 - 128;
+        break;
+    }
+  }
+}
+
+/* Allocates and fills the operands of bc, in host memory for the CPU
+ backend. Values shrink with the problem order so repeated calls stay
+ finite. */
+static void allocate(const benchmarkCase &bc, hc::accelerator &accl,
+                     bool onHost, benchmarkContext *context) {
+  for (int i = 0; i < BENCHMARK_OPERANDS; i++) {
+    context->operand[i] = NULL;
+    context->pointers[i] = NULL;
+    context->group[i].clear();
+    if (bc.count[i] == 0) {
+      continue;
+    }
+    size_t size = benchmarkTypeSize(bc.type[i]);
+    size_t count = bc.count[i] * bc.batch;
+    std::vector<unsigned char> host(count * size);
+    fill(&host[0], bc.type[i], count, bc.n);
+    if (onHost) {
+      context->operand[i] = malloc(host.size());
+      memcpy(context->operand[i], &host[0], host.size());
+    } else {
+      context->operand[i] = hc::am_alloc(host.size(), accl, 0);
+      context->view.copy(&host[0], context->operand[i], host.size());
+    }
+    if (bc.pointerArrays) {
+      for (int b = 0; b < bc.batch; b++) {
+        context->group[i].push_back(
+            static_cast<unsigned char *>(context->operand[i]) +
+            b * bc.count[i] * size);
+      }
+      if (onHost) {
+        context->pointers[i] = malloc(sizeof(void *) * bc.batch);
+        memcpy(context->pointers[i], &context->group[i][0],
+               sizeof(void *) * bc.batch);
+      } else {
+        context->pointers[i] =
+            hc::am_alloc(sizeof(void *) * bc.batch, accl, 0);
+        context->view.copy(&context->group[i][0], context->pointers[i],
+                           sizeof(void *) * bc.batch);
+      }
+    }
+  }
+}
+
+static void release(bool onHost, benchmarkContext *context) {
+  for (int i = 0; i < BENCHMARK_OPERANDS; i++) {
+    if (onHost) {
+      free(context->operand[i]);
+      free(context->pointers[i]);
+      continue;
+    }
+    if (context->operand[i]) hc::am_free(context->operand[i]);
+    if (context->pointers[i]) hc::am_free(context->pointers[i]);
+  }
+}
+
+/* Runs the case in context config.warmup + config.iterations times. Each
+ sample spans the launch and the wait for the device to finish it. */
+static benchmarkResult run(benchmarkContext &context,
+                           const benchmarkConfig &config) {
+  const benchmarkCase &bc = *context.bcase;
+  benchmarkResult result;
+  result.routine = bc.routine;
+  result.precision = bc.precision;
+  result.layout = !bc.hasOrder ? "none"
+                               : (context.order == RowMajor ? "row" : "col");
+  result.args = bc.args;
+  result.flops = bc.flops;
+  result.bytes = bc.bytes;
+  result.succeeded = true;
+  std::vector<double> samples;
+  for (int it = 0; it < config.warmup + config.iterations; it++) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    hcblasStatus status = bc.launch(context);
+    context.view.wait();
+    std::chrono::steady_clock::time_point stop =
+        std::chrono::steady_clock::now();
+    if (status != HCBLAS_SUCCEEDS) {
+      result.succeeded = false;
+      break;
+    }
+    if (it >= config.warmup) {
+      samples.push_back(
+          std::chrono::duration<double, std::micro>(stop - start).count());
+    }
+  }
+  result.summary = benchmarkSummarize(samples, config.outlierMads);
+  return result;
+}
+
+// Percentages of the roofline, - where it is unknown
+static void print_fraction(double fraction) {
+  if (fraction < 0) {
+    cout << ",-";
+  } else {
+    cout << "," << 100 * fraction;
+  }
+}
+
+static void print_row(const benchmarkResult &result,
+                      const benchmarkRoofline &roofline) {
+  benchmarkRating rating = benchmarkRate(result, roofline);
+  cout << result.routine << "," << result.precision << "," << result.layout
+       << ",\"" << result.args << "\"";
+  if (!result.succeeded) {
+    cout << ",failed" << endl;
+    return;
+  }
+  cout << "," << result.summary.samples << "," << result.summary.medianUs
+       << "," << result.summary.p95Us << "," << rating.gflops << ","
+       << rating.gbps;
+  print_fraction(rating.fraction);
+  print_fraction(rating.bandwidthFraction);
+  cout << endl;
+}
+
+int main(int argc, char *argv[]) {
+  benchmarkConfig config = {3, 20, 3};
+  const char *filter = "";
+  const char *json = NULL;
+  int device = -1;
+  hcblasBackend backend = HccBackend;
+  int n1 = 1 << 22, n2 = 4096, n3 = 1024;
+  double fp64Ratio = 1.0 / 16;
+  int busBits = 4096;
+  double peakGflops = 0, peakGbps = 0;
+  for (int i = 1; i < argc; i++) {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (value == NULL) {
+      usage(argv[0]);
+      return -1;
+    } else if (!strcmp(argv[i], "--filter")) {
+      filter = value;
+    } else if (!strcmp(argv[i], "--iterations")) {
+      config.iterations = atoi(value);
+    } else if (!strcmp(argv[i], "--warmup")) {
+      config.warmup = atoi(value);
+    } else if (!strcmp(argv[i], "--outlier-mads")) {
+      config.outlierMads = atof(value);
+    } else if (!strcmp(argv[i], "--json")) {
+      json = value;
+    } else if (!strcmp(argv[i], "--device")) {
+      device = atoi(value);
+    } else if (!strcmp(argv[i], "--backend") && !strcmp(value, "hcc")) {
+      backend = HccBackend;
+    } else if (!strcmp(argv[i], "--backend") && !strcmp(value, "cpu")) {
+      backend = CpuBackend;
+    } else if (!strcmp(argv[i], "--size-l1")) {
+      n1 = atoi(value);
+    } else if (!strcmp(argv[i], "--size-l2")) {
+      n2 = atoi(value);
+    } else if (!strcmp(argv[i], "--size-l3")) {
+      n3 = atoi(value);
+    } else if (!strcmp(argv[i], "--fp64-ratio")) {
+      fp64Ratio = atof(value);
+    } else if (!strcmp(argv[i], "--bus-bits")) {
+      busBits = atoi(value);
+    } else if (!strcmp(argv[i], "--peak-gflops")) {
+      peakGflops = atof(value);
+    } else if (!strcmp(argv[i], "--peak-gbps")) {
+      peakGbps = atof(value);
+    } else {
+      usage(argv[0]);
+      return -1;
+    }
+    i++;
+  }
+  // The batched forms run on an eighth (level 1 and 2) or a sixteenth
+  // (level 3) of these
+  if (config.iterations < 1 || config.warmup < 0 || n1 < 8 || n2 < 8 ||
+      n3 < 16) {
+    usage(argv[0]);
+    return -1;
+  }
+
+  hc::accelerator accl;
+  if (device >= 0) {
+    std::vector<hc::accelerator> all = hc::accelerator::get_all();
+    if (device >= static_cast<int>(all.size())) {
+      cerr << "no device " << device << endl;
+      return -1;
+    }
+    accl = all[device];
+  }
+  hc::accelerator_view accl_view = accl.get_default_view();
+  Hcblaslibrary *library = hcblasNewLibrary(&accl_view, backend);
+  if (library == NULL) {
+    cerr << "cannot create the library" << endl;
+    return -1;
+  }
+  bool onHost = backend == CpuBackend;
+  std::wstring description = accl.get_description();
+  std::string name(description.begin(), description.end());
+
+  // The device clocks say nothing about the host, so the CPU backend is
+  // rated only against the peaks passed in
+  benchmarkRoofline roofline = {0, 0, 0, 0, 0};
+  if (onHost) {
+    name = std::string("cpu (") + hcblasCpuIsa() + ")";
+  } else {
+    roofline = benchmarkRooflineFor(library->deviceProps, fp64Ratio, busBits);
+  }
+  if (peakGflops > 0) {
+    roofline.fp64Gflops = peakGflops * fp64Ratio;
+    roofline.fp16Gflops = 2 * peakGflops;
+    roofline.int8Gops = peakGflops;
+    roofline.fp32Gflops = peakGflops;
+  }
+  if (peakGbps > 0) {
+    roofline.gbps = peakGbps;
+  }
+  cerr << name << ": " << roofline.fp32Gflops << " FP32 GFLOP/s, "
+       << roofline.gbps << " GB/s" << endl;
+
+  std::vector<benchmarkCase> cases = benchmarkCases(n1, n2, n3);
+  std::vector<benchmarkResult> results;
+  int failures = 0;
+  cout << "routine,precision,layout,args,samples,median_us,p95_us,gflops,"
+       << "gbps,roofline_pct,bandwidth_pct" << endl;
+  for (size_t i = 0; i < cases.size(); i++) {
+    if (!strstr(cases[i].routine.c_str(), filter)) {
+      continue;
+    }
+    benchmarkContext context;
+    context.library = library;
+    context.view = accl_view;
+    context.bcase = &cases[i];
+    allocate(cases[i], accl, onHost, &context);
+    const hcblasOrder orders[2] = {ColMajor, RowMajor};
+    for (int o = 0; o < (cases[i].hasOrder ? 2 : 1); o++) {
+      context.order = orders[o];
+      results.push_back(run(context, config));
+      print_row(results.back(), roofline);
+      if (!results.back().succeeded) {
+        failures++;
+      }
+    }
+    release(onHost, &context);
+  }
+
+  if (json) {
+    std::ofstream out(json);
+    if (!out) {
+      cerr << "cannot write " << json << endl;
+      delete library;
+      return -1;
+    }
+    benchmarkWriteJson(out, name, library->deviceProps, roofline, config,
+                       results);
+  }
+  delete library;
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,126 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/*
+* hcblas-benchmark: times every routine of Hcblaslibrary in every precision
+* and layout on synthetic operands and rates each against the device
+* roofline. The harness below (statistics, roofline model and JSON output)
+* does not touch the device so it can be tested on any host; the cases
+* that launch live in benchmark_cases.cpp.
+*/
+
+#ifndef TEST_SRC_BENCHMARK_HCBLAS_BENCHMARK_H_
+#define TEST_SRC_BENCHMARK_HCBLAS_BENCHMARK_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "include/hcblas_device.h"
+
+struct benchmarkConfig {
+  int warmup;          // untimed runs before the samples
+  int iterations;      // timed runs
+  double outlierMads;  // samples further than this many MADs from the
+                       // median are rejected, 0 keeps all
+};
+
+// Statistics of the samples left after outlier rejection, in us
+struct benchmarkSummary {
+  int samples;
+  int pruned;
+  double medianUs;
+  double p95Us;
+  double meanUs;
+  double minUs;
+};
+
+/* Summarizes samplesUs. The median absolute deviation is scaled to a
+ standard deviation (x 1.4826) before the outlierMads cut, so 3 rejects
+ what a 3 sigma cut would for normal noise. p95 is nearest rank. */
+benchmarkSummary benchmarkSummarize(const std::vector<double> &samplesUs,
+                                    double outlierMads);
+
+/* Peak rates of a device. Compute peaks are in G operations per second;
+ a peak of 0 means unknown and rates against it are not reported. */
+struct benchmarkRoofline {
+  double fp32Gflops;
+  double fp64Gflops;
+  double fp16Gflops;
+  double int8Gops;
+  double gbps;
+};
+
+/* Roofline of a GCN device from its properties: every SIMD retires a fused
+ multiply add per lane per clock (a wavefront issues over
+ wavefrontSize / 16 clocks), packed half math doubles that, FP64 runs at
+ fp64Ratio of the FP32 rate and int8 at the FP32 rate. Memory moves
+ busBits per edge of a double data rate clock. */
+benchmarkRoofline benchmarkRooflineFor(const hcblasDeviceProps &props,
+                                       double fp64Ratio, int busBits);
+
+/* Compute peak for a precision: FP32 for S, C and B (bfloat16 is widened
+ before the multiply), FP64 for D and Z, half for H and int8 for I */
+double benchmarkPeakGflops(const benchmarkRoofline &roofline,
+                           char precision);
+
+// One timed case
+struct benchmarkResult {
+  std::string routine;  // Hcblaslibrary routine without the hcblas_ prefix
+  char precision;
+  std::string layout;   // row, col or none for routines without an order
+  std::string args;     // key=value pairs describing the problem
+  bool succeeded;
+  benchmarkSummary summary;
+  double flops;         // per call
+  double bytes;         // per call; an operand read and written counts
+                        // twice
+};
+
+/* Rates of result against roofline. fraction is the achieved FLOP rate
+ over the attainable one, min(peak, intensity x bandwidth), and
+ bandwidthFraction the achieved bytes per second over the peak; both are
+ negative when the peak they need is unknown. memoryBound says which roof
+ limits the case. */
+struct benchmarkRating {
+  double gflops;
+  double gbps;
+  double fraction;
+  double bandwidthFraction;
+  bool memoryBound;
+};
+
+benchmarkRating benchmarkRate(const benchmarkResult &result,
+                              const benchmarkRoofline &roofline);
+
+// Quotes and escapes text for a JSON string
+std::string benchmarkJsonString(const std::string &text);
+
+/* Writes a run as one JSON document: the device, its roofline, the
+ configuration and one entry per result with its statistics and rating. */
+void benchmarkWriteJson(std::ostream &out, const std::string &device,
+                        const hcblasDeviceProps &props,
+                        const benchmarkRoofline &roofline,
+                        const benchmarkConfig &config,
+                        const std::vector<benchmarkResult> &results);
+
+#endif  // TEST_SRC_BENCHMARK_HCBLAS_BENCHMARK_H_
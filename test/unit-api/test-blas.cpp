@@ -2065,6 +2065,102 @@ TEST(hcblaswrapper_sgemmBatched, func_return_correct_sgemmBatched) {
   hc::am_free(d_Carray);
 }
 
+TEST(hcblaswrapper_sgemmBatched, func_return_correct_sgemmBatched_tiny) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  hc::accelerator_view accl_view = default_acc.get_default_view();
+  // Passing a Null handle and default accelerator to the API
+  status = hcblasCreate(&handle, &av);
+  // Shapes small enough for the tiny matrix kernels, including a batch
+  // that does not fill the last work group
+  int shapes[4][4] = {{3, 3, 3, 1000}, {12, 12, 12, 77}, {5, 17, 32, 9},
+                      {32, 2, 7, 40}};
+  float alpha = 2;
+  float beta = 1;
+  hcblasOperation_t ops[2] = {HCBLAS_OP_N, HCBLAS_OP_T};
+  CBLAS_TRANSPOSE cops[2] = {CblasNoTrans, CblasTrans};
+
+  for (int s = 0; s < 4; s++) {
+    int M = shapes[s][0];
+    int N = shapes[s][1];
+    int K = shapes[s][2];
+    int batchSize = shapes[s][3];
+    int size = 32 * 32;
+    float *A = (float *)malloc(sizeof(float) * size * batchSize);
+    float *B = (float *)malloc(sizeof(float) * size * batchSize);
+    float *C = (float *)malloc(sizeof(float) * size * batchSize);
+    float *C_cblas = (float *)malloc(sizeof(float) * size * batchSize);
+    float *devA[1000], *devB[1000], *devC[1000];
+    float *dA = hc::am_alloc(sizeof(float) * size * batchSize, default_acc, 0);
+    float *dB = hc::am_alloc(sizeof(float) * size * batchSize, default_acc, 0);
+    float *dC = hc::am_alloc(sizeof(float) * size * batchSize, default_acc, 0);
+    float **d_Aarray =
+        hc::am_alloc(batchSize * sizeof(float *), default_acc, 0);
+    float **d_Barray =
+        hc::am_alloc(batchSize * sizeof(float *), default_acc, 0);
+    float **d_Carray =
+        hc::am_alloc(batchSize * sizeof(float *), default_acc, 0);
+    for (int b = 0; b < batchSize; b++) {
+      devA[b] = dA + b * size;
+      devB[b] = dB + b * size;
+      devC[b] = dC + b * size;
+    }
+    accl_view.copy(devA, d_Aarray, batchSize * sizeof(float *));
+    accl_view.copy(devB, d_Barray, batchSize * sizeof(float *));
+    accl_view.copy(devC, d_Carray, batchSize * sizeof(float *));
+
+    for (int o = 0; o < 2; o++) {
+      handle->Order = o ? ColMajor : RowMajor;
+      CBLAS_ORDER order = o ? CblasColMajor : CblasRowMajor;
+      for (int ta = 0; ta < 2; ta++) {
+        for (int tb = 0; tb < 2; tb++) {
+          int rowsA = ta ? K : M, colsA = ta ? M : K;
+          int rowsB = tb ? N : K, colsB = tb ? K : N;
+          int lda = o ? rowsA : colsA;
+          int ldb = o ? rowsB : colsB;
+          int ldc = o ? M : N;
+          for (int i = 0; i < size * batchSize; i++) {
+            A[i] = rand_r(&global_seed) % 10;
+            B[i] = rand_r(&global_seed) % 15;
+            C[i] = rand_r(&global_seed) % 25;
+            C_cblas[i] = C[i];
+          }
+          accl_view.copy(A, dA, sizeof(float) * size * batchSize);
+          accl_view.copy(B, dB, sizeof(float) * size * batchSize);
+          accl_view.copy(C, dC, sizeof(float) * size * batchSize);
+          status = hcblasSgemmBatched(handle, ops[ta], ops[tb], M, N, K,
+                                      &alpha, d_Aarray, lda, d_Barray, ldb,
+                                      &beta, d_Carray, ldc, batchSize);
+          EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+          accl_view.copy(dC, C, sizeof(float) * size * batchSize);
+          for (int b = 0; b < batchSize; b++) {
+            cblas_sgemm(order, cops[ta], cops[tb], M, N, K, alpha,
+                        A + b * size, lda, B + b * size, ldb, beta,
+                        C_cblas + b * size, ldc);
+          }
+          for (int i = 0; i < size * batchSize; i++) {
+            EXPECT_EQ(C[i], C_cblas[i]);
+          }
+        }
+      }
+    }
+
+    free(A);
+    free(B);
+    free(C);
+    free(C_cblas);
+    hc::am_free(dA);
+    hc::am_free(dB);
+    hc::am_free(dC);
+    hc::am_free(d_Aarray);
+    hc::am_free(d_Barray);
+    hc::am_free(d_Carray);
+  }
+  hcblasDestroy(&handle);
+}
+
 TEST(hcblaswrapper_dgemmBatched, func_return_correct_dgemmBatched) {
   hcblasStatus_t status;
   hcblasHandle_t handle = NULL;
@@ -2820,3 +2916,167 @@ TEST(hcblaswrapper_zgemmBatched, func_return_correct_zgemmBatched) {
   hc::am_free(d_Carray);
 }
 #endif
+
+TEST(hcblaswrapper_gemmEx, func_return_correct_gemmEx) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  // Passing a Null handle and default accelerator to the API
+  status = hcblasCreate(&handle, &av);
+  int M = 45, N = 38, K = 57;
+  float alpha = 1, beta = 2;
+  hc::accelerator accl = handle->currentAccl;
+  // Homogeneous single precision goes through the sgemm kernels
+  float* A = (float*)calloc(M * K, sizeof(float));
+  float* B = (float*)calloc(K * N, sizeof(float));
+  float* C = (float*)calloc(M * N, sizeof(float));
+  float* C_cblas = (float*)calloc(M * N, sizeof(float));
+  float* devA = hc::am_alloc(sizeof(float) * M * K, accl, 0);
+  float* devB = hc::am_alloc(sizeof(float) * K * N, accl, 0);
+  float* devC = hc::am_alloc(sizeof(float) * M * N, accl, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    A[i] = rand_r(&global_seed) % 100;
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    B[i] = rand_r(&global_seed) % 15;
+  }
+
+  for (int i = 0; i < M * N; i++) {
+    C[i] = rand_r(&global_seed) % 25;
+    C_cblas[i] = C[i];
+  }
+
+  status = hcblasSetMatrix(handle, M, K, sizeof(float), A, M, devA, M);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, K, N, sizeof(float), B, K, devB, K);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, M, N, sizeof(float), C, M, devC, M);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGemmEx(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, HCBLAS_R_32F, M, devB, HCBLAS_R_32F, K, &beta,
+                        devC, HCBLAS_R_32F, M, HCBLAS_R_32F,
+                        HCBLAS_GEMM_DEFAULT);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, M, N, sizeof(float), devC, M, C, M);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, A, M,
+              B, K, beta, C_cblas, M);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C[i], C_cblas[i]);
+  }
+
+  // Unsupported type combination
+  status = hcblasGemmEx(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, HCBLAS_R_32F, M, devB, HCBLAS_R_32F, K, &beta,
+                        devC, HCBLAS_R_64F, M, HCBLAS_R_32F,
+                        HCBLAS_GEMM_DEFAULT);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasGemmEx(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, HCBLAS_R_32F, M, devB, HCBLAS_R_32F, K, &beta,
+                        devC, HCBLAS_R_32F, M, HCBLAS_R_32F,
+                        HCBLAS_GEMM_DEFAULT);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_cblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblaswrapper_sgemmGrouped, func_return_correct_sgemmGrouped) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  // Passing a Null handle and default accelerator to the API
+  status = hcblasCreate(&handle, &av);
+  const int groupCount = 3;
+  int M[groupCount] = {37, 5, 64};
+  int N[groupCount] = {20, 33, 64};
+  int K[groupCount] = {12, 70, 3};
+  float alpha = 1, beta = 2;
+  hc::accelerator accl = handle->currentAccl;
+  float *A[groupCount], *B[groupCount], *C[groupCount], *C_cblas[groupCount];
+  float *devA[groupCount], *devB[groupCount], *devC[groupCount];
+
+  for (int p = 0; p < groupCount; p++) {
+    A[p] = (float*)calloc(M[p] * K[p], sizeof(float));
+    B[p] = (float*)calloc(K[p] * N[p], sizeof(float));
+    C[p] = (float*)calloc(M[p] * N[p], sizeof(float));
+    C_cblas[p] = (float*)calloc(M[p] * N[p], sizeof(float));
+    devA[p] = hc::am_alloc(sizeof(float) * M[p] * K[p], accl, 0);
+    devB[p] = hc::am_alloc(sizeof(float) * K[p] * N[p], accl, 0);
+    devC[p] = hc::am_alloc(sizeof(float) * M[p] * N[p], accl, 0);
+    for (int i = 0; i < M[p] * K[p]; i++) {
+      A[p][i] = rand_r(&global_seed) % 100;
+    }
+    for (int i = 0; i < K[p] * N[p]; i++) {
+      B[p][i] = rand_r(&global_seed) % 15;
+    }
+    for (int i = 0; i < M[p] * N[p]; i++) {
+      C[p][i] = rand_r(&global_seed) % 25;
+      C_cblas[p][i] = C[p][i];
+    }
+    status = hcblasSetMatrix(handle, M[p], K[p], sizeof(float), A[p], M[p],
+                             devA[p], M[p]);
+    EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+    status = hcblasSetMatrix(handle, K[p], N[p], sizeof(float), B[p], K[p],
+                             devB[p], K[p]);
+    EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+    status = hcblasSetMatrix(handle, M[p], N[p], sizeof(float), C[p], M[p],
+                             devC[p], M[p]);
+    EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  }
+
+  status = hcblasSgemmGrouped(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K,
+                              &alpha, devA, M, devB, K, &beta, devC, M,
+                              groupCount);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  for (int p = 0; p < groupCount; p++) {
+    status = hcblasGetMatrix(handle, M[p], N[p], sizeof(float), devC[p], M[p],
+                             C[p], M[p]);
+    EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+    cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M[p], N[p], K[p],
+                alpha, A[p], M[p], B[p], K[p], beta, C_cblas[p], M[p]);
+    for (int i = 0; i < M[p] * N[p]; i++) {
+      EXPECT_EQ(C[p][i], C_cblas[p][i]);
+    }
+  }
+
+  // HCBLAS_STATUS_INVALID_VALUE
+  status = hcblasSgemmGrouped(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K,
+                              &alpha, devA, M, devB, K, &beta, devC, M, -1);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+  status = hcblasSgemmGrouped(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, NULL,
+                              &alpha, devA, M, devB, K, &beta, devC, M,
+                              groupCount);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasSgemmGrouped(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K,
+                              &alpha, devA, M, devB, K, &beta, devC, M,
+                              groupCount);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  for (int p = 0; p < groupCount; p++) {
+    free(A[p]);
+    free(B[p]);
+    free(C[p]);
+    free(C_cblas[p]);
+    hc::am_free(devA[p]);
+    hc::am_free(devB[p]);
+    hc::am_free(devC[p]);
+  }
+}
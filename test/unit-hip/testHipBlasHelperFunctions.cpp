@@ -23,6 +23,8 @@ THE SOFTWARE.
 #include "hip/hip_runtime_api.h"
 #include "include/hipblas.h"
 #include "gtest/gtest.h"
+#include <thread>
+#include <vector>
 
 TEST(hipblasCreateTest, return_Check_hipblasCreate) {
   // Case I: Input to the API is null handle
@@ -229,3 +231,46 @@ TEST(hipblasGetMatrixTest, return_Check_hipblasGetMatrix) {
   hipFree(x1);
   hipFree(x2);
 }
+
+TEST(hipblasSetVectorTest, return_Check_hipblasSetVector_concurrent) {
+  // The handle-less copies share one default context per device; hammer it
+  // from several threads so the first-use initialisation races.
+  const int n = 64;
+  const int numThreads = 8;
+  const int iterations = 100;
+  std::vector<std::thread> threads;
+  std::vector<int> failures(numThreads, 0);
+  for (int t = 0; t < numThreads; t++) {
+    threads.push_back(std::thread([&, t]() {
+      float *x = (float *)calloc(n, sizeof(float));
+      float *z = (float *)calloc(n, sizeof(float));
+      float *y = NULL;
+      hipMalloc(&y, n * sizeof(float));
+      for (int i = 0; i < iterations; i++) {
+        for (int j = 0; j < n; j++) {
+          x[j] = t * 1000 + i + j;
+        }
+        if (hipblasSetVector(n, sizeof(float), x, 1, y, 1) !=
+                HIPBLAS_STATUS_SUCCESS ||
+            hipblasGetVector(n, sizeof(float), y, 1, z, 1) !=
+                HIPBLAS_STATUS_SUCCESS) {
+          failures[t]++;
+          continue;
+        }
+        for (int j = 0; j < n; j++) {
+          if (z[j] != x[j]) {
+            failures[t]++;
+            break;
+          }
+        }
+      }
+      free(x);
+      free(z);
+      hipFree(y);
+    }));
+  }
+  for (int t = 0; t < numThreads; t++) {
+    threads[t].join();
+    EXPECT_EQ(failures[t], 0);
+  }
+}
@@ -0,0 +1,159 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "hcblas_bench.h"
+#include <sstream>
+#include "gtest/gtest.h"
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_bench, return_correct_parse) {
+  benchCall call;
+  std::string error;
+  // HCBLAS_LAYER=1 CSV line
+  ASSERT_EQ(benchParseLine("84.5,0,hcblasSgemm,\"gemm_NoTransAB_STEP\",,"
+                           "\"order=R,transa=T,transb=N,m=64,n=48,k=32,"
+                           "alpha=2,lda=70,ldb=48,beta=0.5,ldc=50\"",
+                           &call, &error),
+            BenchParsed);
+  EXPECT_EQ(call.routine, "gemm");
+  EXPECT_EQ(call.precision, 'S');
+  EXPECT_EQ(call.order, 'R');
+  EXPECT_EQ(call.transA, 'T');
+  EXPECT_EQ(call.transB, 'N');
+  EXPECT_EQ(call.m, 64);
+  EXPECT_EQ(call.n, 48);
+  EXPECT_EQ(call.k, 32);
+  EXPECT_EQ(call.lda, 70);
+  EXPECT_EQ(call.ldc, 50);
+  EXPECT_EQ(call.alpha[0], 2);
+  EXPECT_EQ(call.beta[0], 0.5);
+  EXPECT_FALSE(call.batched);
+
+  // JSON line with a complex scalar and a batch
+  ASSERT_EQ(benchParseLine("{\"time_us\":1.0,\"thread\":0,\"call\":"
+                           "\"hcblasZgemmBatched\",\"kernel\":\"\","
+                           "\"device_us\":null,\"args\":{\"order\":\"C\","
+                           "\"transa\":\"N\",\"transb\":\"C\",\"m\":8,"
+                           "\"n\":9,\"k\":10,\"alpha\":\"1.5-2i\","
+                           "\"batchCount\":7}}",
+                           &call, &error),
+            BenchParsed);
+  EXPECT_EQ(call.routine, "gemm");
+  EXPECT_EQ(call.precision, 'Z');
+  EXPECT_TRUE(call.batched);
+  EXPECT_EQ(call.batchCount, 7);
+  EXPECT_EQ(call.transB, 'C');
+  EXPECT_EQ(call.alpha[0], 1.5);
+  EXPECT_EQ(call.alpha[1], -2);
+  // Leading dimensions default to packed column major operands
+  EXPECT_EQ(call.lda, 8);
+  EXPECT_EQ(call.ldb, 9);
+  EXPECT_EQ(call.ldc, 8);
+
+  // Dimension file line: transposes are 0 or 1
+  ASSERT_EQ(benchParseLine("96\t192\t288\t1\t0\t288\t288\t96\t1\t1\t0\t0\t0",
+                           &call, &error),
+            BenchParsed);
+  EXPECT_EQ(call.name, "hcblasSgemm");
+  EXPECT_EQ(call.transA, 'T');
+  EXPECT_EQ(call.k, 288);
+  EXPECT_EQ(call.ldc, 96);
+  EXPECT_EQ(call.beta[0], 1);
+
+  EXPECT_EQ(benchParseLine("time_us,thread,call,kernel,device_us,args",
+                           &call, &error),
+            BenchSkipped);
+  EXPECT_EQ(benchParseLine("# dropped 3 records", &call, &error),
+            BenchSkipped);
+  EXPECT_EQ(benchParseLine("{\"dropped\":3}", &call, &error), BenchSkipped);
+  EXPECT_EQ(benchParseLine("   ", &call, &error), BenchSkipped);
+  EXPECT_EQ(benchParseLine("1.0,0,hcblasCscal,\"\",,\"n=5\"", &call, &error),
+            BenchError);
+  EXPECT_EQ(benchParseLine("1.0,0,hcblasSgemm,\"\",,\"m=5,n=5\"", &call,
+                           &error),
+            BenchError);
+}
+
+TEST(hcblas_bench, return_correct_parse_log) {
+  std::istringstream log(
+      "time_us,thread,call,kernel,device_us,args\n"
+      "1.0,0,hcblasSaxpy,\"\",,\"order=C,n=100,alpha=2,incx=1,incy=1\"\n"
+      "2.0,0,hcblasDgemv,\"\",,\"order=C,trans=T,m=30,n=20,alpha=1,"
+      "lda=30,incx=1,incy=2,beta=0\"\n"
+      "3.0,1,hcblasSaxpy,\"\",,\"order=C,n=100,alpha=2,incx=1,incy=1\"\n"
+      "4.0,0,hcblasSfoo,\"\",,\"n=1\"\n");
+  std::vector<std::string> errors;
+  std::vector<benchCall> calls = benchParseLog(log, &errors);
+  ASSERT_EQ(calls.size(), 2);
+  EXPECT_EQ(calls[0].name, "hcblasSaxpy");
+  EXPECT_EQ(calls[0].count, 2);
+  EXPECT_EQ(calls[1].name, "hcblasDgemv");
+  EXPECT_EQ(calls[1].count, 1);
+  ASSERT_EQ(errors.size(), 1);
+  EXPECT_EQ(errors[0], "line 5: unsupported call: hcblasSfoo");
+
+  size_t sizes[3];
+  benchOperandSizes(calls[1], sizes);
+  EXPECT_EQ(sizes[0], 30 * 20);
+  EXPECT_EQ(sizes[1], 30);           // x has m elements for trans
+  EXPECT_EQ(sizes[2], 1 + 19 * 2);   // y has n elements, stride 2
+  EXPECT_EQ(benchFlops(calls[1]), 2.0 * 30 * 20);
+  EXPECT_EQ(benchBytes(calls[1]), 8.0 * (30 * 20 + 30 + 20));
+  EXPECT_EQ(benchFlops(calls[0]), 200);
+  EXPECT_EQ(benchBytes(calls[0]), 4.0 * 300);
+}
+
+TEST(hcblas_bench, return_correct_stats) {
+  StatisticalTimer &timer = StatisticalTimer::getInstance();
+  timer.Reserve(2, 16);
+  timer.setNormalize(true);
+  StatisticalTimer::sTimerID id = timer.getUniqueID("bench", 0);
+  // Ten samples of 100 us and one stall, which is pruned
+  for (int i = 0; i < 10; i++) {
+    timer.AddSample(id, 100);
+  }
+  timer.AddSample(id, 10000);
+  benchStats stats = benchSummarize(timer, id, 11, 2e6, 4e5);
+  EXPECT_EQ(stats.samples, 10);
+  EXPECT_EQ(stats.pruned, 1);
+  EXPECT_DOUBLE_EQ(stats.meanUs, 100);
+  EXPECT_DOUBLE_EQ(stats.minUs, 100);
+  EXPECT_DOUBLE_EQ(stats.stdDevUs, 0);
+  EXPECT_DOUBLE_EQ(stats.gflops, 20);
+  EXPECT_DOUBLE_EQ(stats.gbps, 4);
+
+  // Totals weight each entry by how often it was logged
+  std::vector<benchCall> calls(2);
+  std::string error;
+  benchParseLine("1,0,hcblasSscal,\"\",,\"n=1000,alpha=2,incx=1\"", &calls[0],
+                 &error);
+  benchParseLine("1,0,hcblasSscal,\"\",,\"n=3000,alpha=2,incx=1\"", &calls[1],
+                 &error);
+  calls[0].count = 3;
+  std::vector<benchStats> each(2, stats);
+  each[1].meanUs = 200;
+  benchStats total = benchAggregate(calls, each);
+  EXPECT_DOUBLE_EQ(total.meanUs, 3 * 100 + 200);
+  EXPECT_DOUBLE_EQ(total.gflops, (3 * 1000 + 3000) / 500e-6 * 1e-9);
+  EXPECT_DOUBLE_EQ(total.gbps, (3 * 8000 + 24000) / 500e-6 * 1e-9);
+}
@@ -0,0 +1,150 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "hcblas_benchmark.h"
+#include <sstream>
+#include "gtest/gtest.h"
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_benchmark, return_correct_summary) {
+  // 19 samples around 100 us and one stall
+  std::vector<double> samples;
+  for (int i = 0; i < 19; i++) {
+    samples.push_back(95 + i % 10);
+  }
+  samples.push_back(5000);
+  benchmarkSummary summary = benchmarkSummarize(samples, 3);
+  EXPECT_EQ(summary.samples, 19);
+  EXPECT_EQ(summary.pruned, 1);
+  EXPECT_EQ(summary.minUs, 95);
+  EXPECT_EQ(summary.medianUs, 99);
+  // Nearest rank: the 19th of 19
+  EXPECT_EQ(summary.p95Us, 104);
+  EXPECT_NEAR(summary.meanUs, 1886 / 19.0, 1e-9);
+
+  // 0 keeps every sample
+  summary = benchmarkSummarize(samples, 0);
+  EXPECT_EQ(summary.samples, 20);
+  EXPECT_EQ(summary.pruned, 0);
+  EXPECT_EQ(summary.p95Us, 104);
+  EXPECT_EQ(summary.medianUs, 99.5);
+
+  // Identical samples have no spread to cut by
+  std::vector<double> flat(10, 7.5);
+  flat.push_back(8);
+  summary = benchmarkSummarize(flat, 3);
+  EXPECT_EQ(summary.samples, 11);
+  EXPECT_EQ(summary.medianUs, 7.5);
+
+  summary = benchmarkSummarize(std::vector<double>(), 3);
+  EXPECT_EQ(summary.samples, 0);
+}
+
+TEST(hcblas_benchmark, return_correct_roofline) {
+  hcblasDeviceProps props = hcblasDefaultDeviceProps();
+  props.computeUnits = 64;
+  props.simdsPerCU = 4;
+  props.coreClockMHz = 1000;
+  props.memoryClockMHz = 500;
+  benchmarkRoofline roofline = benchmarkRooflineFor(props, 0.5, 4096);
+  // 64 CUs x 64 lanes x 2 flops x 1 GHz, 4096 bits x 2 x 500 MHz
+  EXPECT_DOUBLE_EQ(roofline.fp32Gflops, 8192);
+  EXPECT_DOUBLE_EQ(roofline.fp64Gflops, 4096);
+  EXPECT_DOUBLE_EQ(roofline.fp16Gflops, 16384);
+  EXPECT_DOUBLE_EQ(roofline.gbps, 512);
+  EXPECT_DOUBLE_EQ(benchmarkPeakGflops(roofline, 'Z'), 4096);
+  EXPECT_DOUBLE_EQ(benchmarkPeakGflops(roofline, 'B'), 8192);
+  EXPECT_DOUBLE_EQ(benchmarkPeakGflops(roofline, 'I'), 8192);
+
+  benchmarkResult result;
+  result.precision = 'S';
+  result.succeeded = true;
+  result.summary = benchmarkSummarize(std::vector<double>(1, 1000), 3);
+  // 4 TFLOP/s on 1 GB/s: intensity 4096 is past the ridge at 16
+  result.flops = 4.096e9;
+  result.bytes = 1e6;
+  benchmarkRating rating = benchmarkRate(result, roofline);
+  EXPECT_DOUBLE_EQ(rating.gflops, 4096);
+  EXPECT_DOUBLE_EQ(rating.gbps, 1);
+  EXPECT_DOUBLE_EQ(rating.fraction, 0.5);
+  EXPECT_FALSE(rating.memoryBound);
+
+  // Intensity 0.25: capped at 128 GFLOP/s by bandwidth
+  result.flops = 64e6;
+  result.bytes = 256e6;
+  rating = benchmarkRate(result, roofline);
+  EXPECT_TRUE(rating.memoryBound);
+  EXPECT_DOUBLE_EQ(rating.fraction, 0.5);
+  EXPECT_DOUBLE_EQ(rating.bandwidthFraction, 0.5);
+
+  // Copies move data only and unknown clocks give no fractions
+  result.flops = 0;
+  EXPECT_LT(benchmarkRate(result, roofline).fraction, 0);
+  props.coreClockMHz = 0;
+  props.memoryClockMHz = 0;
+  roofline = benchmarkRooflineFor(props, 0.5, 4096);
+  result.flops = 64e6;
+  rating = benchmarkRate(result, roofline);
+  EXPECT_LT(rating.fraction, 0);
+  EXPECT_LT(rating.bandwidthFraction, 0);
+  EXPECT_DOUBLE_EQ(rating.gbps, 256);
+}
+
+TEST(hcblas_benchmark, return_correct_json) {
+  EXPECT_EQ(benchmarkJsonString("n=4,a=\"x\\y\"\n"),
+            "\"n=4,a=\\\"x\\\\y\\\"\\u000a\"");
+
+  hcblasDeviceProps props = hcblasDefaultDeviceProps();
+  benchmarkRoofline roofline = {100, 50, 200, 100, 0};
+  benchmarkConfig config = {1, 4, 3};
+  std::vector<benchmarkResult> results(2);
+  results[0].routine = "sgemm";
+  results[0].precision = 'S';
+  results[0].layout = "col";
+  results[0].args = "n=64";
+  results[0].succeeded = true;
+  results[0].summary = benchmarkSummarize(std::vector<double>(4, 10), 3);
+  results[0].flops = 2e6;
+  results[0].bytes = 1e5;
+  results[1] = results[0];
+  results[1].layout = "row";
+  results[1].succeeded = false;
+  std::ostringstream out;
+  benchmarkWriteJson(out, "gfx", props, roofline, config, results);
+  std::string json = out.str();
+  EXPECT_NE(json.find("\"name\": \"gfx\""), std::string::npos);
+  EXPECT_NE(json.find("\"iterations\": 4"), std::string::npos);
+  EXPECT_NE(json.find("\"routine\": \"sgemm\", \"precision\": \"S\", "
+                      "\"layout\": \"col\", \"args\": \"n=64\", "
+                      "\"status\": \"ok\", \"samples\": 4"),
+            std::string::npos);
+  // 200 GFLOP/s against a 100 GFLOP/s peak and no bandwidth figure
+  EXPECT_NE(json.find("\"gflops\": 200, \"gbps\": 10, \"roofline_fraction\": "
+                      "2, \"bandwidth_fraction\": null, \"bound\": "
+                      "\"compute\"}"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"layout\": \"row\", \"args\": \"n=64\", "
+                      "\"status\": \"failed\"}"),
+            std::string::npos);
+}
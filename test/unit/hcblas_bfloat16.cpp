@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas_bfloat16.h"
+#include "gtest/gtest.h"
+#include <cmath>
+#include <cstring>
+
+// Host only checks of the bfloat16 conversions; no device is involved
+
+static unsigned int float_bits(float value) {
+  unsigned int bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float bits_float(unsigned int bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static unsigned short to_bf16(unsigned int bits) {
+  return hcblasFloatToBfloat16(bits_float(bits)).data;
+}
+
+TEST(hcblas_bfloat16, func_correct_bfloat16_to_float) {
+  // Every bfloat16 pattern widens to the float with the same upper half
+  for (unsigned int i = 0; i < 0x10000; i++) {
+    hcBfloat16 value;
+    value.data = static_cast<unsigned short>(i);
+    EXPECT_EQ(float_bits(hcblasBfloat16ToFloat(value)), i << 16);
+  }
+}
+
+TEST(hcblas_bfloat16, func_correct_float_to_bfloat16_round_trip) {
+  // Every non NaN bfloat16 survives a round trip through float unchanged
+  for (unsigned int i = 0; i < 0x10000; i++) {
+    if ((i & 0x7fff) > 0x7f80) continue;
+    EXPECT_EQ(to_bf16(i << 16), i);
+  }
+}
+
+TEST(hcblas_bfloat16, func_correct_float_to_bfloat16_rounding) {
+  // Below, above and exactly at the halfway point
+  EXPECT_EQ(to_bf16(0x3f807fff), 0x3f80);
+  EXPECT_EQ(to_bf16(0x3f808001), 0x3f81);
+  // Ties go to the even mantissa
+  EXPECT_EQ(to_bf16(0x3f808000), 0x3f80);
+  EXPECT_EQ(to_bf16(0x3f818000), 0x3f82);
+  EXPECT_EQ(to_bf16(0xbf818000), 0xbf82);
+  // Rounding carries into the exponent
+  EXPECT_EQ(to_bf16(0x3fffc000), 0x4000);
+  // The largest finite values round to infinity or stay finite
+  EXPECT_EQ(to_bf16(0x7f7fffff), 0x7f80);
+  EXPECT_EQ(to_bf16(0xff7fffff), 0xff80);
+  EXPECT_EQ(to_bf16(0x7f7f7fff), 0x7f7f);
+  // Subnormals round like normals
+  EXPECT_EQ(to_bf16(0x00018000), 0x0002);
+  EXPECT_EQ(to_bf16(0x00008000), 0x0000);
+  // Signed zeros and infinities are preserved
+  EXPECT_EQ(to_bf16(0x00000000), 0x0000);
+  EXPECT_EQ(to_bf16(0x80000000), 0x8000);
+  EXPECT_EQ(to_bf16(0x7f800000), 0x7f80);
+  EXPECT_EQ(to_bf16(0xff800000), 0xff80);
+}
+
+TEST(hcblas_bfloat16, func_correct_float_to_bfloat16_nan) {
+  // A NaN whose payload lives only in the low half must not become infinity
+  unsigned short value = to_bf16(0x7f800001);
+  EXPECT_EQ(value & 0x7f80, 0x7f80);
+  EXPECT_NE(value & 0x007f, 0);
+  EXPECT_TRUE(std::isnan(hcblasBfloat16ToFloat(hcblasFloatToBfloat16(NAN))));
+  // Sign is kept
+  EXPECT_EQ(to_bf16(0xffc00000), 0xffc0);
+  // Rounding never carries a NaN payload into the sign bit
+  EXPECT_EQ(to_bf16(0x7fffffff), 0x7fff);
+}
+
+TEST(hcblas_bfloat16, func_correct_float_to_bfloat16_reference) {
+  // Compare against a reference that rounds in double precision
+  unsigned int seed = 100;
+  for (int i = 0; i < 100000; i++) {
+    unsigned int bits = (static_cast<unsigned int>(rand_r(&seed)) << 16) ^
+                        static_cast<unsigned int>(rand_r(&seed));
+    float value = bits_float(bits);
+    if (std::isnan(value) || std::isinf(value)) continue;
+    unsigned short lo = static_cast<unsigned short>(bits >> 16);
+    unsigned short hi = static_cast<unsigned short>(lo + 1);
+    double dlo = hcblasBfloat16ToFloat(hcBfloat16{lo});
+    double dhi = hcblasBfloat16ToFloat(hcBfloat16{hi});
+    if ((hi & 0x7fff) == 0x7f80) {
+      // The next pattern up is infinity; measure against 2^128 instead
+      dhi = std::copysign(std::ldexp(1.0, 128), value);
+    }
+    double errLo = std::fabs(value - dlo);
+    double errHi = std::fabs(value - dhi);
+    unsigned short expected =
+        (errLo < errHi || (errLo == errHi && (lo & 1) == 0)) ? lo : hi;
+    EXPECT_EQ(to_bf16(bits), expected);
+  }
+}
@@ -0,0 +1,467 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_cpu.h"
+#include "include/hcblas_thread_pool.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+static void fill(std::vector<float> &v, int range) {
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = rand_r(&global_seed) % range - range / 2;
+  }
+}
+
+static void expect_close(const std::vector<float> &result,
+                         const std::vector<float> &expected, float tol) {
+  ASSERT_EQ(result.size(), expected.size());
+  for (size_t i = 0; i < result.size(); i++) {
+    EXPECT_NEAR(result[i], expected[i], tol * (1 + fabs(expected[i])));
+  }
+}
+
+TEST(hcblas_cpu_backend, return_correct_thread_pool_coverage) {
+  hcblasThreadPool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+  const int count = 10007;
+  std::vector<std::atomic<int> > seen(count);
+  for (int i = 0; i < count; i++) {
+    seen[i] = 0;
+  }
+  pool.parallelFor(count, 13, [&](__int64_t begin, __int64_t end) {
+    EXPECT_LE(end - begin, 13);
+    for (__int64_t i = begin; i < end; i++) {
+      seen[i]++;
+    }
+  });
+  for (int i = 0; i < count; i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+
+  // Nested ranges finish even when every thread is inside an outer chunk
+  std::atomic<__int64_t> total(0);
+  pool.parallelFor(16, 1, [&](__int64_t begin, __int64_t end) {
+    pool.parallelFor(100, 7, [&](__int64_t b, __int64_t e) {
+      total += e - b;
+    });
+  });
+  EXPECT_EQ(total, 1600);
+
+  // Empty ranges return at once
+  pool.parallelFor(0, 1, [&](__int64_t, __int64_t) { total = -1; });
+  EXPECT_EQ(total, 1600);
+}
+
+TEST(hcblas_cpu_backend, return_correct_level1_cpu) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  HcblasCpuLibrary cpu(&av);
+  EXPECT_EQ(cpu.backend, CpuBackend);
+  // Long enough to be split over several tasks
+  const int N = 150001;
+  const int batchSize = 3;
+  float alpha = 0.5;
+  std::vector<float> X(N * 2 * batchSize), Y(N * batchSize);
+  fill(X, 10);
+  fill(Y, 10);
+  std::vector<float> Y_cblas = Y;
+
+  EXPECT_EQ(cpu.hcblas_saxpy(av, N, alpha, X.data(), 2, N * 2, Y.data(), 1, N,
+                             0, 0, batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    cblas_saxpy(N, alpha, &X[b * N * 2], 2, &Y_cblas[b * N], 1);
+  }
+  expect_close(Y, Y_cblas, 0);
+
+  // The batched dot product is the sum over the batch
+  float dot = 0;
+  EXPECT_EQ(cpu.hcblas_sdot(av, N, X.data(), 2, 0, Y.data(), 1, 0, dot, N * 2,
+                            N, batchSize),
+            HCBLAS_SUCCEEDS);
+  double dot_cblas = 0;
+  for (int b = 0; b < batchSize; b++) {
+    dot_cblas += cblas_dsdot(N, &X[b * N * 2], 2, &Y[b * N], 1);
+  }
+  EXPECT_NEAR(dot, dot_cblas, 1e-4 * fabs(dot_cblas));
+
+  float asum = 0;
+  EXPECT_EQ(cpu.hcblas_sasum(av, N, X.data(), 1, 1, &asum), HCBLAS_SUCCEEDS);
+  EXPECT_NEAR(asum, cblas_sasum(N, &X[1], 1), 1e-4 * asum);
+
+  EXPECT_EQ(cpu.hcblas_sscal(av, N, alpha, X.data(), 0, 0), HCBLAS_INVALID);
+  EXPECT_EQ(cpu.hcblas_sasum(av, N, X.data(), 1, 0, NULL), HCBLAS_INVALID);
+}
+
+TEST(hcblas_cpu_backend, return_correct_level2_cpu) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  HcblasCpuLibrary cpu(&av);
+  const int M = 131, N = 97;
+  float alpha = 1.5, beta = 0.5;
+  hcblasOrder orders[2] = {ColMajor, RowMajor};
+  CBLAS_ORDER cblasOrders[2] = {CblasColMajor, CblasRowMajor};
+  hcblasTranspose trans[2] = {NoTrans, Trans};
+  CBLAS_TRANSPOSE cblasTrans[2] = {CblasNoTrans, CblasTrans};
+  hcblasUplo uplos[2] = {Upper, Lower};
+  CBLAS_UPLO cblasUplos[2] = {CblasUpper, CblasLower};
+  hcblasDiag diags[2] = {NonUnit, Unit};
+  CBLAS_DIAG cblasDiags[2] = {CblasNonUnit, CblasUnit};
+
+  std::vector<float> A(M * M), X(M * 2), Y(M * 3);
+  fill(A, 10);
+  fill(X, 10);
+  for (int o = 0; o < 2; o++) {
+    for (int t = 0; t < 2; t++) {
+      // SGEMV with strided vectors
+      int lda = (o == 0) ? M : N;
+      fill(Y, 10);
+      std::vector<float> Y_cblas = Y;
+      EXPECT_EQ(cpu.hcblas_sgemv(av, orders[o], trans[t], M, N, alpha,
+                                 A.data(), 0, lda, X.data(), 0, 2, beta,
+                                 Y.data(), 1, 3),
+                HCBLAS_SUCCEEDS);
+      cblas_sgemv(cblasOrders[o], cblasTrans[t], M, N, alpha, A.data(), lda,
+                  X.data(), 2, beta, &Y_cblas[1], 3);
+      expect_close(Y, Y_cblas, 1e-5);
+
+      for (int u = 0; u < 2; u++) {
+        // SSYMV
+        fill(Y, 10);
+        Y_cblas = Y;
+        EXPECT_EQ(cpu.hcblas_ssymv(av, orders[o], uplos[u], N, alpha,
+                                   A.data(), 1, M, X.data(), 0, 1, beta,
+                                   Y.data(), 0, 2),
+                  HCBLAS_SUCCEEDS);
+        cblas_ssymv(cblasOrders[o], cblasUplos[u], N, alpha, &A[1], M,
+                    X.data(), 1, beta, Y_cblas.data(), 2);
+        expect_close(Y, Y_cblas, 1e-5);
+
+        // SSYR2
+        std::vector<float> A2 = A, A2_cblas = A;
+        EXPECT_EQ(cpu.hcblas_ssyr2(av, orders[o], uplos[u], N, alpha,
+                                   X.data(), 0, 1, Y.data(), 0, 2, A2.data(),
+                                   0, M),
+                  HCBLAS_SUCCEEDS);
+        cblas_ssyr2(cblasOrders[o], cblasUplos[u], N, alpha, X.data(), 1,
+                    Y.data(), 2, A2_cblas.data(), M);
+        expect_close(A2, A2_cblas, 1e-5);
+
+        for (int d = 0; d < 2; d++) {
+          // STRMV
+          std::vector<float> x = X, x_cblas = X;
+          EXPECT_EQ(cpu.hcblas_strmv(av, orders[o], uplos[u], trans[t],
+                                     diags[d], N, A.data(), 0, M, x.data(),
+                                     0, 2),
+                    HCBLAS_SUCCEEDS);
+          cblas_strmv(cblasOrders[o], cblasUplos[u], cblasTrans[t],
+                      cblasDiags[d], N, A.data(), M, x_cblas.data(), 2);
+          expect_close(x, x_cblas, 1e-5);
+
+          // STRSV on a diagonally dominant matrix
+          std::vector<float> T = A;
+          for (int i = 0; i < N; i++) {
+            T[i * M + i] = 40 + i % 7;
+          }
+          x = X;
+          x_cblas = X;
+          EXPECT_EQ(cpu.hcblas_strsv(av, orders[o], uplos[u], trans[t],
+                                     diags[d], N, T.data(), 0, M, x.data(),
+                                     0, 1),
+                    HCBLAS_SUCCEEDS);
+          cblas_strsv(cblasOrders[o], cblasUplos[u], cblasTrans[t],
+                      cblasDiags[d], N, T.data(), M, x_cblas.data(), 1);
+          // Without the dominant diagonal the solution grows too fast to
+          // compare
+          if (d == 0) {
+            expect_close(x, x_cblas, 1e-4);
+          }
+        }
+      }
+
+      // SGBMV with KL = 3, KU = 5
+      const int KL = 3, KU = 5, ldab = KL + KU + 2;
+      std::vector<float> AB(ldab * M);
+      fill(AB, 10);
+      fill(Y, 10);
+      Y_cblas = Y;
+      EXPECT_EQ(cpu.hcblas_sgbmv(av, orders[o], trans[t], M, N, KL, KU, alpha,
+                                 AB.data(), 0, ldab, X.data(), 0, 1, 0,
+                                 Y.data(), 0, 1),
+                HCBLAS_SUCCEEDS);
+      cblas_sgbmv(cblasOrders[o], cblasTrans[t], M, N, KL, KU, alpha,
+                  AB.data(), ldab, X.data(), 1, 0, Y_cblas.data(), 1);
+      expect_close(Y, Y_cblas, 1e-5);
+    }
+
+    // SGER with a negative increment
+    std::vector<float> A2 = A, A2_cblas = A;
+    EXPECT_EQ(cpu.hcblas_sger(av, orders[o], M, N, alpha, X.data(), 0, 1,
+                              Y.data(), 0, -2, A2.data(), 0, M),
+              HCBLAS_SUCCEEDS);
+    cblas_sger(cblasOrders[o], M, N, alpha, X.data(), 1, Y.data(), -2,
+               A2_cblas.data(), M);
+    expect_close(A2, A2_cblas, 1e-5);
+
+    // SSBMV with K = 4
+    for (int u = 0; u < 2; u++) {
+      fill(Y, 10);
+      std::vector<float> Y_cblas = Y;
+      EXPECT_EQ(cpu.hcblas_ssbmv(av, orders[o], uplos[u], N, 4, alpha,
+                                 A.data(), 0, 6, X.data(), 0, 1, beta,
+                                 Y.data(), 0, 1),
+                HCBLAS_SUCCEEDS);
+      cblas_ssbmv(cblasOrders[o], cblasUplos[u], N, 4, alpha, A.data(), 6,
+                  X.data(), 1, beta, Y_cblas.data(), 1);
+      expect_close(Y, Y_cblas, 1e-5);
+    }
+  }
+
+  EXPECT_EQ(cpu.hcblas_ssymv(av, ColMajor, Upper, N, alpha, A.data(), 0,
+                             N - 1, X.data(), 0, 1, beta, Y.data(), 0, 1),
+            HCBLAS_INVALID);
+}
+
+TEST(hcblas_cpu_backend, return_correct_sgemm_cpu) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  HcblasCpuLibrary cpu(&av);
+  // More than one cache block in every dimension, none of them full
+  const int M = 301, N = 140, K = 517;
+  float alpha = 1.5, beta = 0.5;
+  hcblasOrder orders[2] = {ColMajor, RowMajor};
+  CBLAS_ORDER cblasOrders[2] = {CblasColMajor, CblasRowMajor};
+  hcblasTranspose trans[2] = {NoTrans, Trans};
+  CBLAS_TRANSPOSE cblasTrans[2] = {CblasNoTrans, CblasTrans};
+  std::vector<float> A(K * M + 8), B(K * N + 8), C(M * N + 8);
+  fill(A, 10);
+  fill(B, 15);
+  // Every kernel set the host supports: each has its own mr x nr edges
+  const char *isas[8];
+  int isaCount = hcblasCpuIsas(isas, 8);
+  ASSERT_GE(isaCount, 1);
+  const char *picked = hcblasCpuIsa();
+  for (int s = 0; s < isaCount; s++) {
+    SCOPED_TRACE(isas[s]);
+    ASSERT_TRUE(hcblasCpuUseIsa(isas[s]));
+    EXPECT_STREQ(hcblasCpuIsa(), isas[s]);
+    for (int o = 0; o < 2; o++) {
+      for (int ta = 0; ta < 2; ta++) {
+        for (int tb = 0; tb < 2; tb++) {
+          bool col = o == 0;
+          int lda = ((ta == 0) == col) ? M : K;
+          int ldb = ((tb == 0) == col) ? K : N;
+          int ldc = col ? M : N;
+          fill(C, 10);
+          std::vector<float> C_cblas = C;
+          EXPECT_EQ(cpu.hcblas_sgemm(av, orders[o], trans[ta], trans[tb], M,
+                                     N, K, alpha, A.data(), lda, B.data(),
+                                     ldb, beta, C.data(), ldc, 3, 5, 7),
+                    HCBLAS_SUCCEEDS);
+          cblas_sgemm(cblasOrders[o], cblasTrans[ta], cblasTrans[tb], M, N,
+                      K, alpha, &A[3], lda, &B[5], ldb, beta, &C_cblas[7],
+                      ldc);
+          expect_close(C, C_cblas, 1e-5);
+        }
+      }
+    }
+  }
+  EXPECT_TRUE(hcblasCpuUseIsa(picked));
+  EXPECT_FALSE(hcblasCpuUseIsa("none"));
+  EXPECT_STREQ(hcblasCpuIsa(), picked);
+
+  // alpha == 0 only scales C
+  fill(C, 10);
+  std::vector<float> C_scaled = C;
+  for (size_t i = 0; i < C.size(); i++) {
+    C_scaled[i] *= (i < M * N) ? beta : 1;
+  }
+  EXPECT_EQ(cpu.hcblas_sgemm(av, ColMajor, NoTrans, NoTrans, M, N, K, 0,
+                             A.data(), M, B.data(), K, beta, C.data(), M, 0,
+                             0, 0),
+            HCBLAS_SUCCEEDS);
+  expect_close(C, C_scaled, 0);
+
+  // Batched double precision with one offset shared by the batch
+  const int batchSize = 3;
+  std::vector<double> dA[batchSize], dB[batchSize], dC[batchSize];
+  std::vector<double> dC_cblas[batchSize];
+  double *pA[batchSize], *pB[batchSize], *pC[batchSize];
+  for (int b = 0; b < batchSize; b++) {
+    dA[b].resize(M * K + 4);
+    dB[b].resize(K * N + 4);
+    dC[b].resize(M * N + 4);
+    for (size_t i = 0; i < dA[b].size(); i++) {
+      dA[b][i] = rand_r(&global_seed) % 7;
+    }
+    for (size_t i = 0; i < dB[b].size(); i++) {
+      dB[b][i] = rand_r(&global_seed) % 9;
+    }
+    for (size_t i = 0; i < dC[b].size(); i++) {
+      dC[b][i] = rand_r(&global_seed) % 5;
+    }
+    dC_cblas[b] = dC[b];
+    pA[b] = dA[b].data();
+    pB[b] = dB[b].data();
+    pC[b] = dC[b].data();
+  }
+  EXPECT_EQ(cpu.hcblas_dgemm(av, RowMajor, Trans, NoTrans, M, N, K, 2.0, pA, M,
+                             2, pB, N, 2, 0.5, pC, N, 2, 1, 1, 1, batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    cblas_dgemm(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 2.0,
+                &dA[b][3], M, &dB[b][3], N, 0.5, &dC_cblas[b][3], N);
+    for (size_t i = 0; i < dC[b].size(); i++) {
+      EXPECT_EQ(dC[b][i], dC_cblas[b][i]);
+    }
+  }
+
+  EXPECT_EQ(cpu.hcblas_sgemm(av, ColMajor, NoTrans, NoTrans, M, N, 0, alpha,
+                             A.data(), M, B.data(), K, beta, C.data(), M, 0,
+                             0, 0),
+            HCBLAS_INVALID);
+}
+
+TEST(hcblas_cpu_backend, return_correct_gemmex_cpu) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  HcblasCpuLibrary cpu(&av);
+  const int M = 70, N = 45, K = 300;
+  std::vector<hcBfloat16> A(M * K), B(K * N);
+  std::vector<float> Af(M * K), Bf(K * N), bias(M), C(M * N), aux(M * N);
+  for (int i = 0; i < M * K; i++) {
+    A[i] = hcblasFloatToBfloat16((rand_r(&global_seed) % 16 - 8) / 4.0f);
+    Af[i] = hcblasBfloat16ToFloat(A[i]);
+  }
+  for (int i = 0; i < K * N; i++) {
+    B[i] = hcblasFloatToBfloat16((rand_r(&global_seed) % 16 - 8) / 4.0f);
+    Bf[i] = hcblasBfloat16ToFloat(B[i]);
+  }
+  fill(bias, 20);
+  fill(C, 10);
+  float alpha = 0.5f, beta = 2.0f;
+
+  // Row major C = relu(alpha * A * B + beta * C + bias per row), aux before
+  // the activation
+  hcblasEpilogue ep = {bias.data(), PerRow, NULL, PerRow, ActivationRelu,
+                       0, 0, aux.data(), 0, N};
+  std::vector<float> expected = C, expectedAux(M * N);
+  cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              Af.data(), K, Bf.data(), N, beta, expected.data(), N);
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      float v = expected[i * N + j] + bias[i];
+      expectedAux[i * N + j] = v;
+      expected[i * N + j] = v > 0 ? v : 0;
+    }
+  }
+  EXPECT_TRUE(cpu.hcblas_gemmex_supported(Bfloat16Type, Bfloat16Type,
+                                          FloatType, FloatType, true));
+  EXPECT_EQ(cpu.hcblas_gemmex(av, RowMajor, NoTrans, NoTrans, M, N, K, &alpha,
+                              A.data(), Bfloat16Type, 0, K, B.data(),
+                              Bfloat16Type, 0, N, &beta, C.data(), FloatType,
+                              0, N, FloatType, &ep),
+            HCBLAS_SUCCEEDS);
+  expect_close(C, expected, 1e-5);
+  expect_close(aux, expectedAux, 1e-5);
+
+  // The same combinations as the HCC backend accept an epilogue
+  EXPECT_FALSE(cpu.hcblas_gemmex_supported(DoubleType, DoubleType, DoubleType,
+                                           DoubleType, true));
+  EXPECT_EQ(cpu.hcblas_gemmex(av, RowMajor, NoTrans, NoTrans, M, N, K, &alpha,
+                              A.data(), Bfloat16Type, 0, K, B.data(),
+                              Bfloat16Type, 0, N, &beta, C.data(), FloatType,
+                              0, N, DoubleType, NULL),
+            HCBLAS_INVALID);
+
+  // IGEMM requantised per column of a column major C
+  std::vector<signed char> A8(M * K), B8(K * N), C8(M * N);
+  std::vector<float> scale(N);
+  std::vector<int> zeroPoint(N);
+  for (int i = 0; i < M * K; i++) A8[i] = rand_r(&global_seed) % 255 - 127;
+  for (int i = 0; i < K * N; i++) B8[i] = rand_r(&global_seed) % 255 - 127;
+  for (int j = 0; j < N; j++) {
+    scale[j] = 1.0f / (512 << (j % 4));
+    zeroPoint[j] = j % 5 - 2;
+  }
+  EXPECT_EQ(cpu.hcblas_igemm_requant(av, ColMajor, Trans, NoTrans, M, N, K,
+                                     A8.data(), K, B8.data(), K, C8.data(), M,
+                                     PerColumn, scale.data(), zeroPoint.data(),
+                                     0, 0, 0),
+            HCBLAS_SUCCEEDS);
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < M; i++) {
+      int acc = 0;
+      for (int k = 0; k < K; k++) {
+        acc += A8[i * K + k] * B8[j * K + k];
+      }
+      float v = acc * scale[j] + zeroPoint[j];
+      v += (v < 0) ? -0.5f : 0.5f;
+      v = v > 127 ? 127 : (v < -128 ? -128 : v);
+      EXPECT_EQ(C8[j * M + i], static_cast<signed char>(v));
+    }
+  }
+}
+
+TEST(hcblas_cpu_backend, return_correct_cpu_handle) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  EXPECT_EQ(hcblasCreateWithBackend(&handle, &av, HCBLAS_BACKEND_CPU),
+            HCBLAS_STATUS_SUCCESS);
+  hcblasBackend_t backend = HCBLAS_BACKEND_DEFAULT;
+  EXPECT_EQ(hcblasGetBackend(handle, &backend), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(backend, HCBLAS_BACKEND_CPU);
+  EXPECT_EQ(hcblasGetBackend(handle, NULL), HCBLAS_STATUS_INVALID_VALUE);
+
+  // The C API runs on host memory through the handle
+  const int M = 33, N = 21, K = 17;
+  float alpha = 1, beta = 0;
+  std::vector<float> A(M * K), B(K * N), C(M * N), C_cblas(M * N);
+  fill(A, 10);
+  fill(B, 10);
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        A.data(), M, B.data(), K, &beta, C.data(), M),
+            HCBLAS_STATUS_SUCCESS);
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              A.data(), M, B.data(), K, beta, C_cblas.data(), M);
+  expect_close(C, C_cblas, 0);
+
+  // Calls on a CPU handle are never deferred
+  EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+
+  EXPECT_EQ(hcblasCreateWithBackend(&handle, &av, HCBLAS_BACKEND_HCC),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasGetBackend(handle, &backend), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(backend, HCBLAS_BACKEND_HCC);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,177 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_decision_cache.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Key and value of test entry i; the value encodes every key word so that a
+// value read together with the wrong key shows
+static hcblasDecisionKey entry_key(int i) {
+  return hcblasGemmKey(FloatType, 0, ColMajor, NoTrans, Trans, false, i,
+                       i + 1, i + 2, i + 3, i + 4, i + 5, i & 0x3f);
+}
+
+static uint64_t entry_value(const hcblasDecisionKey &key) {
+  uint64_t value = 0;
+  for (int w = 0; w < HCBLAS_DECISION_KEY_WORDS; w++) {
+    value = value * 31 + key.word[w];
+  }
+  return value;
+}
+
+TEST(hcblas_decision_cache, return_correct_key) {
+  hcblasDecisionKey key = entry_key(7);
+  EXPECT_EQ(key.hash(), entry_key(7).hash());
+  // Every field of the signature takes part
+  EXPECT_NE(key.word[0], hcblasGemmKey(DoubleType, 0, ColMajor, NoTrans,
+                                       Trans, false, 7, 8, 9, 10, 11, 12,
+                                       7).word[0]);
+  EXPECT_NE(key.word[0], hcblasGemmKey(FloatType, 1, ColMajor, NoTrans,
+                                       Trans, false, 7, 8, 9, 10, 11, 12,
+                                       7).word[0]);
+  EXPECT_NE(key.word[0], hcblasGemmKey(FloatType, 0, ColMajor, NoTrans,
+                                       Trans, true, 7, 8, 9, 10, 11, 12,
+                                       7).word[0]);
+  EXPECT_NE(key.word[1], hcblasGemmKey(FloatType, 0, ColMajor, NoTrans,
+                                       Trans, false, 8, 7, 9, 10, 11, 12,
+                                       7).word[1]);
+
+  float data[8] __attribute__((aligned(16)));
+  EXPECT_EQ(hcblasOperandAlignment(data, 0, 4, sizeof(float)), 3u);
+  EXPECT_EQ(hcblasOperandAlignment(data, 0, 3, sizeof(float)), 1u);
+  EXPECT_EQ(hcblasOperandAlignment(data, 1, 4, sizeof(float)), 0u);
+  EXPECT_EQ(hcblasOperandAlignment(data, 2, 2, sizeof(double)), 3u);
+}
+
+TEST(hcblas_decision_cache, return_correct_find_insert) {
+  hcblasDecisionCache<uint64_t, 16> cache;
+  uint64_t value = 0;
+  EXPECT_FALSE(cache.find(entry_key(1), &value));
+  cache.insert(entry_key(1), 42);
+  EXPECT_TRUE(cache.find(entry_key(1), &value));
+  EXPECT_EQ(value, 42);
+  EXPECT_FALSE(cache.find(entry_key(2), &value));
+  EXPECT_EQ(cache.hits(), 1);
+  EXPECT_EQ(cache.misses(), 2);
+
+  // A full cache keeps working, evicting older entries
+  for (int i = 0; i < 100; i++) {
+    cache.insert(entry_key(i), entry_value(entry_key(i)));
+  }
+  EXPECT_TRUE(cache.find(entry_key(99), &value));
+  EXPECT_EQ(value, entry_value(entry_key(99)));
+}
+
+// Threads look up and insert overlapping keys in a cache too small to hold
+// them: a hit must never return another key's value and every lookup is
+// counted once
+TEST(hcblas_decision_cache, return_correct_concurrent_access) {
+  hcblasDecisionCache<uint64_t, 16> cache;
+  const int threads = 8, lookups = 20000, keys = 40;
+  std::atomic<int> wrong(0), found(0);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.push_back(std::thread([&cache, &wrong, &found, t] {
+      for (int n = 0; n < lookups; n++) {
+        hcblasDecisionKey key = entry_key((n * (t + 1) + t) % keys);
+        uint64_t value;
+        if (cache.find(key, &value)) {
+          found++;
+          if (value != entry_value(key)) wrong++;
+        } else {
+          cache.insert(key, entry_value(key));
+        }
+      }
+    }));
+  }
+  for (int t = 0; t < threads; t++) {
+    pool[t].join();
+  }
+  EXPECT_EQ(wrong, 0);
+  EXPECT_GT(found, 0);
+  EXPECT_EQ(cache.hits(), found);
+  EXPECT_EQ(cache.hits() + cache.misses(), threads * lookups);
+}
+
+TEST(hcblas_decision_cache, return_correct_sgemm_stats) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  int M = 20, N = 12, K = 8;
+  float alpha = 1.0f, beta = 0.0f;
+  std::vector<float> A(M * K, 1.0f), B(K * N, 2.0f), C(M * N);
+  float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(B.data(), devB, sizeof(float) * B.size());
+
+  unsigned long long hits = 1, misses = 1;
+  EXPECT_EQ(hcblasGetGemmCacheStats(NULL, &hits, &misses),
+            HCBLAS_STATUS_NOT_INITIALIZED);
+  EXPECT_EQ(hcblasGetGemmCacheStats(handle, NULL, &misses),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasGetGemmCacheStats(handle, &hits, &misses),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hits, 0);
+  EXPECT_EQ(misses, 0);
+
+  // The first call selects its kernel, repeats reuse it
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                          devA, M, devB, K, &beta, devC, M),
+              HCBLAS_STATUS_SUCCESS);
+    av.copy(devC, C.data(), sizeof(float) * C.size());
+    for (int j = 0; j < C.size(); j++) {
+      EXPECT_EQ(C[j], 2.0f * K);
+    }
+  }
+  EXPECT_EQ(hcblasGetGemmCacheStats(handle, &hits, &misses),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hits, 2);
+  EXPECT_EQ(misses, 1);
+
+  // Another shape or transpose is a decision of its own
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M - 1, N, K,
+                        &alpha, devA, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_T, M, K, K, &alpha,
+                        devA, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasGetGemmCacheStats(handle, &hits, &misses),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hits, 2);
+  EXPECT_EQ(misses, 3);
+
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblaslib.h"
+#include "include/hcblas_device.h"
+#include "include/hcblas_splitk.h"
+#include "gtest/gtest.h"
+
+unsigned int global_seed = 100;
+
+// A 64 CU part with a smaller register file than the default profile
+static hcblasDeviceProps large_profile() {
+  hcblasDeviceProps props = hcblasDefaultDeviceProps();
+  props.computeUnits = 64;
+  props.maxWavesPerSimd = 8;
+  props.ldsBytesPerCU = 32768;
+  props.maxLdsPerGroup = 32768;
+  return props;
+}
+
+TEST(hcblas_device, return_correct_occupancy) {
+  hcblasDeviceProps props = hcblasDefaultDeviceProps();
+  EXPECT_EQ(props.computeUnits, 40);
+  EXPECT_EQ(props.wavefrontSize, 64);
+
+  // 256 work items are four waves: 40 wave slots hold ten groups
+  hcblasKernelResources kernel = {256, 0, 0};
+  EXPECT_EQ(hcblasGroupsPerCU(props, kernel), 10);
+  EXPECT_EQ(hcblasResidentGroups(props, kernel), 400);
+
+  // Small groups run into the per CU group limit
+  kernel.groupSize = 64;
+  EXPECT_EQ(hcblasGroupsPerCU(props, kernel), 16);
+
+  // Registers: 64 per lane leaves four waves per SIMD
+  kernel.groupSize = 256;
+  kernel.vgprs = 64;
+  EXPECT_EQ(hcblasGroupsPerCU(props, kernel), 4);
+
+  // LDS: 16KB per group fits four times in 64KB
+  kernel.vgprs = 0;
+  kernel.ldsBytes = 16384;
+  EXPECT_EQ(hcblasGroupsPerCU(props, kernel), 4);
+
+  // The same kernel on a different profile
+  hcblasDeviceProps large = large_profile();
+  EXPECT_EQ(hcblasGroupsPerCU(large, kernel), 2);
+  EXPECT_EQ(hcblasResidentGroups(large, kernel), 128);
+  kernel.ldsBytes = 0;
+  EXPECT_EQ(hcblasGroupsPerCU(large, kernel), 8);
+  EXPECT_EQ(hcblasResidentGroups(large, kernel), 512);
+
+  // Kernels the device cannot launch
+  kernel.ldsBytes = 40000;
+  EXPECT_EQ(hcblasGroupsPerCU(large, kernel), 0);
+  EXPECT_EQ(hcblasResidentGroups(large, kernel), 0);
+  kernel.ldsBytes = 0;
+  kernel.groupSize = 0;
+  EXPECT_EQ(hcblasGroupsPerCU(props, kernel), 0);
+  kernel.groupSize = 256;
+  kernel.vgprs = 512;
+  EXPECT_EQ(hcblasGroupsPerCU(props, kernel), 0);
+}
+
+TEST(hcblas_device, return_correct_splitk_decision_per_profile) {
+  // 128 x 128 is 16 tiles: split on the 64 CU part, which holds 7 groups
+  // per CU (LDS bound), not on a single CU
+  hcblasKernelResources kernel = {256, 4224, 0};
+  hcblasDeviceProps small = hcblasDefaultDeviceProps();
+  small.computeUnits = 1;
+  hcblasDeviceProps large = large_profile();
+  hcblasSplitK p = hcblasSplitKPartition(
+      128, 128, 100000, 32, 32, 16, 256,
+      static_cast<int>(hcblasResidentGroups(small, kernel)));
+  EXPECT_EQ(p.splits, 1);
+  p = hcblasSplitKPartition(
+      128, 128, 100000, 32, 32, 16, 256,
+      static_cast<int>(hcblasResidentGroups(large, kernel)));
+  EXPECT_EQ(p.splits, 28);
+}
+
+TEST(hcblas_device, return_correct_grid_groups_per_profile) {
+  // A reduction with work for 4096 groups launches what the device holds
+  hcblasKernelResources kernel = {256, 1024, 0};
+  hcblasDeviceProps props = hcblasDefaultDeviceProps();
+  hcblasDeviceProps large = large_profile();
+  EXPECT_EQ(hcblasGridGroups(props, kernel, 4096, 1), 400);
+  EXPECT_EQ(hcblasGridGroups(large, kernel, 4096, 1), 512);
+
+  // Small problems launch only the groups they have work for
+  EXPECT_EQ(hcblasGridGroups(props, kernel, 3, 1), 3);
+
+  // Batches share the device, down to one group each
+  EXPECT_EQ(hcblasGridGroups(props, kernel, 4096, 8), 50);
+  EXPECT_EQ(hcblasGridGroups(props, kernel, 4096, 1000), 1);
+
+  // A kernel the device cannot hold still gets one group
+  kernel.ldsBytes = 40000;
+  EXPECT_EQ(hcblasGridGroups(large, kernel, 16, 1), 1);
+}
+
+TEST(hcblas_device, return_correct_cached_properties) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  hcblasDeviceProps props = hcblasDeviceProperties(accl);
+  EXPECT_GT(props.computeUnits, 0);
+  EXPECT_GT(props.wavefrontSize, 0);
+  EXPECT_GT(props.ldsBytesPerCU, 0u);
+  EXPECT_EQ(static_cast<unsigned int>(props.computeUnits),
+            accl.get_cu_count());
+  // The handle keeps the copy taken when it was created
+  EXPECT_EQ(hc.deviceProps.computeUnits, props.computeUnits);
+  EXPECT_EQ(hc.deviceProps.ldsBytesPerCU, props.ldsBytesPerCU);
+  EXPECT_EQ(hcblasDeviceProperties(accl).computeUnits, props.computeUnits);
+  // and dispatchers read that copy for launches on its own accelerator
+  hc.deviceProps.computeUnits = props.computeUnits + 1;
+  EXPECT_EQ(hc.deviceProperties(accl).computeUnits, props.computeUnits + 1);
+}
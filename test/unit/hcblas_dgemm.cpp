@@ -22,9 +22,15 @@ THE SOFTWARE.
 
 #include "include/hcblas.h"
 #include "include/hcblaslib.h"
+#include "include/hcblas_trace.h"
 #include "gtest/gtest.h"
 #include <cblas.h>
+#include <cmath>
 #include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
 #include <hc_am.hpp>
 
 unsigned int global_seed = 100;
@@ -1163,3 +1169,89 @@ TEST(hcblas_dgemm, func_correct_dgemm_Implementation_type_2) {
     hc::am_free(devCbatch);*/
 }
 
+
+// hcblasDgemm on the handle, checked against CBLAS
+static void dgemm_variant_check(hcblasHandle_t handle,
+                                hcblasOperation_t transa,
+                                hcblasOperation_t transb, int M, int N,
+                                int K) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  double alpha = 2, beta = 1;
+  int lda = (transa == HCBLAS_OP_N) ? M : K;
+  int ldb = (transb == HCBLAS_OP_N) ? K : N;
+  int ldc = M;
+  std::vector<double> A(M * K), B(K * N), C(M * N);
+  for (size_t i = 0; i < A.size(); i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (size_t i = 0; i < B.size(); i++) {
+    B[i] = rand_r(&global_seed) % 10;
+  }
+  for (size_t i = 0; i < C.size(); i++) {
+    C[i] = rand_r(&global_seed) % 10;
+  }
+  double *devA = hc::am_alloc(sizeof(double) * A.size(), accl, 0);
+  double *devB = hc::am_alloc(sizeof(double) * B.size(), accl, 0);
+  double *devC = hc::am_alloc(sizeof(double) * C.size(), accl, 0);
+  av.copy(A.data(), devA, sizeof(double) * A.size());
+  av.copy(B.data(), devB, sizeof(double) * B.size());
+  av.copy(C.data(), devC, sizeof(double) * C.size());
+  EXPECT_EQ(hcblasDgemm(handle, transa, transb, M, N, K, &alpha, devA, lda,
+                        devB, ldb, &beta, devC, ldc),
+            HCBLAS_STATUS_SUCCESS);
+  std::vector<double> result(C.size());
+  av.copy(devC, result.data(), sizeof(double) * C.size());
+  CBLAS_TRANSPOSE opA = (transa == HCBLAS_OP_N) ? CblasNoTrans : CblasTrans;
+  CBLAS_TRANSPOSE opB = (transb == HCBLAS_OP_N) ? CblasNoTrans : CblasTrans;
+  cblas_dgemm(CblasColMajor, opA, opB, M, N, K, alpha, A.data(), lda,
+              B.data(), ldb, beta, C.data(), ldc);
+  int errors = 0;
+  for (size_t i = 0; i < C.size(); i++) {
+    errors += std::fabs(result[i] - C[i]) > 1e-10 * std::fabs(C[i]);
+  }
+  EXPECT_EQ(errors, 0);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_dgemm, return_correct_dgemm_variants) {
+  char path[] = "/tmp/hcblas_variantsXXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  hcblasTraceConfigure(1, path, TraceJson);
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+
+  // Ragged shapes, each picked by the selectors for one variant
+  dgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_N, 67, 45, 29);
+  dgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_N, 521, 519, 43);
+  dgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_T, 71, 53, 37);
+  dgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_T, 523, 517, 43);
+  dgemm_variant_check(handle, HCBLAS_OP_T, HCBLAS_OP_N, 701, 131, 15);
+  dgemm_variant_check(handle, HCBLAS_OP_T, HCBLAS_OP_N, 1001, 997, 31);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hcblasTraceFlush();
+  hcblasTraceConfigure(0, NULL, TraceCsv);
+
+  std::ifstream log(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(log, line);) {
+    lines.push_back(line);
+  }
+  unlink(path);
+  const char *kernels[] = {"gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2",
+                           "gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4",
+                           "gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2",
+                           "gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4",
+                           "gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2",
+                           "gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS4"};
+  ASSERT_EQ(lines.size(), 6);
+  for (int i = 0; i < 6; i++) {
+    EXPECT_NE(lines[i].find(kernels[i]), std::string::npos) << lines[i];
+  }
+}
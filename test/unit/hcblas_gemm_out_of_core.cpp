@@ -0,0 +1,309 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_cpu.h"
+#include "include/hcblas_out_of_core.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+// Budget that gives tiles of 64 a side in float
+#define SMALLEST_BUDGET (5 * 64 * 64 * sizeof(float))
+
+static void fill(std::vector<float> &v) {
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = rand_r(&global_seed) % 10 - 5;
+  }
+}
+
+/* Records what the engine asks for and checks the pipeline rules as it
+ goes: a slot is only loaded once the multiply that last used it has been
+ drained, and a step is only multiplied once it has been loaded. */
+class recording_executor : public hcblasOutOfCoreExecutor {
+ public:
+  explicit recording_executor(int failAt = -1)
+      : failAt(failAt), multiplies(0), finished(0) {
+    for (int s = 0; s < 2; s++) {
+      filled[s] = false;
+      busy[s] = false;
+    }
+  }
+
+  bool load(const hcblasOutOfCoreStep &step) override {
+    EXPECT_FALSE(busy[step.slot]);
+    loaded[step.slot] = step;
+    filled[step.slot] = true;
+    return true;
+  }
+
+  bool multiply(const hcblasOutOfCoreStep &step) override {
+    EXPECT_TRUE(filled[step.slot] && loaded[step.slot].tile == step.tile &&
+                loaded[step.slot].k0 == step.k0);
+    busy[step.slot] = true;
+    order.push_back(step);
+    return multiplies++ != failAt;
+  }
+
+  bool drain(int slot) override {
+    busy[slot] = false;
+    return true;
+  }
+
+  bool finish() override {
+    busy[0] = busy[1] = false;
+    finished++;
+    return true;
+  }
+
+  int failAt;
+  int multiplies;
+  int finished;
+  std::vector<hcblasOutOfCoreStep> order;
+
+ private:
+  hcblasOutOfCoreStep loaded[2];
+  bool filled[2];
+  bool busy[2];
+};
+
+TEST(hcblas_gemm_out_of_core, return_correct_out_of_core_schedule) {
+  hcblasOutOfCoreSchedule schedule;
+  ASSERT_TRUE(schedule.build(300, 200, 500, sizeof(float), SMALLEST_BUDGET,
+                             0.25));
+  EXPECT_EQ(schedule.tileM(), 64);
+  EXPECT_EQ(schedule.tileN(), 64);
+  EXPECT_EQ(schedule.tileK(), 64);
+
+  // Every element of C is covered once; the last quarter of the tiles run
+  // on the host
+  const std::vector<hcblasOutOfCoreTile> &tiles = schedule.tiles();
+  ASSERT_EQ(tiles.size(), 5u * 4u);
+  EXPECT_EQ(schedule.hostTiles(), 5);
+  std::vector<int> seen(300 * 200, 0);
+  for (size_t t = 0; t < tiles.size(); t++) {
+    EXPECT_EQ(tiles[t].onHost, t >= 15);
+    for (int j = 0; j < tiles[t].cols; j++) {
+      for (int i = 0; i < tiles[t].rows; i++) {
+        seen[(tiles[t].col0 + j) * 300 + tiles[t].row0 + i]++;
+      }
+    }
+  }
+  for (size_t i = 0; i < seen.size(); i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+
+  // K is walked in steps of tileK with a short last one, slots alternate
+  std::vector<hcblasOutOfCoreStep> steps = schedule.steps(false);
+  ASSERT_EQ(steps.size(), 15u * 8u);
+  for (size_t s = 0; s < steps.size(); s++) {
+    EXPECT_EQ(steps[s].tile, static_cast<int>(s / 8));
+    EXPECT_EQ(steps[s].k0, static_cast<long long>(s % 8) * 64);
+    EXPECT_EQ(steps[s].depth, s % 8 == 7 ? 500 - 7 * 64 : 64);
+    EXPECT_EQ(steps[s].slot, static_cast<int>(s % 2));
+    EXPECT_EQ(steps[s].first, s % 8 == 0);
+    EXPECT_EQ(steps[s].last, s % 8 == 7);
+  }
+  EXPECT_EQ(schedule.steps(true).size(), 5u * 8u);
+
+  // A budget larger than the problem gives one tile of the whole of C
+  ASSERT_TRUE(schedule.build(300, 200, 500, sizeof(float), 1 << 30, 0));
+  EXPECT_EQ(schedule.tileM(), 300);
+  EXPECT_EQ(schedule.tileN(), 200);
+  EXPECT_EQ(schedule.tileK(), 500);
+  EXPECT_EQ(schedule.tiles().size(), 1u);
+
+  // Tiles always fit the budget and cut to multiples of 64
+  for (size_t bytes = 2 * SMALLEST_BUDGET; bytes < (64u << 20); bytes *= 3) {
+    ASSERT_TRUE(schedule.build(5000, 3000, 4000, sizeof(double), bytes, 0));
+    size_t needed = 2 * (schedule.tileM() * schedule.tileK() +
+                         schedule.tileK() * schedule.tileN()) +
+                    schedule.tileM() * schedule.tileN();
+    EXPECT_LE(needed * sizeof(double), bytes);
+    EXPECT_EQ(schedule.tileM() % 64, 0);
+    EXPECT_EQ(schedule.tileN() % 64, 0);
+    EXPECT_EQ(schedule.tileK() % 64, 0);
+  }
+
+  // Invalid arguments leave the schedule empty
+  EXPECT_FALSE(schedule.build(300, 200, 500, sizeof(float),
+                              SMALLEST_BUDGET - 1, 0));
+  EXPECT_EQ(schedule.tiles().size(), 0u);
+  EXPECT_FALSE(schedule.build(300, 200, 500, sizeof(float), 1 << 30, 1.5));
+  EXPECT_FALSE(schedule.build(0, 200, 500, sizeof(float), 1 << 30, 0));
+  EXPECT_FALSE(schedule.build(300, 200, 0, sizeof(float), 1 << 30, 0));
+}
+
+TEST(hcblas_gemm_out_of_core, return_correct_out_of_core_pipeline) {
+  hcblasOutOfCoreSchedule schedule;
+  ASSERT_TRUE(schedule.build(300, 200, 500, sizeof(float), SMALLEST_BUDGET,
+                             0.5));
+
+  // Each executor multiplies its own steps once, in order, and is left
+  // with nothing in flight
+  recording_executor device, host;
+  EXPECT_TRUE(hcblasOutOfCoreRun(schedule, &device, &host));
+  std::vector<hcblasOutOfCoreStep> deviceSteps = schedule.steps(false);
+  std::vector<hcblasOutOfCoreStep> hostSteps = schedule.steps(true);
+  ASSERT_EQ(device.order.size(), deviceSteps.size());
+  ASSERT_EQ(host.order.size(), hostSteps.size());
+  for (size_t s = 0; s < deviceSteps.size(); s++) {
+    EXPECT_EQ(device.order[s].tile, deviceSteps[s].tile);
+    EXPECT_EQ(device.order[s].k0, deviceSteps[s].k0);
+  }
+  for (size_t s = 0; s < hostSteps.size(); s++) {
+    EXPECT_EQ(host.order[s].tile, hostSteps[s].tile);
+    EXPECT_TRUE(schedule.tiles()[host.order[s].tile].onHost);
+  }
+  EXPECT_EQ(device.finished, 1);
+  EXPECT_EQ(host.finished, 1);
+
+  // Host tiles need a host executor
+  EXPECT_FALSE(hcblasOutOfCoreRun(schedule, &device, NULL));
+
+  // A failing step stops its executor, which is still finished
+  recording_executor failing(3), other;
+  EXPECT_FALSE(hcblasOutOfCoreRun(schedule, &failing, &other));
+  EXPECT_EQ(failing.multiplies, 4);
+  EXPECT_EQ(failing.finished, 1);
+  EXPECT_EQ(other.order.size(), hostSteps.size());
+}
+
+// The CPU executes every tile: a CPU handle through the C API, and the HCC
+// library with all tiles handed to the host
+TEST(hcblas_gemm_out_of_core, return_correct_sgemm_out_of_core_cpu) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreateWithBackend(&handle, &av, HCBLAS_BACKEND_CPU),
+            HCBLAS_STATUS_SUCCESS);
+  const int M = 301, N = 140, K = 517, lda = 520, ldb = 530, ldc = 305;
+  std::vector<float> A(lda * 520), B(ldb * 520), C(ldc * N);
+  fill(A);
+  fill(B);
+  fill(C);
+  float alpha = 2, beta = -1;
+  const hcblasOperation_t ops[2] = {HCBLAS_OP_N, HCBLAS_OP_T};
+  for (int ta = 0; ta < 2; ta++) {
+    for (int tb = 0; tb < 2; tb++) {
+      std::vector<float> result = C, expected = C;
+      EXPECT_EQ(hcblasSgemmOutOfCore(handle, ops[ta], ops[tb], M, N, K,
+                                     &alpha, A.data(), lda, B.data(), ldb,
+                                     &beta, result.data(), ldc,
+                                     SMALLEST_BUDGET, 0),
+                HCBLAS_STATUS_SUCCESS);
+      cblas_sgemm(CblasColMajor, ta ? CblasTrans : CblasNoTrans,
+                  tb ? CblasTrans : CblasNoTrans, M, N, K, alpha, A.data(),
+                  lda, B.data(), ldb, beta, expected.data(), ldc);
+      for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(result[i], expected[i]);
+      }
+    }
+  }
+
+  // beta == 0 ignores what C holds
+  std::vector<float> result(C.size(), NAN), expected = C;
+  float zero = 0;
+  EXPECT_EQ(hcblasSgemmOutOfCore(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K,
+                                 &alpha, A.data(), lda, B.data(), ldb, &zero,
+                                 result.data(), ldc, SMALLEST_BUDGET, 0),
+            HCBLAS_STATUS_SUCCESS);
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              A.data(), lda, B.data(), ldb, zero, expected.data(), ldc);
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < M; i++) {
+      EXPECT_EQ(result[j * ldc + i], expected[j * ldc + i]);
+    }
+  }
+
+  EXPECT_EQ(hcblasSgemmOutOfCore(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K,
+                                 &alpha, A.data(), lda, B.data(), ldb, &beta,
+                                 C.data(), ldc, SMALLEST_BUDGET - 1, 0),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasSgemmOutOfCore(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K,
+                                 &alpha, A.data(), lda, B.data(), ldb, &beta,
+                                 C.data(), ldc, 0, 2),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasSgemmOutOfCore(handle, HCBLAS_OP_N, HCBLAS_OP_N, 0, N, K,
+                                 &alpha, A.data(), lda, B.data(), ldb, &beta,
+                                 C.data(), ldc, 0, 0),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+
+  // Row major double precision, every tile handed to the host by an HCC
+  // library, so no device memory is touched
+  Hcblaslibrary hc(&av);
+  std::vector<double> dA(A.begin(), A.end()), dB(B.begin(), B.end());
+  std::vector<double> dC(M * ldc);
+  for (size_t i = 0; i < dC.size(); i++) {
+    dC[i] = i % 7;
+  }
+  std::vector<double> dExpected = dC;
+  EXPECT_EQ(hc.hcblas_dgemm_out_of_core(av, RowMajor, Trans, NoTrans, M,
+                                        ldc - 100, K, 0.5, dA.data(), lda,
+                                        dB.data(), ldb, 2.0, dC.data(), ldc,
+                                        5 * 64 * 64 * sizeof(double), 1.0f),
+            HCBLAS_SUCCEEDS);
+  cblas_dgemm(CblasRowMajor, CblasTrans, CblasNoTrans, M, ldc - 100, K, 0.5,
+              dA.data(), lda, dB.data(), ldb, 2.0, dExpected.data(), ldc);
+  for (size_t i = 0; i < dExpected.size(); i++) {
+    EXPECT_EQ(dC[i], dExpected[i]);
+  }
+}
+
+// Tiles split between the device and the host
+TEST(hcblas_gemm_out_of_core, return_correct_sgemm_out_of_core_split) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  const int M = 200, N = 150, K = 130;
+  std::vector<float> A(M * K), B(K * N), C(M * N);
+  fill(A);
+  fill(B);
+  fill(C);
+  const hcblasTranspose ops[2] = {NoTrans, Trans};
+  for (int ta = 0; ta < 2; ta++) {
+    for (int tb = 0; tb < 2; tb++) {
+      for (float fraction = 0; fraction <= 1; fraction += 0.5f) {
+        std::vector<float> result = C, expected = C;
+        int lda = ta ? K : M, ldb = tb ? N : K;
+        EXPECT_EQ(hc.hcblas_sgemm_out_of_core(
+                      av, ColMajor, ops[ta], ops[tb], M, N, K, 1.5f, A.data(),
+                      lda, B.data(), ldb, 0.5f, result.data(), M,
+                      SMALLEST_BUDGET, fraction),
+                  HCBLAS_SUCCEEDS);
+        cblas_sgemm(CblasColMajor, ta ? CblasTrans : CblasNoTrans,
+                    tb ? CblasTrans : CblasNoTrans, M, N, K, 1.5f, A.data(),
+                    lda, B.data(), ldb, 0.5f, expected.data(), M);
+        for (size_t i = 0; i < expected.size(); i++) {
+          EXPECT_EQ(result[i], expected[i]);
+        }
+      }
+    }
+  }
+}
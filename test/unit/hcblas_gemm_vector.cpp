@@ -0,0 +1,191 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_trace.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_gemm_vector, return_correct_alignment) {
+  float data[64] __attribute__((aligned(16)));
+  EXPECT_EQ(hcblasGemmAlignment(data, 0, 128, data, 4, 64, data, 8, 256,
+                                sizeof(float)),
+            HCBLAS_GEMM_VECTOR_ALIGNED);
+  // An offset or a leading dimension off the 16 byte grid rules it out
+  EXPECT_NE(hcblasGemmAlignment(data, 1, 128, data, 4, 64, data, 8, 256,
+                                sizeof(float)),
+            HCBLAS_GEMM_VECTOR_ALIGNED);
+  EXPECT_NE(hcblasGemmAlignment(data, 0, 128, data, 4, 66, data, 8, 256,
+                                sizeof(float)),
+            HCBLAS_GEMM_VECTOR_ALIGNED);
+  EXPECT_EQ(hcblasGemmAlignment(data, 2, 130, data, 4, 64, data, 0, 2,
+                                sizeof(double)),
+            HCBLAS_GEMM_VECTOR_ALIGNED);
+  EXPECT_NE(hcblasGemmAlignment(data, 2, 130, data, 4, 64, data, 0, 3,
+                                sizeof(double)),
+            HCBLAS_GEMM_VECTOR_ALIGNED);
+}
+
+static hcblasStatus gemm(Hcblaslibrary &hc, int M, int N, int K, float alpha,
+                         float *A, int lda, float *B, int ldb, float beta,
+                         float *C, int ldc, __int64_t aOffset,
+                         __int64_t bOffset, __int64_t cOffset) {
+  return hc.hcblas_sgemm(hc.currentAcclView, ColMajor, NoTrans, NoTrans, M, N,
+                         K, alpha, A, lda, B, ldb, beta, C, ldc, aOffset,
+                         bOffset, cOffset);
+}
+
+static hcblasStatus gemm(Hcblaslibrary &hc, int M, int N, int K, double alpha,
+                         double *A, int lda, double *B, int ldb, double beta,
+                         double *C, int ldc, __int64_t aOffset,
+                         __int64_t bOffset, __int64_t cOffset) {
+  return hc.hcblas_dgemm(hc.currentAcclView, ColMajor, NoTrans, NoTrans, M, N,
+                         K, alpha, A, lda, B, ldb, beta, C, ldc, aOffset,
+                         bOffset, cOffset);
+}
+
+static void cblas_gemm(int M, int N, int K, float alpha, const float *A,
+                       int lda, const float *B, int ldb, float beta, float *C,
+                       int ldc) {
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, A,
+              lda, B, ldb, beta, C, ldc);
+}
+
+static void cblas_gemm(int M, int N, int K, double alpha, const double *A,
+                       int lda, const double *B, int ldb, double beta,
+                       double *C, int ldc) {
+  cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, A,
+              lda, B, ldb, beta, C, ldc);
+}
+
+// NN product at the given offsets and leading dimensions, against CBLAS
+template <typename T>
+static void gemm_vector_check(Hcblaslibrary &hc, int M, int N, int K,
+                              int lda, int ldb, int ldc, __int64_t offset) {
+  T alpha = 2, beta = 0.5;
+  std::vector<T> A(offset + lda * K), B(offset + ldb * N);
+  std::vector<T> C(offset + ldc * N), C_hcblas(C.size());
+  for (size_t i = 0; i < A.size(); i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (size_t i = 0; i < B.size(); i++) {
+    B[i] = rand_r(&global_seed) % 15;
+  }
+  for (size_t i = 0; i < C.size(); i++) {
+    C[i] = rand_r(&global_seed) % 25;
+  }
+  T *devA = hc::am_alloc(sizeof(T) * A.size(), hc.currentAccl, 0);
+  T *devB = hc::am_alloc(sizeof(T) * B.size(), hc.currentAccl, 0);
+  T *devC = hc::am_alloc(sizeof(T) * C.size(), hc.currentAccl, 0);
+  hc::accelerator_view av = hc.currentAcclView;
+  av.copy(A.data(), devA, sizeof(T) * A.size());
+  av.copy(B.data(), devB, sizeof(T) * B.size());
+  av.copy(C.data(), devC, sizeof(T) * C.size());
+  EXPECT_EQ(gemm(hc, M, N, K, alpha, devA, lda, devB, ldb, beta, devC, ldc,
+                 offset, offset, offset),
+            HCBLAS_SUCCEEDS);
+  av.copy(devC, C_hcblas.data(), sizeof(T) * C.size());
+  cblas_gemm(M, N, K, alpha, A.data() + offset, lda, B.data() + offset, ldb,
+             beta, C.data() + offset, ldc);
+  for (size_t i = 0; i < C.size(); i++) {
+    EXPECT_EQ(C_hcblas[i], C[i]);
+  }
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_gemm_vector, return_correct_sgemm_vector) {
+  char path[] = "/tmp/hcblas_vectorXXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  hcblasTraceConfigure(1, path, TraceJson);
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  // Aligned operands take the vector variant, unaligned ones the scalar one
+  int M = 128, N = 128, K = 128;
+  std::vector<float> A(M * K + 1, 1.0f), B(K * N + 1, 2.0f), C(M * N + 1);
+  float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(B.data(), devB, sizeof(float) * B.size());
+  float alpha = 1.0f, beta = 0.0f;
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA + 1, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  av.copy(devC, C.data(), sizeof(float) * C.size());
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C[i], 2.0f * K);
+  }
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hcblasTraceFlush();
+  hcblasTraceConfigure(0, NULL, TraceCsv);
+
+  std::ifstream log(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(log, line);) {
+    lines.push_back(line);
+  }
+  unlink(path);
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_NE(lines[0].find("TS16XMTS2_MB2_VEC\""), std::string::npos)
+      << lines[0];
+  EXPECT_NE(lines[1].find("TS16XMTS2_MB2\""), std::string::npos) << lines[1];
+
+  // Padded leading dimensions and offsets, in and out of the vector grid,
+  // and a ragged shape whose interior runs the vector variant
+  Hcblaslibrary hc(&av);
+  gemm_vector_check<float>(hc, 128, 256, 128, 132, 136, 128, 4);
+  gemm_vector_check<float>(hc, 128, 256, 128, 130, 136, 128, 4);
+  gemm_vector_check<float>(hc, 128, 128, 128, 128, 128, 128, 3);
+  gemm_vector_check<float>(hc, 300, 270, 100, 300, 100, 300, 0);
+}
+
+TEST(hcblas_gemm_vector, return_correct_dgemm_vector) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  gemm_vector_check<double>(hc, 128, 256, 128, 130, 132, 128, 2);
+  gemm_vector_check<double>(hc, 128, 256, 128, 129, 132, 128, 2);
+  gemm_vector_check<double>(hc, 128, 128, 128, 128, 128, 128, 1);
+}
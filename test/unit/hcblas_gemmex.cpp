@@ -0,0 +1,275 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "./test_constants.h"
+#include "include/hcblaslib.h"
+#include "include/helper_functions.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cstdlib>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+// Column major host reference C = alpha * op(A) * op(B) + beta * C
+template <typename T>
+static void gemmex_ref(hcblasTranspose typeA, hcblasTranspose typeB, int M,
+                       int N, int K, T alpha, const T *A, int lda, const T *B,
+                       int ldb, T beta, T *C, int ldc) {
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < M; i++) {
+      T sum = 0;
+      for (int l = 0; l < K; l++) {
+        T a = (typeA == NoTrans) ? A[i + l * lda] : A[l + i * lda];
+        T b = (typeB == NoTrans) ? B[l + j * ldb] : B[j + l * ldb];
+        sum += a * b;
+      }
+      C[i + j * ldc] = alpha * sum + beta * C[i + j * ldc];
+    }
+  }
+}
+
+TEST(hcblas_gemmex, return_correct_gemmex_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 67, N = 41, K = 29;
+  float alpha = 2, beta = 1;
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  // fp16 inputs accumulated and stored in fp32
+  hc::half* A = (hc::half*)calloc(M * K, sizeof(hc::half));
+  hc::half* B = (hc::half*)calloc(K * N, sizeof(hc::half));
+  float* Af = (float*)calloc(M * K, sizeof(float));
+  float* Bf = (float*)calloc(K * N, sizeof(float));
+  float* C = (float*)calloc(M * N, sizeof(float));
+  float* C_cblas = (float*)calloc(M * N, sizeof(float));
+  hc::half* devA = hc::am_alloc(sizeof(hc::half) * M * K, acc, 0);
+  hc::half* devB = hc::am_alloc(sizeof(hc::half) * K * N, acc, 0);
+  float* devC = hc::am_alloc(sizeof(float) * M * N, acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    Af[i] = rand_r(&global_seed) % 10;
+    A[i] = Af[i];
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    Bf[i] = rand_r(&global_seed) % 10;
+    B[i] = Bf[i];
+  }
+
+  for (int i = 0; i < M * N; i++) {
+    C[i] = rand_r(&global_seed) % 25;
+    C_cblas[i] = C[i];
+  }
+
+  accl_view.copy(A, devA, M * K * sizeof(hc::half));
+  accl_view.copy(B, devB, K * N * sizeof(hc::half));
+  accl_view.copy(C, devC, M * N * sizeof(float));
+  // NoTransA and TransB, column major
+  status = hc.hcblas_gemmex(accl_view, ColMajor, NoTrans, Trans, M, N, K,
+                            &alpha, devA, HalfType, aOffset, M, devB, HalfType,
+                            bOffset, N, &beta, devC, FloatType, cOffset, M,
+                            FloatType);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devC, C, M * N * sizeof(float));
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, Af, M,
+              Bf, N, beta, C_cblas, M);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C[i], C_cblas[i]);
+  }
+
+  // Unsupported type combination
+  status = hc.hcblas_gemmex(accl_view, ColMajor, NoTrans, Trans, M, N, K,
+                            &alpha, devA, HalfType, aOffset, M, devB,
+                            DoubleType, bOffset, N, &beta, devC, FloatType,
+                            cOffset, M, FloatType);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  // alpha is NULL
+  status = hc.hcblas_gemmex(accl_view, ColMajor, NoTrans, Trans, M, N, K,
+                            NULL, devA, HalfType, aOffset, M, devB, HalfType,
+                            bOffset, N, &beta, devC, FloatType, cOffset, M,
+                            FloatType);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+
+  free(A);
+  free(B);
+  free(Af);
+  free(Bf);
+  free(C);
+  free(C_cblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_gemmex, return_correct_gemmex_Implementation_type_2) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 70, N = 33, K = 131;
+  int alpha = 1, beta = 3;
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  // int8 inputs accumulated and stored in int32
+  signed char* A = (signed char*)calloc(M * K, sizeof(signed char));
+  signed char* B = (signed char*)calloc(K * N, sizeof(signed char));
+  int* Ai = (int*)calloc(M * K, sizeof(int));
+  int* Bi = (int*)calloc(K * N, sizeof(int));
+  int* C = (int*)calloc(M * N, sizeof(int));
+  int* C_ref = (int*)calloc(M * N, sizeof(int));
+  signed char* devA = hc::am_alloc(sizeof(signed char) * M * K, acc, 0);
+  signed char* devB = hc::am_alloc(sizeof(signed char) * K * N, acc, 0);
+  int* devC = hc::am_alloc(sizeof(int) * M * N, acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    A[i] = rand_r(&global_seed) % 256 - 128;
+    Ai[i] = A[i];
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    B[i] = rand_r(&global_seed) % 256 - 128;
+    Bi[i] = B[i];
+  }
+
+  for (int i = 0; i < M * N; i++) {
+    C[i] = rand_r(&global_seed) % 1000 - 500;
+    C_ref[i] = C[i];
+  }
+
+  accl_view.copy(A, devA, M * K * sizeof(signed char));
+  accl_view.copy(B, devB, K * N * sizeof(signed char));
+  accl_view.copy(C, devC, M * N * sizeof(int));
+  // TransA and NoTransB, column major
+  status = hc.hcblas_gemmex(accl_view, ColMajor, Trans, NoTrans, M, N, K,
+                            &alpha, devA, Int8Type, aOffset, K, devB, Int8Type,
+                            bOffset, K, &beta, devC, Int32Type, cOffset, M,
+                            Int32Type);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devC, C, M * N * sizeof(int));
+  gemmex_ref<int>(Trans, NoTrans, M, N, K, alpha, Ai, K, Bi, K, beta, C_ref,
+                  M);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C[i], C_ref[i]);
+  }
+
+  free(A);
+  free(B);
+  free(Ai);
+  free(Bi);
+  free(C);
+  free(C_ref);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_gemmex, return_correct_gemmex_Implementation_type_3) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 53, N = 71, K = 37;
+  float alpha = 1, beta = 2;
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  // bfloat16 inputs accumulated in fp32, stored in bfloat16 and in fp32
+  hcBfloat16* A = (hcBfloat16*)calloc(M * K, sizeof(hcBfloat16));
+  hcBfloat16* B = (hcBfloat16*)calloc(K * N, sizeof(hcBfloat16));
+  hcBfloat16* C = (hcBfloat16*)calloc(M * N, sizeof(hcBfloat16));
+  float* Af = (float*)calloc(M * K, sizeof(float));
+  float* Bf = (float*)calloc(K * N, sizeof(float));
+  float* Cf = (float*)calloc(M * N, sizeof(float));
+  float* C_cblas = (float*)calloc(M * N, sizeof(float));
+  hcBfloat16* devA = hc::am_alloc(sizeof(hcBfloat16) * M * K, acc, 0);
+  hcBfloat16* devB = hc::am_alloc(sizeof(hcBfloat16) * K * N, acc, 0);
+  hcBfloat16* devC = hc::am_alloc(sizeof(hcBfloat16) * M * N, acc, 0);
+  float* devCf = hc::am_alloc(sizeof(float) * M * N, acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    Af[i] = rand_r(&global_seed) % 10;
+    A[i] = hcblasFloatToBfloat16(Af[i]);
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    Bf[i] = rand_r(&global_seed) % 10;
+    B[i] = hcblasFloatToBfloat16(Bf[i]);
+  }
+
+  for (int i = 0; i < M * N; i++) {
+    Cf[i] = rand_r(&global_seed) % 25;
+    C[i] = hcblasFloatToBfloat16(Cf[i]);
+    C_cblas[i] = Cf[i];
+  }
+
+  accl_view.copy(A, devA, M * K * sizeof(hcBfloat16));
+  accl_view.copy(B, devB, K * N * sizeof(hcBfloat16));
+  accl_view.copy(C, devC, M * N * sizeof(hcBfloat16));
+  accl_view.copy(Cf, devCf, M * N * sizeof(float));
+  cblas_sgemm(CblasColMajor, CblasTrans, CblasNoTrans, M, N, K, alpha, Af, K,
+              Bf, K, beta, C_cblas, M);
+  // TransA and NoTransB, fp32 output
+  status = hc.hcblas_gemmex(accl_view, ColMajor, Trans, NoTrans, M, N, K,
+                            &alpha, devA, Bfloat16Type, aOffset, K, devB,
+                            Bfloat16Type, bOffset, K, &beta, devCf, FloatType,
+                            cOffset, M, FloatType);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devCf, Cf, M * N * sizeof(float));
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(Cf[i], C_cblas[i]);
+  }
+
+  // bfloat16 output is the fp32 result rounded to nearest even
+  status = hc.hcblas_gemmex(accl_view, ColMajor, Trans, NoTrans, M, N, K,
+                            &alpha, devA, Bfloat16Type, aOffset, K, devB,
+                            Bfloat16Type, bOffset, K, &beta, devC,
+                            Bfloat16Type, cOffset, M, FloatType);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devC, C, M * N * sizeof(hcBfloat16));
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C[i].data, hcblasFloatToBfloat16(C_cblas[i]).data);
+  }
+
+  free(A);
+  free(B);
+  free(C);
+  free(Af);
+  free(Bf);
+  free(Cf);
+  free(C_cblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  hc::am_free(devCf);
+}
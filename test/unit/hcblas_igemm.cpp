@@ -0,0 +1,221 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "./test_constants.h"
+#include "include/hcblaslib.h"
+#include "include/helper_functions.h"
+#include "gtest/gtest.h"
+#include <cstdlib>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+// Column major host reference of the int32 product op(A) * op(B)
+static int igemm_ref(hcblasTranspose typeA, hcblasTranspose typeB,
+                     const signed char *A, int lda, const signed char *B,
+                     int ldb, int K, int i, int j) {
+  int sum = 0;
+  for (int l = 0; l < K; l++) {
+    int a = (typeA == NoTrans) ? A[i + l * lda] : A[l + i * lda];
+    int b = (typeB == NoTrans) ? B[l + j * ldb] : B[j + l * ldb];
+    sum += a * b;
+  }
+  return sum;
+}
+
+TEST(hcblas_igemm, return_correct_igemm_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 75, N = 41, K = 132;
+  int alpha = 2, beta = 3;
+  __int64_t lda, ldb, ldc;
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  // Implementation type I - Inputs and Outputs are HCC device pointers
+  signed char* A = (signed char*)calloc(M * K, sizeof(signed char));
+  signed char* B = (signed char*)calloc(K * N, sizeof(signed char));
+  int* C = (int*)calloc(M * N, sizeof(int));
+  int* C_hcblas = (int*)calloc(M * N, sizeof(int));
+  signed char* devA = hc::am_alloc(sizeof(signed char) * M * K, acc, 0);
+  signed char* devB = hc::am_alloc(sizeof(signed char) * K * N, acc, 0);
+  int* devC = hc::am_alloc(sizeof(int) * M * N, acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    A[i] = rand_r(&global_seed) % 256 - 128;
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    B[i] = rand_r(&global_seed) % 256 - 128;
+  }
+
+  for (int i = 0; i < M * N; i++) {
+    C[i] = rand_r(&global_seed) % 1000 - 500;
+  }
+
+  accl_view.copy(A, devA, M * K * sizeof(signed char));
+  accl_view.copy(B, devB, K * N * sizeof(signed char));
+
+  // All transpose combinations, column major
+  hcblasTranspose trans[2] = {NoTrans, Trans};
+  for (int ta = 0; ta < 2; ta++) {
+    for (int tb = 0; tb < 2; tb++) {
+      lda = (trans[ta] == NoTrans) ? M : K;
+      ldb = (trans[tb] == NoTrans) ? K : N;
+      ldc = M;
+      accl_view.copy(C, devC, M * N * sizeof(int));
+      status = hc.hcblas_igemm(accl_view, ColMajor, trans[ta], trans[tb], M, N,
+                               K, alpha, devA, lda, devB, ldb, beta, devC, ldc,
+                               aOffset, bOffset, cOffset);
+      EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+      accl_view.copy(devC, C_hcblas, M * N * sizeof(int));
+      for (int j = 0; j < N; j++) {
+        for (int i = 0; i < M; i++) {
+          EXPECT_EQ(C_hcblas[i + j * ldc],
+                    alpha * igemm_ref(trans[ta], trans[tb], A, lda, B, ldb, K,
+                                      i, j) +
+                        beta * C[i + j * ldc]);
+        }
+      }
+    }
+  }
+
+  // Row major with K not a multiple of the packed word
+  int Kr = K - 3;
+  lda = Kr;
+  ldb = N;
+  ldc = N;
+  accl_view.copy(C, devC, M * N * sizeof(int));
+  status = hc.hcblas_igemm(accl_view, RowMajor, NoTrans, NoTrans, M, N, Kr,
+                           alpha, devA, lda, devB, ldb, beta, devC, ldc,
+                           aOffset, bOffset, cOffset);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devC, C_hcblas, M * N * sizeof(int));
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      // Row major C(i, j) is column major C'(j, i) = B' * A'
+      EXPECT_EQ(C_hcblas[j + i * ldc],
+                alpha * igemm_ref(NoTrans, NoTrans, B, ldb, A, lda, Kr, j, i) +
+                    beta * C[j + i * ldc]);
+    }
+  }
+
+  // A is NULL
+  status = hc.hcblas_igemm(accl_view, ColMajor, NoTrans, NoTrans, M, N, K,
+                           alpha, NULL, M, devB, K, beta, devC, M, aOffset,
+                           bOffset, cOffset);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_igemm, return_correct_igemm_requant_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 50, N = 37, K = 67;
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  signed char* A = (signed char*)calloc(M * K, sizeof(signed char));
+  signed char* B = (signed char*)calloc(K * N, sizeof(signed char));
+  signed char* C = (signed char*)calloc(M * N, sizeof(signed char));
+  float* scale = (float*)calloc(M + N, sizeof(float));
+  int* zeroPoint = (int*)calloc(M + N, sizeof(int));
+  signed char* devA = hc::am_alloc(sizeof(signed char) * M * K, acc, 0);
+  signed char* devB = hc::am_alloc(sizeof(signed char) * K * N, acc, 0);
+  signed char* devC = hc::am_alloc(sizeof(signed char) * M * N, acc, 0);
+  float* devScale = hc::am_alloc(sizeof(float) * (M + N), acc, 0);
+  int* devZeroPoint = hc::am_alloc(sizeof(int) * (M + N), acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    A[i] = rand_r(&global_seed) % 256 - 128;
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    B[i] = rand_r(&global_seed) % 256 - 128;
+  }
+
+  // Power of two scales keep the reference rounding exact
+  for (int i = 0; i < M + N; i++) {
+    scale[i] = 1.0f / (1 << (8 + rand_r(&global_seed) % 6));
+    zeroPoint[i] = rand_r(&global_seed) % 21 - 10;
+  }
+
+  accl_view.copy(A, devA, M * K * sizeof(signed char));
+  accl_view.copy(B, devB, K * N * sizeof(signed char));
+  accl_view.copy(scale, devScale, (M + N) * sizeof(float));
+  accl_view.copy(zeroPoint, devZeroPoint, (M + N) * sizeof(int));
+
+  hcblasQuantAxis axes[2] = {PerRow, PerColumn};
+  for (int a = 0; a < 2; a++) {
+    status = hc.hcblas_igemm_requant(
+        accl_view, ColMajor, NoTrans, Trans, M, N, K, devA, M, devB, N, devC,
+        M, axes[a], devScale, (a == 0) ? devZeroPoint : NULL, aOffset, bOffset,
+        cOffset);
+    EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+    accl_view.copy(devC, C, M * N * sizeof(signed char));
+    for (int j = 0; j < N; j++) {
+      for (int i = 0; i < M; i++) {
+        int q = (axes[a] == PerRow) ? i : j;
+        float value = igemm_ref(NoTrans, Trans, A, M, B, N, K, i, j) * scale[q];
+        value += (a == 0) ? zeroPoint[q] : 0;
+        int expected = static_cast<int>(value >= 0 ? value + 0.5f
+                                                   : value - 0.5f);
+        expected = expected > 127 ? 127 : (expected < -128 ? -128 : expected);
+        EXPECT_EQ(C[i + j * M], expected);
+      }
+    }
+  }
+
+  // scale is NULL
+  status = hc.hcblas_igemm_requant(accl_view, ColMajor, NoTrans, Trans, M, N, K,
+                                   devA, M, devB, N, devC, M, PerRow, NULL,
+                                   NULL, aOffset, bOffset, cOffset);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+
+  free(A);
+  free(B);
+  free(C);
+  free(scale);
+  free(zeroPoint);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  hc::am_free(devScale);
+  hc::am_free(devZeroPoint);
+}
@@ -0,0 +1,158 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_modules.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Stand-in entry tables, one per routine
+static int fake_tables[ModuleRoutines];
+static std::atomic<int> fake_loads[ModuleRoutines];
+static std::atomic<int> fake_reports;
+
+static const void *fake_loader(hcblasModuleRoutine routine) {
+  fake_loads[routine]++;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  // The zgemm module is missing
+  return routine == ModuleZgemm ? NULL : &fake_tables[routine];
+}
+
+static void fake_reporter(hcblasModuleRoutine routine, double milliseconds) {
+  EXPECT_NE(routine, ModuleZgemm);
+  EXPECT_GT(milliseconds, 0);
+  fake_reports++;
+}
+
+static void reset_fake_loader() {
+  for (int r = 0; r < ModuleRoutines; r++) {
+    fake_loads[r] = 0;
+  }
+  fake_reports = 0;
+}
+
+TEST(hcblas_modules, return_correct_module_file) {
+  EXPECT_STREQ(hcblasModuleRoutineName(ModuleSgemm), "sgemm");
+  EXPECT_STREQ(hcblasModuleRoutineName(ModuleZgemm), "zgemm");
+  EXPECT_EQ(hcblasRoutineModuleFile("/opt/rocm/hcblas/lib/hcblas",
+                                    ModuleDgemm),
+            "/opt/rocm/hcblas/lib/hcblas/libhcblas-dgemm.so");
+  EXPECT_EQ(hcblasRoutineModuleFile("", ModuleHgemm), "libhcblas-hgemm.so");
+}
+
+// Routines built into the library never reach the loader
+TEST(hcblas_modules, return_correct_builtin_routines) {
+  reset_fake_loader();
+  hcblasModuleRegistry registry(0, fake_loader, fake_reporter);
+  for (int r = 0; r < ModuleRoutines; r++) {
+    hcblasModuleRoutine routine = static_cast<hcblasModuleRoutine>(r);
+    EXPECT_FALSE(registry.isModule(routine));
+    EXPECT_EQ(registry.entries(routine), static_cast<const void *>(NULL));
+    EXPECT_EQ(registry.loadMilliseconds(routine), 0);
+    EXPECT_EQ(fake_loads[r], 0);
+  }
+  EXPECT_EQ(fake_reports, 0);
+}
+
+// Threads racing for a module all get its table from a single load
+TEST(hcblas_modules, return_correct_module_loaded_once) {
+  reset_fake_loader();
+  hcblasModuleRegistry registry((1u << ModuleSgemm) | (1u << ModuleCgemm),
+                                fake_loader, fake_reporter);
+  EXPECT_TRUE(registry.isModule(ModuleSgemm));
+  EXPECT_FALSE(registry.isModule(ModuleDgemm));
+  EXPECT_LT(registry.loadMilliseconds(ModuleSgemm), 0);
+
+  const int threads = 8;
+  std::vector<const void *> tables(threads);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.push_back(std::thread([&registry, &tables, t] {
+      tables[t] = registry.entries(ModuleSgemm);
+    }));
+  }
+  for (int t = 0; t < threads; t++) {
+    pool[t].join();
+    EXPECT_EQ(tables[t], &fake_tables[ModuleSgemm]);
+  }
+  EXPECT_EQ(fake_loads[ModuleSgemm], 1);
+  EXPECT_EQ(fake_reports, 1);
+  EXPECT_GE(registry.loadMilliseconds(ModuleSgemm), 15);
+
+  // Loaded modules do not reload; others load on their own first use
+  EXPECT_EQ(registry.entries(ModuleSgemm), &fake_tables[ModuleSgemm]);
+  EXPECT_LT(registry.loadMilliseconds(ModuleCgemm), 0);
+  EXPECT_EQ(registry.entries(ModuleCgemm), &fake_tables[ModuleCgemm]);
+  EXPECT_EQ(registry.entries(ModuleDgemm), static_cast<const void *>(NULL));
+  EXPECT_EQ(fake_loads[ModuleSgemm], 1);
+  EXPECT_EQ(fake_loads[ModuleCgemm], 1);
+  EXPECT_EQ(fake_loads[ModuleDgemm], 0);
+  EXPECT_EQ(fake_reports, 2);
+}
+
+// A module that fails to load is not retried on every call
+TEST(hcblas_modules, return_correct_module_load_failure) {
+  reset_fake_loader();
+  hcblasModuleRegistry registry(1u << ModuleZgemm, fake_loader, fake_reporter);
+  EXPECT_EQ(registry.entries(ModuleZgemm), static_cast<const void *>(NULL));
+  EXPECT_EQ(registry.entries(ModuleZgemm), static_cast<const void *>(NULL));
+  EXPECT_EQ(fake_loads[ModuleZgemm], 1);
+  EXPECT_EQ(fake_reports, 0);
+  EXPECT_LT(registry.loadMilliseconds(ModuleZgemm), 0);
+}
+
+TEST(hcblas_modules, return_correct_warmup) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+
+  EXPECT_EQ(hcblasWarmup(NULL, HCBLAS_ROUTINE_ALL),
+            HCBLAS_STATUS_NOT_INITIALIZED);
+  EXPECT_EQ(hcblasWarmup(handle, HCBLAS_ROUTINE_ALL + 1),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasWarmup(handle, 0), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasWarmup(handle, HCBLAS_ROUTINE_SGEMM | HCBLAS_ROUTINE_DGEMM),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasWarmup(handle, HCBLAS_ROUTINE_ALL), HCBLAS_STATUS_SUCCESS);
+
+  // Once warmed up every routine is either built in (0) or loaded (> 0)
+  double milliseconds = -1;
+  EXPECT_EQ(hcblasGetModuleLoadTime(HCBLAS_ROUTINE_SGEMM, &milliseconds),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_GE(milliseconds, 0);
+  EXPECT_EQ(hcblasGetModuleLoadTime(HCBLAS_ROUTINE_ZGEMM, &milliseconds),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_GE(milliseconds, 0);
+  EXPECT_EQ(hcblasGetModuleLoadTime(HCBLAS_ROUTINE_ALL, &milliseconds),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasGetModuleLoadTime(HCBLAS_ROUTINE_SGEMM, NULL),
+            HCBLAS_STATUS_INVALID_VALUE);
+
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,328 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+#include <thread>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+namespace {
+
+// Recording backend: steps launched through it only log what they were
+// given, so the plan bookkeeping can be checked without running kernels.
+std::vector<hcblasPlanStep> launched;
+
+hcblasStatus record_launch(hc::accelerator_view accl_view,
+                           const hcblasPlanStep &step) {
+  launched.push_back(step);
+  return step.dim[0] < 0 ? HCBLAS_INVALID : HCBLAS_SUCCEEDS;
+}
+
+void dummy_kernel() {}
+
+hcblasPlanStep record_step(void *x, void *y, __int64_t n) {
+  hcblasPlanStep step = {record_launch,
+                         dummy_kernel,
+                         {x, y, NULL},
+                         {0, n, 0},
+                         {n},
+                         {1.0, 0.0}};
+  return step;
+}
+
+}  // namespace
+
+TEST(hcblas_plan, return_correct_plan_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  float a[4], b[4], c[4];
+  hcblasPlan plan;
+  plan.steps.push_back(record_step(a, b, 1));
+  plan.steps.push_back(record_step(b, c, 2));
+  plan.steps.push_back(record_step(a, c, 3));
+
+  // Replay runs every step in capture order with the recorded arguments
+  launched.clear();
+  EXPECT_EQ(plan.launch(av), HCBLAS_SUCCEEDS);
+  ASSERT_EQ(launched.size(), 3);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(launched[i].dim[0], i + 1);
+    EXPECT_EQ(launched[i].offset[1], i + 1);
+    EXPECT_TRUE(launched[i].kernel == dummy_kernel);
+  }
+  EXPECT_EQ(launched[0].operand[0], a);
+  EXPECT_EQ(launched[1].operand[1], c);
+
+  // Rebinding swaps every use of a pointer and nothing else
+  float d[4];
+  EXPECT_EQ(plan.rebind(a, d), 2);
+  EXPECT_EQ(plan.rebind(a, d), 0);
+  launched.clear();
+  EXPECT_EQ(plan.launch(av), HCBLAS_SUCCEEDS);
+  ASSERT_EQ(launched.size(), 3);
+  EXPECT_EQ(launched[0].operand[0], d);
+  EXPECT_EQ(launched[1].operand[0], b);
+  EXPECT_EQ(launched[2].operand[0], d);
+  EXPECT_EQ(launched[2].operand[1], c);
+
+  // A failing step stops the replay
+  plan.steps[1].dim[0] = -1;
+  launched.clear();
+  EXPECT_EQ(plan.launch(av), HCBLAS_INVALID);
+  EXPECT_EQ(launched.size(), 2);
+}
+
+TEST(hcblas_plan, return_correct_plan_Implementation_type_2) {
+  // Capture sgemm -> sgemv -> saxpy through a handle, replay and compare
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  EXPECT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  int M = 37, N = 23, K = 19;
+  float alpha = 1.5f, beta = 0.5f, one = 1.0f;
+  std::vector<float> A(M * K), B(K * N), C(M * N), x(N), y(M), z(M);
+  for (int i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 10;
+  for (int i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 10;
+  for (int i = 0; i < C.size(); i++) C[i] = rand_r(&global_seed) % 10;
+  for (int i = 0; i < N; i++) x[i] = rand_r(&global_seed) % 10;
+  for (int i = 0; i < M; i++) y[i] = rand_r(&global_seed) % 10;
+  for (int i = 0; i < M; i++) z[i] = rand_r(&global_seed) % 10;
+  float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+  float *devX = hc::am_alloc(sizeof(float) * N, accl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * M, accl, 0);
+  float *devZ = hc::am_alloc(sizeof(float) * M, accl, 0);
+  float *devZ2 = hc::am_alloc(sizeof(float) * M, accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(B.data(), devB, sizeof(float) * B.size());
+  av.copy(C.data(), devC, sizeof(float) * C.size());
+  av.copy(x.data(), devX, sizeof(float) * N);
+  av.copy(y.data(), devY, sizeof(float) * M);
+  av.copy(z.data(), devZ, sizeof(float) * M);
+  av.copy(z.data(), devZ2, sizeof(float) * M);
+
+  hcblasPlan_t plan = NULL;
+  EXPECT_EQ(hcblasEndCapture(handle, &plan), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSgemv(handle, HCBLAS_OP_N, M, N, &one, devC, M, devX, 1,
+                        &beta, devY, 1),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSaxpy(handle, M, &alpha, devY, 1, devZ, 1),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasEndCapture(handle, &plan), HCBLAS_STATUS_SUCCESS);
+  ASSERT_TRUE(plan != NULL);
+  EXPECT_EQ(plan->steps.size(), 3);
+
+  // Nothing ran while capturing
+  std::vector<float> out(M * N);
+  av.copy(devC, out.data(), sizeof(float) * C.size());
+  EXPECT_TRUE(out == C);
+
+  EXPECT_EQ(hcblasLaunchPlan(handle, plan), HCBLAS_STATUS_SUCCESS);
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              A.data(), M, B.data(), K, beta, C.data(), M);
+  cblas_sgemv(CblasColMajor, CblasNoTrans, M, N, one, C.data(), M, x.data(),
+              1, beta, y.data(), 1);
+  std::vector<float> z2(z);
+  cblas_saxpy(M, alpha, y.data(), 1, z.data(), 1);
+  av.copy(devC, out.data(), sizeof(float) * C.size());
+  for (int i = 0; i < C.size(); i++) EXPECT_NEAR(out[i], C[i], 1e-5 * fabs(C[i]));
+  av.copy(devZ, out.data(), sizeof(float) * M);
+  for (int i = 0; i < M; i++) EXPECT_NEAR(out[i], z[i], 1e-5 * fabs(z[i]));
+
+  // Retarget the saxpy output and replay on the new buffer
+  EXPECT_EQ(hcblasPlanRebind(plan, devZ, devZ2), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasPlanRebind(plan, devZ, devZ2), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasLaunchPlan(handle, plan), HCBLAS_STATUS_SUCCESS);
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              A.data(), M, B.data(), K, beta, C.data(), M);
+  cblas_sgemv(CblasColMajor, CblasNoTrans, M, N, one, C.data(), M, x.data(),
+              1, beta, y.data(), 1);
+  cblas_saxpy(M, alpha, y.data(), 1, z2.data(), 1);
+  av.copy(devZ2, out.data(), sizeof(float) * M);
+  for (int i = 0; i < M; i++) EXPECT_NEAR(out[i], z2[i], 1e-5 * fabs(z2[i]));
+
+  EXPECT_EQ(hcblasDestroyPlan(plan), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasDestroyPlan(NULL), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  hc::am_free(devX);
+  hc::am_free(devY);
+  hc::am_free(devZ);
+  hc::am_free(devZ2);
+}
+
+TEST(hcblas_plan, return_correct_plan_Implementation_type_3) {
+  // Routines that cannot be recorded refuse to run while capturing, and
+  // library routines calling a capturable one internally run it right away
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  EXPECT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  int N = 130, lda = N;
+  float alpha = 1.0f, beta = 0.0f;
+  std::vector<float> A(lda * N), x(N);
+  for (int i = 0; i < A.size(); i++) {
+    A[i] = (rand_r(&global_seed) % 10) / 100.0f;
+  }
+  for (int i = 0; i < N; i++) A[i * lda + i] = 1 + rand_r(&global_seed) % 4;
+  for (int i = 0; i < N; i++) x[i] = rand_r(&global_seed) % 10;
+  float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float *devX = hc::am_alloc(sizeof(float) * N, accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * N * N, accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(x.data(), devX, sizeof(float) * N);
+
+  EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasStrsv(handle, HCBLAS_FILL_MODE_LOWER, HCBLAS_OP_N,
+                        HCBLAS_DIAG_NON_UNIT, N, devA, lda, devX, 1),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasGemmEx(handle, HCBLAS_OP_N, HCBLAS_OP_N, N, N, N, &alpha,
+                         devA, HCBLAS_R_32F, lda, devA, HCBLAS_R_32F, lda,
+                         &beta, devC, HCBLAS_R_32F, N, HCBLAS_R_32F,
+                         HCBLAS_GEMM_DEFAULT),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasSetVector(handle, N, sizeof(float), x.data(), 1, devX, 1),
+            HCBLAS_STATUS_INVALID_VALUE);
+  std::vector<float> out(N);
+  av.copy(devX, out.data(), sizeof(float) * N);
+  EXPECT_TRUE(out == x);
+
+  // The member routine solves in full; its trailing GEMMs are not recorded
+  EXPECT_EQ(handle->hcblas_strsv(av, ColMajor, Lower, NoTrans, NonUnit, N,
+                                 devA, 0, lda, devX, 0, 1),
+            HCBLAS_SUCCEEDS);
+  hcblasPlan_t plan = NULL;
+  EXPECT_EQ(hcblasEndCapture(handle, &plan), HCBLAS_STATUS_SUCCESS);
+  ASSERT_TRUE(plan != NULL);
+  EXPECT_EQ(plan->steps.size(), 0);
+  cblas_strsv(CblasColMajor, CblasLower, CblasNoTrans, CblasNonUnit, N,
+              A.data(), lda, x.data(), 1);
+  av.copy(devX, out.data(), sizeof(float) * N);
+  for (int i = 0; i < N; i++) {
+    EXPECT_NEAR(out[i], x[i], 1e-3 * fabs(x[i]) + 1e-4);
+  }
+
+  // Outside a capture the same calls run as usual
+  EXPECT_EQ(hcblasSetVector(handle, N, sizeof(float), x.data(), 1, devX, 1),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasStrsv(handle, HCBLAS_FILL_MODE_LOWER, HCBLAS_OP_N,
+                        HCBLAS_DIAG_NON_UNIT, N, devA, lda, devX, 1),
+            HCBLAS_STATUS_SUCCESS);
+
+  EXPECT_EQ(hcblasDestroyPlan(plan), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hc::am_free(devA);
+  hc::am_free(devX);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_plan, return_correct_plan_Implementation_type_4) {
+  // An SGEMM captured on aligned buffers may record the vector load kernel;
+  // replaying after a rebind to a misaligned operand must not use it
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  EXPECT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  int M = 128, N = 256, K = 128;
+  float alpha = 1.0f, beta = 0.0f;
+  std::vector<float> A(M * K), B(K * N), C(M * N);
+  for (int i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 10;
+  for (int i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 10;
+  float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float *devA2 = hc::am_alloc(sizeof(float) * (A.size() + 1), accl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(A.data(), devA2 + 1, sizeof(float) * A.size());
+  av.copy(B.data(), devB, sizeof(float) * B.size());
+
+  hcblasPlan_t plan = NULL;
+  EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasEndCapture(handle, &plan), HCBLAS_STATUS_SUCCESS);
+  ASSERT_TRUE(plan != NULL);
+
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              A.data(), M, B.data(), K, beta, C.data(), M);
+  std::vector<float> out(M * N);
+  EXPECT_EQ(hcblasLaunchPlan(handle, plan), HCBLAS_STATUS_SUCCESS);
+  av.copy(devC, out.data(), sizeof(float) * C.size());
+  for (int i = 0; i < C.size(); i++) EXPECT_EQ(out[i], C[i]);
+
+  // Same values, one float past a 16 byte boundary
+  EXPECT_EQ(hcblasPlanRebind(plan, devA, devA2 + 1), HCBLAS_STATUS_SUCCESS);
+  av.copy(std::vector<float>(C.size()).data(), devC,
+          sizeof(float) * C.size());
+  EXPECT_EQ(hcblasLaunchPlan(handle, plan), HCBLAS_STATUS_SUCCESS);
+  av.copy(devC, out.data(), sizeof(float) * C.size());
+  for (int i = 0; i < C.size(); i++) EXPECT_EQ(out[i], C[i]);
+
+  EXPECT_EQ(hcblasDestroyPlan(plan), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hc::am_free(devA);
+  hc::am_free(devA2);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_plan, return_correct_plan_Implementation_type_5) {
+  // Destroying a handle releases the plans threads are still capturing
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  EXPECT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  int n = 64;
+  float alpha = 2.0f;
+  float *devX = hc::am_alloc(sizeof(float) * n, accl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * n, accl, 0);
+  EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSaxpy(handle, n, &alpha, devX, 1, devY, 1),
+            HCBLAS_STATUS_SUCCESS);
+  std::thread other([&]() {
+    EXPECT_EQ(hcblasBeginCapture(handle), HCBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hcblasSaxpy(handle, n, &alpha, devX, 1, devY, 1),
+              HCBLAS_STATUS_SUCCESS);
+  });
+  other.join();
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_TRUE(handle == NULL);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
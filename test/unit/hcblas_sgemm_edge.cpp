@@ -0,0 +1,166 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_edge.h"
+#include "include/hcblas_trace.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_sgemm_edge, return_correct_edge_partition) {
+  // 1000^3 in 64 x 64 tiles: 96% of M and N, 99% of K
+  hcblasEdgeSplit split = hcblasEdgePartition(1000, 1000, 1000, 64, 16);
+  EXPECT_EQ(split.M0, 960);
+  EXPECT_EQ(split.N0, 960);
+  EXPECT_EQ(split.K0, 992);
+  split = hcblasEdgePartition(1000, 1000, 1000, 128, 16);
+  EXPECT_EQ(split.M0, 896);
+  EXPECT_EQ(split.N0, 896);
+
+  // Too few interior tiles, too short a K, or too small an interior share
+  split = hcblasEdgePartition(255, 1000, 1000, 64, 16);
+  EXPECT_EQ(split.M0, 0);
+  split = hcblasEdgePartition(1000, 1000, 15, 64, 16);
+  EXPECT_EQ(split.M0, 0);
+  split = hcblasEdgePartition(1000, 1000, 31, 64, 16);
+  EXPECT_EQ(split.M0, 0);
+  split = hcblasEdgePartition(0, 1000, 1000, 64, 16);
+  EXPECT_EQ(split.M0, 0);
+}
+
+// Every element of C gets exactly one block over the whole of K, plus the
+// K tail when it lies in the interior
+TEST(hcblas_sgemm_edge, return_correct_edge_blocks) {
+  int shapes[][3] = {{1000, 1000, 1000}, {1024, 1000, 1000},
+                     {1000, 1024, 1000}, {1000, 1000, 1024},
+                     {1024, 1024, 1024}, {300, 270, 100}};
+  for (int s = 0; s < 6; s++) {
+    int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+    hcblasEdgeSplit split = hcblasEdgePartition(M, N, K, 64, 16);
+    ASSERT_GT(split.M0, 0);
+    hcblasEdgeBlock blocks[HCBLAS_EDGE_MAX_BLOCKS];
+    int count = hcblasEdgeBlocks(M, N, K, split, blocks);
+    ASSERT_GE(count, 1);
+    ASSERT_LE(count, HCBLAS_EDGE_MAX_BLOCKS);
+    EXPECT_EQ(blocks[0].rows, split.M0);
+    EXPECT_EQ(blocks[0].cols, split.N0);
+    EXPECT_EQ(blocks[0].depth, split.K0);
+    EXPECT_FALSE(blocks[0].accumulate);
+
+    std::vector<int> depth(M * N, 0), owners(M * N, 0);
+    for (int b = 0; b < count; b++) {
+      ASSERT_GT(blocks[b].rows * blocks[b].cols * blocks[b].depth, 0);
+      for (int j = blocks[b].col; j < blocks[b].col + blocks[b].cols; j++) {
+        for (int i = blocks[b].row; i < blocks[b].row + blocks[b].rows; i++) {
+          depth[i + j * M] += blocks[b].depth;
+          owners[i + j * M] += !blocks[b].accumulate;
+        }
+      }
+    }
+    for (int i = 0; i < M * N; i++) {
+      EXPECT_EQ(depth[i], K);
+      EXPECT_EQ(owners[i], 1);
+    }
+  }
+}
+
+// Ragged shapes that run the M128_N128_K16 kernels on their interior,
+// checked against CBLAS with padded leading dimensions
+TEST(hcblas_sgemm_edge, return_correct_sgemm_edge_Implementation_type_1) {
+  char path[] = "/tmp/hcblas_edgeXXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  hcblasTraceConfigure(1, path, TraceJson);
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  int M = 650, N = 270, K = 100;
+  float alpha = 2, beta = 0.5;
+  hcblasOperation_t transA[3] = {HCBLAS_OP_N, HCBLAS_OP_N, HCBLAS_OP_T};
+  hcblasOperation_t transB[3] = {HCBLAS_OP_N, HCBLAS_OP_T, HCBLAS_OP_N};
+  for (int t = 0; t < 3; t++) {
+    int lda = (transA[t] == HCBLAS_OP_N ? M : K) + 3;
+    int ldb = (transB[t] == HCBLAS_OP_N ? K : N) + 5;
+    int ldc = M + 1;
+    std::vector<float> A(lda * (transA[t] == HCBLAS_OP_N ? K : M));
+    std::vector<float> B(ldb * (transB[t] == HCBLAS_OP_N ? N : K));
+    std::vector<float> C(ldc * N), C_hcblas(ldc * N);
+    for (size_t i = 0; i < A.size(); i++) {
+      A[i] = rand_r(&global_seed) % 10;
+    }
+    for (size_t i = 0; i < B.size(); i++) {
+      B[i] = rand_r(&global_seed) % 15;
+    }
+    for (size_t i = 0; i < C.size(); i++) {
+      C[i] = rand_r(&global_seed) % 25;
+    }
+    float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+    float *devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+    float *devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+    av.copy(A.data(), devA, sizeof(float) * A.size());
+    av.copy(B.data(), devB, sizeof(float) * B.size());
+    av.copy(C.data(), devC, sizeof(float) * C.size());
+    EXPECT_EQ(hcblasSgemm(handle, transA[t], transB[t], M, N, K, &alpha, devA,
+                          lda, devB, ldb, &beta, devC, ldc),
+              HCBLAS_STATUS_SUCCESS);
+    av.copy(devC, C_hcblas.data(), sizeof(float) * C.size());
+    cblas_sgemm(CblasColMajor,
+                (transA[t] == HCBLAS_OP_N) ? CblasNoTrans : CblasTrans,
+                (transB[t] == HCBLAS_OP_N) ? CblasNoTrans : CblasTrans, M, N, K,
+                alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+    for (size_t i = 0; i < C.size(); i++) {
+      EXPECT_EQ(C_hcblas[i], C[i]);
+    }
+    hc::am_free(devA);
+    hc::am_free(devB);
+    hc::am_free(devC);
+  }
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hcblasTraceFlush();
+  hcblasTraceConfigure(0, NULL, TraceCsv);
+
+  std::ifstream log(path);
+  std::string trace((std::istreambuf_iterator<char>(log)),
+                    std::istreambuf_iterator<char>());
+  unlink(path);
+  EXPECT_NE(trace.find("gemm_edge_M128_N128_K16_TS16XMTS2_MB2<0,0>"
+                       "(640x256x96)"),
+            std::string::npos)
+      << trace;
+  EXPECT_NE(trace.find("gemm_edge_M128_N128_K16_TS16XMTS2_MB2<0,1>"),
+            std::string::npos);
+  EXPECT_NE(trace.find("gemm_edge_M128_N128_K16_TS16XMTS2_MB2<1,0>"),
+            std::string::npos);
+}
@@ -0,0 +1,207 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "./test_constants.h"
+#include "include/hcblaslib.h"
+#include "include/helper_functions.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+static float epilogue_ref(float v, hcblasActivation activation, float lo,
+                          float hi) {
+  switch (activation) {
+    case ActivationRelu:
+      return v > 0 ? v : 0;
+    case ActivationGelu:
+      return 0.5f * v *
+             (1.0f + tanhf(0.7978845608f * (v + 0.044715f * v * v * v)));
+    case ActivationSigmoid:
+      return 1.0f / (1.0f + expf(-v));
+    case ActivationClamp:
+      return v < lo ? lo : (v > hi ? hi : v);
+    default:
+      return v;
+  }
+}
+
+TEST(hcblas_sgemm_epilogue,
+     return_correct_sgemm_epilogue_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 83, N = 45, K = 29;
+  float alpha = 1, beta = 1;
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  float* A = (float*)calloc(M * K, sizeof(float));
+  float* B = (float*)calloc(K * N, sizeof(float));
+  float* C = (float*)calloc(M * N, sizeof(float));
+  float* C_hcblas = (float*)calloc(M * N, sizeof(float));
+  float* C_cblas = (float*)calloc(M * N, sizeof(float));
+  float* aux = (float*)calloc(M * N, sizeof(float));
+  float* bias = (float*)calloc(M + N, sizeof(float));
+  float* scale = (float*)calloc(M + N, sizeof(float));
+  float* devA = hc::am_alloc(sizeof(float) * M * K, acc, 0);
+  float* devB = hc::am_alloc(sizeof(float) * K * N, acc, 0);
+  float* devC = hc::am_alloc(sizeof(float) * M * N, acc, 0);
+  float* devAux = hc::am_alloc(sizeof(float) * M * N, acc, 0);
+  float* devBias = hc::am_alloc(sizeof(float) * (M + N), acc, 0);
+  float* devScale = hc::am_alloc(sizeof(float) * (M + N), acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    A[i] = rand_r(&global_seed) % 10 - 5;
+  }
+
+  for (int i = 0; i < K * N; i++) {
+    B[i] = rand_r(&global_seed) % 10 - 5;
+  }
+
+  for (int i = 0; i < M * N; i++) {
+    C[i] = rand_r(&global_seed) % 25 - 12;
+  }
+
+  for (int i = 0; i < M + N; i++) {
+    bias[i] = rand_r(&global_seed) % 50 - 25;
+    scale[i] = (rand_r(&global_seed) % 4 + 1) * 0.25f;
+  }
+
+  accl_view.copy(A, devA, M * K * sizeof(float));
+  accl_view.copy(B, devB, K * N * sizeof(float));
+  accl_view.copy(bias, devBias, (M + N) * sizeof(float));
+  accl_view.copy(scale, devScale, (M + N) * sizeof(float));
+
+  // Plain product used by every reference below
+  for (int i = 0; i < M * N; i++) {
+    C_cblas[i] = 0;
+  }
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1, A, M, B,
+              K, 0, C_cblas, M);
+
+  hcblasActivation activations[5] = {ActivationNone, ActivationRelu,
+                                     ActivationGelu, ActivationSigmoid,
+                                     ActivationClamp};
+  hcblasQuantAxis axes[2] = {PerRow, PerColumn};
+  for (int a = 0; a < 5; a++) {
+    for (int x = 0; x < 2; x++) {
+      hcblasEpilogue epilogue;
+      epilogue.bias = devBias;
+      epilogue.biasAxis = axes[x];
+      epilogue.scale = devScale;
+      epilogue.scaleAxis = axes[1 - x];
+      epilogue.activation = activations[a];
+      epilogue.clampMin = -20;
+      epilogue.clampMax = 30;
+      epilogue.aux = devAux;
+      epilogue.auxOffset = 0;
+      epilogue.ldaux = M;
+      accl_view.copy(C, devC, M * N * sizeof(float));
+      status = hc.hcblas_gemmex(accl_view, ColMajor, NoTrans, NoTrans, M, N,
+                                K, &alpha, devA, FloatType, aOffset, M, devB,
+                                FloatType, bOffset, K, &beta, devC, FloatType,
+                                cOffset, M, FloatType, &epilogue);
+      EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+      accl_view.copy(devC, C_hcblas, M * N * sizeof(float));
+      accl_view.copy(devAux, aux, M * N * sizeof(float));
+      for (int j = 0; j < N; j++) {
+        for (int i = 0; i < M; i++) {
+          int p = (axes[x] == PerRow) ? i : j;
+          int q = (axes[1 - x] == PerRow) ? i : j;
+          float v = alpha * scale[q] * C_cblas[i + j * M] +
+                    beta * C[i + j * M] + bias[p];
+          EXPECT_EQ(aux[i + j * M], v);
+          EXPECT_NEAR(C_hcblas[i + j * M],
+                      epilogue_ref(v, activations[a], -20, 30), 1e-4);
+        }
+      }
+    }
+  }
+
+  // Row major, bias along N and no scale or aux
+  hcblasEpilogue epilogue;
+  epilogue.bias = devBias;
+  epilogue.biasAxis = PerColumn;
+  epilogue.scale = NULL;
+  epilogue.scaleAxis = PerRow;
+  epilogue.activation = ActivationRelu;
+  epilogue.clampMin = 0;
+  epilogue.clampMax = 0;
+  epilogue.aux = NULL;
+  epilogue.auxOffset = 0;
+  epilogue.ldaux = 0;
+  accl_view.copy(C, devC, M * N * sizeof(float));
+  // A is M x K row major with lda = K, the column major buffer is reused
+  status = hc.hcblas_gemmex(accl_view, RowMajor, Trans, Trans, M, N, K, &alpha,
+                            devA, FloatType, aOffset, M, devB, FloatType,
+                            bOffset, K, &beta, devC, FloatType, cOffset, N,
+                            FloatType, &epilogue);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devC, C_hcblas, M * N * sizeof(float));
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      // Row major C(i, j) with op(A)(i, l) = A[i + l * M]
+      float v = beta * C[i * N + j] + bias[j] + alpha * C_cblas[i + j * M];
+      EXPECT_EQ(C_hcblas[i * N + j], v > 0 ? v : 0);
+    }
+  }
+
+  // Epilogue on a combination without a fused kernel
+  double dalpha = 1, dbeta = 1;
+  status = hc.hcblas_gemmex(accl_view, ColMajor, NoTrans, NoTrans, M, N, K,
+                            &dalpha, devA, DoubleType, aOffset, M, devB,
+                            DoubleType, bOffset, K, &dbeta, devC, DoubleType,
+                            cOffset, M, DoubleType, &epilogue);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  // Clamp bounds out of order
+  epilogue.activation = ActivationClamp;
+  epilogue.clampMin = 1;
+  status = hc.hcblas_gemmex(accl_view, ColMajor, NoTrans, NoTrans, M, N, K,
+                            &alpha, devA, FloatType, aOffset, M, devB,
+                            FloatType, bOffset, K, &beta, devC, FloatType,
+                            cOffset, M, FloatType, &epilogue);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_hcblas);
+  free(C_cblas);
+  free(aux);
+  free(bias);
+  free(scale);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  hc::am_free(devAux);
+  hc::am_free(devBias);
+  hc::am_free(devScale);
+}
@@ -0,0 +1,190 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_grouped.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cstdlib>
+#include <vector>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_sgemm_grouped, return_correct_grouped_schedule) {
+  // Problem 3 is empty, 1 and 4 tie on cost
+  int M[6] = {64, 100, 32, 0, 50, 10};
+  int N[6] = {32, 32, 32, 8, 64, 10};
+  int K[6] = {16, 40, 600, 8, 40, 0};
+  hcblasGroupedSchedule schedule(32, 32);
+  EXPECT_TRUE(schedule.build(M, N, K, 6));
+
+  // Costs: p0 2*1*16=32, p1 4*1*40=160, p2 1*1*600=600, p4 2*2*40=160,
+  // p5 1*1*1=1
+  const std::vector<hcblasGroupedRange> &ranges = schedule.ranges();
+  ASSERT_EQ(ranges.size(), 5u);
+  int expected[5] = {2, 1, 4, 0, 5};
+  long long first = 0;
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(ranges[i].problem, expected[i]);
+    EXPECT_EQ(ranges[i].firstTile, first);
+    first += ranges[i].tilesM * ranges[i].tilesN;
+  }
+  EXPECT_EQ(schedule.tileCount(), first);
+  EXPECT_EQ(schedule.tileCount(), 1 + 4 + 4 + 2 + 1);
+
+  // Every block of every non empty problem is reached exactly once
+  std::vector<int> seen(6 * 16, 0);
+  for (long long t = 0; t < schedule.tileCount(); t++) {
+    int p, row, col;
+    ASSERT_TRUE(schedule.locate(t, &p, &row, &col));
+    EXPECT_LT(row * 32, M[p]);
+    EXPECT_LT(col * 32, N[p]);
+    seen[p * 16 + col * 4 + row]++;
+  }
+  for (int p = 0; p < 6; p++) {
+    int tilesM = (M[p] + 31) / 32;
+    int tilesN = (N[p] + 31) / 32;
+    for (int col = 0; col < tilesN; col++) {
+      for (int row = 0; row < tilesM; row++) {
+        EXPECT_EQ(seen[p * 16 + col * 4 + row], 1);
+      }
+    }
+  }
+  int p, row, col;
+  EXPECT_FALSE(schedule.locate(-1, &p, &row, &col));
+  EXPECT_FALSE(schedule.locate(schedule.tileCount(), &p, &row, &col));
+
+  // The same input always gives the same schedule
+  hcblasGroupedSchedule again(32, 32);
+  EXPECT_TRUE(again.build(M, N, K, 6));
+  ASSERT_EQ(again.ranges().size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); i++) {
+    EXPECT_EQ(again.ranges()[i].problem, ranges[i].problem);
+    EXPECT_EQ(again.ranges()[i].firstTile, ranges[i].firstTile);
+  }
+
+  // Negative sizes are rejected and leave the schedule empty
+  K[1] = -1;
+  EXPECT_FALSE(again.build(M, N, K, 6));
+  EXPECT_EQ(again.tileCount(), 0);
+  EXPECT_EQ(again.ranges().size(), 0u);
+  EXPECT_TRUE(again.build(M, N, K, 0));
+  EXPECT_EQ(again.tileCount(), 0);
+}
+
+TEST(hcblas_sgemm_grouped, return_correct_sgemm_grouped_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  hcblasStatus status;
+  // Implementation type I - Inputs and Outputs are HCC device pointers
+  // Experts of different sizes, one of them idle this step
+  const int groupCount = 5;
+  int M[groupCount] = {70, 3, 0, 129, 33};
+  int N[groupCount] = {40, 65, 16, 1, 33};
+  int K[groupCount] = {45, 17, 9, 100, 1};
+  float alpha = 1.5, beta = 0.5;
+  int lda[groupCount], ldb[groupCount], ldc[groupCount];
+  std::vector<float> A[groupCount], B[groupCount], C[groupCount];
+  float *devA[groupCount], *devB[groupCount], *devC[groupCount];
+  std::vector<float> C_hcblas;
+
+  hcblasOrder orders[2] = {ColMajor, RowMajor};
+  hcblasTranspose trans[2] = {NoTrans, Trans};
+  for (int o = 0; o < 2; o++) {
+    for (int ta = 0; ta < 2; ta++) {
+      for (int tb = 0; tb < 2; tb++) {
+        bool col = orders[o] == ColMajor;
+        for (int p = 0; p < groupCount; p++) {
+          int rowsA = (trans[ta] == NoTrans) ? M[p] : K[p];
+          int colsA = (trans[ta] == NoTrans) ? K[p] : M[p];
+          int rowsB = (trans[tb] == NoTrans) ? K[p] : N[p];
+          int colsB = (trans[tb] == NoTrans) ? N[p] : K[p];
+          // Padded leading dimensions, different for every problem
+          lda[p] = (col ? rowsA : colsA) + p;
+          ldb[p] = (col ? rowsB : colsB) + 2 * p;
+          ldc[p] = (col ? M[p] : N[p]) + 1;
+          size_t sizeA = static_cast<size_t>(lda[p]) * (col ? colsA : rowsA);
+          size_t sizeB = static_cast<size_t>(ldb[p]) * (col ? colsB : rowsB);
+          size_t sizeC = static_cast<size_t>(ldc[p]) * (col ? N[p] : M[p]);
+          A[p].resize(sizeA + 1);
+          B[p].resize(sizeB + 1);
+          C[p].resize(sizeC + 1);
+          for (size_t i = 0; i < A[p].size(); i++) {
+            A[p][i] = rand_r(&global_seed) % 10;
+          }
+          for (size_t i = 0; i < B[p].size(); i++) {
+            B[p][i] = rand_r(&global_seed) % 15;
+          }
+          for (size_t i = 0; i < C[p].size(); i++) {
+            C[p][i] = rand_r(&global_seed) % 25;
+          }
+          devA[p] = hc::am_alloc(sizeof(float) * A[p].size(), acc, 0);
+          devB[p] = hc::am_alloc(sizeof(float) * B[p].size(), acc, 0);
+          devC[p] = hc::am_alloc(sizeof(float) * C[p].size(), acc, 0);
+          accl_view.copy(A[p].data(), devA[p], sizeof(float) * A[p].size());
+          accl_view.copy(B[p].data(), devB[p], sizeof(float) * B[p].size());
+          accl_view.copy(C[p].data(), devC[p], sizeof(float) * C[p].size());
+        }
+
+        status = hc.hcblas_sgemm_grouped(
+            accl_view, orders[o], trans[ta], trans[tb], M, N, K, alpha, devA,
+            lda, devB, ldb, beta, devC, ldc, groupCount);
+        EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+
+        for (int p = 0; p < groupCount; p++) {
+          C_hcblas.resize(C[p].size());
+          accl_view.copy(devC[p], C_hcblas.data(),
+                         sizeof(float) * C[p].size());
+          if (M[p] > 0 && N[p] > 0) {
+            cblas_sgemm(col ? CblasColMajor : CblasRowMajor,
+                        (trans[ta] == NoTrans) ? CblasNoTrans : CblasTrans,
+                        (trans[tb] == NoTrans) ? CblasNoTrans : CblasTrans,
+                        M[p], N[p], K[p], alpha, A[p].data(), lda[p],
+                        B[p].data(), ldb[p], beta, C[p].data(), ldc[p]);
+          }
+          for (size_t i = 0; i < C[p].size(); i++) {
+            EXPECT_EQ(C_hcblas[i], C[p][i]);
+          }
+          hc::am_free(devA[p]);
+          hc::am_free(devB[p]);
+          hc::am_free(devC[p]);
+        }
+      }
+    }
+  }
+
+  // Negative sizes and missing arrays are rejected
+  K[1] = -1;
+  status = hc.hcblas_sgemm_grouped(accl_view, ColMajor, NoTrans, NoTrans, M,
+                                   N, K, alpha, devA, lda, devB, ldb, beta,
+                                   devC, ldc, groupCount);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  status = hc.hcblas_sgemm_grouped(accl_view, ColMajor, NoTrans, NoTrans, M,
+                                   N, K, alpha, NULL, lda, devB, ldb, beta,
+                                   devC, ldc, groupCount);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+}
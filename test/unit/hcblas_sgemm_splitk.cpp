@@ -0,0 +1,147 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_splitk.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_sgemm_splitk, return_correct_splitk_partition) {
+  // 64 x 64 is four 32 x 32 tiles: 160 / 4 = 40 chunks of K
+  hcblasSplitK p = hcblasSplitKPartition(64, 64, 500000, 32, 32, 16, 256, 160);
+  EXPECT_EQ(p.splits, 40);
+  EXPECT_EQ(p.kChunk, 12512);
+  EXPECT_EQ(p.kChunk % 16, 0);
+  EXPECT_LT(static_cast<long long>(p.splits - 1) * p.kChunk, 500000);
+  EXPECT_GE(static_cast<long long>(p.splits) * p.kChunk, 500000);
+
+  // Enough tiles already, or too little K to be worth splitting
+  p = hcblasSplitKPartition(512, 512, 500000, 32, 32, 16, 256, 160);
+  EXPECT_EQ(p.splits, 1);
+  EXPECT_EQ(p.kChunk, 500000);
+  p = hcblasSplitKPartition(64, 64, 511, 32, 32, 16, 256, 160);
+  EXPECT_EQ(p.splits, 1);
+
+  // Limited by the minimum chunk length, then by the split bound
+  p = hcblasSplitKPartition(32, 32, 1024, 32, 32, 16, 256, 160);
+  EXPECT_EQ(p.splits, 4);
+  EXPECT_EQ(p.kChunk, 256);
+  p = hcblasSplitKPartition(1, 1, 1 << 24, 32, 32, 16, 256, 1000);
+  EXPECT_EQ(p.splits, HCBLAS_SPLITK_MAX_SPLITS);
+
+  // Rounding the chunk up to kUnit never leaves an empty chunk
+  for (int K = 512; K < 4096; K += 37) {
+    p = hcblasSplitKPartition(16, 16, K, 32, 32, 16, 64, 100);
+    ASSERT_GE(p.splits, 1);
+    EXPECT_LT(static_cast<long long>(p.splits - 1) * p.kChunk, K);
+    EXPECT_GE(static_cast<long long>(p.splits) * p.kChunk, K);
+  }
+
+  // Partial products respect the workspace bound
+  p = hcblasSplitKPartition(4000, 4000, 1 << 20, 4000, 4000, 16, 256, 1000);
+  EXPECT_LE(static_cast<long long>(p.splits) * 4000 * 4000,
+            HCBLAS_SPLITK_MAX_WORKSPACE);
+
+  // Degenerate input
+  p = hcblasSplitKPartition(0, 64, 100000, 32, 32, 16, 256, 160);
+  EXPECT_EQ(p.splits, 1);
+}
+
+TEST(hcblas_sgemm_splitk, return_correct_sgemm_splitk_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  hcblasStatus status;
+  // Implementation type I - Inputs and Outputs are HCC device pointers
+  // Few output tiles and a long K select the split-K kernels
+  int M = 70, N = 45, K = 20000;
+  float alpha = 2, beta = 0.5;
+  std::vector<float> A(M * K), B(K * N), C(M * N), C_hcblas(M * N);
+  float *devA = hc::am_alloc(sizeof(float) * M * K, acc, 0);
+  float *devB = hc::am_alloc(sizeof(float) * K * N, acc, 0);
+  float *devC = hc::am_alloc(sizeof(float) * M * N, acc, 0);
+
+  for (int i = 0; i < M * K; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < K * N; i++) {
+    B[i] = rand_r(&global_seed) % 15;
+  }
+  accl_view.copy(A.data(), devA, sizeof(float) * M * K);
+  accl_view.copy(B.data(), devB, sizeof(float) * K * N);
+
+  hcblasOrder orders[2] = {ColMajor, RowMajor};
+  hcblasTranspose trans[2] = {NoTrans, Trans};
+  for (int o = 0; o < 2; o++) {
+    for (int ta = 0; ta < 2; ta++) {
+      for (int tb = 0; tb < 2; tb++) {
+        bool col = orders[o] == ColMajor;
+        int lda = (col == (trans[ta] == NoTrans)) ? M : K;
+        int ldb = (col == (trans[tb] == NoTrans)) ? K : N;
+        int ldc = col ? M : N;
+        for (int i = 0; i < M * N; i++) {
+          C[i] = rand_r(&global_seed) % 25;
+        }
+        accl_view.copy(C.data(), devC, sizeof(float) * M * N);
+        status = hc.hcblas_sgemm(accl_view, orders[o], trans[ta], trans[tb], M,
+                                 N, K, alpha, devA, lda, devB, ldb, beta, devC,
+                                 ldc, 0, 0, 0);
+        EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+        accl_view.copy(devC, C_hcblas.data(), sizeof(float) * M * N);
+        cblas_sgemm(col ? CblasColMajor : CblasRowMajor,
+                    (trans[ta] == NoTrans) ? CblasNoTrans : CblasTrans,
+                    (trans[tb] == NoTrans) ? CblasNoTrans : CblasTrans, M, N,
+                    K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(),
+                    ldc);
+        for (int i = 0; i < M * N; i++) {
+          EXPECT_EQ(C_hcblas[i], C[i]);
+        }
+      }
+    }
+  }
+
+  // beta == 0 must not read C, so NaN already in it does not show through
+  std::vector<float> C_nan(M * N, NAN);
+  accl_view.copy(C_nan.data(), devC, sizeof(float) * M * N);
+  status = hc.hcblas_sgemm(accl_view, ColMajor, NoTrans, NoTrans, M, N, K,
+                           alpha, devA, M, devB, K, 0.0f, devC, M, 0, 0, 0);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  accl_view.copy(devC, C_hcblas.data(), sizeof(float) * M * N);
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+              A.data(), M, B.data(), K, 0.0f, C.data(), M);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C_hcblas[i], C[i]);
+  }
+
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_trace.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <hc_am.hpp>
+#include "gtest/gtest.h"
+
+unsigned int global_seed = 100;
+
+// hcblasSgemm on the handle, checked against CBLAS
+static void sgemm_variant_check(hcblasHandle_t handle,
+                                hcblasOperation_t transa,
+                                hcblasOperation_t transb, int M, int N,
+                                int K) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  float alpha = 2, beta = 1;
+  int lda = (transa == HCBLAS_OP_N) ? M : K;
+  int ldb = (transb == HCBLAS_OP_N) ? K : N;
+  int ldc = M;
+  std::vector<float> A(M * K), B(K * N), C(M * N);
+  for (size_t i = 0; i < A.size(); i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (size_t i = 0; i < B.size(); i++) {
+    B[i] = rand_r(&global_seed) % 10;
+  }
+  for (size_t i = 0; i < C.size(); i++) {
+    C[i] = rand_r(&global_seed) % 10;
+  }
+  float *devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(B.data(), devB, sizeof(float) * B.size());
+  av.copy(C.data(), devC, sizeof(float) * C.size());
+  EXPECT_EQ(hcblasSgemm(handle, transa, transb, M, N, K, &alpha, devA, lda,
+                        devB, ldb, &beta, devC, ldc),
+            HCBLAS_STATUS_SUCCESS);
+  std::vector<float> result(C.size());
+  av.copy(devC, result.data(), sizeof(float) * C.size());
+  CBLAS_TRANSPOSE opA = (transa == HCBLAS_OP_N) ? CblasNoTrans : CblasTrans;
+  CBLAS_TRANSPOSE opB = (transb == HCBLAS_OP_N) ? CblasNoTrans : CblasTrans;
+  cblas_sgemm(CblasColMajor, opA, opB, M, N, K, alpha, A.data(), lda,
+              B.data(), ldb, beta, C.data(), ldc);
+  int errors = 0;
+  for (size_t i = 0; i < C.size(); i++) {
+    errors += std::fabs(result[i] - C[i]) > 1e-3f * std::fabs(C[i]);
+  }
+  EXPECT_EQ(errors, 0);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_sgemm_variants, return_correct_variants) {
+  char path[] = "/tmp/hcblas_variantsXXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  hcblasTraceConfigure(1, path, TraceJson);
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+
+  // Ragged shapes, each picked by the selectors for one variant. The large
+  // ones have too short a K for the tile aligned edge path.
+  sgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_N, 67, 45, 29);
+  sgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_N, 521, 519, 43);
+  sgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_T, 71, 53, 37);
+  sgemm_variant_check(handle, HCBLAS_OP_N, HCBLAS_OP_T, 523, 517, 43);
+  sgemm_variant_check(handle, HCBLAS_OP_T, HCBLAS_OP_N, 701, 131, 15);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  hcblasTraceFlush();
+  hcblasTraceConfigure(0, NULL, TraceCsv);
+
+  std::ifstream log(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(log, line);) {
+    lines.push_back(line);
+  }
+  unlink(path);
+  const char *kernels[] = {"gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2",
+                           "gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4",
+                           "gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2",
+                           "gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4",
+                           "gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2"};
+  ASSERT_EQ(lines.size(), 5);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_NE(lines[i].find(kernels[i]), std::string::npos) << lines[i];
+  }
+}
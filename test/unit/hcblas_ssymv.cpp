@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cstdlib>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_ssymv, return_correct_ssymv_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 131;
+  int lda = N;
+  float alpha = 1;
+  float beta = 1;
+  int incX = 1;
+  int incY = 1;
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  float *devA = hc::am_alloc(sizeof(float) * N * N, acc, 0);
+  float *devX = hc::am_alloc(sizeof(float) * N, acc, 0);
+  float *devY = hc::am_alloc(sizeof(float) * N, acc, 0);
+  float *devA1 = NULL;
+  float *devX1 = NULL;
+  float *devY1 = NULL;
+
+  /* A, x, y are not allocated properly */
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, N, alpha, devA1,
+                           aOffset, lda, devX, xOffset, incX, beta, devY,
+                           yOffset, incY);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, N, alpha, devA, aOffset,
+                           lda, devX1, xOffset, incX, beta, devY, yOffset,
+                           incY);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, N, alpha, devA, aOffset,
+                           lda, devX, xOffset, incX, beta, devY1, yOffset,
+                           incY);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* N is 0 */
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, 0, alpha, devA, aOffset,
+                           lda, devX, xOffset, incX, beta, devY, yOffset,
+                           incY);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* lda is smaller than N */
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, N, alpha, devA, aOffset,
+                           N - 1, devX, xOffset, incX, beta, devY, yOffset,
+                           incY);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* incX is 0 */
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, N, alpha, devA, aOffset,
+                           lda, devX, xOffset, 0, beta, devY, yOffset, incY);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* incY is 0 */
+  status = hc.hcblas_ssymv(accl_view, ColMajor, Lower, N, alpha, devA, aOffset,
+                           lda, devX, xOffset, incX, beta, devY, yOffset, 0);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  hc::am_free(devA);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
+
+TEST(hcblas_ssymv, func_correct_ssymv_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 131;
+  int lda = N + 3;
+  float alpha = 2;
+  float beta = 3;
+  int incX = 2;
+  int incY = 1;
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  __int64_t yOffset = 0;
+  __int64_t lenx = 1 + (N - 1) * incX;
+  __int64_t leny = 1 + (N - 1) * incY;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  float *A = (float *)calloc(lda * N, sizeof(float));
+  float *x = (float *)calloc(lenx, sizeof(float));
+  float *y = (float *)calloc(leny, sizeof(float));
+  float *ycblas = (float *)calloc(leny, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * lda * N, acc, 0);
+  float *devX = hc::am_alloc(sizeof(float) * lenx, acc, 0);
+  float *devY = hc::am_alloc(sizeof(float) * leny, acc, 0);
+  for (int i = 0; i < lda * N; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < lenx; i++) {
+    x[i] = rand_r(&global_seed) % 15;
+  }
+  accl_view.copy(A, devA, lda * N * sizeof(float));
+  accl_view.copy(x, devX, lenx * sizeof(float));
+
+  hcblasOrder orders[2] = {ColMajor, RowMajor};
+  CBLAS_ORDER cblasOrders[2] = {CblasColMajor, CblasRowMajor};
+  hcblasUplo uplos[2] = {Lower, Upper};
+  CBLAS_UPLO cblasUplos[2] = {CblasLower, CblasUpper};
+  for (int o = 0; o < 2; o++) {
+    for (int u = 0; u < 2; u++) {
+      for (int i = 0; i < leny; i++) {
+        y[i] = rand_r(&global_seed) % 25;
+        ycblas[i] = y[i];
+      }
+      accl_view.copy(y, devY, leny * sizeof(float));
+      status = hc.hcblas_ssymv(accl_view, orders[o], uplos[u], N, alpha, devA,
+                               aOffset, lda, devX, xOffset, incX, beta, devY,
+                               yOffset, incY);
+      EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+      accl_view.copy(devY, y, leny * sizeof(float));
+      cblas_ssymv(cblasOrders[o], cblasUplos[u], N, alpha, A, lda, x, incX,
+                  beta, ycblas, incY);
+      for (int i = 0; i < leny; i++) EXPECT_EQ(y[i], ycblas[i]);
+    }
+  }
+
+  free(A);
+  free(x);
+  free(y);
+  free(ycblas);
+  hc::am_free(devA);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
@@ -0,0 +1,129 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+
+unsigned int global_seed = 100;
+
+TEST(hcblas_strmv, return_correct_strmv_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 131;
+  int lda = N;
+  int incX = 1;
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  float *devA = hc::am_alloc(sizeof(float) * N * N, acc, 0);
+  float *devX = hc::am_alloc(sizeof(float) * N, acc, 0);
+  float *devA1 = NULL;
+  float *devX1 = NULL;
+
+  /* A, x are not allocated properly */
+  status = hc.hcblas_strmv(accl_view, ColMajor, Lower, NoTrans, NonUnit, N,
+                          devA1, aOffset, lda, devX, xOffset, incX);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  status = hc.hcblas_strmv(accl_view, ColMajor, Lower, NoTrans, NonUnit, N,
+                          devA, aOffset, lda, devX1, xOffset, incX);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* N is 0 */
+  status = hc.hcblas_strmv(accl_view, ColMajor, Lower, NoTrans, NonUnit, 0,
+                          devA, aOffset, lda, devX, xOffset, incX);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* lda is smaller than N */
+  status = hc.hcblas_strmv(accl_view, ColMajor, Lower, NoTrans, NonUnit, N,
+                          devA, aOffset, N - 1, devX, xOffset, incX);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  /* incX is 0 */
+  status = hc.hcblas_strmv(accl_view, ColMajor, Lower, NoTrans, NonUnit, N,
+                          devA, aOffset, lda, devX, xOffset, 0);
+  EXPECT_EQ(status, HCBLAS_INVALID);
+  hc::am_free(devA);
+  hc::am_free(devX);
+}
+
+TEST(hcblas_strmv, func_correct_strmv_Implementation_type_1) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 150;
+  int lda = N + 2;
+  __int64_t aOffset = 0;
+  __int64_t xOffset = 0;
+  hcblasStatus status;
+  hc::accelerator_view accl_view = hc.currentAcclView;
+  hc::accelerator acc = hc.currentAccl;
+  float *A = (float *)calloc(lda * N, sizeof(float));
+  float *x = (float *)calloc(2 * N, sizeof(float));
+  float *xcblas = (float *)calloc(2 * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * lda * N, acc, 0);
+  float *devX = hc::am_alloc(sizeof(float) * 2 * N, acc, 0);
+  for (int i = 0; i < lda * N; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < N; i++) {
+    A[i * lda + i] = 1 + rand_r(&global_seed) % 4;
+  }
+  accl_view.copy(A, devA, lda * N * sizeof(float));
+
+  hcblasOrder orders[2] = {ColMajor, RowMajor};
+  CBLAS_ORDER cblasOrders[2] = {CblasColMajor, CblasRowMajor};
+  hcblasUplo uplos[2] = {Lower, Upper};
+  CBLAS_UPLO cblasUplos[2] = {CblasLower, CblasUpper};
+  hcblasTranspose trans[2] = {NoTrans, Trans};
+  CBLAS_TRANSPOSE cblasTrans[2] = {CblasNoTrans, CblasTrans};
+  hcblasDiag diags[2] = {NonUnit, Unit};
+  CBLAS_DIAG cblasDiags[2] = {CblasNonUnit, CblasUnit};
+  for (int c = 0; c < 32; c++) {
+    int o = c & 1, u = (c >> 1) & 1, t = (c >> 2) & 1, d = (c >> 3) & 1;
+    int incX = 1 + ((c >> 4) & 1);
+    int lenx = 1 + (N - 1) * incX;
+    for (int i = 0; i < lenx; i++) {
+      x[i] = rand_r(&global_seed) % 15;
+      xcblas[i] = x[i];
+    }
+    accl_view.copy(x, devX, lenx * sizeof(float));
+    status = hc.hcblas_strmv(accl_view, orders[o], uplos[u], trans[t], diags[d],
+                            N, devA, aOffset, lda, devX, xOffset, incX);
+    EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+    accl_view.copy(devX, x, lenx * sizeof(float));
+    cblas_strmv(cblasOrders[o], cblasUplos[u], cblasTrans[t], cblasDiags[d], N,
+               A, lda, xcblas, incX);
+    for (int i = 0; i < lenx; i++) EXPECT_EQ(x[i], xcblas[i]);
+  }
+
+  free(A);
+  free(x);
+  free(xcblas);
+  hc::am_free(devA);
+  hc::am_free(devX);
+}
@@ -0,0 +1,95 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblaslib.h"
+#include "include/hcblas_targets.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+TEST(hcblas_targets, return_correct_target_name) {
+  EXPECT_EQ(hcblasTargetName("gfx900"), "gfx900");
+  EXPECT_EQ(hcblasTargetName("gfx906:sramecc+:xnack-"), "gfx906");
+  EXPECT_EQ(hcblasTargetName("amdgcn-amd-amdhsa--gfx90a:xnack+"), "gfx90a");
+  EXPECT_EQ(hcblasTargetName(" GFX1030 "), "gfx1030");
+  EXPECT_EQ(hcblasTargetName("gfx"), "");
+  EXPECT_EQ(hcblasTargetName("cpu"), "");
+  EXPECT_EQ(hcblasTargetName(""), "");
+
+  // Both separators, repeats and stray entries
+  std::vector<std::string> targets =
+      hcblasParseTargets("gfx803;gfx900,,gfx900:xnack-;cpu;gfx906");
+  ASSERT_EQ(targets.size(), 3u);
+  EXPECT_EQ(targets[0], "gfx803");
+  EXPECT_EQ(targets[1], "gfx900");
+  EXPECT_EQ(targets[2], "gfx906");
+  EXPECT_TRUE(hcblasParseTargets("").empty());
+
+  EXPECT_EQ(hcblasTargetModuleFile("/opt/rocm/hcblas/lib/hcblas", "gfx906"),
+            "/opt/rocm/hcblas/lib/hcblas/libhcblas-gfx906.so");
+  EXPECT_EQ(hcblasTargetModuleFile("modules/", "gfx900"),
+            "modules/libhcblas-gfx900.so");
+  EXPECT_EQ(hcblasTargetModuleFile("", "gfx900"), "libhcblas-gfx900.so");
+}
+
+TEST(hcblas_targets, return_correct_target_selection) {
+  // A library carrying gfx803 with modules for gfx900 and gfx906
+  hcblasTargetRegistry registry("gfx803", "gfx900;gfx906");
+  ASSERT_EQ(registry.builtinTargets().size(), 1u);
+  ASSERT_EQ(registry.moduleTargets().size(), 2u);
+
+  hcblasTargetSelection selection = registry.select("gfx803", "/lib/hcblas");
+  EXPECT_EQ(selection.target, "gfx803");
+  EXPECT_EQ(selection.source, hcblasTargetBuiltin);
+  EXPECT_TRUE(selection.module.empty());
+
+  selection = registry.select("gfx906:sramecc-:xnack-", "/lib/hcblas");
+  EXPECT_EQ(selection.target, "gfx906");
+  EXPECT_EQ(selection.source, hcblasTargetModule);
+  EXPECT_EQ(selection.module, "/lib/hcblas/libhcblas-gfx906.so");
+
+  selection = registry.select("gfx1030", "/lib/hcblas");
+  EXPECT_EQ(selection.source, hcblasTargetMissing);
+  EXPECT_TRUE(selection.module.empty());
+  EXPECT_EQ(registry.select("cpu", "/lib/hcblas").source,
+            hcblasTargetMissing);
+
+  // Code objects carried by the library win over a module for the target
+  hcblasTargetRegistry both("gfx803,gfx900", "gfx900");
+  EXPECT_EQ(both.select("gfx900", "/lib/hcblas").source,
+            hcblasTargetBuiltin);
+
+  // A build without modules serves its targets from the library alone
+  hcblasTargetRegistry fat("gfx803;gfx900", "");
+  EXPECT_EQ(fat.select("gfx900", "").source, hcblasTargetBuiltin);
+  EXPECT_EQ(fat.select("gfx906", "").source, hcblasTargetMissing);
+}
+
+// Devices whose target is built in need no module
+TEST(hcblas_targets, return_correct_target_kernels_loaded) {
+  std::vector<hc::accelerator> accs = hc::accelerator::get_all();
+  for (size_t i = 0; i < accs.size(); i++) {
+    EXPECT_TRUE(hcblasLoadTargetKernels(accs[i]));
+  }
+}
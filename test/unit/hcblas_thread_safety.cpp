@@ -0,0 +1,251 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdlib>
+#include <hc_am.hpp>
+#include <thread>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+namespace {
+
+struct Snapshot {
+  Snapshot(int v) : a(v), b(2 * v) {}
+  bool operator==(const Snapshot &o) const { return a == o.a && b == o.b; }
+  int a;
+  int b;
+};
+
+}  // namespace
+
+TEST(hcblas_thread_safety, return_correct_published_snapshot_type_1) {
+  // Readers must only ever see whole snapshots while a writer replaces them
+  hcblasPublished<Snapshot> shared(Snapshot(0));
+  std::atomic<bool> done(false);
+  std::atomic<int> torn(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.push_back(std::thread([&]() {
+      int last = 0;
+      while (!done.load()) {
+        const Snapshot *s = shared.read();
+        if (s->b != 2 * s->a || s->a < last) torn++;
+        last = s->a;
+      }
+    }));
+  }
+  for (int i = 1; i <= 2000; i++) {
+    shared.publish(Snapshot(i));
+  }
+  done = true;
+  for (int t = 0; t < readers.size(); t++) {
+    readers[t].join();
+  }
+  EXPECT_EQ(torn.load(), 0);
+  EXPECT_EQ(shared.read()->a, 2000);
+
+  // Republishing an earlier value reuses its snapshot
+  const Snapshot *before = shared.read();
+  shared.publish(Snapshot(5));
+  const Snapshot *five = shared.read();
+  shared.publish(Snapshot(2000));
+  EXPECT_EQ(shared.read(), before);
+  shared.publish(Snapshot(5));
+  EXPECT_EQ(shared.read(), five);
+}
+
+TEST(hcblas_thread_safety, return_correct_thread_bindings_type_2) {
+  typedef hcblasThreadBindings<int> Bindings;
+  Bindings first;
+  Bindings second;
+  first.bind(1);
+  std::thread other([&]() {
+    // Bindings are private to the thread that made them
+    EXPECT_NE(Bindings::threadId(), 0u);
+    EXPECT_TRUE(first.find() == NULL);
+    first.bind(7);
+    EXPECT_EQ(*first.find(), 7);
+  });
+  other.join();
+  EXPECT_EQ(*first.find(), 1);
+  EXPECT_TRUE(second.find() == NULL);
+  second.bind(2);
+  first.bind(3);
+  EXPECT_EQ(*first.find(), 3);
+  EXPECT_EQ(*second.find(), 2);
+
+  // A binding keeps its address when others come and go or it is rebound
+  const int *mine = first.find();
+  first.unbind();
+  EXPECT_TRUE(first.find() == NULL);
+  EXPECT_EQ(*second.find(), 2);
+  first.bind(4);
+  EXPECT_EQ(first.find(), mine);
+  EXPECT_EQ(*mine, 4);
+}
+
+TEST(hcblas_thread_safety, return_correct_shared_handle_type_3) {
+  // Worker threads share one handle, each on its own bound stream, while
+  // another thread keeps changing the handle default underneath them.
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  EXPECT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  const int numThreads = 8;
+  const int iterations = 50;
+  const int n = 257;
+  std::atomic<bool> done(false);
+  std::atomic<int> failures(0);
+
+  std::thread writer([&]() {
+    long i = 0;
+    while (!done.load()) {
+      hcblasSetAcclView(handle, av, reinterpret_cast<void *>(1000 + i % 4));
+      i++;
+    }
+  });
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < numThreads; t++) {
+    workers.push_back(std::thread([&, t]() {
+      void *mine = reinterpret_cast<void *>(t + 1);
+      hc::accelerator_view view = accl.create_view();
+      if (hcblasSetThreadAcclView(handle, view, mine) !=
+          HCBLAS_STATUS_SUCCESS) {
+        failures++;
+        return;
+      }
+      float *X = (float *)calloc(n, sizeof(float));
+      float *Y = (float *)calloc(n, sizeof(float));
+      float *devX = hc::am_alloc(sizeof(float) * n, accl, 0);
+      float *devY = hc::am_alloc(sizeof(float) * n, accl, 0);
+      float alpha = 1.0f;
+      for (int i = 0; i < n; i++) {
+        X[i] = t + 1;
+      }
+      view.copy(X, devX, n * sizeof(float));
+      view.copy(Y, devY, n * sizeof(float));
+      for (int iter = 0; iter < iterations; iter++) {
+        hc::accelerator_view *bound = NULL;
+        void *stream = NULL;
+        hcblasGetAcclView(handle, bound, &stream);
+        if (stream != mine) failures++;
+        if (hcblasSaxpy(handle, n, &alpha, devX, 1, devY, 1) !=
+            HCBLAS_STATUS_SUCCESS) {
+          failures++;
+        }
+      }
+      view.copy(devY, Y, n * sizeof(float));
+      for (int i = 0; i < n; i++) {
+        if (Y[i] != static_cast<float>((t + 1) * iterations)) {
+          failures++;
+          break;
+        }
+      }
+      // Dropping the binding falls back to the handle default
+      hcblasClearThreadAcclView(handle);
+      hc::accelerator_view *bound = NULL;
+      void *stream = NULL;
+      hcblasGetAcclView(handle, bound, &stream);
+      if (stream == mine) failures++;
+      free(X);
+      free(Y);
+      hc::am_free(devX);
+      hc::am_free(devY);
+    }));
+  }
+  for (int t = 0; t < numThreads; t++) {
+    workers[t].join();
+  }
+  done = true;
+  writer.join();
+  EXPECT_EQ(failures.load(), 0);
+  EXPECT_EQ(hcblasDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+}
+
+TEST(hcblas_thread_safety, return_correct_released_bindings_type_4) {
+  // Destroying the table frees the bindings of every thread, also of
+  // threads that are still running
+  static std::atomic<int> live(0);
+  struct Counted {
+    Counted() { live++; }
+    Counted(const Counted &) { live++; }
+    Counted &operator=(const Counted &) { return *this; }
+    ~Counted() { live--; }
+  };
+  hcblasThreadBindings<Counted> *bindings =
+      new hcblasThreadBindings<Counted>();
+  std::atomic<int> bound(0);
+  std::atomic<bool> destroyed(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.push_back(std::thread([&]() {
+      bindings->bind(Counted());
+      bound++;
+      while (!destroyed.load()) {
+      }
+    }));
+  }
+  while (bound.load() < 4) {
+  }
+  EXPECT_EQ(live.load(), 4);
+  delete bindings;
+  EXPECT_EQ(live.load(), 0);
+  destroyed = true;
+  for (int t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+}
+
+TEST(hcblas_thread_safety, return_correct_stable_accl_view_type_5) {
+  // The view hcblasGetAcclView hands out survives the calling thread
+  // binding and clearing views on this and other handles
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t first = NULL;
+  hcblasHandle_t second = NULL;
+  EXPECT_EQ(hcblasCreate(&first, &av), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasCreate(&second, &av), HCBLAS_STATUS_SUCCESS);
+  void *mine = reinterpret_cast<void *>(1);
+  EXPECT_EQ(hcblasSetThreadAcclView(first, av, mine), HCBLAS_STATUS_SUCCESS);
+  hc::accelerator_view *bound = NULL;
+  void *stream = NULL;
+  EXPECT_EQ(hcblasGetAcclView(first, bound, &stream), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(stream, mine);
+
+  EXPECT_EQ(hcblasSetThreadAcclView(second, av, NULL), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasClearThreadAcclView(first), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSetThreadAcclView(first, av, mine), HCBLAS_STATUS_SUCCESS);
+  hc::accelerator_view *again = NULL;
+  EXPECT_EQ(hcblasGetAcclView(first, again, &stream), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(again, bound);
+  EXPECT_EQ(stream, mine);
+  EXPECT_TRUE(*bound == av);
+
+  EXPECT_EQ(hcblasDestroy(&second), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasDestroy(&first), HCBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,153 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_trace.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <hc_am.hpp>
+#include "gtest/gtest.h"
+
+unsigned int global_seed = 100;
+
+static hcblasTraceRecord sample_record() {
+  hcblasTraceRecord record;
+  snprintf(record.call, HCBLAS_TRACE_NAME, "hcblasSgemm");
+  snprintf(record.kernel, HCBLAS_TRACE_NAME, "gemm_splitK<0,1,0>");
+  snprintf(record.args, HCBLAS_TRACE_ARGS, "order=C,transa=N,m=64,alpha=1+0i");
+  record.thread = 3;
+  record.hostUs = 12.5;
+  record.timed = false;
+  return record;
+}
+
+TEST(hcblas_trace, return_correct_ring) {
+  hcblasTraceRing<int, 4> ring;
+  int value = 0;
+  EXPECT_FALSE(ring.pop(&value));
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(ring.push(i));
+  }
+  // Full: the record is dropped and counted, the caller does not wait
+  EXPECT_FALSE(ring.push(4));
+  EXPECT_EQ(ring.droppedCount(), 1);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(ring.pop(&value));
+    EXPECT_EQ(value, i);
+  }
+  // Indices wrap around the slots
+  EXPECT_TRUE(ring.push(5));
+  EXPECT_TRUE(ring.push(6));
+  EXPECT_TRUE(ring.pop(&value));
+  EXPECT_EQ(value, 3);
+  EXPECT_TRUE(ring.pop(&value));
+  EXPECT_EQ(value, 5);
+  EXPECT_TRUE(ring.pop(&value));
+  EXPECT_EQ(value, 6);
+  EXPECT_FALSE(ring.pop(&value));
+}
+
+TEST(hcblas_trace, return_correct_format) {
+  hcblasTraceRecord record = sample_record();
+  char line[1024];
+  hcblasTraceFormatRecord(record, 85.25, TraceCsv, line, sizeof(line));
+  EXPECT_STREQ(line,
+               "12.5,3,hcblasSgemm,\"gemm_splitK<0,1,0>\",85.2,"
+               "\"order=C,transa=N,m=64,alpha=1+0i\"");
+  hcblasTraceFormatRecord(record, -1, TraceCsv, line, sizeof(line));
+  EXPECT_STREQ(line,
+               "12.5,3,hcblasSgemm,\"gemm_splitK<0,1,0>\",,"
+               "\"order=C,transa=N,m=64,alpha=1+0i\"");
+  hcblasTraceFormatRecord(record, -1, TraceJson, line, sizeof(line));
+  EXPECT_STREQ(line,
+               "{\"time_us\":12.5,\"thread\":3,\"call\":\"hcblasSgemm\","
+               "\"kernel\":\"gemm_splitK<0,1,0>\",\"device_us\":null,"
+               "\"args\":{\"order\":\"C\",\"transa\":\"N\",\"m\":64,"
+               "\"alpha\":\"1+0i\"}}");
+  // Truncation keeps the buffer terminated
+  size_t len = hcblasTraceFormatRecord(record, 1, TraceJson, line, 16);
+  EXPECT_EQ(len, 15);
+  EXPECT_EQ(strlen(line), 15);
+}
+
+TEST(hcblas_trace, return_correct_trace_log) {
+  char path[] = "/tmp/hcblas_traceXXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  hcblasTraceConfigure(2, path, TraceJson);
+
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  hcblasHandle_t handle = NULL;
+  ASSERT_EQ(hcblasCreate(&handle, &av), HCBLAS_STATUS_SUCCESS);
+  const int M = 64, N = 48, K = 32;
+  std::vector<float> hostA(M * K, 1.0f), hostB(K * N, 1.0f), hostC(M * N);
+  float *devA = hc::am_alloc(sizeof(float) * M * K, accl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * K * N, accl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * M * N, accl, 0);
+  av.copy(hostA.data(), devA, sizeof(float) * M * K);
+  av.copy(hostB.data(), devB, sizeof(float) * K * N);
+  float alpha = 1.0f, beta = 0.0f;
+  EXPECT_EQ(hcblasSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &alpha,
+                        devA, M, devB, K, &beta, devC, M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasSaxpy(handle, M, &alpha, devA, 1, devC, 1),
+            HCBLAS_STATUS_SUCCESS);
+  hcblasTraceFlush();
+  hcblasTraceConfigure(0, NULL, TraceCsv);
+
+  std::ifstream log(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(log, line);) {
+    lines.push_back(line);
+  }
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_NE(lines[0].find("\"call\":\"hcblasSgemm\""), std::string::npos);
+  EXPECT_NE(lines[0].find("\"kernel\":\"gemm_NoTransAB_"), std::string::npos);
+  EXPECT_NE(lines[0].find("\"m\":64,\"n\":48,\"k\":32"), std::string::npos);
+  EXPECT_EQ(lines[0].find("\"device_us\":null"), std::string::npos);
+  EXPECT_NE(lines[1].find("\"call\":\"hcblasSaxpy\""), std::string::npos);
+
+  // Tracing off: nothing more is written
+  EXPECT_EQ(hcblasSaxpy(handle, M, &alpha, devA, 1, devC, 1),
+            HCBLAS_STATUS_SUCCESS);
+  hcblasTraceFlush();
+  std::ifstream after(path);
+  int count = 0;
+  for (std::string line; std::getline(after, line);) {
+    count++;
+  }
+  EXPECT_EQ(count, 2);
+
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  hcblasDestroy(&handle);
+  remove(path);
+}
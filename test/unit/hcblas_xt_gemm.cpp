@@ -0,0 +1,348 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "include/hcblas_xt.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+static void fill(std::vector<float> &v) {
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = rand_r(&global_seed) % 10 - 5;
+  }
+}
+
+// Counts how often each element of an M x N matrix is covered by blocks
+template <typename Block>
+static std::vector<int> coverage(const std::vector<Block> &blocks, int M,
+                                 int N) {
+  std::vector<int> seen(M * N, 0);
+  for (size_t b = 0; b < blocks.size(); b++) {
+    for (int j = 0; j < blocks[b].cols; j++) {
+      for (int i = 0; i < blocks[b].rows; i++) {
+        seen[(blocks[b].col0 + j) * M + blocks[b].row0 + i]++;
+      }
+    }
+  }
+  return seen;
+}
+
+/* A device simulated in host memory: load copies the panels of a step into
+ buffers of its own and multiply accumulates them into a private tile of C
+ that goes back to C after the last step, as the accelerator executor
+ does with device memory. Column major, no transposes. */
+class simulated_device : public hcblasOutOfCoreExecutor {
+ public:
+  simulated_device(const hcblasOutOfCoreSchedule &schedule, const float *A,
+                   int lda, const float *B, int ldb, float *C, int ldc)
+      : schedule(schedule), A(A), lda(lda), B(B), ldb(ldb), C(C), ldc(ldc),
+        tile(schedule.tileM() * schedule.tileN()) {
+    for (int s = 0; s < 2; s++) {
+      panelA[s].resize(schedule.tileM() * schedule.tileK());
+      panelB[s].resize(schedule.tileK() * schedule.tileN());
+    }
+  }
+
+  bool load(const hcblasOutOfCoreStep &step) override {
+    const hcblasOutOfCoreTile &t = schedule.tiles()[step.tile];
+    for (int k = 0; k < step.depth; k++) {
+      for (int i = 0; i < t.rows; i++) {
+        panelA[step.slot][k * t.rows + i] = A[(step.k0 + k) * lda + t.row0 + i];
+      }
+    }
+    for (int j = 0; j < t.cols; j++) {
+      for (int k = 0; k < step.depth; k++) {
+        panelB[step.slot][j * step.depth + k] =
+            B[(t.col0 + j) * ldb + step.k0 + k];
+      }
+    }
+    return true;
+  }
+
+  bool multiply(const hcblasOutOfCoreStep &step) override {
+    const hcblasOutOfCoreTile &t = schedule.tiles()[step.tile];
+    if (step.first) {
+      for (int j = 0; j < t.cols; j++) {
+        for (int i = 0; i < t.rows; i++) {
+          tile[j * t.rows + i] = C[(t.col0 + j) * ldc + t.row0 + i];
+        }
+      }
+    }
+    for (int j = 0; j < t.cols; j++) {
+      for (int k = 0; k < step.depth; k++) {
+        float b = panelB[step.slot][j * step.depth + k];
+        for (int i = 0; i < t.rows; i++) {
+          tile[j * t.rows + i] += panelA[step.slot][k * t.rows + i] * b;
+        }
+      }
+    }
+    if (step.last) {
+      for (int j = 0; j < t.cols; j++) {
+        for (int i = 0; i < t.rows; i++) {
+          C[(t.col0 + j) * ldc + t.row0 + i] = tile[j * t.rows + i];
+        }
+      }
+    }
+    return true;
+  }
+
+  bool drain(int) override { return true; }
+
+  bool finish() override { return true; }
+
+ private:
+  const hcblasOutOfCoreSchedule &schedule;
+  const float *A;
+  int lda;
+  const float *B;
+  int ldb;
+  float *C;
+  int ldc;
+  std::vector<float> panelA[2];
+  std::vector<float> panelB[2];
+  std::vector<float> tile;
+};
+
+TEST(hcblas_xt_gemm, return_correct_xt_schedule) {
+  hcblasXtSchedule schedule;
+  const std::vector<double> two(2, 1.0);
+  ASSERT_TRUE(schedule.build(256, 256, 100, 64, two));
+  ASSERT_EQ(schedule.devices(), 2);
+
+  // Every element of C is covered once and equal devices get equal shares
+  const std::vector<hcblasXtBlock> &blocks = schedule.blocks();
+  ASSERT_EQ(blocks.size(), 16u);
+  std::vector<int> seen = coverage(blocks, 256, 256);
+  for (size_t i = 0; i < seen.size(); i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+  EXPECT_EQ(schedule.regions(0).size(), 8u);
+  EXPECT_EQ(schedule.regions(1).size(), 8u);
+  EXPECT_EQ(schedule.finishTime(0), schedule.finishTime(1));
+
+  // Blocks of a block row stay on one device when the balance allows
+  for (size_t b = 0; b < blocks.size(); b++) {
+    EXPECT_EQ(blocks[b].device, blocks[b].row0 / 64 % 2);
+  }
+
+  // Shares follow the weights; ragged edges keep the finish times within
+  // one block of each other
+  std::vector<double> weights;
+  weights.push_back(1);
+  weights.push_back(3);
+  weights.push_back(2);
+  ASSERT_TRUE(schedule.build(1000, 700, 300, 64, weights));
+  seen = coverage(schedule.blocks(), 1000, 700);
+  for (size_t i = 0; i < seen.size(); i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+  double block = 64.0 * 64 * 300;
+  for (int d = 0; d < 3; d++) {
+    for (int e = 0; e < 3; e++) {
+      EXPECT_LE(schedule.finishTime(d),
+                schedule.finishTime(e) + block / weights[e]);
+    }
+  }
+  EXPECT_GT(schedule.regions(1).size(), 2 * schedule.regions(0).size());
+
+  // Regions come back in column order and the schedule is deterministic
+  std::vector<hcblasXtBlock> first = schedule.blocks();
+  ASSERT_TRUE(schedule.build(1000, 700, 300, 64, weights));
+  for (size_t b = 0; b < first.size(); b++) {
+    EXPECT_EQ(schedule.blocks()[b].device, first[b].device);
+  }
+  std::vector<hcblasOutOfCoreTile> regions = schedule.regions(2);
+  for (size_t r = 1; r < regions.size(); r++) {
+    EXPECT_TRUE(regions[r].col0 > regions[r - 1].col0 ||
+                (regions[r].col0 == regions[r - 1].col0 &&
+                 regions[r].row0 > regions[r - 1].row0));
+  }
+
+  // Invalid arguments leave the schedule empty
+  EXPECT_FALSE(schedule.build(256, 256, 100, 0, two));
+  EXPECT_EQ(schedule.blocks().size(), 0u);
+  EXPECT_EQ(schedule.devices(), 0);
+  EXPECT_FALSE(schedule.build(0, 256, 100, 64, two));
+  EXPECT_FALSE(schedule.build(256, 256, 0, 64, two));
+  EXPECT_FALSE(schedule.build(256, 256, 100, 64, std::vector<double>()));
+  EXPECT_FALSE(schedule.build(256, 256, 100, 64, std::vector<double>(2, 0)));
+}
+
+// An out-of-core schedule over regions cuts its tiles within each region
+TEST(hcblas_xt_gemm, return_correct_out_of_core_regions) {
+  std::vector<hcblasOutOfCoreTile> regions(2);
+  regions[0].row0 = 0;
+  regions[0].col0 = 0;
+  regions[0].rows = 100;
+  regions[0].cols = 150;
+  regions[1].row0 = 100;
+  regions[1].col0 = 0;
+  regions[1].rows = 50;
+  regions[1].cols = 150;
+  hcblasOutOfCoreSchedule schedule;
+  ASSERT_TRUE(schedule.build(200, sizeof(float), 5 * 64 * 64 * sizeof(float),
+                             0, regions));
+  EXPECT_EQ(schedule.tileM(), 64);
+  std::vector<int> seen = coverage(schedule.tiles(), 150, 150);
+  for (size_t i = 0; i < seen.size(); i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+  // 2 x 3 tiles in the first region, 1 x 3 in the second
+  ASSERT_EQ(schedule.tiles().size(), 9u);
+  for (size_t t = 6; t < 9; t++) {
+    EXPECT_EQ(schedule.tiles()[t].row0, 100);
+    EXPECT_EQ(schedule.tiles()[t].rows, 50);
+  }
+
+  regions[1].rows = 0;
+  EXPECT_FALSE(schedule.build(200, sizeof(float), 1 << 30, 0, regions));
+  EXPECT_FALSE(schedule.build(200, sizeof(float), 1 << 30, 0,
+                              std::vector<hcblasOutOfCoreTile>()));
+}
+
+// Simulated devices of different speeds run their shares concurrently
+TEST(hcblas_xt_gemm, return_correct_xt_simulated_devices) {
+  const int M = 333, N = 270, K = 150;
+  std::vector<float> A(M * K), B(K * N), C(M * N);
+  fill(A);
+  fill(B);
+  fill(C);
+  std::vector<float> expected = C;
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1,
+              A.data(), M, B.data(), K, 1, expected.data(), M);
+
+  std::vector<double> weights;
+  weights.push_back(4);
+  weights.push_back(1);
+  weights.push_back(2);
+  hcblasXtSchedule schedule;
+  ASSERT_TRUE(schedule.build(M, N, K, 64, weights));
+  std::mutex lock;
+  std::vector<int> calls(3, 0);
+  std::vector<size_t> tiles(3, 0);
+  EXPECT_TRUE(hcblasXtRun(
+      schedule, [&](int d, const std::vector<hcblasOutOfCoreTile> &regions) {
+        hcblasOutOfCoreSchedule plan;
+        if (!plan.build(K, sizeof(float), 5 * 64 * 64 * sizeof(float), 0,
+                        regions)) {
+          return false;
+        }
+        simulated_device device(plan, A.data(), M, B.data(), K, C.data(), M);
+        bool ok = hcblasOutOfCoreRun(plan, &device, NULL);
+        std::lock_guard<std::mutex> guard(lock);
+        calls[d]++;
+        tiles[d] = plan.tiles().size();
+        return ok;
+      }));
+  for (int d = 0; d < 3; d++) {
+    EXPECT_EQ(calls[d], 1);
+    EXPECT_EQ(tiles[d], schedule.regions(d).size());
+  }
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(C[i], expected[i]);
+  }
+
+  // A failing device fails the run; the others still run
+  std::vector<int> ran(3, 0);
+  EXPECT_FALSE(hcblasXtRun(
+      schedule, [&](int d, const std::vector<hcblasOutOfCoreTile> &) {
+        ran[d] = 1;
+        return d != 2;
+      }));
+  EXPECT_EQ(ran, std::vector<int>(3, 1));
+}
+
+// The C API over the devices the runtime reports
+TEST(hcblas_xt_gemm, return_correct_xt_sgemm) {
+  hcblasXtHandle_t handle = NULL;
+  ASSERT_EQ(hcblasXtCreate(&handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasXtSetBlockDim(handle, 64), HCBLAS_STATUS_SUCCESS);
+  int blockDim = 0;
+  EXPECT_EQ(hcblasXtGetBlockDim(handle, &blockDim), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(blockDim, 64);
+
+  const int M = 150, N = 140, K = 70;
+  std::vector<float> A(M * K), B(K * N), C(M * N);
+  fill(A);
+  fill(B);
+  fill(C);
+  float alpha = 2, beta = -1;
+  const hcblasOperation_t ops[2] = {HCBLAS_OP_N, HCBLAS_OP_T};
+  for (int ta = 0; ta < 2; ta++) {
+    for (int tb = 0; tb < 2; tb++) {
+      std::vector<float> result = C, expected = C;
+      int lda = ta ? K : M, ldb = tb ? N : K;
+      EXPECT_EQ(hcblasXtSgemm(handle, ops[ta], ops[tb], M, N, K, &alpha,
+                              A.data(), lda, B.data(), ldb, &beta,
+                              result.data(), M),
+                HCBLAS_STATUS_SUCCESS);
+      cblas_sgemm(CblasColMajor, ta ? CblasTrans : CblasNoTrans,
+                  tb ? CblasTrans : CblasNoTrans, M, N, K, alpha, A.data(),
+                  lda, B.data(), ldb, beta, expected.data(), M);
+      for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(result[i], expected[i]);
+      }
+    }
+  }
+
+  // Double precision on the first device only
+  int first = 0;
+  EXPECT_EQ(hcblasXtDeviceSelect(handle, 1, &first), HCBLAS_STATUS_SUCCESS);
+  std::vector<double> dA(A.begin(), A.end()), dB(B.begin(), B.end());
+  std::vector<double> dC(C.begin(), C.end()), dExpected = dC;
+  double dAlpha = 0.5, dBeta = 2;
+  EXPECT_EQ(hcblasXtDgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, K, &dAlpha,
+                          dA.data(), M, dB.data(), K, &dBeta, dC.data(), M),
+            HCBLAS_STATUS_SUCCESS);
+  cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, dAlpha,
+              dA.data(), M, dB.data(), K, dBeta, dExpected.data(), M);
+  for (size_t i = 0; i < dExpected.size(); i++) {
+    EXPECT_EQ(dC[i], dExpected[i]);
+  }
+
+  int repeated[2] = {0, 0};
+  int outside = 1 << 20;
+  EXPECT_EQ(hcblasXtDeviceSelect(handle, 2, repeated),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasXtDeviceSelect(handle, 1, &outside),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasXtDeviceSelect(handle, 0, &first),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasXtSetBlockDim(handle, 0), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasXtSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, M, N, 0, &alpha,
+                          A.data(), M, B.data(), K, &beta, C.data(), M),
+            HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasXtSgemm(handle, HCBLAS_OP_N, HCBLAS_OP_N, 0, N, K, &alpha,
+                          A.data(), M, B.data(), K, &beta, C.data(), M),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hcblasXtDestroy(&handle), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(handle, (hcblasXtHandle_t)NULL);
+  EXPECT_EQ(hcblasXtSetBlockDim(handle, 64), HCBLAS_STATUS_NOT_INITIALIZED);
+}